@@ -0,0 +1,10 @@
+/* Built without RNGBETTER_INLINE, so xor16_598() here is a call into the library */
+#include <rngBetter.h>
+
+__attribute__((noinline)) uint16_t runOutOfLine(uint16_t n) {
+  uint16_t acc = 0;
+  while (n--) {
+    acc ^= xor16_598();
+  }
+  return acc;
+}
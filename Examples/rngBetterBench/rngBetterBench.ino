@@ -0,0 +1,79 @@
+/* Compares the cost of one xor16_598() call in the normal (out-of-line) build, in the inline
+ * build, and as xor16_598_step() on a local state, plus xor16_598_fill().
+ * This file is built with RNGBETTER_INLINE; OutOfLine.cpp is built without it, so it calls the
+ * functions in the library. Both work on the same generator state. */
+#define RNGBETTER_INLINE
+#include <rngBetter.h>
+#define SERIALPORT Serial
+#define SERIALSWAPLEVEL (0)
+#define RUNS (4096)
+
+uint16_t runOutOfLine(uint16_t n); // in OutOfLine.cpp
+uint16_t buffer[256];
+volatile uint16_t sink;
+
+__attribute__((noinline)) uint16_t runEmpty(uint16_t n) {
+  uint16_t acc = 0;
+  while (n--) {
+    __asm__ __volatile__("" : "+r"(acc)); // the loop with nothing in it, to subtract
+    acc ^= n;
+  }
+  return acc;
+}
+
+__attribute__((noinline)) uint16_t runInline(uint16_t n) {
+  uint16_t acc = 0;
+  while (n--) {
+    acc ^= xor16_598();
+  }
+  return acc;
+}
+
+__attribute__((noinline)) uint16_t runStep(uint16_t n) {
+  uint16_t acc = 0;
+  uint16_t s = xor16_598();
+  while (n--) {
+    s = xor16_598_step(s);
+    acc ^= s;
+  }
+  seed_xor16_598(s);
+  return acc;
+}
+
+__attribute__((noinline)) uint16_t runFill(uint16_t n) {
+  while (n) {
+    uint16_t count = n < 256 ? n : 256;
+    xor16_598_fill(buffer, count);
+    n -= count;
+  }
+  return buffer[0];
+}
+
+uint32_t clocks(uint16_t (*fn)(uint16_t)) {
+  uint32_t start = micros();
+  sink = fn(RUNS);
+  return (micros() - start) * (F_CPU / 1000000UL);
+}
+
+void report(const char *name, uint16_t (*fn)(uint16_t), uint32_t empty) {
+  uint32_t total = clocks(fn);
+  SERIALPORT.print(name);
+  SERIALPORT.print(((float)total - (fn == runFill ? 0 : empty)) / RUNS, 1);
+  SERIALPORT.println(" clocks per value");
+}
+
+void setup() {
+  SERIALPORT.swap(SERIALSWAPLEVEL);
+  SERIALPORT.begin(115200);
+  delay(1000);
+  seed_xor16_598(1234);
+  uint32_t empty = clocks(runEmpty);
+  report("xor16_598(), out of line: ", runOutOfLine, empty);
+  report("xor16_598(), inline:      ", runInline, empty);
+  report("xor16_598_step():         ", runStep, empty);
+  report("xor16_598_fill():         ", runFill, empty);
+  SERIALPORT.println("Done");
+}
+
+void loop() {
+}
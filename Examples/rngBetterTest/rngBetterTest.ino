@@ -25,6 +25,8 @@ void setup() {
       while (1);
     }
     uint16_t seed = rng16::ADCtoSeed((uint16_t) adcread, 16);
+    SERIALPORT.print("Seed: ");       // extras/host/xor16sim chain <seed> prints the same thing
+    SERIALPORT.println(seed);
     seed_xor16_11e(seed);
     seed = xor16_11e();
     SERIALPORT.print("11e: ");
@@ -0,0 +1,261 @@
+"""Runs the inline asm bodies in src/ on a small model of the AVR core, for checking them on a PC.
+
+Only what the generators use is modelled: the registers, SREG, data memory as a dict and the
+instructions below, with AVRxt (tinyAVR 0/1/2, Dx) timings. There are no I/O registers, no calls
+and no interrupts.
+
+  cpu = CPU()
+  cpu.setw(24, 0xACE1)
+  clocks = run(extract_asm(source, 'uint16_t xor16_3d9()'), {'A0': 24, 'B0': 25}, cpu)
+
+The operand map gives the register each %A0, %B0, %1 ... operand was allocated, the way
+avr-gcc would have for the constraints of that asm statement.
+"""
+import re
+
+
+class CPU:
+    def __init__(self):
+        self.r = [0] * 32
+        self.C = self.Z = self.N = self.V = self.S = self.T = 0
+        self.mem = {}
+
+    def w(self, n):
+        return self.r[n] | self.r[n + 1] << 8
+
+    def setw(self, n, v):
+        self.r[n] = v & 0xFF
+        self.r[n + 1] = v >> 8 & 0xFF
+
+    def load(self, addr, data):
+        for i, b in enumerate(data):
+            self.mem[addr + i] = b
+
+    def dump(self, addr, n):
+        return [self.mem.get(addr + i, 0) for i in range(n)]
+
+    def zn(self, v):
+        self.Z = int(v == 0)
+        self.N = v >> 7 & 1
+
+
+def extract_asm(text, func):
+    """The instructions of the first asm statement after func, one per list entry"""
+    seg = text[text.index('__asm__', text.index(func)):]
+    lit = re.compile(r'(?:\s|//[^\n]*\n)*"((?:[^"\\]|\\.)*)"')
+    out = []
+    pos = seg.index('(') + 1
+    while True:
+        m = lit.match(seg, pos)
+        if not m:
+            break
+        out.append(m.group(1))
+        pos = m.end()
+    return ''.join(out).replace('\\n', '\n').replace('\\t', ' ').split('\n')
+
+
+def parse(lines, opmap):
+    prog = []
+    labels = {}
+    for line in lines:
+        line = line.split(';')[0].strip()
+        line = re.sub(r'%([A-D]\d+)', lambda m: 'r%d' % opmap[m.group(1)], line)
+        line = re.sub(r'%(\d+)', lambda m: 'r%d' % opmap[m.group(1)], line)
+        line = line.replace('__zero_reg__', 'r1').replace('__tmp_reg__', 'r0')
+        m = re.match(r'^(\w+):\s*(.*)$', line)
+        if m:
+            labels.setdefault(m.group(1), []).append(len(prog))
+            line = m.group(2)
+        if not line:
+            continue
+        op, _, args = line.partition(' ')
+        prog.append((op.lower(), [a.strip() for a in args.split(',')] if args.strip() else []))
+    return prog, labels
+
+
+def reg(a):
+    assert a[0] == 'r', a
+    return int(a[1:])
+
+
+def imm(a):
+    return int(a, 0) & 0xFFFF
+
+
+def pointer(cpu, arg):
+    """Address for an X/Y/Z operand, applying any pre-decrement or post-increment"""
+    m = re.match(r'^(-?)([XYZ])(\+?)(?:\+(\d+))?$', arg.replace(' ', ''))
+    pre, p, post, off = m.groups()
+    n = {'X': 26, 'Y': 28, 'Z': 30}[p]
+    addr = cpu.w(n)
+    if pre:
+        addr = (addr - 1) & 0xFFFF
+        cpu.setw(n, addr)
+    if post:
+        cpu.setw(n, addr + 1)
+    return (addr + int(off or 0)) & 0xFFFF
+
+
+BRANCHES = {
+    'brne': lambda c: not c.Z, 'breq': lambda c: c.Z,
+    'brcc': lambda c: not c.C, 'brsh': lambda c: not c.C,
+    'brcs': lambda c: c.C, 'brlo': lambda c: c.C,
+    'brpl': lambda c: not c.N, 'brmi': lambda c: c.N,
+    'brtc': lambda c: not c.T, 'brts': lambda c: c.T,
+    'brge': lambda c: not c.S, 'brlt': lambda c: c.S,
+}
+
+
+def run(lines, opmap, cpu, maxsteps=10 ** 7):
+    """Runs to the end of the asm, returning the clocks it took"""
+    prog, labels = parse(lines, opmap)
+    r = cpu.r
+    pc = clk = steps = 0
+
+    def target(a, at):
+        m = re.match(r'^(\d+)([bf])$', a)
+        if not m:
+            return labels[a][0]
+        if m.group(2) == 'b':
+            return max(x for x in labels[m.group(1)] if x <= at)
+        return min(x for x in labels[m.group(1)] if x > at)
+    while pc < len(prog):
+        steps += 1
+        assert steps < maxsteps, 'runaway loop'
+        op, a = prog[pc]
+        pc += 1
+        c = 1
+        if op == 'mov':
+            r[reg(a[0])] = r[reg(a[1])]
+        elif op == 'movw':
+            d, s = reg(a[0]), reg(a[1])
+            assert d % 2 == 0 and s % 2 == 0
+            r[d], r[d + 1] = r[s], r[s + 1]
+        elif op in ('add', 'adc'):
+            d = reg(a[0])
+            x, y = r[d], r[reg(a[1])]
+            res = x + y + (cpu.C if op == 'adc' else 0)
+            cpu.C = res >> 8
+            res &= 0xFF
+            cpu.V = int(((x ^ res) & (y ^ res) & 0x80) != 0)
+            r[d] = res
+            cpu.zn(res)
+            cpu.S = cpu.N ^ cpu.V
+        elif op in ('lsl', 'rol'):
+            d = reg(a[0])
+            res = r[d] << 1 | (cpu.C if op == 'rol' else 0)
+            cpu.C = res >> 8
+            r[d] = res & 0xFF
+            cpu.zn(r[d])
+            cpu.V = cpu.N ^ cpu.C
+            cpu.S = cpu.N ^ cpu.V
+        elif op in ('lsr', 'ror', 'asr'):
+            d = reg(a[0])
+            x = r[d]
+            top = {'lsr': 0, 'ror': cpu.C << 7, 'asr': x & 0x80}[op]
+            cpu.C = x & 1
+            r[d] = x >> 1 | top
+            cpu.zn(r[d])
+            cpu.V = cpu.N ^ cpu.C
+            cpu.S = cpu.N ^ cpu.V
+        elif op in ('sub', 'sbc', 'subi', 'sbci', 'cp', 'cpc', 'cpi'):
+            d = reg(a[0])
+            if op in ('subi', 'sbci', 'cpi'):
+                assert d >= 16, 'immediate needs r16-r31: %s %s' % (op, a)
+                y = imm(a[1]) & 0xFF
+            else:
+                y = r[reg(a[1])]
+            x = r[d]
+            cin = cpu.C if op in ('sbc', 'sbci', 'cpc') else 0
+            res = (x - y - cin) & 0xFF
+            cpu.C = int(x < y + cin)
+            cpu.Z = int(res == 0 and (cpu.Z or op not in ('sbc', 'sbci', 'cpc')))
+            cpu.N = res >> 7
+            cpu.V = int(((x ^ y) & (x ^ res) & 0x80) != 0)
+            cpu.S = cpu.N ^ cpu.V
+            if not op.startswith('cp'):
+                r[d] = res
+        elif op in ('and', 'andi', 'or', 'ori', 'eor'):
+            d = reg(a[0])
+            if op in ('andi', 'ori'):
+                assert d >= 16, 'immediate needs r16-r31: %s %s' % (op, a)
+                y = imm(a[1]) & 0xFF
+            else:
+                y = r[reg(a[1])]
+            r[d] = {'an': r[d] & y, 'or': r[d] | y, 'eo': r[d] ^ y}[op[:2]]
+            cpu.zn(r[d])
+            cpu.V = 0
+            cpu.S = cpu.N
+        elif op == 'clr':
+            r[reg(a[0])] = 0
+            cpu.Z, cpu.N, cpu.V, cpu.S = 1, 0, 0, 0
+        elif op in ('com', 'neg', 'inc', 'dec', 'tst'):
+            d = reg(a[0])
+            x = r[d]
+            res = {'com': ~x, 'neg': -x, 'inc': x + 1, 'dec': x - 1, 'tst': x}[op] & 0xFF
+            r[d] = res
+            cpu.zn(res)
+            cpu.V = {'com': 0, 'neg': int(res == 0x80), 'inc': int(res == 0x80), 'dec': int(res == 0x7F), 'tst': 0}[op]
+            cpu.S = cpu.N ^ cpu.V
+            if op in ('com', 'neg'):
+                cpu.C = 1 if op == 'com' else int(res != 0)
+        elif op == 'ser':
+            d = reg(a[0])
+            assert d >= 16, 'ser needs r16-r31'
+            r[d] = 0xFF
+        elif op in ('sec', 'clc', 'set', 'clt'):
+            setattr(cpu, op[2].upper(), int(op[0] == 's'))
+        elif op == 'ldi':
+            d = reg(a[0])
+            assert d >= 16, 'ldi needs r16-r31'
+            r[d] = imm(a[1]) & 0xFF
+        elif op == 'swap':
+            d = reg(a[0])
+            r[d] = (r[d] << 4 | r[d] >> 4) & 0xFF
+        elif op == 'bst':
+            cpu.T = r[reg(a[0])] >> int(a[1]) & 1
+        elif op == 'bld':
+            d, b = reg(a[0]), int(a[1])
+            r[d] = r[d] & ~(1 << b) & 0xFF | cpu.T << b
+        elif op == 'mul':
+            p = r[reg(a[0])] * r[reg(a[1])]
+            r[0], r[1] = p & 0xFF, p >> 8
+            cpu.C = p >> 15 & 1
+            cpu.Z = int(p == 0)
+            c = 2
+        elif op in ('adiw', 'sbiw'):
+            d = reg(a[0])
+            assert d in (24, 26, 28, 30)
+            res = cpu.w(d) + (imm(a[1]) if op == 'adiw' else -imm(a[1]))
+            cpu.C = int(res < 0 or res > 0xFFFF)
+            res &= 0xFFFF
+            cpu.setw(d, res)
+            cpu.Z = int(res == 0)
+            cpu.N = res >> 15
+            c = 2
+        elif op in ('st', 'std'):
+            cpu.mem[pointer(cpu, a[0])] = r[reg(a[1])]
+        elif op in ('ld', 'ldd'):
+            r[reg(a[0])] = cpu.mem.get(pointer(cpu, a[1]), 0)
+            c = 2
+        elif op in BRANCHES:
+            if BRANCHES[op](cpu):
+                pc = target(a[0], pc - 1)
+                c = 2
+        elif op == 'rjmp':
+            pc = target(a[0], pc - 1)
+            c = 2
+        elif op in ('sbrc', 'sbrs', 'cpse'):
+            if op == 'cpse':
+                skip = r[reg(a[0])] == r[reg(a[1])]
+            else:
+                skip = (r[reg(a[0])] >> int(a[1]) & 1) == (op == 'sbrs')
+            if skip:
+                pc += 1
+                c = 2
+        elif op == 'nop':
+            pass
+        else:
+            raise ValueError('avrsim does not know ' + op)
+        clk += c
+    return clk
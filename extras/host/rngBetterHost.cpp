@@ -0,0 +1,454 @@
+/* rngBetter host build - see rngBetterHost.h */
+#include "rngBetterHost.h"
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+  #include <immintrin.h>
+  #define XOR16HOST_X86 1
+#endif
+
+#define XOR16_DEFINE(name, a, b, c) \
+  static uint16_t __xor16_##name##_state; \
+  static uint8_t __xor16_##name##_spare_full; /* for the _byte() versions */ \
+  bool seed_xor16_##name(uint16_t seed) { \
+    if (seed) { \
+      __xor16_##name##_state = seed; \
+      __xor16_##name##_spare_full = 0; \
+      return 1; \
+    } \
+    return 0; \
+  } \
+  uint16_t xor16_##name() { \
+    return __xor16_##name##_state = xor16host::step(__xor16_##name##_state, a, b, c); \
+  } \
+  void xor16_##name##_fill(uint16_t *dst, uint16_t n) { \
+    while (n--) { \
+      *dst++ = xor16_##name(); \
+    } \
+  }
+XOR16_GENERATORS(XOR16_DEFINE)
+#undef XOR16_DEFINE
+
+#define XOR16_SWAP_DEFINE(name, which) \
+  static uint16_t __xor16_##name##_state; \
+  bool seed_xor16_##name(uint16_t seed) { \
+    if (seed) { \
+      __xor16_##name##_state = seed; \
+      return 1; \
+    } \
+    return 0; \
+  } \
+  uint16_t xor16_##name() { \
+    return __xor16_##name##_state = xor16host::stepSwap(__xor16_##name##_state, which); \
+  } \
+  void xor16_##name##_fill(uint16_t *dst, uint16_t n) { \
+    while (n--) { \
+      *dst++ = xor16_##name(); \
+    } \
+  }
+XOR16_SWAP_GENERATORS(XOR16_SWAP_DEFINE)
+#undef XOR16_SWAP_DEFINE
+
+#define XOR16_STAR_DEFINE(name) \
+  uint16_t xor16_##name##_star() { \
+    return xor16host::star(xor16_##name()); \
+  }
+XOR16_STAR_GENERATORS(XOR16_STAR_DEFINE)
+#undef XOR16_STAR_DEFINE
+
+#define XOR16_WEYL_DEFINE(name) \
+  static uint16_t __xor16_##name##_weyl_count; \
+  void seed_xor16_##name##_weyl(uint16_t seed) { \
+    seed_xor16_##name(seed ? seed : 1); \
+    __xor16_##name##_weyl_count = seed; \
+  } \
+  uint16_t xor16_##name##_weyl() { \
+    uint16_t s = xor16_##name(); \
+    return s + (__xor16_##name##_weyl_count += xor16host::weylIncrement); \
+  }
+XOR16_STAR_GENERATORS(XOR16_WEYL_DEFINE)
+#undef XOR16_WEYL_DEFINE
+
+#define XOR16_BYTE_DEFINE(name) \
+  static uint8_t __xor16_##name##_spare; \
+  uint8_t xor16_##name##_byte() { \
+    if (__xor16_##name##_spare_full) { \
+      __xor16_##name##_spare_full = 0; \
+      return __xor16_##name##_spare; \
+    } \
+    uint16_t s = xor16_##name(); \
+    __xor16_##name##_spare = s >> 8; \
+    __xor16_##name##_spare_full = 1; \
+    return (uint8_t) s; \
+  } \
+  void xor16_##name##_fill_bytes(uint8_t *dst, uint16_t n) { \
+    while (n--) { \
+      *dst++ = xor16_##name##_byte(); \
+    } \
+  }
+XOR16_STAR_GENERATORS(XOR16_BYTE_DEFINE)
+#undef XOR16_BYTE_DEFINE
+
+void xor16_sliced_load(uint8_t *planes, const uint16_t *states) {
+  for (int i = 0; i < 16; i++) {
+    uint8_t p = 0;
+    for (int j = 0; j < 8; j++) {
+      p |= ((states[j] >> i) & 1) << j;
+    }
+    planes[i] = p;
+  }
+}
+void xor16_sliced_store(const uint8_t *planes, uint16_t *states) {
+  for (int j = 0; j < 8; j++) {
+    uint16_t s = 0;
+    for (int i = 0; i < 16; i++) {
+      s |= (uint16_t)((planes[i] >> j) & 1) << i;
+    }
+    states[j] = s;
+  }
+}
+/* The same plane-index xors as the AVR kernels */
+static void slicedSteps(const char *name, uint8_t *planes, uint8_t *dst, uint16_t n) {
+  const xor16host::Generator *g = xor16host::find(name);
+  while (n--) {
+    for (int i = 15; i >= g->a; i--) {
+      planes[i] ^= planes[i - g->a];
+    }
+    for (int i = 0; i + g->b < 16; i++) {
+      planes[i] ^= planes[i + g->b];
+    }
+    for (int i = 15; i >= g->c; i--) {
+      planes[i] ^= planes[i - g->c];
+    }
+    memcpy(dst, planes, 16);
+    dst += 16;
+  }
+}
+#define XOR16_SLICED_DEFINE(name) \
+  void xor16_##name##_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) { \
+    slicedSteps(#name, planes, dst, n); \
+  }
+XOR16_STAR_GENERATORS(XOR16_SLICED_DEFINE)
+#undef XOR16_SLICED_DEFINE
+
+#define XOR16_PAIR_DEFINE(x, y) \
+  static uint16_t __xor16_##x##_##y##_a, __xor16_##x##_##y##_b; \
+  bool seed_xor16_##x##_##y(uint32_t seed) { \
+    if ((uint16_t)seed && (uint16_t)(seed >> 16)) { \
+      __xor16_##x##_##y##_a = seed; \
+      __xor16_##x##_##y##_b = seed >> 16; \
+      return 1; \
+    } \
+    return 0; \
+  } \
+  uint16_t xor16_##x##_##y() { \
+    static const xor16host::Generator *ga = xor16host::find(#x), *gb = xor16host::find(#y); \
+    uint16_t &sa = __xor16_##x##_##y##_a, &sb = __xor16_##x##_##y##_b; \
+    sa = xor16host::step(sa, ga->a, ga->b, ga->c); \
+    if (sa & 0x8000) { \
+      sb = xor16host::step(sb, gb->a, gb->b, gb->c); \
+    } \
+    return sa ^ sb; \
+  }
+XOR16_PAIR_GENERATORS(XOR16_PAIR_DEFINE)
+#undef XOR16_PAIR_DEFINE
+
+uint16_t __state = 0;
+static uint8_t __spare, __spare_full;
+bool seed_xor16(uint16_t seed) {
+  if (seed) {
+    __state = seed;
+    __spare_full = 0;
+    return 1;
+  }
+  return 0;
+}
+uint16_t xor16() {
+  return __state = xor16host::step(__state, 3, 13, 9);
+}
+uint16_t xor16_star() {
+  return xor16host::star(xor16());
+}
+static uint16_t __weyl_count;
+void seed_xor16_weyl(uint16_t seed) {
+  seed_xor16(seed ? seed : 1);
+  __weyl_count = seed;
+}
+uint16_t xor16_weyl() {
+  uint16_t s = xor16();
+  return s + (__weyl_count += xor16host::weylIncrement);
+}
+uint16_t xor16(uint16_t seed) {
+  if (!seed_xor16(seed)) {
+    return 0;
+  }
+  return xor16();
+}
+void xor16_fill(uint16_t *dst, uint16_t n) {
+  while (n--) {
+    *dst++ = xor16();
+  }
+}
+uint8_t xor16_byte() {
+  if (__spare_full) {
+    __spare_full = 0;
+    return __spare;
+  }
+  uint16_t s = xor16();
+  __spare = s >> 8;
+  __spare_full = 1;
+  return (uint8_t) s;
+}
+void xor16_fill_bytes(uint8_t *dst, uint16_t n) {
+  while (n--) {
+    *dst++ = xor16_byte();
+  }
+}
+
+#define XOR32_DEFINE(name, a, b, c) \
+  static uint32_t __xor32_##name##_state; \
+  bool seed_xor32_##name(uint32_t seed) { \
+    if (seed) { \
+      __xor32_##name##_state = seed; \
+      return 1; \
+    } \
+    return 0; \
+  } \
+  uint32_t xor32_##name() { \
+    return __xor32_##name##_state = xor16host::step32(__xor32_##name##_state, a, b, c); \
+  } \
+  void xor32_##name##_fill(uint32_t *dst, uint16_t n) { \
+    while (n--) { \
+      *dst++ = xor32_##name(); \
+    } \
+  }
+XOR32_GENERATORS(XOR32_DEFINE)
+#undef XOR32_DEFINE
+
+uint32_t __state32 = 0;
+bool seed_xor32(uint32_t seed) {
+  if (seed) {
+    __state32 = seed;
+    return 1;
+  }
+  return 0;
+}
+uint32_t xor32() {
+  return __state32 = xor16host::step32(__state32, 8, 9, 23);
+}
+uint32_t xor32(uint32_t seed) {
+  if (!seed_xor32(seed)) {
+    return 0;
+  }
+  return xor32();
+}
+void xor32_fill(uint32_t *dst, uint16_t n) {
+  while (n--) {
+    *dst++ = xor32();
+  }
+}
+
+#define MWC8_DEFINE(name, mult) \
+  static uint16_t __mwc8_##name##_state; \
+  bool seed_mwc8_##name(uint16_t seed) { \
+    uint8_t c = seed >> 8; \
+    if (c >= mult) { \
+      c -= mult; \
+    } \
+    seed = (uint16_t)((uint8_t) seed | c << 8); \
+    if (seed && seed != (uint16_t)(mult * 256 - 1)) { \
+      __mwc8_##name##_state = seed; \
+      return 1; \
+    } \
+    return 0; \
+  } \
+  uint8_t mwc8_##name() { \
+    return (uint8_t)(__mwc8_##name##_state = xor16host::stepMwc8(__mwc8_##name##_state, mult)); \
+  } \
+  void mwc8_##name##_fill(uint8_t *dst, uint16_t n) { \
+    while (n--) { \
+      *dst++ = mwc8_##name(); \
+    } \
+  }
+MWC8_GENERATORS(MWC8_DEFINE)
+#undef MWC8_DEFINE
+bool seed_mwc8(uint16_t seed) {
+  return seed_mwc8_f9(seed);
+}
+uint8_t mwc8() {
+  return mwc8_f9();
+}
+void mwc8_fill(uint8_t *dst, uint16_t n) {
+  mwc8_f9_fill(dst, n);
+}
+
+static uint16_t __xoroshiro32pp_s0, __xoroshiro32pp_s1;
+bool seed_xoroshiro32pp(uint32_t seed) {
+  if (seed) {
+    __xoroshiro32pp_s0 = (uint16_t) seed;
+    __xoroshiro32pp_s1 = (uint16_t)(seed >> 16);
+    return 1;
+  }
+  return 0;
+}
+uint16_t xoroshiro32pp() {
+  return xor16host::stepXoroshiro(__xoroshiro32pp_s0, __xoroshiro32pp_s1);
+}
+void xoroshiro32pp_fill(uint16_t *dst, uint16_t n) {
+  while (n--) {
+    *dst++ = xoroshiro32pp();
+  }
+}
+void xoroshiro32pp_jump(uint16_t n) {
+  // rngTables.py xoroshiro, the same table as src/xoroshiro32pp.cpp
+  static const uint32_t table[16] = {
+    0x700FDAE3, 0x5FC6F895, 0x96A80433, 0x99F9D658,
+    0xC8BD0E1B, 0xBBEB5E4C, 0x609CB5C9, 0xF0C3164E,
+    0xB30C47BB, 0x93F9441E, 0x8341CFD7, 0x0CF4F0AE,
+    0xF77A58FC, 0x1FED63DD, 0x39B094FF, 0xAACCEBF9
+  };
+  for (int k = 0; n; k++, n >>= 1) {
+    if (n & 1) {
+      uint16_t s0 = 0, s1 = 0;
+      for (int i = 0; i < 32; i++) {
+        if (table[k] >> i & 1) {
+          s0 ^= __xoroshiro32pp_s0;
+          s1 ^= __xoroshiro32pp_s1;
+        }
+        xoroshiro32pp();
+      }
+      __xoroshiro32pp_s0 = s0;
+      __xoroshiro32pp_s1 = s1;
+    }
+  }
+}
+
+namespace xor16host {
+  #define XOR16_ENTRY(name, a, b, c) {#name, a, b, c},
+  const Generator generators[60] = {
+    XOR16_GENERATORS(XOR16_ENTRY)
+  };
+  #undef XOR16_ENTRY
+
+  const Generator *find(const char *name) {
+    if (!strncmp(name, "xor16_", 6)) {
+      name += 6;
+    }
+    if (!strcmp(name, "xor16") || !strcmp(name, "default")) {
+      name = "3d9";
+    }
+    for (int i = 0; i < 60; i++) {
+      if (!strcmp(generators[i].name, name)) {
+        return &generators[i];
+      }
+    }
+    return NULL;
+  }
+
+  static void stepLanesScalar(uint16_t *states, size_t n, uint8_t a, uint8_t b, uint8_t c, uint32_t steps) {
+    for (size_t i = 0; i < n; i++) {
+      uint16_t s = states[i];
+      for (uint32_t k = 0; k < steps; k++) {
+        s = step(s, a, b, c);
+      }
+      states[i] = s;
+    }
+  }
+
+  #if defined(XOR16HOST_X86)
+  /* 2 registers per pass so the two dependency chains overlap */
+  __attribute__((target("avx2")))
+  static size_t stepLanesAVX2(uint16_t *states, size_t n, uint8_t a, uint8_t b, uint8_t c, uint32_t steps) {
+    const __m128i sa = _mm_cvtsi32_si128(a), sb = _mm_cvtsi32_si128(b), sc = _mm_cvtsi32_si128(c);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+      __m256i x = _mm256_loadu_si256((const __m256i *)(states + i));
+      __m256i y = _mm256_loadu_si256((const __m256i *)(states + i + 16));
+      for (uint32_t k = 0; k < steps; k++) {
+        x = _mm256_xor_si256(x, _mm256_sll_epi16(x, sa));
+        y = _mm256_xor_si256(y, _mm256_sll_epi16(y, sa));
+        x = _mm256_xor_si256(x, _mm256_srl_epi16(x, sb));
+        y = _mm256_xor_si256(y, _mm256_srl_epi16(y, sb));
+        x = _mm256_xor_si256(x, _mm256_sll_epi16(x, sc));
+        y = _mm256_xor_si256(y, _mm256_sll_epi16(y, sc));
+      }
+      _mm256_storeu_si256((__m256i *)(states + i), x);
+      _mm256_storeu_si256((__m256i *)(states + i + 16), y);
+    }
+    for (; i + 16 <= n; i += 16) {
+      __m256i x = _mm256_loadu_si256((const __m256i *)(states + i));
+      for (uint32_t k = 0; k < steps; k++) {
+        x = _mm256_xor_si256(x, _mm256_sll_epi16(x, sa));
+        x = _mm256_xor_si256(x, _mm256_srl_epi16(x, sb));
+        x = _mm256_xor_si256(x, _mm256_sll_epi16(x, sc));
+      }
+      _mm256_storeu_si256((__m256i *)(states + i), x);
+    }
+    return i;
+  }
+
+  __attribute__((target("sse2")))
+  static size_t stepLanesSSE2(uint16_t *states, size_t n, uint8_t a, uint8_t b, uint8_t c, uint32_t steps) {
+    const __m128i sa = _mm_cvtsi32_si128(a), sb = _mm_cvtsi32_si128(b), sc = _mm_cvtsi32_si128(c);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      __m128i x = _mm_loadu_si128((const __m128i *)(states + i));
+      __m128i y = _mm_loadu_si128((const __m128i *)(states + i + 8));
+      for (uint32_t k = 0; k < steps; k++) {
+        x = _mm_xor_si128(x, _mm_sll_epi16(x, sa));
+        y = _mm_xor_si128(y, _mm_sll_epi16(y, sa));
+        x = _mm_xor_si128(x, _mm_srl_epi16(x, sb));
+        y = _mm_xor_si128(y, _mm_srl_epi16(y, sb));
+        x = _mm_xor_si128(x, _mm_sll_epi16(x, sc));
+        y = _mm_xor_si128(y, _mm_sll_epi16(y, sc));
+      }
+      _mm_storeu_si128((__m128i *)(states + i), x);
+      _mm_storeu_si128((__m128i *)(states + i + 8), y);
+    }
+    return i;
+  }
+
+  static bool haveAVX2() {
+    static int have = -1;
+    if (have < 0) {
+      __builtin_cpu_init();
+      have = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return have;
+  }
+  #endif
+
+  const char *laneKernel() {
+    #if defined(XOR16HOST_X86)
+      return haveAVX2() ? "avx2" : "sse2";
+    #else
+      return "scalar";
+    #endif
+  }
+
+  void stepLanes(uint16_t *states, size_t n, uint8_t a, uint8_t b, uint8_t c, uint32_t steps) {
+    size_t done = 0;
+    #if defined(XOR16HOST_X86)
+      done = haveAVX2() ? stepLanesAVX2(states, n, a, b, c, steps) : stepLanesSSE2(states, n, a, b, c, steps);
+    #endif
+    stepLanesScalar(states + done, n - done, a, b, c, steps);
+  }
+
+  void Bitsliced64::load(const uint16_t *states) {
+    for (int i = 0; i < 16; i++) {
+      uint64_t p = 0;
+      for (int j = 0; j < 64; j++) {
+        p |= (uint64_t)((states[j] >> i) & 1) << j;
+      }
+      plane[i] = p;
+    }
+  }
+  void Bitsliced64::store(uint16_t *states) const {
+    for (int j = 0; j < 64; j++) {
+      uint16_t s = 0;
+      for (int i = 0; i < 16; i++) {
+        s |= (uint16_t)((plane[i] >> j) & 1) << i;
+      }
+      states[j] = s;
+    }
+  }
+}
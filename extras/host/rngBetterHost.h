@@ -0,0 +1,245 @@
+/* rngBetter host build - bit-exact C++ copies of every generator in src/, for simulating on a PC.
+ *
+ * The API matches rngBetter.h: seed_xor16_xxx(), xor16_xxx(), xor16_xxx_fill(), seed_xor16(),
+ * xor16() and xor16_fill(), and the same for xor32 and xoroshiro32pp, so animation code can be compiled for the PC unchanged. On top of
+ * that there are multi-lane engines that step many independent states at once:
+ *
+ *   xor16host::stepLanes(states, n, a, b, c)  - AVX2 (16 lanes per register, 2 registers per
+ *                                               pass, so 32 at a time) or SSE2 (8 per register,
+ *                                               16 at a time), chosen at runtime, scalar elsewhere
+ *   xor16host::Bitsliced64                    - 64 states in bitsliced form, where shifts are just
+ *                                               plane indices and a step is 64-bit xors
+ *
+ * No Arduino headers needed. Build with e.g.  g++ -O2 -std=c++11 -o xor16sim xor16sim.cpp
+ */
+#ifndef rngBetterHost_h
+#define rngBetterHost_h
+#include <stdint.h>
+#include <stddef.h>
+
+/* name, a, b, c for all 60 full period generators, in the same order as rngBetter.h and the
+ * rngBetterTest example. xor16() is 3d9. */
+#define XOR16_GENERATORS(X) \
+  X(11e,  1,  1, 14) X(11f,  1,  1, 15) X(152,  1,  5,  2) X(174,  1,  7,  4) \
+  X(17b,  1,  7, 11) X(1b3,  1, 11,  3) X(1f6,  1, 15,  6) X(1f7,  1, 15,  7) \
+  X(251,  2,  5,  1) X(25d,  2,  5, 13) X(25f,  2,  5, 15) X(27d,  2,  7, 13) \
+  X(27f,  2,  7, 15) X(31c,  3,  1, 12) X(31f,  3,  1, 15) X(35b,  3,  5, 11) \
+  X(3b1,  3, 11,  1) X(3bb,  3, 11, 11) X(3d9,  3, 13,  9) X(437,  4,  3,  7) \
+  X(471,  4,  7,  1) X(4bb,  4, 11, 11) X(57e,  5,  7, 14) X(598,  5,  9,  8) \
+  X(5b6,  5, 11,  6) X(5bb,  5, 11, 11) X(67d,  6,  7, 13) X(6b5,  6, 11,  5) \
+  X(6f1,  6, 15,  1) X(71b,  7,  1, 11) X(734,  7,  3,  4) X(798,  7,  9,  8) \
+  X(79d,  7,  9, 13) X(7f1,  7, 15,  1) X(895,  8,  9,  5) X(897,  8,  9,  7) \
+  X(97d,  9,  7, 13) X(9d3,  9, 13,  3) X(b17, 11,  1,  7) X(b3d, 11,  3, 13) \
+  X(b53, 11,  5,  3) X(b71, 11,  7,  1) X(bb3, 11, 11,  3) X(bb4, 11, 11,  4) \
+  X(bb5, 11, 11,  5) X(c13, 12,  1,  3) X(d3b, 13,  3, 11) X(c3d, 12,  3, 13) \
+  X(d3c, 13,  3, 12) X(d52, 13,  5,  2) X(d72, 13,  7,  2) X(d76, 13,  7,  6) \
+  X(d79, 13,  7,  9) X(d97, 13,  9,  7) X(e11, 14,  1,  1) X(e75, 14,  7,  5) \
+  X(f11, 15,  1,  1) X(f13, 15,  1,  3) X(f52, 15,  5,  2) X(f72, 15,  7,  2) \
+
+#define XOR16_DECLARE(name, a, b, c) \
+  bool seed_xor16_##name(uint16_t seed); \
+  uint16_t xor16_##name(); \
+  void xor16_##name##_fill(uint16_t *dst, uint16_t n);
+XOR16_GENERATORS(XOR16_DECLARE)
+#undef XOR16_DECLARE
+/* The swap family, sw1 to sw4 - see xor16host::stepSwap() */
+#define XOR16_SWAP_GENERATORS(X) \
+  X(sw1, 1) X(sw2, 2) X(sw3, 3) X(sw4, 4)
+
+#define XOR16_SWAP_DECLARE(name, which) \
+  bool seed_xor16_##name(uint16_t seed); \
+  uint16_t xor16_##name(); \
+  void xor16_##name##_fill(uint16_t *dst, uint16_t n);
+XOR16_SWAP_GENERATORS(XOR16_SWAP_DECLARE)
+#undef XOR16_SWAP_DECLARE
+
+/* The generators that have a scrambled-output xor16_xxx_star() */
+#define XOR16_STAR_GENERATORS(X) \
+  X(17b) X(3bb) X(3d9) X(4bb) X(598) X(798) X(895) X(897) X(9d3) X(b71) X(bb4) X(d3b)
+
+#define XOR16_STAR_DECLARE(name) \
+  uint16_t xor16_##name##_star();
+XOR16_STAR_GENERATORS(XOR16_STAR_DECLARE)
+#undef XOR16_STAR_DECLARE
+/* The same generators have Weyl versions, xor16_xxx_weyl() */
+#define XOR16_WEYL_DECLARE(name) \
+  void seed_xor16_##name##_weyl(uint16_t seed); \
+  uint16_t xor16_##name##_weyl();
+XOR16_STAR_GENERATORS(XOR16_WEYL_DECLARE)
+#undef XOR16_WEYL_DECLARE
+/* Byte versions, two bytes per step: xor16_xxx_byte() and xor16_xxx_fill_bytes() */
+#define XOR16_BYTE_DECLARE(name) \
+  uint8_t xor16_##name##_byte(); \
+  void xor16_##name##_fill_bytes(uint8_t *dst, uint16_t n);
+XOR16_STAR_GENERATORS(XOR16_BYTE_DECLARE)
+#undef XOR16_BYTE_DECLARE
+/* And bitsliced versions, eight streams at once: xor16_xxx_sliced() */
+#define XOR16_SLICED_DECLARE(name) \
+  void xor16_##name##_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+XOR16_STAR_GENERATORS(XOR16_SLICED_DECLARE)
+#undef XOR16_SLICED_DECLARE
+void xor16_sliced_load(uint8_t *planes, const uint16_t *states);
+void xor16_sliced_store(const uint8_t *planes, uint16_t *states);
+/* The combined generators: a, then b, which only steps when bit 15 of a is set */
+#define XOR16_PAIR_GENERATORS(X) \
+  X(3d9, 9d3) X(598, 895) X(798, 897)
+
+#define XOR16_PAIR_DECLARE(x, y) \
+  bool seed_xor16_##x##_##y(uint32_t seed); \
+  uint16_t xor16_##x##_##y();
+XOR16_PAIR_GENERATORS(XOR16_PAIR_DECLARE)
+#undef XOR16_PAIR_DECLARE
+bool seed_xor16(uint16_t seed);
+uint16_t xor16();
+uint16_t xor16_star();
+void seed_xor16_weyl(uint16_t seed);
+uint16_t xor16_weyl();
+uint16_t xor16(uint16_t seed);
+void xor16_fill(uint16_t *dst, uint16_t n);
+uint8_t xor16_byte();
+void xor16_fill_bytes(uint8_t *dst, uint16_t n);
+
+/* name, a, b, c for the 32-bit generators. xor32() is 8_9_23. */
+#define XOR32_GENERATORS(X) \
+  X(8_9_23, 8, 9, 23) X(23_9_8, 23, 9, 8) X(8_7_23, 8, 7, 23) X(23_7_8, 23, 7, 8) \
+  X(9_21_16, 9, 21, 16) X(16_21_9, 16, 21, 9)
+
+#define XOR32_DECLARE(name, a, b, c) \
+  bool seed_xor32_##name(uint32_t seed); \
+  uint32_t xor32_##name(); \
+  void xor32_##name##_fill(uint32_t *dst, uint16_t n);
+XOR32_GENERATORS(XOR32_DECLARE)
+#undef XOR32_DECLARE
+bool seed_xor32(uint32_t seed);
+uint32_t xor32();
+uint32_t xor32(uint32_t seed);
+void xor32_fill(uint32_t *dst, uint16_t n);
+
+/* name, multiplier for the 8-bit multiply with carry generators. mwc8() is f9. */
+#define MWC8_GENERATORS(X) \
+  X(f9, 0xF9) X(f3, 0xF3) X(e4, 0xE4) X(e3, 0xE3) X(da, 0xDA) X(cc, 0xCC)
+
+#define MWC8_DECLARE(name, mult) \
+  bool seed_mwc8_##name(uint16_t seed); \
+  uint8_t mwc8_##name(); \
+  void mwc8_##name##_fill(uint8_t *dst, uint16_t n);
+MWC8_GENERATORS(MWC8_DECLARE)
+#undef MWC8_DECLARE
+bool seed_mwc8(uint16_t seed);
+uint8_t mwc8();
+void mwc8_fill(uint8_t *dst, uint16_t n);
+
+bool seed_xoroshiro32pp(uint32_t seed);
+uint16_t xoroshiro32pp();
+void xoroshiro32pp_fill(uint16_t *dst, uint16_t n);
+void xoroshiro32pp_jump(uint16_t n);
+
+namespace xor16host {
+  struct Generator {
+    const char *name;
+    uint8_t a, b, c;
+  };
+  extern const Generator generators[60];
+  const Generator *find(const char *name);
+
+  /* One LRL step (y ^= y << a; y ^= y >> b; y ^= y << c), or RLR if rlr is set */
+  inline uint16_t step(uint16_t s, uint8_t a, uint8_t b, uint8_t c, bool rlr = false) {
+    if (rlr) {
+      s ^= s >> a;
+      s ^= (uint16_t)(s << b);
+      s ^= s >> c;
+    } else {
+      s ^= (uint16_t)(s << a);
+      s ^= s >> b;
+      s ^= (uint16_t)(s << c);
+    }
+    return s;
+  }
+  /* One step of swap family generator n (1-4). L and H are the low and high bytes. */
+  inline uint16_t stepSwap(uint16_t s, uint8_t n) {
+    uint8_t L = s, H = s >> 8;
+    switch (n) {
+      case 1:
+        H ^= L;
+        H = (uint8_t)(H << 4 | H >> 4);
+        L ^= H >> 1;
+        L ^= (uint8_t)(L << 1);
+        break;
+      case 2:
+        H ^= (uint8_t)(L << 1);
+        H ^= H >> 1;
+        L ^= H;
+        L = (uint8_t)(L << 4 | L >> 4);
+        break;
+      case 3:
+        H ^= H >> 1;
+        H ^= L;
+        L ^= H;
+        H = (uint8_t)(H << 4 | H >> 4);
+        L ^= (uint8_t)(H << 1);
+        break;
+      case 4:
+        H ^= L;
+        L ^= H >> 1;
+        s = L | H << 8;
+        s = (uint16_t)(s << 1 | s >> 15);
+        L = s;
+        H = s >> 8;
+        L = (uint8_t)(L << 4 | L >> 4);
+        L ^= H;
+        break;
+    }
+    return L | H << 8;
+  }
+  /* Output mixing of the _star() functions - rng16::star() in rngUtil.h */
+  inline uint16_t star(uint16_t s) {
+    uint16_t p = s * 0xDD;
+    p ^= p >> 8;
+    return (uint16_t)((p << 8) | (p >> 8));
+  }
+  /* What the _weyl() functions add to their counter each call */
+  const uint16_t weylIncrement = 0x7F4B;
+  inline uint32_t step32(uint32_t s, uint8_t a, uint8_t b, uint8_t c) {
+    s ^= s << a;
+    s ^= s >> b;
+    s ^= s << c;
+    return s;
+  }
+  /* One step of an 8-bit multiply with carry: x in the low byte, c in the high byte */
+  inline uint16_t stepMwc8(uint16_t s, uint8_t mult) {
+    return (uint16_t)((uint8_t) s * mult + (s >> 8));
+  }
+  /* One step of xoroshiro32++ (13, 5, 10, 9); returns the output */
+  inline uint16_t stepXoroshiro(uint16_t &s0, uint16_t &s1) {
+    uint16_t sum = s0 + s1;
+    uint16_t ret = (uint16_t)((sum << 9 | sum >> 7) + s0);
+    s1 ^= s0;
+    s0 = (uint16_t)((s0 << 13 | s0 >> 3) ^ s1 ^ (s1 << 5));
+    s1 = (uint16_t)(s1 << 10 | s1 >> 6);
+    return ret;
+  }
+
+  /* Advance each of n independent states by steps steps, writing the final states back. */
+  void stepLanes(uint16_t *states, size_t n, uint8_t a, uint8_t b, uint8_t c, uint32_t steps = 1);
+  /* Which kernel stepLanes() uses on this machine: "avx2", "sse2" or "scalar" */
+  const char *laneKernel();
+
+  /* 64 generators in bitsliced form: bit j of plane[i] is bit i of the state of lane j. */
+  struct Bitsliced64 {
+    uint64_t plane[16];
+    void load(const uint16_t *states);   // 64 states
+    void store(uint16_t *states) const;  // 64 states
+    void step(uint8_t a, uint8_t b, uint8_t c) {
+      for (int i = 15; i >= a; i--) {
+        plane[i] ^= plane[i - a];
+      }
+      for (int i = 0; i + b < 16; i++) {
+        plane[i] ^= plane[i + b];
+      }
+      for (int i = 15; i >= c; i--) {
+        plane[i] ^= plane[i - c];
+      }
+    }
+  };
+}
+#endif
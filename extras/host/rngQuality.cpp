@@ -0,0 +1,110 @@
+/* Quality metrics - see rngQuality.h */
+#include "rngQuality.h"
+#include <string.h>
+
+namespace rngquality {
+  const char *ratingName(Rating r) {
+    static const char *const names[] = {"Terrible", "V. poor", "Okay", "Good", "V. good"};
+    return names[r];
+  }
+
+  Analyzer::Analyzer(uint8_t bits) : _bits(bits) {
+    memset(&_s, 0, sizeof(_s));
+  }
+
+  static inline void track(uint8_t &run, uint8_t &best, bool same) {
+    if (same) {
+      if (run < 255) {
+        run++;
+      }
+      if (run > best) {
+        best = run;
+      }
+    } else {
+      run = 0;
+    }
+  }
+
+  void Analyzer::add(uint16_t v) {
+    static const uint8_t pairA[6] = {0, 0, 0, 1, 1, 2};
+    static const uint8_t pairB[6] = {1, 2, 3, 2, 3, 3};
+    const uint8_t nybbles = _bits / 4;
+    _s.count++;
+    if (_first) {
+      _first = false;
+      _prev = v;
+      return;
+    }
+    uint16_t x = v ^ _prev;
+    for (uint8_t n = 0; n < nybbles; n++) {
+      track(_run[n], _s.stuck[n], !((x >> (4 * n)) & 0x0F));
+    }
+    if (_bits == 16) {
+      track(_runByte[0], _s.stuckByte, !(x & 0x00FF));
+      track(_runByte[1], _s.stuckByte, !(x & 0xFF00));
+      track(_runEnds, _s.stuckEnds, !(x & 0xF00F));
+      track(_runMiddle, _s.stuckMiddle, !(x & 0x0FF0));
+    }
+    for (uint8_t p = 0; p < 6; p++) {
+      if (pairB[p] >= nybbles) {
+        continue;
+      }
+      uint8_t sa = 4 * pairA[p], sb = 4 * pairB[p];
+      bool match = ((v >> sa) & 0x0F) == ((v >> sb) & 0x0F) && ((_prev >> sa) & 0x0F) == ((_prev >> sb) & 0x0F);
+      track(_runPair[p], _s.pairs, match);
+    }
+    uint16_t mask = _bits == 16 ? 0xFFFF : 0xFF;
+    _s.diff[((uint16_t)(v - _prev) & mask) >> (_bits - 4)]++;
+    _prev = v;
+  }
+
+  Stats Analyzer::finish() {
+    int32_t expect = (int32_t)(_s.count - 1) / 16;
+    _s.diffHigh = 0;
+    _s.diffLow = 0;
+    for (int i = 0; i < 16; i++) {
+      int32_t d = (int32_t) _s.diff[i] - expect;
+      if (d > _s.diffHigh) {
+        _s.diffHigh = d;
+      }
+      if (-d > _s.diffLow) {
+        _s.diffLow = -d;
+      }
+    }
+    _s.rating = rate(_s);
+    return _s;
+  }
+
+  /* Thresholds are for a full 65535-value cycle; the difference figures are scaled for other
+   * lengths. The original on-chip test rated by hand, so these were fitted to it: they put 48 of
+   * the 60 xorshift16 generators in the same class as the README appendices, and 11 one class
+   * off. The other is d52, V. poor in the appendices and V. good here. No thresholds on these
+   * metrics can pull it down without pulling 3d9 (V. good) down with it, since 3d9 is as bad or
+   * worse than d52 on every one of them - so whatever the hand rating saw in d52, it isn't
+   * something measured here. */
+  Rating rate(const Stats &s) {
+    uint8_t stuck = 0;
+    uint8_t stuckSum = 0;
+    for (int i = 0; i < 4; i++) {
+      stuckSum += s.stuck[i];
+      if (s.stuck[i] > stuck) {
+        stuck = s.stuck[i];
+      }
+    }
+    double scale = 65535.0 / (s.count > 1 ? s.count : 1);
+    double bias = (s.diffHigh > s.diffLow ? s.diffHigh : s.diffLow) * scale;
+    if (stuck >= 9 || bias >= 2000) {
+      return Terrible;
+    }
+    if (stuck >= 8 || stuckSum >= 25 || bias >= 1000) {
+      return VeryPoor;
+    }
+    if (stuckSum >= 21 || s.pairs >= 6 || bias >= 100) {
+      return Okay;
+    }
+    if (stuckSum >= 20 || s.pairs >= 5 || bias >= 60) {
+      return Good;
+    }
+    return VeryGood;
+  }
+}
@@ -0,0 +1,67 @@
+/* Quality metrics used to rate the generators in the README appendices.
+ *
+ * Over a run of consecutive outputs (for a full period generator, the whole cycle) we record:
+ *   stuck[n]    longest run of consecutive outputs where nybble n (0 = low) didn't change
+ *   stuckByte   longest run where the low or the high byte didn't change
+ *   stuckEnds   longest run where both end nybbles (0 and 3) didn't change
+ *   stuckMiddle longest run where both middle nybbles (1 and 2) didn't change
+ *   pairs       longest run of outputs in which the same two nybbles of the word are equal
+ *               (4524 then b97b has nybbles 0 and 3 matching in both)
+ *   diff[16]    histogram of (next - previous) mod 65536, in 16 buckets by value - so bucket 0
+ *               is small positive differences and bucket 15 is small negative ones
+ *   diffHigh    the largest excess of any bucket over an even split
+ *   diffLow     the largest shortfall of any bucket below an even split
+ * The rating comes from the longest and the total of the stuck nybble runs, the nybble pairs and
+ * the difference bias. For 8-bit generators only the two nybbles of the byte are looked at, and
+ * the byte and end/middle figures are 0.
+ */
+#ifndef rngQuality_h
+#define rngQuality_h
+#include <stdint.h>
+
+namespace rngquality {
+  enum Rating : uint8_t {
+    Terrible = 0,
+    VeryPoor = 1,
+    Okay     = 2,
+    Good     = 3,
+    VeryGood = 4
+  };
+  const char *ratingName(Rating r);
+
+  struct Stats {
+    uint32_t count;
+    uint8_t  stuck[4];
+    uint8_t  stuckByte;
+    uint8_t  stuckEnds;
+    uint8_t  stuckMiddle;
+    uint8_t  pairs;
+    uint32_t diff[16];
+    int32_t  diffHigh;
+    int32_t  diffLow;
+    Rating   rating;
+  };
+
+  /* Accumulates one output at a time */
+  class Analyzer {
+    uint8_t  _bits;
+    bool     _first = true;
+    uint16_t _prev = 0;
+    uint8_t  _run[4] = {0, 0, 0, 0}, _runByte[2] = {0, 0}, _runEnds = 0, _runMiddle = 0, _runPair[6] = {0, 0, 0, 0, 0, 0};
+    Stats    _s;
+   public:
+    explicit Analyzer(uint8_t bits = 16);
+    void add(uint16_t value);
+    Stats finish();
+  };
+
+  template <class Next> Stats analyze(Next next, uint32_t count, uint8_t bits = 16) {
+    Analyzer a(bits);
+    while (count--) {
+      a.add(next());
+    }
+    return a.finish();
+  }
+  Rating rate(const Stats &s);
+}
+#endif
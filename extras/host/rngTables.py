@@ -0,0 +1,157 @@
+"""Generates the PROGMEM tables used by the generators in src/.
+
+  python3 rngTables.py jump <gen>         the 16 matrices M^(2^k) used by xor16_xxx_jump()
+  python3 rngTables.py checkpoints <gen>  the checkpoint tables used by xor16_xxx_position()
+  python3 rngTables.py xoroshiro          the jump polynomials used by xoroshiro32pp_jump()
+
+<gen> is the three hex digit name (3d9) or a,b,c. Each xorshift step is a linear map on the 16
+bits of state, so it's a 16x16 matrix over GF(2). A matrix is stored as 16 words: word i is
+what a state with only bit i set turns into, and applying it to a state is the xor of the words
+for the bits that are set.
+
+Positions count steps from a state of 1: position 0 is 1, position 1 is one step on from that,
+and so on up to 65534. The checkpoints are the states at every 256th position, plus a table
+giving their order when sorted by state, so a state can be looked up by binary search.
+
+xoroshiro32++ has 32 bits of state, so its matrices would be 128 bytes each. Instead, jumping 2^k
+steps is done with the polynomial x^(2^k) mod p(x), where p(x) is the characteristic polynomial of
+the step: bit i of the polynomial says whether the state i steps on is xored into the result.
+"""
+import sys
+
+
+def parse(gen):
+    if ',' in gen:
+        a, b, c = (int(x) for x in gen.split(','))
+    else:
+        gen = gen.replace('xor16_', '')
+        a, b, c = (int(x, 16) for x in gen)
+    return a, b, c
+
+
+def step(s, a, b, c):
+    s ^= (s << a) & 0xFFFF
+    s ^= s >> b
+    s ^= (s << c) & 0xFFFF
+    return s
+
+
+def apply(m, s):
+    r = 0
+    for i in range(16):
+        if s >> i & 1:
+            r ^= m[i]
+    return r
+
+
+def jump_matrices(a, b, c):
+    """M^(2^k) for k = 0..15"""
+    m = [step(1 << i, a, b, c) for i in range(16)]
+    out = []
+    for k in range(16):
+        out.append(m)
+        m = [apply(m, m[i]) for i in range(16)]
+    return out
+
+
+def c_rows(words, indent='    '):
+    return [indent + ', '.join('0x%04X' % w for w in words[i:i + 8]) + ',' for i in range(0, len(words), 8)]
+
+
+def jump_table(gen):
+    lines = []
+    for k, m in enumerate(jump_matrices(*parse(gen))):
+        lines.append('    // M^%d' % (1 << k))
+        lines += c_rows(m)
+    lines[-1] = lines[-1].rstrip(',')
+    return '\n'.join(lines)
+
+
+def checkpoints(a, b, c):
+    s = 1
+    out = []
+    for pos in range(65535):
+        if pos % 256 == 0:
+            out.append(s)
+        s = step(s, a, b, c)
+    return out
+
+
+def checkpoint_tables(gen, name):
+    cp = checkpoints(*parse(gen))
+    order = sorted(range(len(cp)), key=lambda i: cp[i])
+    lines = ['static const uint16_t %s_checkpoints[256] PROGMEM = {' % name]
+    lines += c_rows(cp, '  ')
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append('};')
+    lines.append('static const uint8_t %s_order[256] PROGMEM = {' % name)
+    lines += ['  ' + ', '.join('%3d' % o for o in order[i:i + 16]) + ',' for i in range(0, 256, 16)]
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def xoroshiro_step(s0, s1):
+    rotl = lambda x, k: ((x << k) | (x >> (16 - k))) & 0xFFFF
+    s1 ^= s0
+    return rotl(s0, 13) ^ s1 ^ ((s1 << 5) & 0xFFFF), rotl(s1, 10)
+
+
+def xoroshiro_charpoly():
+    """Berlekamp-Massey on one bit of the state gives the characteristic polynomial"""
+    s0, s1 = 1, 0
+    seq = []
+    for i in range(128):
+        seq.append(s0 & 1)
+        s0, s1 = xoroshiro_step(s0, s1)
+    c, b, L, m = [1] + [0] * 128, [1] + [0] * 128, 0, -1
+    for i in range(len(seq)):
+        d = seq[i]
+        for j in range(1, L + 1):
+            d ^= c[j] & seq[i - j]
+        if d:
+            t = c[:]
+            for j in range(i - m, len(c)):
+                c[j] ^= b[j - (i - m)]
+            if 2 * L <= i:
+                L, m, b = i + 1 - L, i, t
+    assert L == 32
+    return sum(1 << (L - j) for j in range(L + 1) if c[j])
+
+
+def xoroshiro_table():
+    p = xoroshiro_charpoly()
+
+    def mulmod(a, b):
+        r = 0
+        while b:
+            if b & 1:
+                r ^= a
+            b >>= 1
+            a <<= 1
+            if a >> 32 & 1:
+                a ^= p
+        return r
+    x = 2
+    for k in range(16):
+        x = mulmod(x, x)
+    polys = []
+    for k in range(16, 32):
+        polys.append(x)
+        x = mulmod(x, x)
+    lines = ['    ' + ', '.join('0x%08X' % w for w in polys[i:i + 4]) + ',' for i in range(0, 16, 4)]
+    lines[-1] = lines[-1].rstrip(',')
+    return '\n'.join(lines)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) == 3 and sys.argv[1] == 'jump':
+        print(jump_table(sys.argv[2]))
+    elif len(sys.argv) == 3 and sys.argv[1] == 'checkpoints':
+        gen = sys.argv[2].replace('xor16_', '')
+        print(checkpoint_tables(gen, '__xor16_' + gen.replace(',', '_')))
+    elif len(sys.argv) == 2 and sys.argv[1] == 'xoroshiro':
+        print(xoroshiro_table())
+    else:
+        print(__doc__)
+        sys.exit(2)
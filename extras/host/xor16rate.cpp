@@ -0,0 +1,209 @@
+/* xor16rate - rates generators with the metrics from the README appendices
+ *
+ * Walks the whole 65535-step cycle of every generator, one generator per thread, and prints
+ * the metrics from rngQuality.h as CSV (default) or JSON.
+ *
+ *   xor16rate [--json] [--threads n] [--rlr] [--star] [--weyl] [gen | a,b,c ...]
+ *
+ * With no generators given, all 60 are rated. --rlr rates the RLR mirrors instead, and --star
+ * rates the output of the xor16_xxx_star() versions (the same step, output mixed). --weyl rates
+ * the first 65535 values of the xor16_xxx_weyl() versions, from a seed of 1. a,b,c can
+ * be any shifts, so candidates that aren't in the library yet can be rated too; one that isn't
+ * full period is reported with its actual period. sw1 to sw4 are the swap family, and mwc8_f9
+ * and the rest are the 8-bit multiply with carry generators.
+ *
+ * Build:  g++ -O2 -std=c++11 -pthread -o xor16rate xor16rate.cpp rngQuality.cpp rngBetterHost.cpp
+ */
+#include "rngBetterHost.h"
+#include "rngQuality.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rngquality;
+
+struct Job {
+  std::string name;
+  uint8_t bits;                                           // 8 or 16 bit output
+  uint32_t count;                                         // outputs to look at
+  std::function<std::function<uint16_t()>()> make;        // returns a fresh generator
+  Stats stats;
+};
+
+static Job xorshiftJob(const char *name, uint8_t a, uint8_t b, uint8_t c, bool rlr, bool star, bool weyl) {
+  Job j;
+  j.name = std::string(rlr ? "xor16r_" : "xor16_") + name + (star ? "_star" : "") + (weyl ? "_weyl" : "");
+  j.bits = 16;
+  uint16_t s = 1;
+  uint32_t period = 0;
+  do {
+    s = xor16host::step(s, a, b, c, rlr);
+    period++;
+  } while (s != 1 && period < 65536);
+  j.count = period;
+  j.make = [a, b, c, rlr, star, weyl]() {
+    uint16_t state = 1, count = 0;
+    return std::function<uint16_t()>([state, count, a, b, c, rlr, star, weyl]() mutable {
+      state = xor16host::step(state, a, b, c, rlr);
+      if (weyl) {
+        return (uint16_t)(state + (count += xor16host::weylIncrement));
+      }
+      return star ? xor16host::star(state) : state;
+    });
+  };
+  return j;
+}
+
+static Job swapJob(const char *name, uint8_t n, bool star) {
+  Job j;
+  j.name = std::string("xor16_") + name + (star ? "_star" : "");
+  j.bits = 16;
+  j.count = 65535;
+  j.make = [n, star]() {
+    uint16_t state = 1;
+    return std::function<uint16_t()>([state, n, star]() mutable {
+      state = xor16host::stepSwap(state, n);
+      return star ? xor16host::star(state) : state;
+    });
+  };
+  return j;
+}
+
+static Job mwcJob(const char *name, uint8_t mult) {
+  Job j;
+  j.name = std::string("mwc8_") + name;
+  j.bits = 8;
+  j.count = 128 * mult - 1;
+  j.make = [mult]() {
+    uint16_t state = 1;
+    return std::function<uint16_t()>([state, mult]() mutable {
+      state = xor16host::stepMwc8(state, mult);
+      return (uint8_t) state;
+    });
+  };
+  return j;
+}
+
+static uint8_t mwcMultiplier(const char *name) {
+  #define MWC8_MATCH(gen, mult) if (!strcmp(name, "mwc8_" #gen)) return mult;
+  MWC8_GENERATORS(MWC8_MATCH)
+  #undef MWC8_MATCH
+  return 0;
+}
+
+static void printCSVHeader() {
+  printf("name,count,stuck0,stuck1,stuck2,stuck3,stuckByte,stuckEnds,stuckMiddle,pairs,diffHigh,diffLow");
+  for (int i = 0; i < 16; i++) {
+    printf(",diff%d", i);
+  }
+  printf(",rating\n");
+}
+
+static void printCSV(const Job &j) {
+  const Stats &s = j.stats;
+  printf("%s,%u,%u,%u,%u,%u,%u,%u,%u,%u,%d,%d", j.name.c_str(), (unsigned) s.count,
+         s.stuck[0], s.stuck[1], s.stuck[2], s.stuck[3], s.stuckByte, s.stuckEnds, s.stuckMiddle,
+         s.pairs, (int) s.diffHigh, (int) s.diffLow);
+  for (int i = 0; i < 16; i++) {
+    printf(",%u", (unsigned) s.diff[i]);
+  }
+  printf(",%s\n", ratingName(s.rating));
+}
+
+static void printJSON(const Job &j, bool last) {
+  const Stats &s = j.stats;
+  printf("  {\"name\": \"%s\", \"count\": %u, \"stuck\": [%u, %u, %u, %u], \"stuckByte\": %u, "
+         "\"stuckEnds\": %u, \"stuckMiddle\": %u, \"pairs\": %u, \"diffHigh\": %d, \"diffLow\": %d, \"diff\": [",
+         j.name.c_str(), (unsigned) s.count, s.stuck[0], s.stuck[1], s.stuck[2], s.stuck[3],
+         s.stuckByte, s.stuckEnds, s.stuckMiddle, s.pairs, (int) s.diffHigh, (int) s.diffLow);
+  for (int i = 0; i < 16; i++) {
+    printf("%s%u", i ? ", " : "", (unsigned) s.diff[i]);
+  }
+  printf("], \"rating\": \"%s\"}%s\n", ratingName(s.rating), last ? "" : ",");
+}
+
+static void runJobs(std::vector<Job> &jobs, unsigned threads) {
+  std::atomic<size_t> next(0);
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; t++) {
+    pool.emplace_back([&]() {
+      size_t i;
+      while ((i = next++) < jobs.size()) {
+        jobs[i].stats = analyze(jobs[i].make(), jobs[i].count, jobs[i].bits);
+      }
+    });
+  }
+  for (auto &t : pool) {
+    t.join();
+  }
+}
+
+int main(int argc, char **argv) {
+  bool json = false, rlr = false, star = false, weyl = false;
+  unsigned threads = std::thread::hardware_concurrency();
+  std::vector<const char *> names;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (!strcmp(argv[i], "--rlr")) {
+      rlr = true;
+    } else if (!strcmp(argv[i], "--star")) {
+      star = true;
+    } else if (!strcmp(argv[i], "--weyl")) {
+      weyl = true;
+    } else if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = atoi(argv[++i]);
+    } else if (argv[i][0] == '-') {
+      fprintf(stderr, "usage: xor16rate [--json] [--threads n] [--rlr] [--star] [--weyl] [gen | a,b,c ...]\n");
+      return 2;
+    } else {
+      names.push_back(argv[i]);
+    }
+  }
+  if (!threads) {
+    threads = 1;
+  }
+  std::vector<Job> jobs;
+  if (names.empty()) {
+    for (int i = 0; i < 60; i++) {
+      const xor16host::Generator &g = xor16host::generators[i];
+      jobs.push_back(xorshiftJob(g.name, g.a, g.b, g.c, rlr, star, weyl));
+    }
+  }
+  for (const char *n : names) {
+    unsigned a, b, c;
+    if (sscanf(n, "%u,%u,%u", &a, &b, &c) == 3 && a && b && c && a < 16 && b < 16 && c < 16) {
+      const char *digits = "0123456789abcdef";
+      char hex[4] = {digits[a], digits[b], digits[c], 0};
+      jobs.push_back(xorshiftJob(hex, a, b, c, rlr, star, weyl));
+    } else if (!strncmp(n, "sw", 2) && n[2] >= '1' && n[2] <= '4' && !n[3]) {
+      jobs.push_back(swapJob(n, n[2] - '0', star));
+    } else if (uint8_t mult = mwcMultiplier(n)) {
+      jobs.push_back(mwcJob(n + 5, mult));
+    } else if (const xor16host::Generator *g = xor16host::find(n)) {
+      jobs.push_back(xorshiftJob(g->name, g->a, g->b, g->c, rlr, star, weyl));
+    } else {
+      fprintf(stderr, "unknown generator %s\n", n);
+      return 2;
+    }
+  }
+  runJobs(jobs, threads);
+  if (json) {
+    printf("[\n");
+    for (size_t i = 0; i < jobs.size(); i++) {
+      printJSON(jobs[i], i + 1 == jobs.size());
+    }
+    printf("]\n");
+  } else {
+    printCSVHeader();
+    for (const Job &j : jobs) {
+      printCSV(j);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,396 @@
+/* xor16sim - command line front end to the rngBetter host build
+ *
+ *   xor16sim list                      all generators and their shifts
+ *   xor16sim vectors <gen> <seed> [n]  first n outputs (default 16) of one generator
+ *   xor16sim chain <seed>              same output as the rngBetterTest example, for diffing
+ *                                      against its serial output from real hardware or simavr
+ *   xor16sim selftest [vectors]        check the host code against xor16vectors.txt (the output
+ *                                      of the asm in src/, see xor16vectors.py) and the
+ *                                      multi-lane engines against the scalar code
+ *   xor16sim bench <gen>               steps per second for each engine
+ *
+ * Build:  g++ -O2 -std=c++11 -o xor16sim xor16sim.cpp rngBetterHost.cpp
+ */
+#include "rngBetterHost.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace xor16host;
+
+static int usage() {
+  fprintf(stderr, "usage: xor16sim list | vectors <gen> <seed> [n] | chain <seed> | selftest [vectors] | bench <gen>\n");
+  return 2;
+}
+
+static const Generator *need(const char *name) {
+  const Generator *g = find(name);
+  if (!g) {
+    fprintf(stderr, "no generator named %s\n", name);
+    exit(2);
+  }
+  return g;
+}
+
+/* The host versions of one generator's functions, for checking against xor16vectors.txt. Only
+ * the 12 in XOR16_STAR_GENERATORS have the _star, _weyl, _byte and _sliced ones. */
+struct HostFunctions {
+  std::string name;
+  uint8_t a, b, c;
+  bool (*seed)(uint16_t);
+  uint16_t (*next)();
+  void (*fill)(uint16_t *, uint16_t);
+  uint16_t (*star)();
+  void (*seedWeyl)(uint16_t);
+  uint16_t (*weyl)();
+  uint8_t (*byte)();
+  void (*fillBytes)(uint8_t *, uint16_t);
+  void (*sliced)(uint8_t *, uint8_t *, uint16_t);
+};
+
+static std::vector<HostFunctions> hostFunctions() {
+  std::vector<HostFunctions> all;
+  all.push_back({"xor16", 3, 13, 9, seed_xor16, xor16, xor16_fill, xor16_star, seed_xor16_weyl, xor16_weyl,
+                 xor16_byte, xor16_fill_bytes, NULL});
+  #define XOR16_HOST_ENTRY(gen, a, b, c) \
+    all.push_back({"xor16_" #gen, a, b, c, seed_xor16_##gen, xor16_##gen, xor16_##gen##_fill, \
+                   NULL, NULL, NULL, NULL, NULL, NULL});
+  XOR16_GENERATORS(XOR16_HOST_ENTRY)
+  #undef XOR16_HOST_ENTRY
+  #define XOR16_HOST_STAR(gen) \
+    for (HostFunctions &h : all) { \
+      if (h.name == "xor16_" #gen) { \
+        h.star = xor16_##gen##_star; \
+        h.seedWeyl = seed_xor16_##gen##_weyl; \
+        h.weyl = xor16_##gen##_weyl; \
+        h.byte = xor16_##gen##_byte; \
+        h.fillBytes = xor16_##gen##_fill_bytes; \
+        h.sliced = xor16_##gen##_sliced; \
+      } \
+    }
+  XOR16_STAR_GENERATORS(XOR16_HOST_STAR)
+  #undef XOR16_HOST_STAR
+  return all;
+}
+
+/* Runs the host function named on one line of xor16vectors.txt and counts how many of its
+ * outputs differ from the ones the asm gave. -1 if there's no such host function. */
+static int checkVector(const std::vector<HostFunctions> &all, const std::string &fn, uint16_t seed,
+                       const std::vector<uint16_t> &expect) {
+  static const char *const suffixes[] = {"_prev", "_star", "_fill_bytes", "_fill", "_weyl", "_byte", "_sliced", ""};
+  const HostFunctions *h = NULL;
+  std::string suffix;
+  for (const char *sfx : suffixes) {
+    size_t len = strlen(sfx);
+    if (fn.size() > len && !fn.compare(fn.size() - len, len, sfx)) {
+      for (const HostFunctions &candidate : all) {
+        if (candidate.name == fn.substr(0, fn.size() - len)) {
+          h = &candidate;
+        }
+      }
+      if (h) {
+        suffix = sfx;
+        break;
+      }
+    }
+  }
+  if (!h) {
+    return -1;
+  }
+  size_t n = expect.size();
+  std::vector<uint16_t> got(n);
+  if (suffix == "_weyl" && h->weyl) {
+    h->seedWeyl(seed);
+  } else {
+    h->seed(seed);
+  }
+  if (suffix == "") {
+    for (size_t i = 0; i < n; i++) {
+      got[i] = h->next();
+    }
+  } else if (suffix == "_prev") {
+    // No _prev() on the host: step each output forward and it has to land on the one before
+    for (size_t i = 0; i < n; i++) {
+      got[i] = step(expect[i], h->a, h->b, h->c) == (i ? expect[i - 1] : seed) ? expect[i] : (uint16_t) ~expect[i];
+    }
+  } else if (suffix == "_fill") {
+    h->fill(got.data(), n);
+  } else if (suffix == "_star" && h->star) {
+    for (size_t i = 0; i < n; i++) {
+      got[i] = h->star();
+    }
+  } else if (suffix == "_weyl" && h->weyl) {
+    for (size_t i = 0; i < n; i++) {
+      got[i] = h->weyl();
+    }
+  } else if (suffix == "_byte" && h->byte) {
+    for (size_t i = 0; i < n; i++) {
+      got[i] = h->byte();
+    }
+  } else if (suffix == "_fill_bytes" && h->fillBytes && n) {
+    std::vector<uint8_t> bytes(n);
+    bytes[0] = h->byte();
+    h->fillBytes(bytes.data() + 1, n - 1);
+    got.assign(bytes.begin(), bytes.end());
+  } else if (suffix == "_sliced" && h->sliced) {
+    uint16_t states[8];
+    uint8_t planes[16];
+    std::vector<uint8_t> dst(n);
+    for (int j = 0; j < 8; j++) {
+      states[j] = (uint16_t)(seed + j * 0x1F35);
+    }
+    xor16_sliced_load(planes, states);
+    h->sliced(planes, dst.data(), n / 16);
+    got.assign(dst.begin(), dst.end());
+  } else {
+    return -1;
+  }
+  int wrong = 0;
+  for (size_t i = 0; i < n; i++) {
+    wrong += got[i] != expect[i];
+  }
+  return wrong;
+}
+
+/* xor16vectors.txt comes from running the asm in src/, so this is what ties the host code to
+ * what the AVR actually does. */
+static int checkVectors(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    printf("can't open %s (run selftest from extras/host, or give the path)\n", path);
+    return 1;
+  }
+  std::vector<HostFunctions> all = hostFunctions();
+  int failures = 0, lines = 0;
+  char buf[512];
+  while (fgets(buf, sizeof(buf), f)) {
+    if (buf[0] == '#' || buf[0] == '\n') {
+      continue;
+    }
+    char *tok = strtok(buf, " \n");
+    std::string fn = tok;
+    uint16_t seed = (uint16_t) strtoul(strtok(NULL, " \n"), NULL, 16);
+    std::vector<uint16_t> expect;
+    while ((tok = strtok(NULL, " \n"))) {
+      expect.push_back((uint16_t) strtoul(tok, NULL, 16));
+    }
+    int wrong = checkVector(all, fn, seed, expect);
+    if (wrong < 0) {
+      printf("%s: no host version to check\n", fn.c_str());
+      failures++;
+    } else if (wrong) {
+      printf("%s: %d of %u outputs differ from the asm\n", fn.c_str(), wrong, (unsigned) expect.size());
+      failures++;
+    }
+    lines++;
+  }
+  fclose(f);
+  if (!lines) {
+    printf("%s: no vectors\n", path);
+    failures++;
+  }
+  return failures;
+}
+
+static int selftest(const char *vectors) {
+  int failures = checkVectors(vectors);
+  // Reseeding drops the spare byte, so the same seed gives the same bytes
+  for (const HostFunctions &h : hostFunctions()) {
+    if (h.byte) {
+      h.seed(0x1234);
+      uint8_t first = h.byte();
+      h.seed(0x1234);
+      if (h.byte() != first) {
+        printf("%s_byte: reseeding kept the spare byte\n", h.name.c_str());
+        failures++;
+      }
+      h.byte(); // leave no spare byte behind
+    }
+  }
+  std::vector<uint16_t> lanes(101), expect(101);
+  for (int i = 0; i < 60; i++) {
+    const Generator &g = generators[i];
+    for (size_t j = 0; j < lanes.size(); j++) {
+      lanes[j] = expect[j] = (uint16_t)(j * 0x9E37 + i + 1);
+      for (int k = 0; k < 37; k++) {
+        expect[j] = step(expect[j], g.a, g.b, g.c);
+      }
+    }
+    stepLanes(lanes.data(), lanes.size(), g.a, g.b, g.c, 37);
+    if (lanes != expect) {
+      printf("%s: %s lanes differ from scalar\n", g.name, laneKernel());
+      failures++;
+    }
+    Bitsliced64 bs;
+    uint16_t in[64], out[64];
+    for (int j = 0; j < 64; j++) {
+      in[j] = (uint16_t)(j * 0x3C6F + 1);
+    }
+    bs.load(in);
+    for (int k = 0; k < 37; k++) {
+      bs.step(g.a, g.b, g.c);
+    }
+    bs.store(out);
+    for (int j = 0; j < 64; j++) {
+      uint16_t s = in[j];
+      for (int k = 0; k < 37; k++) {
+        s = step(s, g.a, g.b, g.c);
+      }
+      if (s != out[j]) {
+        printf("%s: bitsliced lane %d differs from scalar\n", g.name, j);
+        failures++;
+        break;
+      }
+    }
+    // Full period: the first state comes back after exactly 65535 steps, and not before
+    uint16_t s = 1;
+    uint32_t period = 0;
+    do {
+      s = step(s, g.a, g.b, g.c);
+      period++;
+    } while (s != 1);
+    if (period != 65535) {
+      printf("%s: period %u\n", g.name, (unsigned) period);
+      failures++;
+    }
+  }
+  for (uint8_t n = 1; n <= 4; n++) {
+    uint16_t s = 1;
+    uint32_t period = 0;
+    do {
+      s = stepSwap(s, n);
+      period++;
+    } while (s != 1 && period <= 65535);
+    if (period != 65535) {
+      printf("sw%u: period %u\n", n, (unsigned) period);
+      failures++;
+    }
+  }
+  // xor16_xxx_sliced() has to match eight scalar streams, in its output and its final planes
+  struct Sliced {
+    const char *name;
+    void (*run)(uint8_t *planes, uint8_t *dst, uint16_t n);
+  };
+  #define XOR16_SLICED_ENTRY(gen) {#gen, xor16_##gen##_sliced},
+  static const Sliced sliced[] = {XOR16_STAR_GENERATORS(XOR16_SLICED_ENTRY)};
+  #undef XOR16_SLICED_ENTRY
+  for (const Sliced &sl : sliced) {
+    const Generator *g = find(sl.name);
+    uint16_t states[8], out[8];
+    uint8_t planes[16], dst[16 * 5];
+    for (int j = 0; j < 8; j++) {
+      states[j] = (uint16_t)(j * 0x1F35 + 7);
+    }
+    xor16_sliced_load(planes, states);
+    sl.run(planes, dst, 5);
+    for (int k = 0; k < 5; k++) {
+      for (int j = 0; j < 8; j++) {
+        states[j] = step(states[j], g->a, g->b, g->c);
+      }
+      xor16_sliced_store(dst + 16 * k, out);
+      if (memcmp(out, states, sizeof(out))) {
+        printf("%s: sliced step %d differs from scalar\n", g->name, k);
+        failures++;
+      }
+    }
+    xor16_sliced_store(planes, out);
+    if (memcmp(out, states, sizeof(out))) {
+      printf("%s: sliced planes differ from scalar\n", g->name);
+      failures++;
+    }
+  }
+  // xoroshiro32pp_jump(n) has to land where n * 65536 steps do
+  for (uint16_t n = 1; n <= 3; n++) {
+    uint16_t s0 = 0x5678, s1 = 0x1234;
+    for (uint32_t k = 0; k < n * 65536UL; k++) {
+      stepXoroshiro(s0, s1);
+    }
+    seed_xoroshiro32pp(0x12345678);
+    xoroshiro32pp_jump(n);
+    if (xoroshiro32pp() != stepXoroshiro(s0, s1)) {
+      printf("xoroshiro32pp: jump(%u) differs from stepping\n", n);
+      failures++;
+    }
+  }
+  printf("%s: %d failures (lane kernel: %s)\n", failures ? "FAIL" : "OK", failures, laneKernel());
+  return failures ? 1 : 0;
+}
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static int bench(const Generator &g) {
+  const uint32_t steps = 1 << 16;
+  std::vector<uint16_t> lanes(1024);
+  for (size_t j = 0; j < lanes.size(); j++) {
+    lanes[j] = (uint16_t)(j + 1);
+  }
+  auto start = std::chrono::steady_clock::now();
+  uint16_t s = 1;
+  uint64_t sink = 0;
+  for (uint32_t k = 0; k < steps * 64; k++) {
+    s = step(s, g.a, g.b, g.c);
+    sink += s;
+  }
+  printf("scalar:      %8.1f M steps/s\n", steps * 64 / seconds(start) / 1e6);
+  start = std::chrono::steady_clock::now();
+  stepLanes(lanes.data(), lanes.size(), g.a, g.b, g.c, steps);
+  printf("%-6s lanes: %8.1f M steps/s\n", laneKernel(), (double) steps * lanes.size() / seconds(start) / 1e6);
+  Bitsliced64 bs;
+  bs.load(lanes.data());
+  start = std::chrono::steady_clock::now();
+  for (uint32_t k = 0; k < steps * 16; k++) {
+    bs.step(g.a, g.b, g.c);
+  }
+  printf("bitsliced:   %8.1f M steps/s\n", (double) steps * 16 * 64 / seconds(start) / 1e6);
+  bs.store(lanes.data());
+  return (sink + lanes[0]) == 0x5a5a5a5a; // keep the optimizer from dropping the loops
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    return usage();
+  }
+  if (!strcmp(argv[1], "list")) {
+    for (int i = 0; i < 60; i++) {
+      printf("xor16_%s %2d %2d %2d\n", generators[i].name, generators[i].a, generators[i].b, generators[i].c);
+    }
+    return 0;
+  }
+  if (!strcmp(argv[1], "vectors") && argc >= 4) {
+    const Generator *g = need(argv[2]);
+    uint16_t s = (uint16_t) strtoul(argv[3], NULL, 0);
+    long n = argc > 4 ? strtol(argv[4], NULL, 0) : 16;
+    if (!s) {
+      fprintf(stderr, "seed must not be zero\n");
+      return 2;
+    }
+    while (n-- > 0) {
+      s = step(s, g->a, g->b, g->c);
+      printf("%u\n", s);
+    }
+    return 0;
+  }
+  if (!strcmp(argv[1], "chain") && argc >= 3) {
+    // rngBetterTest seeds each generator with the previous one's first output
+    uint16_t seed = (uint16_t) strtoul(argv[2], NULL, 0);
+    printf("Seed: %u\n", seed);
+    for (int i = 0; i < 60; i++) {
+      seed = step(seed, generators[i].a, generators[i].b, generators[i].c);
+      printf("%s: %u\n", generators[i].name, seed);
+    }
+    printf("Done\n");
+    return 0;
+  }
+  if (!strcmp(argv[1], "selftest")) {
+    return selftest(argc >= 3 ? argv[2] : "xor16vectors.txt");
+  }
+  if (!strcmp(argv[1], "bench") && argc >= 3) {
+    return bench(*need(argv[2]));
+  }
+  return usage();
+}
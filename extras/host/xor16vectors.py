@@ -0,0 +1,157 @@
+"""Writes xor16vectors.txt: the first outputs of every xorshift16 function in src/, taken by running
+the asm in those files on avrsim.py. xor16sim selftest checks the host build against them, so the
+host copies can't drift away from what actually runs on the AVR.
+
+  python3 xor16vectors.py > xor16vectors.txt
+
+Each line is a function name, the seed, and its outputs in hex. Everything starts from SEED with
+no spare byte held. For the parts of a function that are C (the spare byte of _byte(), the
+splitting in _fill_bytes()), this does the same thing the C does.
+
+  xor16_xxx, _prev, _star, _weyl  8 calls after seed_xor16_xxx(SEED) (or seed_xor16_xxx_weyl())
+  _fill                           the 8 words from _fill(dst, 8)
+  _byte                           16 calls
+  _fill_bytes                     one _byte() call, then the 15 bytes from _fill_bytes(dst, 15)
+  _sliced                         the 32 bytes from _sliced(planes, dst, 2), with planes loaded
+                                  from the states SEED + j * 0x1F35 for j = 0 to 7
+"""
+import os
+import re
+from avrsim import CPU, extract_asm, run
+
+SRC = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'src')
+SEED = 0xACE1
+DST = 0x100
+
+# Registers avr-gcc could have given each kind of asm statement, from its constraints
+STEP = {'A0': 24, 'B0': 25}                                     # "+d"(state)
+WEYL = {'A0': 24, 'B0': 25, 'A1': 22, 'B1': 23, 'A2': 20, 'B2': 21}
+FILL = {'A0': 20, 'B0': 21, '1': 26, 'A2': 24, 'B2': 25, '2': 24}
+SLICED = {'1': 24}
+STAR = {'A0': 22, 'B0': 23, 'A1': 24, 'B1': 25, '2': 20}
+
+
+class Generator:
+    """One generator's state, stepped by the asm from its source file"""
+    def __init__(self, name, path, prefix):
+        self.name = name
+        self.text = open(path).read()
+        self.prefix = prefix
+        self.star_asm = extract_asm(open(os.path.join(SRC, 'rngUtil.h')).read(), 'inline uint16_t star(')
+        self.state = self.count = self.spare = self.spare_full = 0
+
+    def seed(self, seed):
+        # seed_xor16_xxx() and seed_xor16_xxx_weyl() both drop any spare byte
+        self.state = seed
+        self.spare_full = 0
+
+    def asm(self, suffix, ret):
+        return extract_asm(self.text, '%s %s%s(' % (ret, self.prefix, suffix))
+
+    def has(self, suffix):
+        return re.search(r'\b%s%s\(' % (self.prefix, suffix), self.text) is not None
+
+    def call(self, suffix):
+        cpu = CPU()
+        cpu.setw(24, self.state)
+        run(self.asm(suffix, 'uint16_t'), STEP, cpu)
+        self.state = cpu.w(24)
+        return self.state
+
+    def star(self):
+        cpu = CPU()
+        cpu.setw(24, self.call('_star'))
+        cpu.r[20] = 0xDD
+        run(self.star_asm, STAR, cpu)
+        return cpu.w(22)
+
+    def weyl(self):
+        cpu = CPU()
+        cpu.setw(24, self.state)
+        cpu.setw(22, self.count)
+        run(self.asm('_weyl', 'uint16_t'), WEYL, cpu)
+        self.state, self.count = cpu.w(24), cpu.w(22)
+        return cpu.w(20)
+
+    def fill(self, n):
+        if not n:
+            return []
+        cpu = CPU()
+        cpu.setw(20, self.state)
+        cpu.setw(26, DST)
+        cpu.setw(24, n)
+        run(self.asm('_fill', 'void'), FILL, cpu)
+        self.state = cpu.w(20)
+        return cpu.dump(DST, 2 * n)
+
+    def byte(self):
+        if self.spare_full:
+            self.spare_full = 0
+            return self.spare
+        cpu = CPU()
+        cpu.setw(24, self.state)
+        run(self.asm('_byte', 'uint8_t'), STEP, cpu)
+        self.state = cpu.w(24)
+        self.spare, self.spare_full = self.state >> 8, 1
+        return self.state & 0xFF
+
+    def fill_bytes(self, n):
+        out = []
+        if n and self.spare_full:
+            self.spare_full = 0
+            out.append(self.spare)
+            n -= 1
+        out += self.fill(n >> 1)
+        if n & 1:
+            out.append(self.byte())
+        return out
+
+    def sliced(self, states, n):
+        cpu = CPU()
+        planes = [sum((s >> i & 1) << j for j, s in enumerate(states)) for i in range(16)]
+        cpu.load(0x80, planes)
+        cpu.setw(30, 0x80)
+        cpu.setw(26, DST)
+        cpu.setw(24, n)
+        run(self.asm('_sliced', 'void'), SLICED, cpu)
+        return cpu.dump(DST, 16 * n)
+
+    def lines(self):
+        def line(suffix, values, width=4):
+            return '%s%s %04x %s' % (self.name, suffix, SEED, ' '.join('%0*x' % (width, v) for v in values))
+        out = []
+        for suffix in ('', '_prev', '_star'):
+            if suffix and not self.has(suffix):
+                continue
+            self.seed(SEED)
+            out.append(line(suffix, [self.star() if suffix == '_star' else self.call(suffix) for i in range(8)]))
+        self.seed(SEED)
+        words = self.fill(8)
+        out.append(line('_fill', [words[i] | words[i + 1] << 8 for i in range(0, 16, 2)]))
+        if self.has('_weyl'):
+            self.seed(SEED)
+            self.count = SEED
+            out.append(line('_weyl', [self.weyl() for i in range(8)]))
+        if self.has('_byte'):
+            self.seed(SEED)
+            out.append(line('_byte', [self.byte() for i in range(16)], 2))
+            self.seed(SEED)
+            out.append(line('_fill_bytes', [self.byte()] + self.fill_bytes(15), 2))
+        if self.has('_sliced'):
+            out.append(line('_sliced', self.sliced([(SEED + j * 0x1F35) & 0xFFFF for j in range(8)], 2), 2))
+        return out
+
+
+def generators():
+    yield Generator('xor16', os.path.join(SRC, 'rngBetter.cpp'), 'xor16')
+    for f in sorted(os.listdir(SRC)):
+        m = re.match(r'^xor16_([0-9a-f]{3})\.cpp$', f)
+        if m:
+            yield Generator('xor16_' + m.group(1), os.path.join(SRC, f), 'xor16_' + m.group(1))
+
+
+if __name__ == '__main__':
+    print('# Generated by xor16vectors.py from the asm in src/ - do not edit')
+    for g in generators():
+        for line in g.lines():
+            print(line)
@@ -0,0 +1,82 @@
+// MWC 8 // lag-1 multiply with carry: x = 0xF9 * x + c, low byte to x and high byte to c //
+// period 31871: 256 * 0xF9 - 1 is prime, and 256 has order 31871 modulo it //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+static uint16_t __mwc8_f9_state; // x in the low byte, c in the high byte
+
+/* c is reduced below 0xF9, and the two states that never change (all 0, and x = 255 with
+ * c = 0xF9 - 1) are refused. Every other seed is on a cycle of the full length. */
+bool seed_mwc8_f9(uint16_t seed) {
+  if (__builtin_constant_p(seed)) {
+    if(seed == 0) {
+      badArg("rng's must be seeded with a non-zero value, but the argument passed is always zero");
+    }
+  }
+  uint8_t c = seed >> 8;
+  if (c >= 0xF9) {
+    c -= 0xF9;
+  }
+  seed = (uint8_t)seed | (uint16_t)c << 8;
+  if (seed && seed != (uint16_t)(0xF9 * 256 - 1)) {
+    __mwc8_f9_state = seed;
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t mwc8_f9() {
+  #if defined(__AVR_HAVE_MUL__)
+    __asm__ __volatile__(
+        "mul    %A0, %1"       "\n\t"
+        "add    r0, %B0"       "\n\t" // + c
+        "movw   %A0, r0"       "\n\t" // new x and c
+        "clr    r1"            "\n\t" // leaves the carry alone
+        "adc    %B0, r1"       "\n\t"
+    :"+r"(__mwc8_f9_state)
+    :"r"((uint8_t)0xF9));
+    return (uint8_t)__mwc8_f9_state;
+  #else
+    uint16_t t = (uint8_t)__mwc8_f9_state * (uint16_t)0xF9 + (__mwc8_f9_state >> 8);
+    __mwc8_f9_state = t;
+    return (uint8_t)t;
+  #endif
+}
+
+/* r18 stands in for the zero register, which MUL overwrites, so it's only cleared once at the
+ * end. 5 clocks of math and a store for each byte, plus 2 for the loop. */
+void mwc8_f9_fill(uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  #if defined(__AVR_HAVE_MUL__)
+    __asm__ __volatile__(
+        "clr    r18"           "\n\t"
+        "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+        "ror    %B2"           "\n\t"
+        "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+        "brcc   2f"            "\n\t" // odd n: enter at the second copy
+      "1:"                             "\n\t"
+        "mul    %A0, %3"       "\n\t"
+        "add    r0, %B0"       "\n\t"
+        "movw   %A0, r0"       "\n\t"
+        "adc    %B0, r18"      "\n\t"
+        "st     X+, %A0"       "\n\t"
+      "2:"                             "\n\t"
+        "mul    %A0, %3"       "\n\t"
+        "add    r0, %B0"       "\n\t"
+        "movw   %A0, r0"       "\n\t"
+        "adc    %B0, r18"      "\n\t"
+        "st     X+, %A0"       "\n\t"
+        "sbiw   %2, 1"         "\n\t"
+        "brne   1b"            "\n\t"
+        "clr    r1"            "\n\t"
+    :"+r"(__mwc8_f9_state), "+x"(dst), "+w"(n)
+    :"r"((uint8_t)0xF9)
+    :"r18","memory");
+  #else
+    while (n--) {
+      *dst++ = mwc8_f9();
+    }
+  #endif
+}
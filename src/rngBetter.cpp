@@ -1,3 +1,4 @@
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
 uint16_t rng16::ADCtoSeed(uint16_t reading, uint8_t length) {
     uint16_t tempseed = 1;
@@ -102,7 +103,54 @@ uint16_t rng16::ADCtoSeed(uint16_t reading, uint8_t length) {
     uint16_t tempseed = ADCtoSeed(reading, length);
     return tempseed ^ tickcount;
   }
+  /* 32-bit versions. Up to 16 bits, the reading is spread out as above, and the high word gets a
+   * byte-swapped, inverted copy of it, because an xorshift32 seeded with only the low bits set
+   * takes several steps to get the high bits going. Longer readings (accumulations of 17 to 32
+   * bits) keep the extra bits in the high word, with the swapped low word xored over them. */
+  uint32_t rng32::ADCtoSeed(uint32_t reading, uint8_t length) {
+    if (length > 32) {
+      return 0;
+    }
+    uint16_t low = rng16::ADCtoSeed((uint16_t)reading, length > 16 ? 16 : length);
+    if (!low) {
+      return 0;
+    }
+    uint16_t high = (low << 8) | (low >> 8);
+    if (length > 16) {
+      high ^= (uint16_t)(reading >> 16);
+    } else {
+      high = ~high;
+    }
+    return ((uint32_t)high << 16) | low;
+  }
+  uint32_t rng32::timeADCtoSeed(uint32_t reading, uint8_t length, uint32_t tickcount) {
+    uint8_t tempval = 0;
+    __asm__ __volatile__( // same scramble as the 16-bit one, but the bytes are reversed so the fast changing low byte of the time lands in the high byte of the seed
+      "mov   r0,  %A0"    "\n\t"
+      "mov  %A0,  %D0"    "\n\t"
+      "mov  %D0,   r0"    "\n\t"
+      "mov   r0,  %B0"    "\n\t"
+      "mov  %B0,  %C0"    "\n\t"
+      "mov  %C0,   r0"    "\n\t"
+      "ldi  %1,  0x55"    "\n\t"
+      "swap %A0"          "\n\t"
+      "swap %B0"          "\n\t"
+      "swap %C0"          "\n\t"
+      "swap %D0"          "\n\t"
+      "eor  %A0,   %1"    "\n\t"
+      "eor  %C0,   %1"    "\n\t"
+      "com  %1"           "\n\t"
+      "eor  %B0,   %1"    "\n\t"
+      "eor  %D0,   %1"    "\n\t"
+    :"+r"(tickcount),
+     "+d"(tempval)
+    ::);
+    uint32_t tempseed = ADCtoSeed(reading, length);
+    return tempseed ^ tickcount;
+  }
 uint16_t __state = 0;
+static uint8_t __spare;      // the high byte of the last _byte() step
+uint8_t __spare_full;        // and whether it is still to be handed out; seed_xor16() clears it
 uint16_t xor16() {
   __asm__ __volatile__(
       "movw   r18, %A0"      "\n\t"
@@ -125,3 +173,284 @@ uint16_t xor16() {
   :"+d"((uint16_t)__state)::"r18","r19");
   return __state;
 }
+
+uint16_t xor16_star() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__state)::"r18","r19");
+  return rng16::star(__state);
+}
+
+static uint16_t __weyl_count;
+void seed_xor16_weyl(uint16_t seed) {
+  __state = seed ? seed : 1;
+  __weyl_count = seed;
+  __spare_full = 0;
+}
+
+uint16_t xor16_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__state), "+d"(__weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16(). */
+uint8_t xor16_byte() {
+  if (__spare_full) {
+    __spare_full = 0;
+    return __spare;
+  }
+  __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov     r18, %B0"     "\n\t"
+      "swap    r18"          "\n\t"
+      "lsr     r18"          "\n\t"
+      "andi    r18, 0x07"    "\n\t"
+      "eor     %A0, r18"     "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+  :"+d"((uint16_t)__state)::"r18","r19");
+  __spare = __state >> 8;
+  __spare_full = 1;
+  return __state;
+}
+
+/* n bytes, the same ones n calls to xor16_byte() would return; whole steps go through xor16_fill(). */
+void xor16_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __spare_full) {
+    __spare_full = 0;
+    *dst++ = __spare;
+    n--;
+  }
+  xor16_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_byte();
+  }
+}
+
+void xor16_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov     r18, %B0"     "\n\t"
+      "swap    r18"          "\n\t"
+      "lsr     r18"          "\n\t"
+      "andi    r18, 0x07"    "\n\t"
+      "eor     %A0, r18"     "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov     r18, %B0"     "\n\t"
+      "swap    r18"          "\n\t"
+      "lsr     r18"          "\n\t"
+      "andi    r18, 0x07"    "\n\t"
+      "eor     %A0, r18"     "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__state)::"r18","r19");
+  return __state;
+}
+
+uint32_t __state32 = 0;
+uint32_t xor32() {
+    __asm__ __volatile__(
+      "eor    %D0, %C0"      "\n\t"
+      "eor    %C0, %B0"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r19, %B0"      "\n\t"
+      "movw   r20, %C0"      "\n\t"
+      "lsr    r21"           "\n\t"
+      "ror    r20"           "\n\t"
+      "ror    r19"           "\n\t"
+      "eor    %A0, r19"      "\n\t"
+      "eor    %B0, r20"      "\n\t"
+      "eor    %C0, r21"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "clr    r0"            "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "ror    r0"            "\n\t"
+      "eor    %C0, r0"       "\n\t"
+      "eor    %D0, r18"      "\n\t"
+    :"+r"(__state32)::"r18","r19","r20","r21");
+  return __state32;
+}
+
+void xor32_fill(uint32_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "eor    %D0, %C0"      "\n\t"
+      "eor    %C0, %B0"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r19, %B0"      "\n\t"
+      "movw   r20, %C0"      "\n\t"
+      "lsr    r21"           "\n\t"
+      "ror    r20"           "\n\t"
+      "ror    r19"           "\n\t"
+      "eor    %A0, r19"      "\n\t"
+      "eor    %B0, r20"      "\n\t"
+      "eor    %C0, r21"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "clr    r0"            "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "ror    r0"            "\n\t"
+      "eor    %C0, r0"       "\n\t"
+      "eor    %D0, r18"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "st     X+, %C0"       "\n\t"
+      "st     X+, %D0"       "\n\t"
+    "2:"                             "\n\t"
+      "eor    %D0, %C0"      "\n\t"
+      "eor    %C0, %B0"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r19, %B0"      "\n\t"
+      "movw   r20, %C0"      "\n\t"
+      "lsr    r21"           "\n\t"
+      "ror    r20"           "\n\t"
+      "ror    r19"           "\n\t"
+      "eor    %A0, r19"      "\n\t"
+      "eor    %B0, r20"      "\n\t"
+      "eor    %C0, r21"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "clr    r0"            "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "ror    r0"            "\n\t"
+      "eor    %C0, r0"       "\n\t"
+      "eor    %D0, r18"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "st     X+, %C0"       "\n\t"
+      "st     X+, %D0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+r"(__state32), "+x"(dst), "+w"(n)::"r18","r19","r20","r21","memory");
+}
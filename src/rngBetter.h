@@ -1,16 +1,54 @@
 #ifndef rngBetter_h
 #define rngBetter_h
 #include <rngUtil.h>
+#include <rngXor16.h>
+#include <rngInfo.h>
 
+/* The library's own .cpp files define RNGBETTER_BUILDING_LIBRARY, and always get the out-of-line
+ * versions, so RNGBETTER_INLINE and RNGBETTER_SIZE can be set as global build flags as well as in
+ * a sketch. */
+#if defined(RNGBETTER_BUILDING_LIBRARY)
+  #undef RNGBETTER_INLINE
+  #undef RNGBETTER_SIZE
+#endif
+#if defined(RNGBETTER_INLINE) && defined(RNGBETTER_SIZE)
+  #error "RNGBETTER_INLINE and RNGBETTER_SIZE pull in opposite directions - define only one"
+#endif
 extern uint16_t __state;
+extern uint8_t __spare_full;
+uint16_t xor16_step_abc(uint16_t s, uint16_t abc);
+#if defined(RNGBETTER_INLINE)
+__attribute__((always_inline)) static inline uint16_t xor16() {
+  return __state = Xor16<3, 13, 9>::step(__state);
+}
+#elif defined(RNGBETTER_SIZE)
+uint16_t __xor16_step_at(uint16_t *state, uint16_t abc);
+static inline uint16_t xor16() {
+  return __xor16_step_at(&__state, 0x3d9);
+}
+#else
 uint16_t xor16();
+#endif
 inline bool seed_xor16(uint16_t seed) {
   if (seed) {
     __state = seed;
+    __spare_full = 0;
     return 1;
   }
   return 0;
 }
+uint16_t xor16_star();
+void seed_xor16_weyl(uint16_t seed);
+uint16_t xor16_weyl();
+uint8_t xor16_byte();
+void xor16_fill(uint16_t *dst, uint16_t n);
+void xor16_fill_bytes(uint8_t *dst, uint16_t n);
+uint16_t xor16_jump(uint16_t n);
+uint16_t xor16_prev();
+uint16_t xor16_position();
+void xor16_set_position(uint16_t pos);
+uint16_t __xor16_jump(uint16_t state, const uint16_t *table, uint16_t n);
+extern const uint16_t __xor16_3d9_jump_table[256] PROGMEM;
 inline uint16_t xor16(uint16_t seed) {
   if(__builtin_constant_p(seed)) {
     if(seed == 0) {
@@ -24,6 +62,46 @@ inline uint16_t xor16(uint16_t seed) {
   return xor16();
 }
 
+/* Bounded random numbers without division
+ * xor16_below(n) returns 0 to n-1, xor16_range(lo, hi) returns lo to hi-1 like random(lo, hi).
+ * These take the high word of xor16() * n, so some results come up one time in 65536 more
+ * often than others (at most n of them). The _exact versions reject the few raw values that
+ * cause that. They almost never need a second step, and only do a division when it might.
+ * Constant n are specialized: powers of 2 are just a shift, below 256 only needs 2 MULs. */
+uint16_t __xor16_below_exact(uint16_t n);
+__attribute__((always_inline)) inline uint16_t xor16_below(uint16_t n) {
+  if (__builtin_constant_p(n)) {
+    if (n == 0) {
+      badArg("xor16_below(0) has no valid result");
+    }
+    if (n == 1) {
+      return 0;
+    }
+    if (!(n & (n - 1))) {
+      return xor16() / (uint16_t)(0x10000UL / n); // top bits; the low nybble is the weakest
+    }
+  }
+  return rng16::scale(xor16(), n);
+}
+__attribute__((always_inline)) inline uint16_t xor16_below_exact(uint16_t n) {
+  if (__builtin_constant_p(n) && !(n & (n - 1))) {
+    return xor16_below(n);
+  }
+  return __xor16_below_exact(n);
+}
+__attribute__((always_inline)) inline int16_t xor16_range(int16_t lo, int16_t hi) {
+  if (hi <= lo) {
+    return lo;
+  }
+  return lo + xor16_below((uint16_t) hi - (uint16_t) lo);
+}
+__attribute__((always_inline)) inline int16_t xor16_range_exact(int16_t lo, int16_t hi) {
+  if (hi <= lo) {
+    return lo;
+  }
+  return lo + xor16_below_exact((uint16_t) hi - (uint16_t) lo);
+}
+
 
 
 /* And now for the complete list of full length RNGs. Someare bad. some are good. */
@@ -90,6 +168,11 @@ bool seed_xor16_f13(uint16_t seed);
 bool seed_xor16_f52(uint16_t seed);
 bool seed_xor16_f72(uint16_t seed);
 
+#if defined(RNGBETTER_INLINE)
+#include <rngInline.h>
+#elif defined(RNGBETTER_SIZE)
+#include <rngSize.h>
+#else
 uint16_t xor16_11e();
 uint16_t xor16_11f();
 uint16_t xor16_152();
@@ -150,6 +233,1038 @@ uint16_t xor16_f11();
 uint16_t xor16_f13();
 uint16_t xor16_f52();
 uint16_t xor16_f72();
+#endif
+
+/* Bulk fill: writes n consecutive outputs of the generator to dst. The state is loaded once, the
+ * loop runs entirely in registers and the state is written back once at the end, so each word
+ * costs only the shift/xor math plus the two stores and a share of the loop counter.
+ * Leaves the generator in the same state as n calls to the corresponding xor16_xxx() would. */
+void xor16_11e_fill(uint16_t *dst, uint16_t n);
+void xor16_11f_fill(uint16_t *dst, uint16_t n);
+void xor16_152_fill(uint16_t *dst, uint16_t n);
+void xor16_174_fill(uint16_t *dst, uint16_t n);
+void xor16_17b_fill(uint16_t *dst, uint16_t n);
+void xor16_1b3_fill(uint16_t *dst, uint16_t n);
+void xor16_1f6_fill(uint16_t *dst, uint16_t n);
+void xor16_1f7_fill(uint16_t *dst, uint16_t n);
+void xor16_251_fill(uint16_t *dst, uint16_t n);
+void xor16_25d_fill(uint16_t *dst, uint16_t n);
+void xor16_25f_fill(uint16_t *dst, uint16_t n);
+void xor16_27d_fill(uint16_t *dst, uint16_t n);
+void xor16_27f_fill(uint16_t *dst, uint16_t n);
+void xor16_31c_fill(uint16_t *dst, uint16_t n);
+void xor16_31f_fill(uint16_t *dst, uint16_t n);
+void xor16_35b_fill(uint16_t *dst, uint16_t n);
+void xor16_3b1_fill(uint16_t *dst, uint16_t n);
+void xor16_3bb_fill(uint16_t *dst, uint16_t n);
+void xor16_3d9_fill(uint16_t *dst, uint16_t n);
+void xor16_437_fill(uint16_t *dst, uint16_t n);
+void xor16_471_fill(uint16_t *dst, uint16_t n);
+void xor16_4bb_fill(uint16_t *dst, uint16_t n);
+void xor16_57e_fill(uint16_t *dst, uint16_t n);
+void xor16_598_fill(uint16_t *dst, uint16_t n);
+void xor16_5b6_fill(uint16_t *dst, uint16_t n);
+void xor16_5bb_fill(uint16_t *dst, uint16_t n);
+void xor16_67d_fill(uint16_t *dst, uint16_t n);
+void xor16_6b5_fill(uint16_t *dst, uint16_t n);
+void xor16_6f1_fill(uint16_t *dst, uint16_t n);
+void xor16_71b_fill(uint16_t *dst, uint16_t n);
+void xor16_734_fill(uint16_t *dst, uint16_t n);
+void xor16_798_fill(uint16_t *dst, uint16_t n);
+void xor16_79d_fill(uint16_t *dst, uint16_t n);
+void xor16_7f1_fill(uint16_t *dst, uint16_t n);
+void xor16_895_fill(uint16_t *dst, uint16_t n);
+void xor16_897_fill(uint16_t *dst, uint16_t n);
+void xor16_97d_fill(uint16_t *dst, uint16_t n);
+void xor16_9d3_fill(uint16_t *dst, uint16_t n);
+void xor16_b17_fill(uint16_t *dst, uint16_t n);
+void xor16_b3d_fill(uint16_t *dst, uint16_t n);
+void xor16_b53_fill(uint16_t *dst, uint16_t n);
+void xor16_b71_fill(uint16_t *dst, uint16_t n);
+void xor16_bb3_fill(uint16_t *dst, uint16_t n);
+void xor16_bb4_fill(uint16_t *dst, uint16_t n);
+void xor16_bb5_fill(uint16_t *dst, uint16_t n);
+void xor16_c13_fill(uint16_t *dst, uint16_t n);
+void xor16_c3d_fill(uint16_t *dst, uint16_t n);
+void xor16_d3b_fill(uint16_t *dst, uint16_t n);
+void xor16_d3c_fill(uint16_t *dst, uint16_t n);
+void xor16_d52_fill(uint16_t *dst, uint16_t n);
+void xor16_d72_fill(uint16_t *dst, uint16_t n);
+void xor16_d76_fill(uint16_t *dst, uint16_t n);
+void xor16_d79_fill(uint16_t *dst, uint16_t n);
+void xor16_d97_fill(uint16_t *dst, uint16_t n);
+void xor16_e11_fill(uint16_t *dst, uint16_t n);
+void xor16_e75_fill(uint16_t *dst, uint16_t n);
+void xor16_f11_fill(uint16_t *dst, uint16_t n);
+void xor16_f13_fill(uint16_t *dst, uint16_t n);
+void xor16_f52_fill(uint16_t *dst, uint16_t n);
+void xor16_f72_fill(uint16_t *dst, uint16_t n);
+
+/* Jump ahead: leaves the generator in the state n calls would have, and returns the value the
+ * last of them would have returned, in at most about 3700 clocks instead of up to 65535 steps.
+ * Each one carries a 512 byte table in flash, which is only linked in if you use it. */
+uint16_t xor16_11e_jump(uint16_t n);
+uint16_t xor16_11f_jump(uint16_t n);
+uint16_t xor16_152_jump(uint16_t n);
+uint16_t xor16_174_jump(uint16_t n);
+uint16_t xor16_17b_jump(uint16_t n);
+uint16_t xor16_1b3_jump(uint16_t n);
+uint16_t xor16_1f6_jump(uint16_t n);
+uint16_t xor16_1f7_jump(uint16_t n);
+uint16_t xor16_251_jump(uint16_t n);
+uint16_t xor16_25d_jump(uint16_t n);
+uint16_t xor16_25f_jump(uint16_t n);
+uint16_t xor16_27d_jump(uint16_t n);
+uint16_t xor16_27f_jump(uint16_t n);
+uint16_t xor16_31c_jump(uint16_t n);
+uint16_t xor16_31f_jump(uint16_t n);
+uint16_t xor16_35b_jump(uint16_t n);
+uint16_t xor16_3b1_jump(uint16_t n);
+uint16_t xor16_3bb_jump(uint16_t n);
+uint16_t xor16_3d9_jump(uint16_t n);
+uint16_t xor16_437_jump(uint16_t n);
+uint16_t xor16_471_jump(uint16_t n);
+uint16_t xor16_4bb_jump(uint16_t n);
+uint16_t xor16_57e_jump(uint16_t n);
+uint16_t xor16_598_jump(uint16_t n);
+uint16_t xor16_5b6_jump(uint16_t n);
+uint16_t xor16_5bb_jump(uint16_t n);
+uint16_t xor16_67d_jump(uint16_t n);
+uint16_t xor16_6b5_jump(uint16_t n);
+uint16_t xor16_6f1_jump(uint16_t n);
+uint16_t xor16_71b_jump(uint16_t n);
+uint16_t xor16_734_jump(uint16_t n);
+uint16_t xor16_798_jump(uint16_t n);
+uint16_t xor16_79d_jump(uint16_t n);
+uint16_t xor16_7f1_jump(uint16_t n);
+uint16_t xor16_895_jump(uint16_t n);
+uint16_t xor16_897_jump(uint16_t n);
+uint16_t xor16_97d_jump(uint16_t n);
+uint16_t xor16_9d3_jump(uint16_t n);
+uint16_t xor16_b17_jump(uint16_t n);
+uint16_t xor16_b3d_jump(uint16_t n);
+uint16_t xor16_b53_jump(uint16_t n);
+uint16_t xor16_b71_jump(uint16_t n);
+uint16_t xor16_bb3_jump(uint16_t n);
+uint16_t xor16_bb4_jump(uint16_t n);
+uint16_t xor16_bb5_jump(uint16_t n);
+uint16_t xor16_c13_jump(uint16_t n);
+uint16_t xor16_c3d_jump(uint16_t n);
+uint16_t xor16_d3b_jump(uint16_t n);
+uint16_t xor16_d3c_jump(uint16_t n);
+uint16_t xor16_d52_jump(uint16_t n);
+uint16_t xor16_d72_jump(uint16_t n);
+uint16_t xor16_d76_jump(uint16_t n);
+uint16_t xor16_d79_jump(uint16_t n);
+uint16_t xor16_d97_jump(uint16_t n);
+uint16_t xor16_e11_jump(uint16_t n);
+uint16_t xor16_e75_jump(uint16_t n);
+uint16_t xor16_f11_jump(uint16_t n);
+uint16_t xor16_f13_jump(uint16_t n);
+uint16_t xor16_f52_jump(uint16_t n);
+uint16_t xor16_f72_jump(uint16_t n);
 
+/* Substreams: call on every controller right after seeding them all with the same seed. Each
+ * controller id of count jumps to id * (65535 / count) steps into the shared cycle, so each one
+ * gets at least 65535 / count values before it reaches the next one's starting point. An id of
+ * count or more doesn't jump at all, rather than wrapping into the middle of another range. */
+__attribute__((always_inline)) inline uint16_t __xor16_substream_offset(uint8_t id, uint8_t count) {
+  if (__builtin_constant_p(count) && count == 0) {
+    badArg("substream count must be at least 1");
+  }
+  if (__builtin_constant_p(id) && __builtin_constant_p(count) && id >= count) {
+    badArg("substream id must be less than the number of substreams");
+  }
+  if (id >= count) {
+    return 0;
+  }
+  return id * (65535U / count);
+}
+inline uint16_t xor16_substream(uint8_t id, uint8_t count) {
+  return xor16_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_11e_substream(uint8_t id, uint8_t count) {
+  return xor16_11e_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_11f_substream(uint8_t id, uint8_t count) {
+  return xor16_11f_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_152_substream(uint8_t id, uint8_t count) {
+  return xor16_152_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_174_substream(uint8_t id, uint8_t count) {
+  return xor16_174_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_17b_substream(uint8_t id, uint8_t count) {
+  return xor16_17b_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_1b3_substream(uint8_t id, uint8_t count) {
+  return xor16_1b3_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_1f6_substream(uint8_t id, uint8_t count) {
+  return xor16_1f6_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_1f7_substream(uint8_t id, uint8_t count) {
+  return xor16_1f7_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_251_substream(uint8_t id, uint8_t count) {
+  return xor16_251_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_25d_substream(uint8_t id, uint8_t count) {
+  return xor16_25d_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_25f_substream(uint8_t id, uint8_t count) {
+  return xor16_25f_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_27d_substream(uint8_t id, uint8_t count) {
+  return xor16_27d_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_27f_substream(uint8_t id, uint8_t count) {
+  return xor16_27f_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_31c_substream(uint8_t id, uint8_t count) {
+  return xor16_31c_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_31f_substream(uint8_t id, uint8_t count) {
+  return xor16_31f_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_35b_substream(uint8_t id, uint8_t count) {
+  return xor16_35b_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_3b1_substream(uint8_t id, uint8_t count) {
+  return xor16_3b1_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_3bb_substream(uint8_t id, uint8_t count) {
+  return xor16_3bb_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_3d9_substream(uint8_t id, uint8_t count) {
+  return xor16_3d9_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_437_substream(uint8_t id, uint8_t count) {
+  return xor16_437_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_471_substream(uint8_t id, uint8_t count) {
+  return xor16_471_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_4bb_substream(uint8_t id, uint8_t count) {
+  return xor16_4bb_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_57e_substream(uint8_t id, uint8_t count) {
+  return xor16_57e_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_598_substream(uint8_t id, uint8_t count) {
+  return xor16_598_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_5b6_substream(uint8_t id, uint8_t count) {
+  return xor16_5b6_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_5bb_substream(uint8_t id, uint8_t count) {
+  return xor16_5bb_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_67d_substream(uint8_t id, uint8_t count) {
+  return xor16_67d_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_6b5_substream(uint8_t id, uint8_t count) {
+  return xor16_6b5_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_6f1_substream(uint8_t id, uint8_t count) {
+  return xor16_6f1_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_71b_substream(uint8_t id, uint8_t count) {
+  return xor16_71b_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_734_substream(uint8_t id, uint8_t count) {
+  return xor16_734_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_798_substream(uint8_t id, uint8_t count) {
+  return xor16_798_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_79d_substream(uint8_t id, uint8_t count) {
+  return xor16_79d_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_7f1_substream(uint8_t id, uint8_t count) {
+  return xor16_7f1_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_895_substream(uint8_t id, uint8_t count) {
+  return xor16_895_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_897_substream(uint8_t id, uint8_t count) {
+  return xor16_897_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_97d_substream(uint8_t id, uint8_t count) {
+  return xor16_97d_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_9d3_substream(uint8_t id, uint8_t count) {
+  return xor16_9d3_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_b17_substream(uint8_t id, uint8_t count) {
+  return xor16_b17_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_b3d_substream(uint8_t id, uint8_t count) {
+  return xor16_b3d_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_b53_substream(uint8_t id, uint8_t count) {
+  return xor16_b53_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_b71_substream(uint8_t id, uint8_t count) {
+  return xor16_b71_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_bb3_substream(uint8_t id, uint8_t count) {
+  return xor16_bb3_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_bb4_substream(uint8_t id, uint8_t count) {
+  return xor16_bb4_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_bb5_substream(uint8_t id, uint8_t count) {
+  return xor16_bb5_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_c13_substream(uint8_t id, uint8_t count) {
+  return xor16_c13_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_c3d_substream(uint8_t id, uint8_t count) {
+  return xor16_c3d_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_d3b_substream(uint8_t id, uint8_t count) {
+  return xor16_d3b_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_d3c_substream(uint8_t id, uint8_t count) {
+  return xor16_d3c_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_d52_substream(uint8_t id, uint8_t count) {
+  return xor16_d52_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_d72_substream(uint8_t id, uint8_t count) {
+  return xor16_d72_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_d76_substream(uint8_t id, uint8_t count) {
+  return xor16_d76_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_d79_substream(uint8_t id, uint8_t count) {
+  return xor16_d79_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_d97_substream(uint8_t id, uint8_t count) {
+  return xor16_d97_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_e11_substream(uint8_t id, uint8_t count) {
+  return xor16_e11_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_e75_substream(uint8_t id, uint8_t count) {
+  return xor16_e75_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_f11_substream(uint8_t id, uint8_t count) {
+  return xor16_f11_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_f13_substream(uint8_t id, uint8_t count) {
+  return xor16_f13_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_f52_substream(uint8_t id, uint8_t count) {
+  return xor16_f52_jump(__xor16_substream_offset(id, count));
+}
+inline uint16_t xor16_f72_substream(uint8_t id, uint8_t count) {
+  return xor16_f72_jump(__xor16_substream_offset(id, count));
+}
+
+/* Step backwards: returns the state from before the last step, which is what the generator
+ * returned the call before last. Undoing y ^= y << k takes shifts of k, 2k, 4k ... so these
+ * cost about the same as the forward step when the shifts are big, and up to 3x when small. */
+uint16_t xor16_11e_prev();
+uint16_t xor16_11f_prev();
+uint16_t xor16_152_prev();
+uint16_t xor16_174_prev();
+uint16_t xor16_17b_prev();
+uint16_t xor16_1b3_prev();
+uint16_t xor16_1f6_prev();
+uint16_t xor16_1f7_prev();
+uint16_t xor16_251_prev();
+uint16_t xor16_25d_prev();
+uint16_t xor16_25f_prev();
+uint16_t xor16_27d_prev();
+uint16_t xor16_27f_prev();
+uint16_t xor16_31c_prev();
+uint16_t xor16_31f_prev();
+uint16_t xor16_35b_prev();
+uint16_t xor16_3b1_prev();
+uint16_t xor16_3bb_prev();
+uint16_t xor16_3d9_prev();
+uint16_t xor16_437_prev();
+uint16_t xor16_471_prev();
+uint16_t xor16_4bb_prev();
+uint16_t xor16_57e_prev();
+uint16_t xor16_598_prev();
+uint16_t xor16_5b6_prev();
+uint16_t xor16_5bb_prev();
+uint16_t xor16_67d_prev();
+uint16_t xor16_6b5_prev();
+uint16_t xor16_6f1_prev();
+uint16_t xor16_71b_prev();
+uint16_t xor16_734_prev();
+uint16_t xor16_798_prev();
+uint16_t xor16_79d_prev();
+uint16_t xor16_7f1_prev();
+uint16_t xor16_895_prev();
+uint16_t xor16_897_prev();
+uint16_t xor16_97d_prev();
+uint16_t xor16_9d3_prev();
+uint16_t xor16_b17_prev();
+uint16_t xor16_b3d_prev();
+uint16_t xor16_b53_prev();
+uint16_t xor16_b71_prev();
+uint16_t xor16_bb3_prev();
+uint16_t xor16_bb4_prev();
+uint16_t xor16_bb5_prev();
+uint16_t xor16_c13_prev();
+uint16_t xor16_c3d_prev();
+uint16_t xor16_d3b_prev();
+uint16_t xor16_d3c_prev();
+uint16_t xor16_d52_prev();
+uint16_t xor16_d72_prev();
+uint16_t xor16_d76_prev();
+uint16_t xor16_d79_prev();
+uint16_t xor16_d97_prev();
+uint16_t xor16_e11_prev();
+uint16_t xor16_e75_prev();
+uint16_t xor16_f11_prev();
+uint16_t xor16_f13_prev();
+uint16_t xor16_f52_prev();
+uint16_t xor16_f72_prev();
+
+/* Position in the cycle, counted in steps from a state of 1 (0 to 65534; 0xFFFF if the
+ * generator hasn't been seeded). set_position() is bounded at 255 steps, position() at 255
+ * steps and lookups. Each generator brings a 768 byte checkpoint table, only if these are used. */
+uint16_t __xor16_position(uint16_t state, uint16_t (*gen)(), const uint16_t *checkpoints, const uint8_t *order);
+void __xor16_set_position(uint16_t pos, bool (*seed)(uint16_t), uint16_t (*gen)(), const uint16_t *checkpoints);
+extern const uint16_t __xor16_3d9_checkpoints[256] PROGMEM;
+extern const uint8_t __xor16_3d9_order[256] PROGMEM;
+uint16_t xor16_11e_position();
+void xor16_11e_set_position(uint16_t pos);
+uint16_t xor16_11f_position();
+void xor16_11f_set_position(uint16_t pos);
+uint16_t xor16_152_position();
+void xor16_152_set_position(uint16_t pos);
+uint16_t xor16_174_position();
+void xor16_174_set_position(uint16_t pos);
+uint16_t xor16_17b_position();
+void xor16_17b_set_position(uint16_t pos);
+uint16_t xor16_1b3_position();
+void xor16_1b3_set_position(uint16_t pos);
+uint16_t xor16_1f6_position();
+void xor16_1f6_set_position(uint16_t pos);
+uint16_t xor16_1f7_position();
+void xor16_1f7_set_position(uint16_t pos);
+uint16_t xor16_251_position();
+void xor16_251_set_position(uint16_t pos);
+uint16_t xor16_25d_position();
+void xor16_25d_set_position(uint16_t pos);
+uint16_t xor16_25f_position();
+void xor16_25f_set_position(uint16_t pos);
+uint16_t xor16_27d_position();
+void xor16_27d_set_position(uint16_t pos);
+uint16_t xor16_27f_position();
+void xor16_27f_set_position(uint16_t pos);
+uint16_t xor16_31c_position();
+void xor16_31c_set_position(uint16_t pos);
+uint16_t xor16_31f_position();
+void xor16_31f_set_position(uint16_t pos);
+uint16_t xor16_35b_position();
+void xor16_35b_set_position(uint16_t pos);
+uint16_t xor16_3b1_position();
+void xor16_3b1_set_position(uint16_t pos);
+uint16_t xor16_3bb_position();
+void xor16_3bb_set_position(uint16_t pos);
+uint16_t xor16_3d9_position();
+void xor16_3d9_set_position(uint16_t pos);
+uint16_t xor16_437_position();
+void xor16_437_set_position(uint16_t pos);
+uint16_t xor16_471_position();
+void xor16_471_set_position(uint16_t pos);
+uint16_t xor16_4bb_position();
+void xor16_4bb_set_position(uint16_t pos);
+uint16_t xor16_57e_position();
+void xor16_57e_set_position(uint16_t pos);
+uint16_t xor16_598_position();
+void xor16_598_set_position(uint16_t pos);
+uint16_t xor16_5b6_position();
+void xor16_5b6_set_position(uint16_t pos);
+uint16_t xor16_5bb_position();
+void xor16_5bb_set_position(uint16_t pos);
+uint16_t xor16_67d_position();
+void xor16_67d_set_position(uint16_t pos);
+uint16_t xor16_6b5_position();
+void xor16_6b5_set_position(uint16_t pos);
+uint16_t xor16_6f1_position();
+void xor16_6f1_set_position(uint16_t pos);
+uint16_t xor16_71b_position();
+void xor16_71b_set_position(uint16_t pos);
+uint16_t xor16_734_position();
+void xor16_734_set_position(uint16_t pos);
+uint16_t xor16_798_position();
+void xor16_798_set_position(uint16_t pos);
+uint16_t xor16_79d_position();
+void xor16_79d_set_position(uint16_t pos);
+uint16_t xor16_7f1_position();
+void xor16_7f1_set_position(uint16_t pos);
+uint16_t xor16_895_position();
+void xor16_895_set_position(uint16_t pos);
+uint16_t xor16_897_position();
+void xor16_897_set_position(uint16_t pos);
+uint16_t xor16_97d_position();
+void xor16_97d_set_position(uint16_t pos);
+uint16_t xor16_9d3_position();
+void xor16_9d3_set_position(uint16_t pos);
+uint16_t xor16_b17_position();
+void xor16_b17_set_position(uint16_t pos);
+uint16_t xor16_b3d_position();
+void xor16_b3d_set_position(uint16_t pos);
+uint16_t xor16_b53_position();
+void xor16_b53_set_position(uint16_t pos);
+uint16_t xor16_b71_position();
+void xor16_b71_set_position(uint16_t pos);
+uint16_t xor16_bb3_position();
+void xor16_bb3_set_position(uint16_t pos);
+uint16_t xor16_bb4_position();
+void xor16_bb4_set_position(uint16_t pos);
+uint16_t xor16_bb5_position();
+void xor16_bb5_set_position(uint16_t pos);
+uint16_t xor16_c13_position();
+void xor16_c13_set_position(uint16_t pos);
+uint16_t xor16_c3d_position();
+void xor16_c3d_set_position(uint16_t pos);
+uint16_t xor16_d3b_position();
+void xor16_d3b_set_position(uint16_t pos);
+uint16_t xor16_d3c_position();
+void xor16_d3c_set_position(uint16_t pos);
+uint16_t xor16_d52_position();
+void xor16_d52_set_position(uint16_t pos);
+uint16_t xor16_d72_position();
+void xor16_d72_set_position(uint16_t pos);
+uint16_t xor16_d76_position();
+void xor16_d76_set_position(uint16_t pos);
+uint16_t xor16_d79_position();
+void xor16_d79_set_position(uint16_t pos);
+uint16_t xor16_d97_position();
+void xor16_d97_set_position(uint16_t pos);
+uint16_t xor16_e11_position();
+void xor16_e11_set_position(uint16_t pos);
+uint16_t xor16_e75_position();
+void xor16_e75_set_position(uint16_t pos);
+uint16_t xor16_f11_position();
+void xor16_f11_set_position(uint16_t pos);
+uint16_t xor16_f13_position();
+void xor16_f13_set_position(uint16_t pos);
+uint16_t xor16_f52_position();
+void xor16_f52_set_position(uint16_t pos);
+uint16_t xor16_f72_position();
+void xor16_f72_set_position(uint16_t pos);
+
+/* The swap family: full period generators built from nybble swaps, byte xors and 1-bit shifts
+ * instead of three shifts. 8 or 9 clocks of math, and they rate as well as the best of the 60. */
+bool seed_xor16_sw1(uint16_t seed);
+bool seed_xor16_sw2(uint16_t seed);
+bool seed_xor16_sw3(uint16_t seed);
+bool seed_xor16_sw4(uint16_t seed);
+uint16_t xor16_sw1();
+uint16_t xor16_sw2();
+uint16_t xor16_sw3();
+uint16_t xor16_sw4();
+void xor16_sw1_fill(uint16_t *dst, uint16_t n);
+void xor16_sw2_fill(uint16_t *dst, uint16_t n);
+void xor16_sw3_fill(uint16_t *dst, uint16_t n);
+void xor16_sw4_fill(uint16_t *dst, uint16_t n);
+
+/* Scrambled output (xorshift*): the same step as xor16_xxx(), sharing its state, but the value
+ * returned is rng16::star() of the new state. For the generators recommended in the appendices
+ * plus the fastest ones, 798 and 897. */
+uint16_t xor16_17b_star();
+uint16_t xor16_3bb_star();
+uint16_t xor16_3d9_star();
+uint16_t xor16_4bb_star();
+uint16_t xor16_598_star();
+uint16_t xor16_798_star();
+uint16_t xor16_895_star();
+uint16_t xor16_897_star();
+uint16_t xor16_9d3_star();
+uint16_t xor16_b71_star();
+uint16_t xor16_bb4_star();
+uint16_t xor16_d3b_star();
+
+/* Weyl variants: the same step as xor16_xxx(), sharing its state, with a 16-bit counter that goes
+ * up by 0x7F4B every call added to the output. The period is 65535 * 65536, and every seed is
+ * valid - a seed of 0 starts the xorshift at 1 with the counter at 0. */
+void seed_xor16_17b_weyl(uint16_t seed);
+void seed_xor16_3bb_weyl(uint16_t seed);
+void seed_xor16_3d9_weyl(uint16_t seed);
+void seed_xor16_4bb_weyl(uint16_t seed);
+void seed_xor16_598_weyl(uint16_t seed);
+void seed_xor16_798_weyl(uint16_t seed);
+void seed_xor16_895_weyl(uint16_t seed);
+void seed_xor16_897_weyl(uint16_t seed);
+void seed_xor16_9d3_weyl(uint16_t seed);
+void seed_xor16_b71_weyl(uint16_t seed);
+void seed_xor16_bb4_weyl(uint16_t seed);
+void seed_xor16_d3b_weyl(uint16_t seed);
+uint16_t xor16_17b_weyl();
+uint16_t xor16_3bb_weyl();
+uint16_t xor16_3d9_weyl();
+uint16_t xor16_4bb_weyl();
+uint16_t xor16_598_weyl();
+uint16_t xor16_798_weyl();
+uint16_t xor16_895_weyl();
+uint16_t xor16_897_weyl();
+uint16_t xor16_9d3_weyl();
+uint16_t xor16_b71_weyl();
+uint16_t xor16_bb4_weyl();
+uint16_t xor16_d3b_weyl();
+
+/* Bytes: each step of the generator is used for two calls, the low byte first, then the high
+ * byte, which is kept until the next call. Same state as xor16_xxx(). The fills return the same
+ * bytes as that many _byte() calls, and can be mixed with them freely. */
+uint8_t xor16_17b_byte();
+uint8_t xor16_3bb_byte();
+uint8_t xor16_3d9_byte();
+uint8_t xor16_4bb_byte();
+uint8_t xor16_598_byte();
+uint8_t xor16_798_byte();
+uint8_t xor16_895_byte();
+uint8_t xor16_897_byte();
+uint8_t xor16_9d3_byte();
+uint8_t xor16_b71_byte();
+uint8_t xor16_bb4_byte();
+uint8_t xor16_d3b_byte();
+void xor16_17b_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_3bb_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_3d9_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_4bb_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_598_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_798_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_895_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_897_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_9d3_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_b71_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_bb4_fill_bytes(uint8_t *dst, uint16_t n);
+void xor16_d3b_fill_bytes(uint8_t *dst, uint16_t n);
+
+/* Register-only steps: the same math as xor16_xxx(), on a state you pass in, with no global
+ * state behind it. In a loop, keep the state in a local and it stays in registers; the last output
+ * of xor16_xxx() is its state, and seed_xor16_xxx() puts it back:
+ *   uint16_t s = xor16_598(); while (...) { s = xor16_598_step(s); ... } seed_xor16_598(s); */
+static inline uint16_t xor16_step(uint16_t s) {
+  return Xor16<3, 13, 9>::step(s);
+}
+static inline uint16_t xor16_11e_step(uint16_t s) {
+  return Xor16<1, 1, 14>::step(s);
+}
+static inline uint16_t xor16_11f_step(uint16_t s) {
+  return Xor16<1, 1, 15>::step(s);
+}
+static inline uint16_t xor16_152_step(uint16_t s) {
+  return Xor16<1, 5, 2>::step(s);
+}
+static inline uint16_t xor16_174_step(uint16_t s) {
+  return Xor16<1, 7, 4>::step(s);
+}
+static inline uint16_t xor16_17b_step(uint16_t s) {
+  return Xor16<1, 7, 11>::step(s);
+}
+static inline uint16_t xor16_1b3_step(uint16_t s) {
+  return Xor16<1, 11, 3>::step(s);
+}
+static inline uint16_t xor16_1f6_step(uint16_t s) {
+  return Xor16<1, 15, 6>::step(s);
+}
+static inline uint16_t xor16_1f7_step(uint16_t s) {
+  return Xor16<1, 15, 7>::step(s);
+}
+static inline uint16_t xor16_251_step(uint16_t s) {
+  return Xor16<2, 5, 1>::step(s);
+}
+static inline uint16_t xor16_25d_step(uint16_t s) {
+  return Xor16<2, 5, 13>::step(s);
+}
+static inline uint16_t xor16_25f_step(uint16_t s) {
+  return Xor16<2, 5, 15>::step(s);
+}
+static inline uint16_t xor16_27d_step(uint16_t s) {
+  return Xor16<2, 7, 13>::step(s);
+}
+static inline uint16_t xor16_27f_step(uint16_t s) {
+  return Xor16<2, 7, 15>::step(s);
+}
+static inline uint16_t xor16_31c_step(uint16_t s) {
+  return Xor16<3, 1, 12>::step(s);
+}
+static inline uint16_t xor16_31f_step(uint16_t s) {
+  return Xor16<3, 1, 15>::step(s);
+}
+static inline uint16_t xor16_35b_step(uint16_t s) {
+  return Xor16<3, 5, 11>::step(s);
+}
+static inline uint16_t xor16_3b1_step(uint16_t s) {
+  return Xor16<3, 11, 1>::step(s);
+}
+static inline uint16_t xor16_3bb_step(uint16_t s) {
+  return Xor16<3, 11, 11>::step(s);
+}
+static inline uint16_t xor16_3d9_step(uint16_t s) {
+  return Xor16<3, 13, 9>::step(s);
+}
+static inline uint16_t xor16_437_step(uint16_t s) {
+  return Xor16<4, 3, 7>::step(s);
+}
+static inline uint16_t xor16_471_step(uint16_t s) {
+  return Xor16<4, 7, 1>::step(s);
+}
+static inline uint16_t xor16_4bb_step(uint16_t s) {
+  return Xor16<4, 11, 11>::step(s);
+}
+static inline uint16_t xor16_57e_step(uint16_t s) {
+  return Xor16<5, 7, 14>::step(s);
+}
+static inline uint16_t xor16_598_step(uint16_t s) {
+  return Xor16<5, 9, 8>::step(s);
+}
+static inline uint16_t xor16_5b6_step(uint16_t s) {
+  return Xor16<5, 11, 6>::step(s);
+}
+static inline uint16_t xor16_5bb_step(uint16_t s) {
+  return Xor16<5, 11, 11>::step(s);
+}
+static inline uint16_t xor16_67d_step(uint16_t s) {
+  return Xor16<6, 7, 13>::step(s);
+}
+static inline uint16_t xor16_6b5_step(uint16_t s) {
+  return Xor16<6, 11, 5>::step(s);
+}
+static inline uint16_t xor16_6f1_step(uint16_t s) {
+  return Xor16<6, 15, 1>::step(s);
+}
+static inline uint16_t xor16_71b_step(uint16_t s) {
+  return Xor16<7, 1, 11>::step(s);
+}
+static inline uint16_t xor16_734_step(uint16_t s) {
+  return Xor16<7, 3, 4>::step(s);
+}
+static inline uint16_t xor16_798_step(uint16_t s) {
+  return Xor16<7, 9, 8>::step(s);
+}
+static inline uint16_t xor16_79d_step(uint16_t s) {
+  return Xor16<7, 9, 13>::step(s);
+}
+static inline uint16_t xor16_7f1_step(uint16_t s) {
+  return Xor16<7, 15, 1>::step(s);
+}
+static inline uint16_t xor16_895_step(uint16_t s) {
+  return Xor16<8, 9, 5>::step(s);
+}
+static inline uint16_t xor16_897_step(uint16_t s) {
+  return Xor16<8, 9, 7>::step(s);
+}
+static inline uint16_t xor16_97d_step(uint16_t s) {
+  return Xor16<9, 7, 13>::step(s);
+}
+static inline uint16_t xor16_9d3_step(uint16_t s) {
+  return Xor16<9, 13, 3>::step(s);
+}
+static inline uint16_t xor16_b17_step(uint16_t s) {
+  return Xor16<11, 1, 7>::step(s);
+}
+static inline uint16_t xor16_b3d_step(uint16_t s) {
+  return Xor16<11, 3, 13>::step(s);
+}
+static inline uint16_t xor16_b53_step(uint16_t s) {
+  return Xor16<11, 5, 3>::step(s);
+}
+static inline uint16_t xor16_b71_step(uint16_t s) {
+  return Xor16<11, 7, 1>::step(s);
+}
+static inline uint16_t xor16_bb3_step(uint16_t s) {
+  return Xor16<11, 11, 3>::step(s);
+}
+static inline uint16_t xor16_bb4_step(uint16_t s) {
+  return Xor16<11, 11, 4>::step(s);
+}
+static inline uint16_t xor16_bb5_step(uint16_t s) {
+  return Xor16<11, 11, 5>::step(s);
+}
+static inline uint16_t xor16_c13_step(uint16_t s) {
+  return Xor16<12, 1, 3>::step(s);
+}
+static inline uint16_t xor16_c3d_step(uint16_t s) {
+  return Xor16<12, 3, 13>::step(s);
+}
+static inline uint16_t xor16_d3b_step(uint16_t s) {
+  return Xor16<13, 3, 11>::step(s);
+}
+static inline uint16_t xor16_d3c_step(uint16_t s) {
+  return Xor16<13, 3, 12>::step(s);
+}
+static inline uint16_t xor16_d52_step(uint16_t s) {
+  return Xor16<13, 5, 2>::step(s);
+}
+static inline uint16_t xor16_d72_step(uint16_t s) {
+  return Xor16<13, 7, 2>::step(s);
+}
+static inline uint16_t xor16_d76_step(uint16_t s) {
+  return Xor16<13, 7, 6>::step(s);
+}
+static inline uint16_t xor16_d79_step(uint16_t s) {
+  return Xor16<13, 7, 9>::step(s);
+}
+static inline uint16_t xor16_d97_step(uint16_t s) {
+  return Xor16<13, 9, 7>::step(s);
+}
+static inline uint16_t xor16_e11_step(uint16_t s) {
+  return Xor16<14, 1, 1>::step(s);
+}
+static inline uint16_t xor16_e75_step(uint16_t s) {
+  return Xor16<14, 7, 5>::step(s);
+}
+static inline uint16_t xor16_f11_step(uint16_t s) {
+  return Xor16<15, 1, 1>::step(s);
+}
+static inline uint16_t xor16_f13_step(uint16_t s) {
+  return Xor16<15, 1, 3>::step(s);
+}
+static inline uint16_t xor16_f52_step(uint16_t s) {
+  return Xor16<15, 5, 2>::step(s);
+}
+static inline uint16_t xor16_f72_step(uint16_t s) {
+  return Xor16<15, 7, 2>::step(s);
+}
+
+/* Bitsliced: eight independent streams of one generator in 16 bytes, where bit j of planes[i] is
+ * bit i of stream j. Shifts are just different plane numbers, so a step is 48 - (a + b + c) eors
+ * on registers. xor16_xxx_sliced() runs n steps and writes the 16 planes to dst after each one.
+ * The streams must not be 0 - start them from different points in the cycle (xor16_jump()). */
+void xor16_sliced_load(uint8_t *planes, const uint16_t *states);
+void xor16_sliced_store(const uint8_t *planes, uint16_t *states);
+void xor16_17b_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_3bb_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_3d9_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_4bb_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_598_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_798_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_895_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_897_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_9d3_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_b71_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_bb4_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+void xor16_d3b_sliced(uint8_t *planes, uint8_t *dst, uint16_t n);
+
+/* Two generators in one: the second one only steps when bit 15 of the first one is set, and the
+ * output is the two states xored together. That makes the period 65535 * 65535 - see README.
+ * The seed is 32 bits and both halves must be non-zero. */
+bool seed_xor16_3d9_9d3(uint32_t seed);
+bool seed_xor16_598_895(uint32_t seed);
+bool seed_xor16_798_897(uint32_t seed);
+uint16_t xor16_3d9_9d3();
+uint16_t xor16_598_895();
+uint16_t xor16_798_897();
+
+/* 32-bit state: the same API, with a period of 2^32 - 1 instead of 65535. These are the full period
+ * 32-bit triplets where every shift is a whole number of bytes, or one bit either side of that,
+ * so they're mostly byte moves. The numbers in the names are the shifts in decimal. xor32() is 8_9_23. */
+extern uint32_t __state32;
+uint32_t xor32();
+inline bool seed_xor32(uint32_t seed) {
+  if (seed) {
+    __state32 = seed;
+    return 1;
+  }
+  return 0;
+}
+inline uint32_t xor32(uint32_t seed) {
+  if(__builtin_constant_p(seed)) {
+    if(seed == 0) {
+      badArg("Seed must not be zero");
+      return 0;
+    }
+  } else if(seed == 0) {
+    return 0;
+  }
+  seed_xor32(seed);
+  return xor32();
+}
+void xor32_fill(uint32_t *dst, uint16_t n);
+bool seed_xor32_8_9_23(uint32_t seed);
+bool seed_xor32_23_9_8(uint32_t seed);
+bool seed_xor32_8_7_23(uint32_t seed);
+bool seed_xor32_23_7_8(uint32_t seed);
+bool seed_xor32_9_21_16(uint32_t seed);
+bool seed_xor32_16_21_9(uint32_t seed);
+uint32_t xor32_8_9_23();
+uint32_t xor32_23_9_8();
+uint32_t xor32_8_7_23();
+uint32_t xor32_23_7_8();
+uint32_t xor32_9_21_16();
+uint32_t xor32_16_21_9();
+void xor32_8_9_23_fill(uint32_t *dst, uint16_t n);
+void xor32_23_9_8_fill(uint32_t *dst, uint16_t n);
+void xor32_8_7_23_fill(uint32_t *dst, uint16_t n);
+void xor32_23_7_8_fill(uint32_t *dst, uint16_t n);
+void xor32_9_21_16_fill(uint32_t *dst, uint16_t n);
+void xor32_16_21_9_fill(uint32_t *dst, uint16_t n);
+
+/* xoroshiro32++: 32 bits of state and a 16-bit output that isn't just the state, for when the
+ * xorshifts aren't good enough. Period 2^32 - 1. The low word of the seed is s0, the high word s1.
+ * xoroshiro32pp_jump(n) moves n * 65536 steps ahead, for non-overlapping streams. */
+bool seed_xoroshiro32pp(uint32_t seed);
+uint16_t xoroshiro32pp();
+void xoroshiro32pp_fill(uint16_t *dst, uint16_t n);
+void xoroshiro32pp_jump(uint16_t n);
+
+/* 8-bit multiply with carry, for loops that only need bytes: x = a * x + c, with the low byte of
+ * the product going to x (the output) and the high byte to c. One MUL and 5 clocks on parts
+ * that have it; on parts without it the compiler's multiply is used, which is much slower. The
+ * hex digits in the names are the multiplier a. mwc8() is mwc8_f9(), which has the longest period. */
+bool seed_mwc8_f9(uint16_t seed);
+bool seed_mwc8_f3(uint16_t seed);
+bool seed_mwc8_e4(uint16_t seed);
+bool seed_mwc8_e3(uint16_t seed);
+bool seed_mwc8_da(uint16_t seed);
+bool seed_mwc8_cc(uint16_t seed);
+uint8_t mwc8_f9();
+uint8_t mwc8_f3();
+uint8_t mwc8_e4();
+uint8_t mwc8_e3();
+uint8_t mwc8_da();
+uint8_t mwc8_cc();
+void mwc8_f9_fill(uint8_t *dst, uint16_t n);
+void mwc8_f3_fill(uint8_t *dst, uint16_t n);
+void mwc8_e4_fill(uint8_t *dst, uint16_t n);
+void mwc8_e3_fill(uint8_t *dst, uint16_t n);
+void mwc8_da_fill(uint8_t *dst, uint16_t n);
+void mwc8_cc_fill(uint8_t *dst, uint16_t n);
+inline bool seed_mwc8(uint16_t seed) {
+  return seed_mwc8_f9(seed);
+}
+inline uint8_t mwc8() {
+  return mwc8_f9();
+}
+inline void mwc8_fill(uint8_t *dst, uint16_t n) {
+  mwc8_f9_fill(dst, n);
+}
+
+
+/* Bit pool - hands out 1 to 16 bits at a time, only stepping the generator when the bits
+ * buffered from the last step have all been used. The 1, 2 and 4 bit paths are a handful of
+ * clocks; the generator is called once per 16, 8 or 4 draws respectively.
+ * rng16::BitPool<xor16_xxx> works on top of any of the generators (it shares that generator's
+ * state), and rng16::bits1(), bits2(), bits4() and bits(k) use a pool on xor16(). */
+uint16_t __xor16_next();
+namespace rng16 {
+  template <uint16_t (*gen)()> class BitPool {
+    uint16_t _pool = 0;
+    uint8_t  _left = 0;
+   public:
+    uint8_t bits1() {
+      if (_left < 1) {
+        _pool = gen();
+        _left = 16;
+      }
+      uint8_t ret;
+      __asm__ __volatile__(
+        "mov    %0, %A1"       "\n\t"
+        "andi   %0, 0x01"      "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+      :"=&d"(ret), "+r"(_pool));
+      _left -= 1;
+      return ret;
+    }
+    uint8_t bits2() {
+      if (_left < 2) {  // the odd leftover bit, if any, is discarded
+        _pool = gen();
+        _left = 16;
+      }
+      uint8_t ret;
+      __asm__ __volatile__(
+        "mov    %0, %A1"       "\n\t"
+        "andi   %0, 0x03"      "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+      :"=&d"(ret), "+r"(_pool));
+      _left -= 2;
+      return ret;
+    }
+    uint8_t bits4() {
+      if (_left < 4) {
+        _pool = gen();
+        _left = 16;
+      }
+      uint8_t ret;
+      uint8_t tmp;
+      __asm__ __volatile__(
+        "mov    %0, %A2"       "\n\t"
+        "andi   %0, 0x0F"      "\n\t" // ret = low nybble
+        "swap   %A2"           "\n\t"
+        "andi   %A2, 0x0F"     "\n\t"
+        "swap   %B2"           "\n\t"
+        "mov    %1, %B2"       "\n\t"
+        "andi   %1, 0xF0"      "\n\t"
+        "or     %A2, %1"       "\n\t"
+        "andi   %B2, 0x0F"     "\n\t" // pool >>= 4
+      :"=&d"(ret), "=&d"(tmp), "+d"(_pool));
+      _left -= 4;
+      return ret;
+    }
+    uint16_t bits(uint8_t k) {
+      if (__builtin_constant_p(k)) {
+        if (k == 0 || k > 16) {
+          badArg("rng16::bits() can only return between 1 and 16 bits");
+        }
+        if (k == 1) {
+          return bits1();
+        }
+        if (k == 2) {
+          return bits2();
+        }
+        if (k == 4) {
+          return bits4();
+        }
+      }
+      if (k == 0 || k > 16) {
+        return 0;
+      }
+      uint16_t ret = _pool;       // bits above _left are always 0
+      if (k <= _left) {           // all from the pool
+        _pool = (k == 16 ? 0 : _pool >> k);
+        _left -= k;
+      } else {                    // what's left in the pool, topped up from the next step
+        uint8_t need = k - _left;
+        uint16_t fresh = gen();
+        ret |= fresh << _left;
+        _pool = (need == 16 ? 0 : fresh >> need);
+        _left = 16 - need;
+      }
+      if (k < 16) {
+        ret &= (1U << k) - 1;
+      }
+      return ret;
+    }
+    /* Throw away any buffered bits, e.g. after reseeding the generator */
+    void flush() {
+      _pool = 0;
+      _left = 0;
+    }
+  };
+  /* The default pool is on xor16() through an out-of-line wrapper. With RNGBETTER_INLINE or
+   * RNGBETTER_SIZE, xor16() is static inline, so BitPool<xor16> would be a different type in each
+   * file; __xor16_next is the same function everywhere. It costs a jump once per refill. */
+  extern BitPool<__xor16_next> xor16bits;
+  inline uint8_t bits1() {
+    return xor16bits.bits1();
+  }
+  inline uint8_t bits2() {
+    return xor16bits.bits2();
+  }
+  inline uint8_t bits4() {
+    return xor16bits.bits4();
+  }
+  inline uint16_t bits(uint8_t k) {
+    return xor16bits.bits(k);
+  }
+}
 
 #endif
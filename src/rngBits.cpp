@@ -0,0 +1,8 @@
+// Bit pool on the default generator //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+uint16_t __xor16_next() {
+  return xor16();
+}
+rng16::BitPool<__xor16_next> rng16::xor16bits;
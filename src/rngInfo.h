@@ -0,0 +1,119 @@
+/* Never include this directly */
+#ifndef rngInfo_h
+#define rngInfo_h
+namespace rng16 {
+  /* The ratings used in the README appendices, worst first, so they compare with < and > */
+  enum class Rating : uint8_t {
+    Terrible = 0,
+    VeryPoor = 1,
+    Okay     = 2,
+    Good     = 3,
+    VeryGood = 4
+  };
+
+  /* What the README appendices say about each of the 60 generators, for use at compile time.
+   * clocks is per call with the usual 12 clocks of overhead (the Clk column), bytes is the flash
+   * taken by xor16_xxx() in the normal build, and rating is the one in the appendices. measured
+   * and the rest are what extras/host/xor16rate gives over the whole cycle - see rngQuality.h
+   * there for what each one means. rlr is false for all of them; the named generators are all LRL.
+   *
+   * The two ratings differ for 12 generators. For 11 of them it's by one class, but d52 is
+   * V. poor in the appendices and V. good by every metric here. worst() is the lower of the two,
+   * and it's what fastest<> goes by, so a generator is only picked if both agree it's good enough. */
+  struct Xor16Info {
+    uint16_t abc;
+    uint8_t  a, b, c;
+    bool     rlr;
+    uint8_t  clocks;
+    uint8_t  bytes;
+    Rating   rating;
+    Rating   measured;
+    uint8_t  stuck[4];
+    uint8_t  stuckByte;
+    uint8_t  stuckEnds;
+    uint8_t  stuckMiddle;
+    uint8_t  pairs;
+    int16_t  diffHigh;
+    int16_t  diffLow;
+    constexpr Rating worst() const {
+      return measured < rating ? measured : rating;
+    }
+  };
+  constexpr Xor16Info xor16Info[60] = {
+    // abc,   a,  b,  c,  rlr,  clk, bytes, rating,          measured,         stuck,       byte, ends, mid, pairs, diffHigh, diffLow
+    {0x11e,  1,  1, 14, false, 28, 50, Rating::Terrible,  Rating::Terrible, {12,  8,  6,  6},  8,  4,  4,  9,    2,    2},
+    {0x11f,  1,  1, 15, false, 26, 46, Rating::Terrible,  Rating::Terrible, {12,  8,  6,  6},  8,  4,  4,  9,    3,    1},
+    {0x152,  1,  5,  2, false, 35, 64, Rating::VeryPoor,  Rating::VeryPoor, { 4,  4,  3,  4},  3,  2,  2,  3, 1689, 1412},
+    {0x174,  1,  7,  4, false, 34, 62, Rating::VeryGood,  Rating::Good,     { 5,  4,  4,  4},  2,  2,  2,  5,    3,    3},
+    {0x17b,  1,  7, 11, false, 30, 54, Rating::VeryGood,  Rating::VeryGood, { 4,  4,  7,  4},  2,  2,  2,  3,   12,    9},
+    {0x1b3,  1, 11,  3, false, 31, 56, Rating::Okay,      Rating::Okay,     { 4,  4,  3,  3},  2,  2,  2,  3,  494,  461},
+    {0x1f6,  1, 15,  6, false, 32, 58, Rating::Terrible,  Rating::Terrible, {12,  8,  6,  4},  8,  4,  4,  8,    1,    1},
+    {0x1f7,  1, 15,  7, false, 29, 52, Rating::Terrible,  Rating::Terrible, {12,  8,  6,  4},  8,  3,  4,  8,   33,   31},
+    {0x251,  2,  5,  1, false, 35, 64, Rating::Terrible,  Rating::Terrible, { 4,  3,  4,  4},  3,  2,  2,  3, 2028, 1481},
+    {0x25d,  2,  5, 13, false, 35, 64, Rating::VeryPoor,  Rating::VeryPoor, { 4,  4,  6,  4},  2,  2,  2,  3, 1028, 1027},
+    {0x25f,  2,  5, 15, false, 34, 62, Rating::Terrible,  Rating::Terrible, { 4,  3,  5,  5},  3,  2,  2,  4, 2701, 3476},
+    {0x27d,  2,  7, 13, false, 32, 58, Rating::VeryPoor,  Rating::VeryPoor, { 4,  4,  6,  4},  2,  2,  2,  3, 1030, 1028},
+    {0x27f,  2,  7, 15, false, 31, 56, Rating::Terrible,  Rating::Terrible, { 4,  4,  6,  5},  3,  2,  2,  4, 2598, 3558},
+    {0x31c,  3,  1, 12, false, 30, 54, Rating::Terrible,  Rating::Terrible, {12,  8,  4,  4},  8,  2,  4,  7,    8,    6},
+    {0x31f,  3,  1, 15, false, 30, 54, Rating::Terrible,  Rating::Terrible, {12,  8,  4,  4},  8,  2,  4,  7,    4,    2},
+    {0x35b,  3,  5, 11, false, 37, 68, Rating::VeryGood,  Rating::VeryGood, { 5,  5,  4,  4},  2,  1,  1,  3,   17,   20},
+    {0x3b1,  3, 11,  1, false, 31, 56, Rating::Okay,      Rating::Okay,     { 4,  4,  4,  3},  2,  2,  3,  4,  489,  456},
+    {0x3bb,  3, 11, 11, false, 31, 56, Rating::VeryGood,  Rating::Good,     { 5,  5,  5,  5},  2,  2,  3,  4,    3,    2},
+    {0x3d9,  3, 13,  9, false, 29, 52, Rating::VeryGood,  Rating::VeryGood, { 4,  4,  4,  4},  3,  2,  2,  4,    9,    8},
+    {0x437,  4,  3,  7, false, 38, 70, Rating::VeryGood,  Rating::VeryGood, { 4,  3,  3,  3},  3,  2,  2,  3,    4,    2},
+    {0x471,  4,  7,  1, false, 34, 62, Rating::Good,      Rating::Okay,     { 5,  5,  6,  5},  2,  2,  3,  3,   26,   24},
+    {0x4bb,  4, 11, 11, false, 31, 56, Rating::VeryGood,  Rating::VeryGood, { 4,  3,  4,  3},  2,  2,  2,  4,    1,    1},
+    {0x57e,  5,  7, 14, false, 37, 68, Rating::VeryPoor,  Rating::Okay,     { 5,  6,  6,  6},  2,  3,  2,  3,  258,  259},
+    {0x598,  5,  9,  8, false, 27, 48, Rating::VeryGood,  Rating::VeryGood, { 4,  4,  5,  3},  2,  2,  2,  4,    4,    2},
+    {0x5b6,  5, 11,  6, false, 39, 72, Rating::Okay,      Rating::Okay,     { 6,  5,  5,  5},  2,  2,  2,  4,    1,    1},
+    {0x5bb,  5, 11, 11, false, 33, 60, Rating::VeryPoor,  Rating::VeryPoor, { 6,  6,  7,  6},  2,  3,  2,  5,    1,    1},
+    {0x67d,  6,  7, 13, false, 36, 66, Rating::VeryPoor,  Rating::VeryPoor, { 6,  5,  8,  5},  2,  4,  2,  4,   67,   63},
+    {0x6b5,  6, 11,  5, false, 39, 72, Rating::Okay,      Rating::Good,     { 6,  5,  4,  5},  2,  2,  2,  4,    1,    1},
+    {0x6f1,  6, 15,  1, false, 32, 58, Rating::Terrible,  Rating::Terrible, {12,  9,  6,  4},  8,  3,  5,  7,   13,   12},
+    {0x71b,  7,  1, 11, false, 30, 54, Rating::Terrible,  Rating::Terrible, {12,  8,  5,  5},  8,  4,  4,  7,    4,    2},
+    {0x734,  7,  3,  4, false, 38, 70, Rating::VeryGood,  Rating::VeryGood, { 4,  4,  4,  3},  3,  2,  2,  3,    6,    4},
+    {0x798,  7,  9,  8, false, 24, 42, Rating::Okay,      Rating::Okay,     { 6,  6,  6,  6},  2,  1,  1,  5,    1,    0},
+    {0x79d,  7,  9, 13, false, 28, 50, Rating::Okay,      Rating::Good,     { 6,  5,  6,  3},  2,  2,  2,  5,   33,   31},
+    {0x7f1,  7, 15,  1, false, 29, 52, Rating::Terrible,  Rating::Terrible, {12,  9,  6,  4},  8,  3,  5,  7,   33,   31},
+    {0x895,  8,  9,  5, false, 27, 48, Rating::VeryGood,  Rating::VeryGood, { 4,  3,  4,  3},  2,  2,  2,  3,    6,    3},
+    {0x897,  8,  9,  7, false, 24, 42, Rating::Okay,      Rating::Okay,     { 6,  6,  6,  5},  2,  1,  1,  5,    1,    0},
+    {0x97d,  9,  7, 13, false, 28, 50, Rating::Good,      Rating::Good,     { 6,  4,  6,  4},  2,  2,  2,  5,    9,    7},
+    {0x9d3,  9, 13,  3, false, 29, 52, Rating::VeryGood,  Rating::VeryGood, { 4,  4,  4,  4},  3,  2,  2,  4,   59,   58},
+    {0xb17, 11,  1,  7, false, 30, 54, Rating::Terrible,  Rating::Terrible, {12, 12,  4,  4},  8,  3,  4, 11,   11,    9},
+    {0xb3d, 11,  3, 13, false, 31, 56, Rating::Good,      Rating::Good,     { 4,  4,  4,  3},  3,  3,  2,  5,    3,    1},
+    {0xb53, 11,  5,  3, false, 37, 68, Rating::VeryGood,  Rating::VeryGood, { 5,  4,  4,  4},  2,  1,  1,  4,   11,   12},
+    {0xb71, 11,  7,  1, false, 30, 54, Rating::VeryGood,  Rating::VeryGood, { 4,  4,  4,  4},  3,  3,  2,  3,    8,    7},
+    {0xbb3, 11, 11,  3, false, 31, 56, Rating::Good,      Rating::Good,     { 5,  5,  5,  5},  2,  3,  2,  4,    2,    1},
+    {0xbb4, 11, 11,  4, false, 31, 56, Rating::VeryGood,  Rating::VeryGood, { 4,  3,  4,  4},  2,  2,  2,  4,    2,    0},
+    {0xbb5, 11, 11,  5, false, 33, 60, Rating::VeryPoor,  Rating::VeryPoor, { 6,  6,  7,  6},  2,  3,  2,  5,    1,    1},
+    {0xc13, 12,  1,  3, false, 30, 54, Rating::Terrible,  Rating::Terrible, {12,  8,  4,  4},  8,  2,  4,  8,    5,    3},
+    {0xc3d, 12,  3, 13, false, 30, 54, Rating::Good,      Rating::VeryGood, { 4,  4,  4,  3},  3,  3,  3,  3,    5,    3},
+    {0xd3b, 13,  3, 11, false, 31, 56, Rating::VeryGood,  Rating::VeryGood, { 4,  4,  4,  3},  3,  3,  3,  3,    2,    0},
+    {0xd3c, 13,  3, 12, false, 30, 54, Rating::Good,      Rating::VeryGood, { 4,  4,  4,  4},  3,  3,  3,  3,    2,    0},
+    {0xd52, 13,  5,  2, false, 35, 64, Rating::VeryPoor,  Rating::VeryGood, { 4,  4,  4,  4},  3,  2,  2,  4,    6,    4},
+    {0xd72, 13,  7,  2, false, 32, 58, Rating::VeryPoor,  Rating::VeryPoor, { 4,  4,  4,  4},  3,  3,  2,  3, 1027, 1025},
+    {0xd76, 13,  7,  6, false, 36, 66, Rating::VeryPoor,  Rating::VeryPoor, { 7,  5,  8,  6},  2,  4,  2,  4,   44,   42},
+    {0xd79, 13,  7,  9, false, 28, 50, Rating::Good,      Rating::Good,     { 6,  4,  6,  3},  2,  2,  2,  5,    9,    8},
+    {0xd97, 13,  9,  7, false, 28, 50, Rating::Okay,      Rating::Good,     { 6,  5,  6,  3},  2,  2,  2,  5,   33,   32},
+    {0xe11, 14,  1,  1, false, 28, 50, Rating::Terrible,  Rating::Terrible, {12,  8,  6,  6},  8,  4,  4,  9,    4,    2},
+    {0xe75, 14,  7,  5, false, 37, 68, Rating::Good,      Rating::Good,     { 5,  4,  6,  5},  2,  4,  2,  4,    3,    2},
+    {0xf11, 15,  1,  1, false, 26, 46, Rating::Terrible,  Rating::Terrible, {12,  8,  6,  6},  8,  4,  4,  9,    2,    1},
+    {0xf13, 15,  1,  3, false, 30, 54, Rating::Terrible,  Rating::Terrible, {12,  8,  4,  3},  8,  2,  4,  8,    4,    3},
+    {0xf52, 15,  5,  2, false, 34, 62, Rating::VeryPoor,  Rating::Terrible, { 4,  3,  4,  5},  4,  2,  2,  3, 2581, 2543},
+    {0xf72, 15,  7,  2, false, 31, 56, Rating::VeryPoor,  Rating::Terrible, { 4,  3,  4,  5},  4,  3,  2,  3, 2690, 3459}
+  };
+
+  /* Index into xor16Info of the fastest generator whose worst() is at least bar (the first one,
+   * on a tie) */
+  constexpr uint8_t fastestIndex(Rating bar, uint8_t i = 0, uint8_t best = 0xFF) {
+    return i == 60 ? best : fastestIndex(bar, i + 1,
+      (xor16Info[i].worst() >= bar && (best == 0xFF || xor16Info[i].clocks < xor16Info[best].clocks)) ? i : best);
+  }
+  /* The fastest generator that's at least as good as R, as an Xor16 type:
+   *   rng16::fastest<rng16::Rating::Good> sparkle(1234);   // Xor16<5, 9, 8> today
+   *   uint16_t s = 1234;
+   *   s = rng16::fastest<rng16::Rating::Okay>::step(s);    // Xor16<7, 9, 8> */
+  template <Rating R> using fastest = Xor16<xor16Info[fastestIndex(R)].a, xor16Info[fastestIndex(R)].b,
+                                             xor16Info[fastestIndex(R)].c>;
+}
+#endif
@@ -0,0 +1,248 @@
+/* Never include this directly - define RNGBETTER_INLINE before including rngBetter.h */
+#ifndef rngInline_h
+#define rngInline_h
+/* The inline build: each xor16_xxx() is the step math inlined at the call site, working on the
+ * same state as the out-of-line function in xor16_xxx.cpp. So seed_xor16_xxx(), the fills, jumps
+ * and the rest all still apply, and only the generators you use get linked in. */
+extern uint16_t __xor16_11e_state;
+extern uint16_t __xor16_11f_state;
+extern uint16_t __xor16_152_state;
+extern uint16_t __xor16_174_state;
+extern uint16_t __xor16_17b_state;
+extern uint16_t __xor16_1b3_state;
+extern uint16_t __xor16_1f6_state;
+extern uint16_t __xor16_1f7_state;
+extern uint16_t __xor16_251_state;
+extern uint16_t __xor16_25d_state;
+extern uint16_t __xor16_25f_state;
+extern uint16_t __xor16_27d_state;
+extern uint16_t __xor16_27f_state;
+extern uint16_t __xor16_31c_state;
+extern uint16_t __xor16_31f_state;
+extern uint16_t __xor16_35b_state;
+extern uint16_t __xor16_3b1_state;
+extern uint16_t __xor16_3bb_state;
+extern uint16_t __xor16_3d9_state;
+extern uint16_t __xor16_437_state;
+extern uint16_t __xor16_471_state;
+extern uint16_t __xor16_4bb_state;
+extern uint16_t __xor16_57e_state;
+extern uint16_t __xor16_598_state;
+extern uint16_t __xor16_5b6_state;
+extern uint16_t __xor16_5bb_state;
+extern uint16_t __xor16_67d_state;
+extern uint16_t __xor16_6b5_state;
+extern uint16_t __xor16_6f1_state;
+extern uint16_t __xor16_71b_state;
+extern uint16_t __xor16_734_state;
+extern uint16_t __xor16_798_state;
+extern uint16_t __xor16_79d_state;
+extern uint16_t __xor16_7f1_state;
+extern uint16_t __xor16_895_state;
+extern uint16_t __xor16_897_state;
+extern uint16_t __xor16_97d_state;
+extern uint16_t __xor16_9d3_state;
+extern uint16_t __xor16_b17_state;
+extern uint16_t __xor16_b3d_state;
+extern uint16_t __xor16_b53_state;
+extern uint16_t __xor16_b71_state;
+extern uint16_t __xor16_bb3_state;
+extern uint16_t __xor16_bb4_state;
+extern uint16_t __xor16_bb5_state;
+extern uint16_t __xor16_c13_state;
+extern uint16_t __xor16_c3d_state;
+extern uint16_t __xor16_d3b_state;
+extern uint16_t __xor16_d3c_state;
+extern uint16_t __xor16_d52_state;
+extern uint16_t __xor16_d72_state;
+extern uint16_t __xor16_d76_state;
+extern uint16_t __xor16_d79_state;
+extern uint16_t __xor16_d97_state;
+extern uint16_t __xor16_e11_state;
+extern uint16_t __xor16_e75_state;
+extern uint16_t __xor16_f11_state;
+extern uint16_t __xor16_f13_state;
+extern uint16_t __xor16_f52_state;
+extern uint16_t __xor16_f72_state;
+
+__attribute__((always_inline)) static inline uint16_t xor16_11e() {
+  return __xor16_11e_state = Xor16<1, 1, 14>::step(__xor16_11e_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_11f() {
+  return __xor16_11f_state = Xor16<1, 1, 15>::step(__xor16_11f_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_152() {
+  return __xor16_152_state = Xor16<1, 5, 2>::step(__xor16_152_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_174() {
+  return __xor16_174_state = Xor16<1, 7, 4>::step(__xor16_174_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_17b() {
+  return __xor16_17b_state = Xor16<1, 7, 11>::step(__xor16_17b_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_1b3() {
+  return __xor16_1b3_state = Xor16<1, 11, 3>::step(__xor16_1b3_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_1f6() {
+  return __xor16_1f6_state = Xor16<1, 15, 6>::step(__xor16_1f6_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_1f7() {
+  return __xor16_1f7_state = Xor16<1, 15, 7>::step(__xor16_1f7_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_251() {
+  return __xor16_251_state = Xor16<2, 5, 1>::step(__xor16_251_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_25d() {
+  return __xor16_25d_state = Xor16<2, 5, 13>::step(__xor16_25d_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_25f() {
+  return __xor16_25f_state = Xor16<2, 5, 15>::step(__xor16_25f_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_27d() {
+  return __xor16_27d_state = Xor16<2, 7, 13>::step(__xor16_27d_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_27f() {
+  return __xor16_27f_state = Xor16<2, 7, 15>::step(__xor16_27f_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_31c() {
+  return __xor16_31c_state = Xor16<3, 1, 12>::step(__xor16_31c_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_31f() {
+  return __xor16_31f_state = Xor16<3, 1, 15>::step(__xor16_31f_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_35b() {
+  return __xor16_35b_state = Xor16<3, 5, 11>::step(__xor16_35b_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_3b1() {
+  return __xor16_3b1_state = Xor16<3, 11, 1>::step(__xor16_3b1_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_3bb() {
+  return __xor16_3bb_state = Xor16<3, 11, 11>::step(__xor16_3bb_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_3d9() {
+  return __xor16_3d9_state = Xor16<3, 13, 9>::step(__xor16_3d9_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_437() {
+  return __xor16_437_state = Xor16<4, 3, 7>::step(__xor16_437_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_471() {
+  return __xor16_471_state = Xor16<4, 7, 1>::step(__xor16_471_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_4bb() {
+  return __xor16_4bb_state = Xor16<4, 11, 11>::step(__xor16_4bb_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_57e() {
+  return __xor16_57e_state = Xor16<5, 7, 14>::step(__xor16_57e_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_598() {
+  return __xor16_598_state = Xor16<5, 9, 8>::step(__xor16_598_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_5b6() {
+  return __xor16_5b6_state = Xor16<5, 11, 6>::step(__xor16_5b6_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_5bb() {
+  return __xor16_5bb_state = Xor16<5, 11, 11>::step(__xor16_5bb_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_67d() {
+  return __xor16_67d_state = Xor16<6, 7, 13>::step(__xor16_67d_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_6b5() {
+  return __xor16_6b5_state = Xor16<6, 11, 5>::step(__xor16_6b5_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_6f1() {
+  return __xor16_6f1_state = Xor16<6, 15, 1>::step(__xor16_6f1_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_71b() {
+  return __xor16_71b_state = Xor16<7, 1, 11>::step(__xor16_71b_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_734() {
+  return __xor16_734_state = Xor16<7, 3, 4>::step(__xor16_734_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_798() {
+  return __xor16_798_state = Xor16<7, 9, 8>::step(__xor16_798_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_79d() {
+  return __xor16_79d_state = Xor16<7, 9, 13>::step(__xor16_79d_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_7f1() {
+  return __xor16_7f1_state = Xor16<7, 15, 1>::step(__xor16_7f1_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_895() {
+  return __xor16_895_state = Xor16<8, 9, 5>::step(__xor16_895_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_897() {
+  return __xor16_897_state = Xor16<8, 9, 7>::step(__xor16_897_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_97d() {
+  return __xor16_97d_state = Xor16<9, 7, 13>::step(__xor16_97d_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_9d3() {
+  return __xor16_9d3_state = Xor16<9, 13, 3>::step(__xor16_9d3_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_b17() {
+  return __xor16_b17_state = Xor16<11, 1, 7>::step(__xor16_b17_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_b3d() {
+  return __xor16_b3d_state = Xor16<11, 3, 13>::step(__xor16_b3d_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_b53() {
+  return __xor16_b53_state = Xor16<11, 5, 3>::step(__xor16_b53_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_b71() {
+  return __xor16_b71_state = Xor16<11, 7, 1>::step(__xor16_b71_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_bb3() {
+  return __xor16_bb3_state = Xor16<11, 11, 3>::step(__xor16_bb3_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_bb4() {
+  return __xor16_bb4_state = Xor16<11, 11, 4>::step(__xor16_bb4_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_bb5() {
+  return __xor16_bb5_state = Xor16<11, 11, 5>::step(__xor16_bb5_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_c13() {
+  return __xor16_c13_state = Xor16<12, 1, 3>::step(__xor16_c13_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_c3d() {
+  return __xor16_c3d_state = Xor16<12, 3, 13>::step(__xor16_c3d_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_d3b() {
+  return __xor16_d3b_state = Xor16<13, 3, 11>::step(__xor16_d3b_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_d3c() {
+  return __xor16_d3c_state = Xor16<13, 3, 12>::step(__xor16_d3c_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_d52() {
+  return __xor16_d52_state = Xor16<13, 5, 2>::step(__xor16_d52_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_d72() {
+  return __xor16_d72_state = Xor16<13, 7, 2>::step(__xor16_d72_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_d76() {
+  return __xor16_d76_state = Xor16<13, 7, 6>::step(__xor16_d76_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_d79() {
+  return __xor16_d79_state = Xor16<13, 7, 9>::step(__xor16_d79_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_d97() {
+  return __xor16_d97_state = Xor16<13, 9, 7>::step(__xor16_d97_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_e11() {
+  return __xor16_e11_state = Xor16<14, 1, 1>::step(__xor16_e11_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_e75() {
+  return __xor16_e75_state = Xor16<14, 7, 5>::step(__xor16_e75_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_f11() {
+  return __xor16_f11_state = Xor16<15, 1, 1>::step(__xor16_f11_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_f13() {
+  return __xor16_f13_state = Xor16<15, 1, 3>::step(__xor16_f13_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_f52() {
+  return __xor16_f52_state = Xor16<15, 5, 2>::step(__xor16_f52_state);
+}
+__attribute__((always_inline)) static inline uint16_t xor16_f72() {
+  return __xor16_f72_state = Xor16<15, 7, 2>::step(__xor16_f72_state);
+}
+#endif
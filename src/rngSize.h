@@ -0,0 +1,249 @@
+/* Never include this directly - define RNGBETTER_SIZE before including rngBetter.h */
+#ifndef rngSize_h
+#define rngSize_h
+/* The size build: each xor16_xxx() is a call to the shared core in xor16_step_abc.cpp with the
+ * address of its state and its shifts, instead of a routine of its own. The state is the same one
+ * the out-of-line function uses, so seed_xor16_xxx(), the fills, jumps and the rest still apply. */
+uint16_t __xor16_step_at(uint16_t *state, uint16_t abc);
+extern uint16_t __xor16_11e_state;
+extern uint16_t __xor16_11f_state;
+extern uint16_t __xor16_152_state;
+extern uint16_t __xor16_174_state;
+extern uint16_t __xor16_17b_state;
+extern uint16_t __xor16_1b3_state;
+extern uint16_t __xor16_1f6_state;
+extern uint16_t __xor16_1f7_state;
+extern uint16_t __xor16_251_state;
+extern uint16_t __xor16_25d_state;
+extern uint16_t __xor16_25f_state;
+extern uint16_t __xor16_27d_state;
+extern uint16_t __xor16_27f_state;
+extern uint16_t __xor16_31c_state;
+extern uint16_t __xor16_31f_state;
+extern uint16_t __xor16_35b_state;
+extern uint16_t __xor16_3b1_state;
+extern uint16_t __xor16_3bb_state;
+extern uint16_t __xor16_3d9_state;
+extern uint16_t __xor16_437_state;
+extern uint16_t __xor16_471_state;
+extern uint16_t __xor16_4bb_state;
+extern uint16_t __xor16_57e_state;
+extern uint16_t __xor16_598_state;
+extern uint16_t __xor16_5b6_state;
+extern uint16_t __xor16_5bb_state;
+extern uint16_t __xor16_67d_state;
+extern uint16_t __xor16_6b5_state;
+extern uint16_t __xor16_6f1_state;
+extern uint16_t __xor16_71b_state;
+extern uint16_t __xor16_734_state;
+extern uint16_t __xor16_798_state;
+extern uint16_t __xor16_79d_state;
+extern uint16_t __xor16_7f1_state;
+extern uint16_t __xor16_895_state;
+extern uint16_t __xor16_897_state;
+extern uint16_t __xor16_97d_state;
+extern uint16_t __xor16_9d3_state;
+extern uint16_t __xor16_b17_state;
+extern uint16_t __xor16_b3d_state;
+extern uint16_t __xor16_b53_state;
+extern uint16_t __xor16_b71_state;
+extern uint16_t __xor16_bb3_state;
+extern uint16_t __xor16_bb4_state;
+extern uint16_t __xor16_bb5_state;
+extern uint16_t __xor16_c13_state;
+extern uint16_t __xor16_c3d_state;
+extern uint16_t __xor16_d3b_state;
+extern uint16_t __xor16_d3c_state;
+extern uint16_t __xor16_d52_state;
+extern uint16_t __xor16_d72_state;
+extern uint16_t __xor16_d76_state;
+extern uint16_t __xor16_d79_state;
+extern uint16_t __xor16_d97_state;
+extern uint16_t __xor16_e11_state;
+extern uint16_t __xor16_e75_state;
+extern uint16_t __xor16_f11_state;
+extern uint16_t __xor16_f13_state;
+extern uint16_t __xor16_f52_state;
+extern uint16_t __xor16_f72_state;
+
+static inline uint16_t xor16_11e() {
+  return __xor16_step_at(&__xor16_11e_state, 0x11e);
+}
+static inline uint16_t xor16_11f() {
+  return __xor16_step_at(&__xor16_11f_state, 0x11f);
+}
+static inline uint16_t xor16_152() {
+  return __xor16_step_at(&__xor16_152_state, 0x152);
+}
+static inline uint16_t xor16_174() {
+  return __xor16_step_at(&__xor16_174_state, 0x174);
+}
+static inline uint16_t xor16_17b() {
+  return __xor16_step_at(&__xor16_17b_state, 0x17b);
+}
+static inline uint16_t xor16_1b3() {
+  return __xor16_step_at(&__xor16_1b3_state, 0x1b3);
+}
+static inline uint16_t xor16_1f6() {
+  return __xor16_step_at(&__xor16_1f6_state, 0x1f6);
+}
+static inline uint16_t xor16_1f7() {
+  return __xor16_step_at(&__xor16_1f7_state, 0x1f7);
+}
+static inline uint16_t xor16_251() {
+  return __xor16_step_at(&__xor16_251_state, 0x251);
+}
+static inline uint16_t xor16_25d() {
+  return __xor16_step_at(&__xor16_25d_state, 0x25d);
+}
+static inline uint16_t xor16_25f() {
+  return __xor16_step_at(&__xor16_25f_state, 0x25f);
+}
+static inline uint16_t xor16_27d() {
+  return __xor16_step_at(&__xor16_27d_state, 0x27d);
+}
+static inline uint16_t xor16_27f() {
+  return __xor16_step_at(&__xor16_27f_state, 0x27f);
+}
+static inline uint16_t xor16_31c() {
+  return __xor16_step_at(&__xor16_31c_state, 0x31c);
+}
+static inline uint16_t xor16_31f() {
+  return __xor16_step_at(&__xor16_31f_state, 0x31f);
+}
+static inline uint16_t xor16_35b() {
+  return __xor16_step_at(&__xor16_35b_state, 0x35b);
+}
+static inline uint16_t xor16_3b1() {
+  return __xor16_step_at(&__xor16_3b1_state, 0x3b1);
+}
+static inline uint16_t xor16_3bb() {
+  return __xor16_step_at(&__xor16_3bb_state, 0x3bb);
+}
+static inline uint16_t xor16_3d9() {
+  return __xor16_step_at(&__xor16_3d9_state, 0x3d9);
+}
+static inline uint16_t xor16_437() {
+  return __xor16_step_at(&__xor16_437_state, 0x437);
+}
+static inline uint16_t xor16_471() {
+  return __xor16_step_at(&__xor16_471_state, 0x471);
+}
+static inline uint16_t xor16_4bb() {
+  return __xor16_step_at(&__xor16_4bb_state, 0x4bb);
+}
+static inline uint16_t xor16_57e() {
+  return __xor16_step_at(&__xor16_57e_state, 0x57e);
+}
+static inline uint16_t xor16_598() {
+  return __xor16_step_at(&__xor16_598_state, 0x598);
+}
+static inline uint16_t xor16_5b6() {
+  return __xor16_step_at(&__xor16_5b6_state, 0x5b6);
+}
+static inline uint16_t xor16_5bb() {
+  return __xor16_step_at(&__xor16_5bb_state, 0x5bb);
+}
+static inline uint16_t xor16_67d() {
+  return __xor16_step_at(&__xor16_67d_state, 0x67d);
+}
+static inline uint16_t xor16_6b5() {
+  return __xor16_step_at(&__xor16_6b5_state, 0x6b5);
+}
+static inline uint16_t xor16_6f1() {
+  return __xor16_step_at(&__xor16_6f1_state, 0x6f1);
+}
+static inline uint16_t xor16_71b() {
+  return __xor16_step_at(&__xor16_71b_state, 0x71b);
+}
+static inline uint16_t xor16_734() {
+  return __xor16_step_at(&__xor16_734_state, 0x734);
+}
+static inline uint16_t xor16_798() {
+  return __xor16_step_at(&__xor16_798_state, 0x798);
+}
+static inline uint16_t xor16_79d() {
+  return __xor16_step_at(&__xor16_79d_state, 0x79d);
+}
+static inline uint16_t xor16_7f1() {
+  return __xor16_step_at(&__xor16_7f1_state, 0x7f1);
+}
+static inline uint16_t xor16_895() {
+  return __xor16_step_at(&__xor16_895_state, 0x895);
+}
+static inline uint16_t xor16_897() {
+  return __xor16_step_at(&__xor16_897_state, 0x897);
+}
+static inline uint16_t xor16_97d() {
+  return __xor16_step_at(&__xor16_97d_state, 0x97d);
+}
+static inline uint16_t xor16_9d3() {
+  return __xor16_step_at(&__xor16_9d3_state, 0x9d3);
+}
+static inline uint16_t xor16_b17() {
+  return __xor16_step_at(&__xor16_b17_state, 0xb17);
+}
+static inline uint16_t xor16_b3d() {
+  return __xor16_step_at(&__xor16_b3d_state, 0xb3d);
+}
+static inline uint16_t xor16_b53() {
+  return __xor16_step_at(&__xor16_b53_state, 0xb53);
+}
+static inline uint16_t xor16_b71() {
+  return __xor16_step_at(&__xor16_b71_state, 0xb71);
+}
+static inline uint16_t xor16_bb3() {
+  return __xor16_step_at(&__xor16_bb3_state, 0xbb3);
+}
+static inline uint16_t xor16_bb4() {
+  return __xor16_step_at(&__xor16_bb4_state, 0xbb4);
+}
+static inline uint16_t xor16_bb5() {
+  return __xor16_step_at(&__xor16_bb5_state, 0xbb5);
+}
+static inline uint16_t xor16_c13() {
+  return __xor16_step_at(&__xor16_c13_state, 0xc13);
+}
+static inline uint16_t xor16_c3d() {
+  return __xor16_step_at(&__xor16_c3d_state, 0xc3d);
+}
+static inline uint16_t xor16_d3b() {
+  return __xor16_step_at(&__xor16_d3b_state, 0xd3b);
+}
+static inline uint16_t xor16_d3c() {
+  return __xor16_step_at(&__xor16_d3c_state, 0xd3c);
+}
+static inline uint16_t xor16_d52() {
+  return __xor16_step_at(&__xor16_d52_state, 0xd52);
+}
+static inline uint16_t xor16_d72() {
+  return __xor16_step_at(&__xor16_d72_state, 0xd72);
+}
+static inline uint16_t xor16_d76() {
+  return __xor16_step_at(&__xor16_d76_state, 0xd76);
+}
+static inline uint16_t xor16_d79() {
+  return __xor16_step_at(&__xor16_d79_state, 0xd79);
+}
+static inline uint16_t xor16_d97() {
+  return __xor16_step_at(&__xor16_d97_state, 0xd97);
+}
+static inline uint16_t xor16_e11() {
+  return __xor16_step_at(&__xor16_e11_state, 0xe11);
+}
+static inline uint16_t xor16_e75() {
+  return __xor16_step_at(&__xor16_e75_state, 0xe75);
+}
+static inline uint16_t xor16_f11() {
+  return __xor16_step_at(&__xor16_f11_state, 0xf11);
+}
+static inline uint16_t xor16_f13() {
+  return __xor16_step_at(&__xor16_f13_state, 0xf13);
+}
+static inline uint16_t xor16_f52() {
+  return __xor16_step_at(&__xor16_f52_state, 0xf52);
+}
+static inline uint16_t xor16_f72() {
+  return __xor16_step_at(&__xor16_f72_state, 0xf72);
+}
+#endif
@@ -6,5 +6,90 @@
 namespace rng16 {
   uint16_t ADCtoSeed(uint16_t reading, uint8_t length);
   uint16_t timeADCtoSeed(uint16_t reading, uint8_t length, uint16_t tickcount);
+
+  /* Full 32-bit product of two 16-bit values. On parts with the hardware multiplier this is four
+   * 2-clock MULs, about 20 clocks, versus ~600 for the 32-bit division inside random(min, max).
+   * The high word of mul16(r, n) is a random value from 0 to n-1 when r is a random word. */
+  inline uint32_t mul16(uint16_t r, uint16_t n) {
+    #if defined(__AVR_HAVE_MUL__)
+      uint32_t p;
+      uint8_t zero;
+      __asm__ __volatile__(
+        "clr    %1"            "\n\t"
+        "mul    %A2, %A3"      "\n\t"
+        "movw   %A0, r0"       "\n\t"
+        "mul    %B2, %B3"      "\n\t"
+        "movw   %C0, r0"       "\n\t"
+        "mul    %A2, %B3"      "\n\t"
+        "add    %B0, r0"       "\n\t"
+        "adc    %C0, r1"       "\n\t"
+        "adc    %D0, %1"       "\n\t"
+        "mul    %B2, %A3"      "\n\t"
+        "add    %B0, r0"       "\n\t"
+        "adc    %C0, r1"       "\n\t"
+        "adc    %D0, %1"       "\n\t"
+        "clr    r1"            "\n\t"
+      :"=&r"(p), "=&r"(zero)
+      :"r"(r), "r"(n));
+      return p;
+    #else
+      return (uint32_t) r * n;
+    #endif
+  }
+  /* Same for an 8-bit n: only 2 MULs, and the result fits in 24 bits */
+  inline uint32_t mul16x8(uint16_t r, uint8_t n) {
+    #if defined(__AVR_HAVE_MUL__)
+      uint32_t p;
+      __asm__ __volatile__(
+        "mul    %A1, %2"       "\n\t"
+        "movw   %A0, r0"       "\n\t"
+        "mul    %B1, %2"       "\n\t"
+        "clr    %D0"           "\n\t"
+        "add    %B0, r0"       "\n\t"
+        "mov    %C0, r1"       "\n\t"
+        "adc    %C0, %D0"      "\n\t"
+        "clr    r1"            "\n\t"
+      :"=&r"(p)
+      :"r"(r), "r"(n));
+      return p;
+    #else
+      return (uint32_t) r * n;
+    #endif
+  }
+  /* Scale a random word to 0 to n-1. Biased by at most n/65536 - see xor16_below_exact(). */
+  inline uint16_t scale(uint16_t r, uint16_t n) {
+    if (__builtin_constant_p(n) && n < 256) {
+      return mul16x8(r, n) >> 16;
+    }
+    return mul16(r, n) >> 16;
+  }
+  /* xorshift* style output mixing: multiply by 0xDD, fold the high byte into the low byte, and
+   * swap the bytes. Every step is reversible, so a full period generator still hits every
+   * nonzero value once per cycle, but each output bit now depends on the whole state, not just
+   * the few bits the low nybble was made from. 2 MULs, 10 clocks. */
+  inline uint16_t star(uint16_t s) {
+    #if defined(__AVR_HAVE_MUL__)
+      uint16_t r;
+      __asm__ __volatile__(
+        "mul    %A1, %2"       "\n\t"
+        "mov    %B0, r0"       "\n\t"
+        "mov    %A0, r1"       "\n\t"
+        "mul    %B1, %2"       "\n\t"
+        "add    %A0, r0"       "\n\t"
+        "clr    r1"            "\n\t"
+        "eor    %B0, %A0"      "\n\t"
+      :"=&r"(r)
+      :"r"(s), "r"((uint8_t)0xDD));
+      return r;
+    #else
+      uint16_t p = s * 0xDD;
+      p ^= p >> 8;
+      return (p << 8) | (p >> 8);
+    #endif
+  }
+}
+namespace rng32 {
+  uint32_t ADCtoSeed(uint32_t reading, uint8_t length);
+  uint32_t timeADCtoSeed(uint32_t reading, uint8_t length, uint32_t tickcount);
 }
 #endif
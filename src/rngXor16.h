@@ -0,0 +1,446 @@
+/* Never include this directly */
+#ifndef rngXor16_h
+#define rngXor16_h
+namespace rng16 {
+  /* The 60 (a, b, c) shift triplets that give full period 16-bit xorshift generators, as 0xabc */
+  constexpr uint16_t xor16Triplets[60] = {
+    0x11e, 0x11f, 0x152, 0x174, 0x17b, 0x1b3, 0x1f6, 0x1f7, 0x251, 0x25d,
+    0x25f, 0x27d, 0x27f, 0x31c, 0x31f, 0x35b, 0x3b1, 0x3bb, 0x3d9, 0x437,
+    0x471, 0x4bb, 0x57e, 0x598, 0x5b6, 0x5bb, 0x67d, 0x6b5, 0x6f1, 0x71b,
+    0x734, 0x798, 0x79d, 0x7f1, 0x895, 0x897, 0x97d, 0x9d3, 0xb17, 0xb3d,
+    0xb53, 0xb71, 0xbb3, 0xbb4, 0xbb5, 0xc13, 0xc3d, 0xd3b, 0xd3c, 0xd52,
+    0xd72, 0xd76, 0xd79, 0xd97, 0xe11, 0xe75, 0xf11, 0xf13, 0xf52, 0xf72
+  };
+  constexpr bool isFullPeriod(uint8_t a, uint8_t b, uint8_t c, uint8_t i = 0) {
+    return i < 60 && (xor16Triplets[i] == (uint16_t)((a << 8) | (b << 4) | c) || isFullPeriod(a, b, c, i + 1));
+  }
+
+  /* s ^= s << N and s ^= s >> N, each with the fastest sequence for that N: add/adc or lsr/ror
+   * ladders for 1-3, swap and andi for 4 and 5 (and 12 and 13), a byte move plus a short ladder
+   * through r0 the other way for 6 and 7, byte moves for 8 and up, and bst/bld for 14 and 15. */
+  template <uint8_t N> __attribute__((always_inline)) inline void xorshl(uint16_t &s) {
+    uint16_t t;
+    if (N == 1) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "add    %A1, %A1"      "\n\t"
+        "adc    %B1, %B1"      "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 2) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "add    %A1, %A1"      "\n\t"
+        "adc    %B1, %B1"      "\n\t"
+        "add    %A1, %A1"      "\n\t"
+        "adc    %B1, %B1"      "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 3) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "add    %A1, %A1"      "\n\t"
+        "adc    %B1, %B1"      "\n\t"
+        "add    %A1, %A1"      "\n\t"
+        "adc    %B1, %B1"      "\n\t"
+        "add    %A1, %A1"      "\n\t"
+        "adc    %B1, %B1"      "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 4) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "swap   %A1"           "\n\t"
+        "swap   %B1"           "\n\t"
+        "andi   %B1, 0xF0"     "\n\t"
+        "eor    %B1, %A1"      "\n\t"
+        "andi   %A1, 0xF0"     "\n\t"
+        "eor    %B1, %A1"      "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 5) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "swap   %A1"           "\n\t"
+        "swap   %B1"           "\n\t"
+        "andi   %B1, 0xF0"     "\n\t"
+        "eor    %B1, %A1"      "\n\t"
+        "andi   %A1, 0xF0"     "\n\t"
+        "eor    %B1, %A1"      "\n\t"
+        "add    %A1, %A1"      "\n\t"
+        "adc    %B1, %B1"      "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 6) {
+      __asm__ __volatile__(
+        "mov    r0, %B0"       "\n\t"
+        "mov    %B1, %A0"      "\n\t"
+        "clr    %A1"           "\n\t"
+        "lsr    r0"            "\n\t"
+        "ror    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "lsr    r0"            "\n\t"
+        "ror    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 7) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "lsr    %B1"           "\n\t"
+        "mov    %B1, %A1"      "\n\t"
+        "clr    %A1"           "\n\t"
+        "ror    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 8) {
+      __asm__ __volatile__(
+        "eor    %B0, %A0"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 9) {
+      __asm__ __volatile__(
+        "mov    %B1, %A0"      "\n\t"
+        "add    %B1, %B1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 10) {
+      __asm__ __volatile__(
+        "mov    %B1, %A0"      "\n\t"
+        "add    %B1, %B1"      "\n\t"
+        "add    %B1, %B1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 11) {
+      __asm__ __volatile__(
+        "mov    %B1, %A0"      "\n\t"
+        "add    %B1, %B1"      "\n\t"
+        "add    %B1, %B1"      "\n\t"
+        "add    %B1, %B1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 12) {
+      __asm__ __volatile__(
+        "mov    %B1, %A0"      "\n\t"
+        "swap   %B1"           "\n\t"
+        "andi   %B1, 0xF0"     "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 13) {
+      __asm__ __volatile__(
+        "mov    %B1, %A0"      "\n\t"
+        "swap   %B1"           "\n\t"
+        "add    %B1, %B1"      "\n\t"
+        "andi   %B1, 0xE0"     "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 14) {
+      __asm__ __volatile__(
+        "clr    %B1"           "\n\t"
+        "bst    %A0, 0"        "\n\t"
+        "bld    %B1, 6"        "\n\t"
+        "bst    %A0, 1"        "\n\t"
+        "bld    %B1, 7"        "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 15) {
+      __asm__ __volatile__(
+        "clr    %B1"           "\n\t"
+        "bst    %A0, 0"        "\n\t"
+        "bld    %B1, 7"        "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    }
+  }
+  template <uint8_t N> __attribute__((always_inline)) inline void xorshr(uint16_t &s) {
+    uint16_t t;
+    if (N == 1) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 2) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 3) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 4) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "swap   %A1"           "\n\t"
+        "swap   %B1"           "\n\t"
+        "andi   %A1, 0x0F"     "\n\t"
+        "eor    %A1, %B1"      "\n\t"
+        "andi   %B1, 0x0F"     "\n\t"
+        "eor    %A1, %B1"      "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 5) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "swap   %A1"           "\n\t"
+        "swap   %B1"           "\n\t"
+        "andi   %A1, 0x0F"     "\n\t"
+        "eor    %A1, %B1"      "\n\t"
+        "andi   %B1, 0x0F"     "\n\t"
+        "eor    %A1, %B1"      "\n\t"
+        "lsr    %B1"           "\n\t"
+        "ror    %A1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 6) {
+      __asm__ __volatile__(
+        "mov    r0, %A0"       "\n\t"
+        "mov    %A1, %B0"      "\n\t"
+        "clr    %B1"           "\n\t"
+        "lsl    r0"            "\n\t"
+        "rol    %A1"           "\n\t"
+        "rol    %B1"           "\n\t"
+        "lsl    r0"            "\n\t"
+        "rol    %A1"           "\n\t"
+        "rol    %B1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 7) {
+      __asm__ __volatile__(
+        "movw   %A1, %A0"      "\n\t"
+        "lsl    %A1"           "\n\t"
+        "mov    %A1, %B1"      "\n\t"
+        "clr    %B1"           "\n\t"
+        "rol    %A1"           "\n\t"
+        "rol    %B1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+        "eor    %B0, %B1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 8) {
+      __asm__ __volatile__(
+        "eor    %A0, %B0"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 9) {
+      __asm__ __volatile__(
+        "mov    %A1, %B0"      "\n\t"
+        "lsr    %A1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 10) {
+      __asm__ __volatile__(
+        "mov    %A1, %B0"      "\n\t"
+        "lsr    %A1"           "\n\t"
+        "lsr    %A1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 11) {
+      __asm__ __volatile__(
+        "mov    %A1, %B0"      "\n\t"
+        "lsr    %A1"           "\n\t"
+        "lsr    %A1"           "\n\t"
+        "lsr    %A1"           "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 12) {
+      __asm__ __volatile__(
+        "mov    %A1, %B0"      "\n\t"
+        "swap   %A1"           "\n\t"
+        "andi   %A1, 0x0F"     "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 13) {
+      __asm__ __volatile__(
+        "mov    %A1, %B0"      "\n\t"
+        "swap   %A1"           "\n\t"
+        "lsr    %A1"           "\n\t"
+        "andi   %A1, 0x07"     "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 14) {
+      __asm__ __volatile__(
+        "clr    %A1"           "\n\t"
+        "bst    %B0, 7"        "\n\t"
+        "bld    %A1, 1"        "\n\t"
+        "bst    %B0, 6"        "\n\t"
+        "bld    %A1, 0"        "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    } else if (N == 15) {
+      __asm__ __volatile__(
+        "clr    %A1"           "\n\t"
+        "bst    %B0, 7"        "\n\t"
+        "bld    %A1, 0"        "\n\t"
+        "eor    %A0, %A1"      "\n\t"
+      :"+r"(s), "=&d"(t));
+    }
+  }
+}
+
+/* One xorshift16 generator as an object. Xor16<3, 13, 9> produces the same sequence as
+ * xor16_3d9(), but each object has its own state, so you can have as many independent streams
+ * of the same generator as you like, and since everything is inline, in a hot loop the compiler
+ * can keep the state in registers instead of loading and storing it on every call.
+ * Xor16<a, b, c, true> is the RLR mirror (y ^= y >> a; y ^= y << b; y ^= y >> c) - same
+ * quality, bit-reversed output.
+ * Only the full period triplets are accepted. */
+template <uint8_t A, uint8_t B, uint8_t C, bool RLR = false> class Xor16 {
+  static_assert(rng16::isFullPeriod(A, B, C), "Xor16<a, b, c>: not one of the 60 full period triplets");
+  uint16_t _state;
+ public:
+  static const uint8_t a = A;
+  static const uint8_t b = B;
+  static const uint8_t c = C;
+  static const bool rlr = RLR;
+  Xor16(uint16_t seed = 1) : _state(seed ? seed : 1) {}
+  bool seed(uint16_t seed) {
+    if (__builtin_constant_p(seed)) {
+      if (seed == 0) {
+        badArg("rng's must be seeded with a non-zero value, but the argument passed is always zero");
+      }
+    }
+    if (seed) {
+      _state = seed;
+      return 1;
+    }
+    return 0;
+  }
+  /* Advance a state by one step without touching any object */
+  __attribute__((always_inline)) static inline uint16_t step(uint16_t s) {
+    if (RLR) {
+      rng16::xorshr<A>(s);
+      rng16::xorshl<B>(s);
+      rng16::xorshr<C>(s);
+    } else {
+      rng16::xorshl<A>(s);
+      rng16::xorshr<B>(s);
+      rng16::xorshl<C>(s);
+    }
+    return s;
+  }
+  __attribute__((always_inline)) inline uint16_t next() {
+    _state = step(_state);
+    return _state;
+  }
+  __attribute__((always_inline)) inline uint16_t operator()() {
+    return next();
+  }
+  uint16_t state() const {
+    return _state;
+  }
+};
+
+#if defined(GPIOR0) && defined(GPIOR1) && defined(GPIOR2)
+/* A generator whose state lives in a pair of GPIOR registers instead of SRAM: PAIR 0 is GPIOR0
+ * (low byte) and GPIOR1, PAIR 2 is GPIOR2 and GPIOR3, where a part has one. Those are reached
+ * with in and out, a clock each, where a state in SRAM takes two lds and two sts. Everything is
+ * static and inline, so there's nothing to construct. Xor16Gpior<3, 13, 9> gives the same sequence
+ * as xor16(). Nothing else may use those GPIORs - check your core and other libraries. */
+template <uint8_t A, uint8_t B, uint8_t C, uint8_t PAIR = 0> class Xor16Gpior {
+  static_assert(rng16::isFullPeriod(A, B, C), "Xor16Gpior<a, b, c>: not one of the 60 full period triplets");
+  #if defined(GPIOR3)
+  static_assert(PAIR == 0 || PAIR == 2, "Xor16Gpior: PAIR must be 0 (GPIOR0/1) or 2 (GPIOR2/3)");
+  #else
+  static_assert(PAIR == 0, "Xor16Gpior: this part has no GPIOR3, so PAIR must be 0 (GPIOR0/1)");
+  #endif
+ public:
+  static const uint8_t a = A;
+  static const uint8_t b = B;
+  static const uint8_t c = C;
+  __attribute__((always_inline)) static inline uint16_t state() {
+    uint16_t s;
+    if (PAIR == 0) {
+      __asm__ __volatile__(
+        "in     %A0, %1"       "\n\t"
+        "in     %B0, %2"       "\n\t"
+      :"=r"(s):"I"(_SFR_IO_ADDR(GPIOR0)), "I"(_SFR_IO_ADDR(GPIOR1)));
+    } else {
+      #if defined(GPIOR3)
+      __asm__ __volatile__(
+        "in     %A0, %1"       "\n\t"
+        "in     %B0, %2"       "\n\t"
+      :"=r"(s):"I"(_SFR_IO_ADDR(GPIOR2)), "I"(_SFR_IO_ADDR(GPIOR3)));
+      #endif
+    }
+    return s;
+  }
+  __attribute__((always_inline)) static inline void setState(uint16_t s) {
+    if (PAIR == 0) {
+      __asm__ __volatile__(
+        "out    %1, %A0"       "\n\t"
+        "out    %2, %B0"       "\n\t"
+      ::"r"(s), "I"(_SFR_IO_ADDR(GPIOR0)), "I"(_SFR_IO_ADDR(GPIOR1)));
+    } else {
+      #if defined(GPIOR3)
+      __asm__ __volatile__(
+        "out    %1, %A0"       "\n\t"
+        "out    %2, %B0"       "\n\t"
+      ::"r"(s), "I"(_SFR_IO_ADDR(GPIOR2)), "I"(_SFR_IO_ADDR(GPIOR3)));
+      #endif
+    }
+  }
+  __attribute__((always_inline)) static inline bool seed(uint16_t seed) {
+    if (__builtin_constant_p(seed)) {
+      if (seed == 0) {
+        badArg("rng's must be seeded with a non-zero value, but the argument passed is always zero");
+      }
+    }
+    if (seed) {
+      setState(seed);
+      return 1;
+    }
+    return 0;
+  }
+  __attribute__((always_inline)) static inline uint16_t next() {
+    uint16_t s = Xor16<A, B, C>::step(state());
+    setState(s);
+    return s;
+  }
+};
+#endif
+
+/* The same thing in a pair of CPU registers, which saves even the in and out:
+ *   XOR16_REGISTER_STATE(rng, 5, 9, 8, "r2")
+ * at file scope gives uint16_t rng() and bool seed_rng(uint16_t), with the state held in r2:r3
+ * by a global register variable. Use an even register from r2 to r14, and only from one file.
+ * Everything else has to leave the pair alone, so build the sketch, core and libraries with
+ * -ffixed-r2 -ffixed-r3 (or whichever). The precompiled parts of the toolchain (libgcc, avr-libc)
+ * may still borrow them and put them back, so don't use the generator from an ISR. */
+#define XOR16_REGISTER_STATE(name, a, b, c, reg)                                  \
+  register uint16_t name##_state asm(reg);                                        \
+  __attribute__((always_inline)) static inline uint16_t name() {                  \
+    return name##_state = Xor16<a, b, c>::step(name##_state);                     \
+  }                                                                               \
+  __attribute__((always_inline)) static inline bool seed_##name(uint16_t seed) {  \
+    if (seed) {                                                                   \
+      name##_state = seed;                                                        \
+      return 1;                                                                   \
+    }                                                                             \
+    return 0;                                                                     \
+  }
+#endif
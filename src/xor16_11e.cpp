@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 11e //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_11e_state;
+uint16_t __xor16_11e_state;
 
 bool seed_xor16_11e(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -37,3 +38,230 @@ uint16_t xor16_11e() {
     :"+d"((uint16_t)__xor16_11e_state)::"r18","r19");
   return __xor16_11e_state;
 }
+
+void xor16_11e_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_11e_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_11e_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x8002, 0x4005, 0x800A, 0x0014, 0x0028, 0x0050, 0x00A0, 0x0140,
+    0x0280, 0x0500, 0x0A00, 0x1400, 0x2800, 0x5000, 0xA000, 0xC000,
+    // M^2
+    0x8005, 0xA008, 0x8011, 0x8022, 0x0044, 0x0088, 0x0110, 0x0220,
+    0x0440, 0x0880, 0x1100, 0x2200, 0x4400, 0x8800, 0x9000, 0x6000,
+    // M^4
+    0x6014, 0x6822, 0xE041, 0xC080, 0x8101, 0x8202, 0x0404, 0x0808,
+    0x1010, 0x2020, 0x4040, 0x8080, 0x8100, 0x4200, 0x2400, 0x1800,
+    // M^8
+    0x0740, 0x0CA0, 0x1A10, 0x3408, 0x6804, 0x5002, 0xA001, 0x4000,
+    0x0001, 0xC002, 0x2004, 0x1008, 0x0810, 0x0420, 0x0240, 0x0180,
+    // M^16
+    0x4006, 0x200E, 0xB01E, 0x183C, 0x0C78, 0x06F0, 0x02E0, 0x0240,
+    0x0740, 0x0F60, 0x1E30, 0x3C18, 0x780C, 0x7006, 0x6003, 0x4001,
+    // M^32
+    0xF013, 0xF82A, 0xCC5F, 0xE6BE, 0x327C, 0x1B78, 0x0930, 0x0D80,
+    0x14F0, 0x2E18, 0x5FCC, 0x3E66, 0xFC33, 0xF819, 0x700D, 0x2005,
+    // M^64
+    0x6E67, 0x6FA8, 0x2836, 0x2F8A, 0x20E7, 0x3E37, 0x0392, 0x78DA,
+    0x8E4B, 0x6369, 0xF92D, 0x6DA5, 0x14B5, 0x4E95, 0xAED5, 0xC455,
+    // M^128
+    0x03FD, 0xF08D, 0x7A7E, 0x0FC7, 0x2213, 0x9AE8, 0xDAB7, 0x82DD,
+    0x1E63, 0x712A, 0x84A2, 0xFA3F, 0xCDC3, 0x4758, 0x60DF, 0xF689,
+    // M^256
+    0xF99C, 0xE854, 0x8629, 0xC0B0, 0xE711, 0x7D1A, 0x63A8, 0x8B9E,
+    0x715B, 0x9185, 0x9A93, 0xA9EA, 0x5DB2, 0x7C57, 0xDB37, 0x67A2,
+    // M^512
+    0x6FD7, 0x6BB8, 0x2882, 0xAD00, 0xA402, 0x7705, 0x718A, 0xECD4,
+    0xDE48, 0xBF60, 0x7F38, 0x7E8C, 0x3D66, 0xDAF3, 0xA5F9, 0xC3FD,
+    // M^1024
+    0x0A27, 0xF27D, 0x2313, 0xC6F2, 0x0D8E, 0x1B29, 0xB648, 0xAC9D,
+    0x393C, 0x427B, 0x5CF7, 0x95EE, 0x7DDC, 0xD0B8, 0x34F0, 0xA320,
+    // M^2048
+    0x17F5, 0x37E6, 0x5E2B, 0x7753, 0x4B24, 0x4489, 0x6072, 0xF454,
+    0xF2F0, 0xE8CC, 0x570E, 0xAD57, 0x9B0B, 0x96C4, 0xFDE1, 0x13F6,
+    // M^4096
+    0x046C, 0xF99F, 0x67B6, 0xB659, 0x5028, 0x3E1D, 0x331C, 0xC1AB,
+    0x909F, 0x68DA, 0x3546, 0xD8F5, 0x68D6, 0xFD32, 0x2C2B, 0x7371,
+    // M^8192
+    0xE9A8, 0x3F4B, 0x2DAD, 0x6A08, 0xCCB9, 0x9526, 0xEC66, 0x7BD9,
+    0xA638, 0xE4B5, 0x9D08, 0x1021, 0x355A, 0x2038, 0x6536, 0x18CF,
+    // M^16384
+    0x6F2F, 0x8A4B, 0x4BDB, 0xDB92, 0x5136, 0x9165, 0xBB4E, 0xFA5E,
+    0x72DD, 0x268A, 0x6C8C, 0x49D4, 0x5BCE, 0x13AF, 0x3547, 0x2382,
+    // M^32768
+    0xB3AF, 0xC964, 0x0614, 0x71AB, 0x1D97, 0x044E, 0xD72C, 0xC180,
+    0xB4EC, 0xF22E, 0x69A7, 0x55B3, 0x2818, 0x118F, 0x43C1, 0x37ED
+  };
+  __xor16_11e_state = __xor16_jump(__xor16_11e_state, table, n);
+  return __xor16_11e_state;
+}
+
+uint16_t xor16_11e_prev() {
+    __asm__ __volatile__(
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_11e_state)::"r18","r19");
+  return __xor16_11e_state;
+}
+
+static const uint16_t __xor16_11e_checkpoints[256] PROGMEM = {
+  0x0001, 0xF99C, 0x6FD7, 0xEC01, 0x0A27, 0xD294, 0x9A04, 0x8456,
+  0x17F5, 0x2A77, 0x2A7A, 0x957F, 0x7F2A, 0x7C8B, 0x934D, 0x0663,
+  0x046C, 0xC2B8, 0xFC35, 0x4BB7, 0x1477, 0xA963, 0xCC3E, 0xBB2A,
+  0x5A8D, 0x8A71, 0x5FF2, 0xCF4B, 0xDDE2, 0xDE7D, 0x057D, 0xAD6E,
+  0xE9A8, 0x2E47, 0x2AE2, 0x3940, 0x9AFC, 0x36DB, 0xF4AC, 0xB7FE,
+  0xE0FA, 0x9A1B, 0x3416, 0x321A, 0x7F95, 0x3A4F, 0x2D73, 0xD61E,
+  0xA3ED, 0xD102, 0x7828, 0xEE92, 0xE6E5, 0x214D, 0xD1A1, 0x9F64,
+  0x712C, 0xB00A, 0x6EA3, 0xE2D0, 0x5E60, 0x3ACB, 0x20C4, 0x1248,
+  0x6F2F, 0x5E8C, 0xE97E, 0x4F1D, 0x5084, 0x8B32, 0x5CC9, 0x64E6,
+  0xC6A2, 0xA953, 0x5635, 0x682D, 0xCC95, 0x9CD6, 0x6833, 0x8549,
+  0xD6EE, 0xD1D0, 0x9F5B, 0xBC76, 0xE2E0, 0xC46B, 0xE9CC, 0xB6DC,
+  0x04EF, 0x58EE, 0x148E, 0xE272, 0x40B0, 0xCAA2, 0x9A2A, 0x5781,
+  0x8ECA, 0x058C, 0x26CF, 0xC826, 0x0618, 0x2CB7, 0xC95A, 0xC879,
+  0xD5F0, 0x78D2, 0xB44B, 0x6E04, 0x83B5, 0xE95C, 0xDA53, 0x4C39,
+  0x4B69, 0xB59D, 0x7E05, 0x279B, 0xBBED, 0x255A, 0x3BC2, 0x68B3,
+  0x0ED7, 0x3A3A, 0xAB65, 0x33C6, 0x4770, 0x58D9, 0x1964, 0x1D98,
+  0xB3AF, 0x074C, 0x5F7C, 0xEA18, 0xDF0C, 0x7419, 0xBE7C, 0x5B81,
+  0xBDB3, 0x0438, 0xC028, 0x013F, 0xBC01, 0x8CA2, 0x4A0B, 0x3220,
+  0xCD7A, 0x2FF0, 0xDDCD, 0xF436, 0xF395, 0x6E94, 0xEF3A, 0xA18A,
+  0xC9D4, 0xED2A, 0xD71E, 0xD2B6, 0x0F4A, 0x98EB, 0xD7AE, 0xC323,
+  0x3099, 0x7446, 0x6D94, 0x0FE4, 0xC0A2, 0xA245, 0x966D, 0x90B1,
+  0xD219, 0xAE9F, 0x82D7, 0x6EE1, 0x692C, 0x4452, 0x2D49, 0x64F1,
+  0xB652, 0x21BC, 0x5A00, 0xBEEA, 0x5973, 0xB65F, 0x9EB9, 0xB055,
+  0xBD4B, 0xB6B5, 0x2371, 0x9CB6, 0x7681, 0x83C6, 0x0137, 0x7CB1,
+  0x21A2, 0x13DC, 0xF4D2, 0xE090, 0xAC4D, 0xF421, 0x8365, 0xE67B,
+  0xE30F, 0x774D, 0x5C32, 0xC7A3, 0x2194, 0xE7AA, 0x64EF, 0xFF8E,
+  0x6B84, 0xE3E3, 0xA4F8, 0x33EB, 0x856F, 0xC589, 0xE5EF, 0xE977,
+  0x7631, 0x9253, 0x3EE4, 0x901C, 0x9B98, 0xDF1B, 0x04E9, 0x3693,
+  0x57B4, 0x6B74, 0x91DE, 0xEAA1, 0xF7B5, 0x891D, 0xE707, 0x2D6E,
+  0x8E0A, 0xEDBA, 0xBB91, 0x9A60, 0x1CCD, 0x39F8, 0x4BD9, 0xA408,
+  0x41D6, 0xCB36, 0x01D7, 0xE99D, 0xCBF9, 0xBEB0, 0xF52E, 0xA56F,
+  0xB9DE, 0x3F1C, 0x53CA, 0xA689, 0xA251, 0xF755, 0x1C31, 0x0D5C
+};
+static const uint8_t __xor16_11e_order[256] PROGMEM = {
+    0, 190, 139, 242, 137,  16, 222,  88,  30,  97, 100,  15, 129,   4, 255, 120,
+  156, 163,  63, 193,  20,  90,   8, 126, 254, 236, 127,  62,  53, 204, 192, 177,
+  186, 117,  98, 115,   9,  10,  34, 101, 174, 231,  46,  33, 145, 160,  43, 143,
+  123, 211,  42, 223,  37,  35, 237, 121,  45,  61, 118, 218, 249,  92, 240, 173,
+  124, 142, 112,  19, 238, 111,  67,  68, 250,  74,  95, 224, 125,  89, 180, 178,
+   24, 135, 202,  70,  60,  65, 130,  26,  71, 206, 175,  75,  78, 119, 172, 225,
+  208, 162, 107, 149,  58, 171,  64,   2,  56, 133, 161, 216, 188, 201,  50, 105,
+   13, 191, 114,  12,  44, 170, 198, 108, 189,   7,  79, 212, 229,  25,  69, 141,
+  232,  96, 219, 167, 226, 217,  14,  11, 166, 157,   6,  41,  94, 235,  36, 220,
+  187,  77, 182,  82,  55, 151, 165, 252,  48, 239, 210, 247, 251,  73,  21, 122,
+  196,  31, 169,  57, 183, 128, 106, 113, 176, 181, 185,  87,  39, 248,  23, 234,
+  116, 140,  83, 184, 136, 134, 245, 179, 138, 164,  17, 159,  85, 213,  72, 203,
+   99, 103, 102, 152,  93, 241, 244,  22,  76, 144,  27,  49,  54,  81, 168,   5,
+  155, 104,  47,  80, 154, 158, 110, 146,  28,  29, 132, 221, 195,  40,  91,  59,
+   84, 200, 209, 214, 199,  52, 230, 205, 109, 215,  66, 243,  32,  86, 131, 227,
+    3, 153, 233,  51, 150, 148, 197, 147,  38, 194, 246, 253, 228,   1,  18, 207
+};
+
+uint16_t xor16_11e_position() {
+  uint16_t saved = __xor16_11e_state;
+  uint16_t pos = __xor16_position(saved, xor16_11e, __xor16_11e_checkpoints, __xor16_11e_order);
+  __xor16_11e_state = saved;
+  return pos;
+}
+
+void xor16_11e_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_11e, xor16_11e, __xor16_11e_checkpoints);
+}
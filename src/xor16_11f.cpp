@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 11f //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_11f_state;
+uint16_t __xor16_11f_state;
 
 bool seed_xor16_11f(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -35,3 +36,224 @@ uint16_t xor16_11f() {
     :"+d"((uint16_t)__xor16_11f_state)::"r18","r19");
   return __xor16_11f_state;
 }
+
+void xor16_11f_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_11f_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_11f_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0002, 0x8005, 0x000A, 0x0014, 0x0028, 0x0050, 0x00A0, 0x0140,
+    0x0280, 0x0500, 0x0A00, 0x1400, 0x2800, 0x5000, 0xA000, 0xC000,
+    // M^2
+    0x8005, 0xC008, 0x8011, 0x0022, 0x0044, 0x0088, 0x0110, 0x0220,
+    0x0440, 0x0880, 0x1100, 0x2200, 0x4400, 0x8800, 0x9000, 0x6000,
+    // M^4
+    0x6014, 0xF022, 0xE041, 0xC080, 0x8101, 0x0202, 0x0404, 0x0808,
+    0x1010, 0x2020, 0x4040, 0x8080, 0x8100, 0x4200, 0x2400, 0x1800,
+    // M^8
+    0x0740, 0x0D20, 0x1A10, 0x3408, 0x6804, 0xD002, 0xA001, 0x4000,
+    0x0001, 0x4002, 0x2004, 0x1008, 0x0810, 0x0420, 0x0240, 0x0180,
+    // M^16
+    0xC006, 0xE00F, 0x301E, 0x183C, 0x0C78, 0x06F0, 0x02E0, 0x0240,
+    0x0740, 0x0F60, 0x1E30, 0x3C18, 0x780C, 0xF006, 0xE003, 0x4001,
+    // M^32
+    0x7013, 0x582F, 0x4C5F, 0x66BE, 0x327C, 0x1B78, 0x0930, 0x0D80,
+    0x14F0, 0x2E18, 0x5FCC, 0xBE66, 0x7C33, 0xF819, 0x700D, 0x2005,
+    // M^64
+    0xEE67, 0xABFD, 0xA836, 0xAF8A, 0xA0E7, 0xBE37, 0x8392, 0xF8DA,
+    0x0E4B, 0x6369, 0xF92D, 0x6DA5, 0x14B5, 0x4E95, 0xAED5, 0xC455,
+    // M^128
+    0x03FD, 0x0604, 0xFA7E, 0x8FC7, 0xA213, 0x9AE8, 0x5AB7, 0x82DD,
+    0x9E63, 0xF12A, 0x04A2, 0x7A3F, 0x4DC3, 0x4758, 0xE0DF, 0xF689,
+    // M^256
+    0xF99C, 0x0FF6, 0x8629, 0xC0B0, 0xE711, 0xFD1A, 0x63A8, 0x0B9E,
+    0xF15B, 0x9185, 0x1A93, 0x29EA, 0xDDB2, 0xFC57, 0x5B37, 0xE7A2,
+    // M^512
+    0xEFD7, 0xA845, 0xA882, 0xAD00, 0x2402, 0x7705, 0xF18A, 0xECD4,
+    0xDE48, 0xBF60, 0x7F38, 0x7E8C, 0xBD66, 0x5AF3, 0xA5F9, 0xC3FD,
+    // M^1024
+    0x8A27, 0x515D, 0xA313, 0x46F2, 0x8D8E, 0x1B29, 0xB648, 0xAC9D,
+    0x393C, 0xC27B, 0xDCF7, 0x15EE, 0x7DDC, 0xD0B8, 0x34F0, 0xA320,
+    // M^2048
+    0x17F5, 0x2410, 0xDE2B, 0xF753, 0x4B24, 0x4489, 0xE072, 0xF454,
+    0xF2F0, 0xE8CC, 0xD70E, 0x2D57, 0x1B0B, 0x96C4, 0xFDE1, 0x93F6,
+    // M^4096
+    0x046C, 0x0AEE, 0xE7B6, 0xB659, 0x5028, 0x3E1D, 0x331C, 0x41AB,
+    0x109F, 0xE8DA, 0xB546, 0xD8F5, 0xE8D6, 0x7D32, 0xAC2B, 0x7371,
+    // M^8192
+    0xE9A8, 0x2784, 0x2DAD, 0x6A08, 0xCCB9, 0x1526, 0x6C66, 0x7BD9,
+    0xA638, 0xE4B5, 0x9D08, 0x1021, 0xB55A, 0x2038, 0xE536, 0x98CF,
+    // M^16384
+    0xEF2F, 0xA9C9, 0xCBDB, 0x5B92, 0xD136, 0x9165, 0x3B4E, 0x7A5E,
+    0x72DD, 0xA68A, 0x6C8C, 0x49D4, 0xDBCE, 0x93AF, 0xB547, 0xA382,
+    // M^32768
+    0x33AF, 0xFE89, 0x0614, 0xF1AB, 0x9D97, 0x844E, 0xD72C, 0xC180,
+    0xB4EC, 0x722E, 0xE9A7, 0xD5B3, 0x2818, 0x918F, 0x43C1, 0x37ED
+  };
+  __xor16_11f_state = __xor16_jump(__xor16_11f_state, table, n);
+  return __xor16_11f_state;
+}
+
+uint16_t xor16_11f_prev() {
+    __asm__ __volatile__(
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_11f_state)::"r18","r19");
+  return __xor16_11f_state;
+}
+
+static const uint16_t __xor16_11f_checkpoints[256] PROGMEM = {
+  0x0001, 0xF99C, 0xEFD7, 0xEC01, 0x8A27, 0xD294, 0x9A04, 0x0456,
+  0x17F5, 0xAA77, 0xAA7A, 0x157F, 0xFF2A, 0xFC8B, 0x934D, 0x8663,
+  0x046C, 0xC2B8, 0xFC35, 0xCBB7, 0x9477, 0x2963, 0x4C3E, 0x3B2A,
+  0x5A8D, 0x8A71, 0xDFF2, 0x4F4B, 0x5DE2, 0xDE7D, 0x057D, 0x2D6E,
+  0xE9A8, 0xAE47, 0xAAE2, 0x3940, 0x9AFC, 0xB6DB, 0xF4AC, 0x37FE,
+  0x60FA, 0x1A1B, 0xB416, 0xB21A, 0x7F95, 0xBA4F, 0xAD73, 0x561E,
+  0xA3ED, 0x5102, 0x7828, 0x6E92, 0xE6E5, 0x214D, 0xD1A1, 0x9F64,
+  0x712C, 0x300A, 0xEEA3, 0xE2D0, 0x5E60, 0xBACB, 0x20C4, 0x1248,
+  0xEF2F, 0x5E8C, 0x697E, 0x4F1D, 0x5084, 0x0B32, 0x5CC9, 0xE4E6,
+  0x46A2, 0x2953, 0x5635, 0x682D, 0xCC95, 0x1CD6, 0xE833, 0x8549,
+  0x56EE, 0xD1D0, 0x1F5B, 0x3C76, 0xE2E0, 0x446B, 0xE9CC, 0xB6DC,
+  0x84EF, 0xD8EE, 0x948E, 0x6272, 0x40B0, 0x4AA2, 0x1A2A, 0x5781,
+  0x0ECA, 0x058C, 0xA6CF, 0x4826, 0x0618, 0xACB7, 0x495A, 0xC879,
+  0xD5F0, 0xF8D2, 0x344B, 0x6E04, 0x83B5, 0xE95C, 0x5A53, 0x4C39,
+  0x4B69, 0xB59D, 0x7E05, 0xA79B, 0xBBED, 0xA55A, 0xBBC2, 0xE8B3,
+  0x8ED7, 0xBA3A, 0xAB65, 0xB3C6, 0x4770, 0x58D9, 0x1964, 0x1D98,
+  0x33AF, 0x074C, 0x5F7C, 0xEA18, 0xDF0C, 0x7419, 0xBE7C, 0x5B81,
+  0x3DB3, 0x0438, 0xC028, 0x813F, 0xBC01, 0x0CA2, 0xCA0B, 0x3220,
+  0x4D7A, 0x2FF0, 0xDDCD, 0x7436, 0xF395, 0x6E94, 0x6F3A, 0x218A,
+  0xC9D4, 0x6D2A, 0x571E, 0x52B6, 0x8F4A, 0x18EB, 0x57AE, 0x4323,
+  0x3099, 0xF446, 0x6D94, 0x0FE4, 0x40A2, 0xA245, 0x966D, 0x90B1,
+  0xD219, 0x2E9F, 0x02D7, 0x6EE1, 0x692C, 0xC452, 0x2D49, 0x64F1,
+  0x3652, 0x21BC, 0x5A00, 0x3EEA, 0xD973, 0x365F, 0x9EB9, 0xB055,
+  0x3D4B, 0xB6B5, 0x2371, 0x1CB6, 0x7681, 0x03C6, 0x8137, 0x7CB1,
+  0xA1A2, 0x13DC, 0x74D2, 0xE090, 0xAC4D, 0xF421, 0x8365, 0x667B,
+  0x630F, 0x774D, 0xDC32, 0x47A3, 0x2194, 0x67AA, 0xE4EF, 0x7F8E,
+  0x6B84, 0x63E3, 0xA4F8, 0xB3EB, 0x056F, 0xC589, 0x65EF, 0x6977,
+  0x7631, 0x1253, 0x3EE4, 0x901C, 0x9B98, 0x5F1B, 0x04E9, 0xB693,
+  0x57B4, 0x6B74, 0x11DE, 0xEAA1, 0xF7B5, 0x891D, 0x6707, 0xAD6E,
+  0x0E0A, 0x6DBA, 0xBB91, 0x9A60, 0x1CCD, 0x39F8, 0x4BD9, 0xA408,
+  0xC1D6, 0x4B36, 0x81D7, 0xE99D, 0xCBF9, 0xBEB0, 0x752E, 0x256F,
+  0x39DE, 0x3F1C, 0xD3CA, 0xA689, 0xA251, 0xF755, 0x1C31, 0x0D5C
+};
+static const uint8_t __xor16_11f_order[256] PROGMEM = {
+    0, 170, 189, 137,   7,  16, 222, 212,  30,  97, 100, 129,  69, 141, 255, 232,
+   96, 163, 226,  63, 217, 193,  11,   8, 157, 126,  41,  94, 254, 187, 236,  77,
+  127,  82,  62,  53, 151, 204, 177, 186, 247,  73,  21, 174,  31, 169, 145,  57,
+  160, 143, 128, 106, 176, 181,  39,  35, 248, 237,  23,  83, 184, 136, 218, 179,
+  249, 164,  92, 159,  85,  72, 124, 203,  99, 102,  93, 241, 112, 238, 111,  22,
+  144,  67,  27,  68,  49, 155,  47,  74,  80, 154,  95, 158, 224, 125, 178, 110,
+   24, 135,  70,  28,  60,  65, 221, 130,  40,  91, 200, 209, 175, 214, 199, 230,
+  205,  75, 172, 215,  66, 225, 208, 153, 162, 233, 107,  51, 149, 171, 150,  56,
+  133, 147, 194, 246, 216, 188, 201,  50, 191, 114, 207,  44, 190, 139, 242, 198,
+  108,  88,  79,  15, 229,   4,  25, 120, 156, 219, 167,  14,  20,  90, 166,   6,
+  235,  36, 220, 182,  55, 192, 165, 252,  48, 239, 210, 117, 251,  98, 115,   9,
+   10,  34, 122, 196, 101, 231,  46,  33, 183,  43, 123, 211,  42, 113, 223, 185,
+   37,  87, 121,  45,  61, 234, 118, 116, 140, 134, 245, 138, 240,  17, 173, 213,
+  103, 152, 142,  19, 244,  76,  54,  81, 168,   5, 250, 104,  89, 180, 202, 146,
+   29, 132,  26, 195,  59,  84,  71, 206,  52,  78, 119, 109, 243,  32,  86, 131,
+  227,   3,  58,  64,   2, 148, 197, 161,  38, 253, 228, 105,   1,  18,  13,  12
+};
+
+uint16_t xor16_11f_position() {
+  uint16_t saved = __xor16_11f_state;
+  uint16_t pos = __xor16_position(saved, xor16_11f, __xor16_11f_checkpoints, __xor16_11f_order);
+  __xor16_11f_state = saved;
+  return pos;
+}
+
+void xor16_11f_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_11f, xor16_11f, __xor16_11f_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 152 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_152_state;
+uint16_t __xor16_152_state;
 
 bool seed_xor16_152(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -24,18 +25,187 @@ uint16_t xor16_152() {
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_152_state)::"r18","r19");
+  return __xor16_152_state;
+}
+
+void xor16_152_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_152_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_152_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x000F, 0x001E, 0x003C, 0x0078, 0x00F5, 0x01EF, 0x03DE, 0x07BC,
+    0x0F78, 0x1EF0, 0x3DE0, 0x7BC0, 0xF780, 0xEF00, 0xDE00, 0x9400,
+    // M^2
+    0x0055, 0x00AF, 0x015E, 0x02BC, 0x054B, 0x0AA0, 0x1545, 0x2A8A,
+    0x5514, 0xAA28, 0x5455, 0xA8AA, 0x7954, 0xF2A8, 0xE550, 0x5E60,
+    // M^4
+    0x1105, 0x2332, 0x4657, 0x8CAB, 0x1642, 0x22A8, 0x6C5B, 0xD8B3,
+    0x9950, 0xA656, 0xD954, 0x265B, 0x8242, 0xB872, 0x58D7, 0xD536,
+    // M^8
+    0x4C40, 0x90AC, 0x29AC, 0x6EBE, 0xB229, 0x6894, 0xDB2F, 0xF796,
+    0x9266, 0x0D3A, 0x8CE6, 0x03F5, 0x3C09, 0xB2DE, 0x2A04, 0x1E28,
+    // M^16
+    0x7E38, 0xFA31, 0xFB5D, 0xE066, 0xD7AF, 0xF73C, 0x67E6, 0x55FE,
+    0x25A0, 0x39DA, 0x6C16, 0x0CB4, 0x233A, 0xD4EB, 0x95BD, 0xB80A,
+    // M^32
+    0xFBE1, 0xB1A3, 0x1FE2, 0x68EA, 0x4311, 0x91A2, 0xF572, 0x0CB0,
+    0x3F9F, 0x2125, 0xF737, 0xEE92, 0xF255, 0xC3D0, 0xC2E8, 0x5938,
+    // M^64
+    0xC9FC, 0x8072, 0x2C89, 0x5E83, 0x64A2, 0xB843, 0xF49F, 0xC7A6,
+    0x4471, 0x89EE, 0xC4CB, 0x9E82, 0xD910, 0x3FB9, 0xBA7F, 0x5BE9,
+    // M^128
+    0xA6B7, 0xF3E5, 0x3529, 0x3EE0, 0xBE9A, 0x9ED3, 0x5B74, 0x3BDC,
+    0x9F36, 0xF818, 0x0169, 0x168A, 0x86D7, 0xFD47, 0xB9D6, 0x2C77,
+    // M^256
+    0x53AF, 0xE4FA, 0xE34B, 0x6A10, 0xF05F, 0xCE3B, 0x00B1, 0xDFCF,
+    0x3CE8, 0x78C1, 0xC2C6, 0x897F, 0x6B4F, 0x5DEB, 0xC6A5, 0xF1E2,
+    // M^512
+    0xC639, 0xC79A, 0xF371, 0x9AAF, 0xCF03, 0xE71E, 0xB204, 0xB2E8,
+    0x0648, 0xF5AF, 0x9749, 0x44AE, 0x68A7, 0x16BB, 0x2C50, 0xC8B4,
+    // M^1024
+    0xF289, 0xA094, 0x353F, 0x2C99, 0xC547, 0xF7B6, 0xB076, 0x3E5A,
+    0x4A4D, 0x3672, 0x2A2F, 0x40AB, 0xD961, 0x0BB8, 0xB85B, 0xC9CE,
+    // M^2048
+    0x7574, 0x0C54, 0xCBF1, 0x4431, 0xC6A3, 0x6C5C, 0x0C3B, 0x7713,
+    0x95DB, 0xEC97, 0xC16C, 0x0F33, 0x175B, 0x1CA6, 0x5009, 0x4C6D,
+    // M^4096
+    0x6276, 0xCF36, 0xCEB8, 0x4EEE, 0x53F0, 0xC7A8, 0x59B1, 0x5C57,
+    0x8F1B, 0xCDFC, 0x6618, 0x64CC, 0x58F2, 0x05EE, 0x7617, 0x0485,
+    // M^8192
+    0x7262, 0xA777, 0x3B5B, 0x3411, 0xFDBC, 0x837C, 0x6F4B, 0x4588,
+    0xF4E8, 0xEEB5, 0xC503, 0x9051, 0x14A1, 0x642D, 0xB0E7, 0x9681,
+    // M^16384
+    0x659E, 0xD237, 0x8973, 0x3A51, 0xC352, 0x921D, 0x158A, 0xF095,
+    0x0E47, 0x8BDD, 0xC298, 0x62B5, 0x6534, 0xEF9D, 0xA1FC, 0x9E7C,
+    // M^32768
+    0xD06C, 0xBEFC, 0x01E2, 0xD087, 0xBEF5, 0x657B, 0xB118, 0x6A03,
+    0x00A0, 0x89A2, 0xBDCB, 0x888B, 0x5A82, 0x10D1, 0x78D4, 0x275F
+  };
+  __xor16_152_state = __xor16_jump(__xor16_152_state, table, n);
+  return __xor16_152_state;
+}
+
+uint16_t xor16_152_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
@@ -43,6 +213,80 @@ uint16_t xor16_152() {
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
     :"+d"((uint16_t)__xor16_152_state)::"r18","r19");
   return __xor16_152_state;
 }
+
+static const uint16_t __xor16_152_checkpoints[256] PROGMEM = {
+  0x0001, 0x53AF, 0xC639, 0x8A9B, 0xF289, 0x9F52, 0x8129, 0x3A8E,
+  0x7574, 0xD3B1, 0xAA25, 0x2368, 0xBD58, 0x2AE9, 0x84AF, 0x1CDE,
+  0x6276, 0xDAEB, 0x61B6, 0x41BC, 0x92BD, 0xD933, 0x60AE, 0xE71B,
+  0xC159, 0xC2FE, 0xC33D, 0x97FE, 0x90F9, 0x4208, 0xD474, 0x4350,
+  0x7262, 0xA2B0, 0x3563, 0xB155, 0xBBA4, 0xF8AF, 0xA766, 0xE3DD,
+  0xDB50, 0x61B0, 0x460D, 0xA656, 0xE151, 0xF505, 0x4F29, 0x3EB1,
+  0xB7D8, 0x0498, 0x8746, 0x700D, 0x2AF5, 0xFDAB, 0xBA03, 0x81AD,
+  0x060A, 0x34ED, 0x3FD3, 0xA140, 0x9050, 0x6A43, 0xDD14, 0x384D,
+  0x659E, 0x2751, 0x7845, 0xC92B, 0x91AE, 0xDA10, 0x5DE9, 0xF241,
+  0x2A3C, 0x1B6A, 0xE679, 0xD7C1, 0x5636, 0x2E38, 0x3AE7, 0x8241,
+  0xDA3D, 0x4926, 0xBAB8, 0xBD43, 0x07F3, 0xD0A0, 0x4DFC, 0xD9B5,
+  0xB8D0, 0x6118, 0x3DE9, 0x690F, 0x10D7, 0x1070, 0x559A, 0xF2BE,
+  0xF528, 0x5BE6, 0x7648, 0x20A7, 0x1801, 0xB19F, 0xEA30, 0xA576,
+  0x6B43, 0xE1FC, 0x3E05, 0xB538, 0x6D1C, 0x951B, 0x4999, 0x651D,
+  0x4FCB, 0xCB0E, 0x97B0, 0xFDE9, 0x5E48, 0xF433, 0x4A14, 0x240F,
+  0xA123, 0xE98F, 0x3EFA, 0x6A2C, 0x2D90, 0x052A, 0xBEFF, 0x2B2A,
+  0xD06C, 0x1BD9, 0xB087, 0x4C97, 0xF692, 0x708E, 0x426F, 0x4EE0,
+  0xE498, 0xEDEA, 0x8252, 0x9D37, 0x8786, 0xAF73, 0x2A19, 0x65B5,
+  0x342F, 0x0457, 0x6636, 0x189C, 0x44FB, 0x383C, 0x08E4, 0x7B71,
+  0x502D, 0xB925, 0x0C0E, 0x2618, 0x7DA3, 0x21F1, 0xD3B6, 0xFE3B,
+  0xD1BA, 0x0FA1, 0x4DCB, 0xB3CF, 0x621F, 0x2DDE, 0x683A, 0xA2BF,
+  0x0B6D, 0xD928, 0x4DB4, 0xB314, 0x907B, 0x793D, 0xA106, 0x9750,
+  0xECAC, 0xB9BA, 0x1D90, 0x338E, 0xC0E3, 0x9157, 0x02B5, 0x298E,
+  0x5A12, 0x48F1, 0xFD6F, 0x8636, 0x7230, 0xB6A4, 0x8FFE, 0x72C9,
+  0x6E01, 0xFB99, 0xDA9A, 0x0CCC, 0x1D9C, 0xBAD5, 0xA93D, 0xFD0E,
+  0x1B13, 0xE113, 0x114E, 0x3AB7, 0x72AF, 0xA73A, 0x9A68, 0xCF89,
+  0xDEA7, 0x2A9A, 0x0D2F, 0x8764, 0x5ACC, 0x0A71, 0x9CC4, 0xED21,
+  0x8069, 0x06D7, 0xC138, 0x5FDB, 0x501E, 0x3014, 0x25B0, 0x426E,
+  0x1D4F, 0x22A1, 0x6771, 0x70DB, 0x0265, 0x06AF, 0x95FD, 0x5F6D,
+  0xB604, 0x9E0A, 0x273F, 0xDB6E, 0x3275, 0xC054, 0x24E2, 0x6A92,
+  0xA19A, 0x319B, 0xF899, 0x9EB3, 0xFF2B, 0x1D0D, 0xC6EA, 0x12EF,
+  0x3CC5, 0x1287, 0x985F, 0xDD32, 0xF1C7, 0xB66B, 0x6E8E, 0x1A58
+};
+static const uint8_t __xor16_152_order[256] PROGMEM = {
+    0, 228, 182, 145,  49, 125,  56, 229, 217,  84, 150, 213, 168, 154, 195, 210,
+  161,  93,  92, 202, 249, 247, 100, 147, 255, 200,  73, 129,  15, 245, 224, 178,
+  196,  99, 157, 225,  11, 119, 238, 222, 155, 234,  65, 183, 142,  72, 209,  13,
+   52, 127, 124, 165,  77, 221, 241, 236, 179, 144,  57,  34, 149,  63,   7, 203,
+   78, 248,  90, 106,  47, 122,  58,  19,  29, 223, 134,  31, 148,  42, 185,  81,
+  110, 118, 131, 170, 162,  86, 135,  46, 112, 220, 152,   1,  94,  76, 184, 212,
+   97,  70, 116, 231, 219,  22,  89,  41,  18, 164,  16, 111,  64, 143, 146, 226,
+  166,  91, 123,  61, 239, 104, 108, 192, 254,  51, 133, 227, 188,  32, 204, 191,
+    8,  98,  66, 173, 151, 156, 216,   6,  55,  79, 138,  14, 187,  50, 211, 140,
+    3, 190,  60, 172,  28, 181,  68,  20, 109, 230, 175, 114,  27, 250, 206, 214,
+  139, 233, 243,   5, 174, 120,  59, 240,  33, 167, 103,  43, 205,  38, 198,  10,
+  141, 130,  35, 101, 171, 163, 107, 232, 253, 189,  48,  88, 153, 177,  54,  82,
+  197,  36,  83,  12, 126, 237, 180, 218,  24,  25,  26,   2, 246,  67, 113, 207,
+  128,  85, 160,   9, 158,  30,  75, 169,  21,  87,  69,  80, 194,  17,  40, 235,
+   62, 251, 208, 201,  44, 105,  39, 136,  74,  23, 121, 102, 176, 215, 137, 252,
+   71,   4,  95, 117,  45,  96, 132, 242,  37, 193, 199, 186,  53, 115, 159, 244
+};
+
+uint16_t xor16_152_position() {
+  uint16_t saved = __xor16_152_state;
+  uint16_t pos = __xor16_position(saved, xor16_152, __xor16_152_checkpoints, __xor16_152_order);
+  __xor16_152_state = saved;
+  return pos;
+}
+
+void xor16_152_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_152, xor16_152, __xor16_152_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 174 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_174_state;
+uint16_t __xor16_174_state;
 
 bool seed_xor16_174(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -23,25 +24,258 @@ uint16_t xor16_174() {
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_174_state)::"r18","r19");
+  return __xor16_174_state;
+}
+
+void xor16_174_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
       "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
       "mov    r18, r19"      "\n\t"
-      "adc    r18, r18"      "\n\t"
-      "sbc    r19, r19"      "\n\t"
-      "neg    r19"           "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
       "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_174_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_174_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0033, 0x0066, 0x00CC, 0x0198, 0x0330, 0x0660, 0x0CD1, 0x19B3,
+    0x3366, 0x66CC, 0xCD98, 0x9B30, 0x3660, 0x6CC0, 0xD980, 0x9100,
+    // M^2
+    0x0505, 0x0A1B, 0x1436, 0x287D, 0x50FA, 0xA1E5, 0x40C9, 0x8280,
+    0x0511, 0x0A22, 0x3655, 0x6CAA, 0xFB45, 0xF68A, 0xCF05, 0x9406,
+    // M^4
+    0x2277, 0x1111, 0x2222, 0x12B8, 0x2570, 0x1502, 0x2034, 0x1CA4,
+    0x66BB, 0xCD76, 0x30B8, 0x6273, 0x64AF, 0xCA5D, 0x1FFC, 0x473B,
+    // M^8
+    0x0629, 0x0513, 0x0338, 0x97B7, 0x8C18, 0x23BD, 0xD80D, 0x1DE0,
+    0x2567, 0x4FC2, 0x909C, 0x3BF7, 0xEF43, 0xE06B, 0xA1D1, 0x9525,
+    // M^16
+    0x6D7D, 0x3AD9, 0x52B7, 0x3218, 0x25E1, 0xAA2D, 0x72E6, 0x871F,
+    0xAE22, 0xA0E1, 0x7F11, 0x3430, 0xCE66, 0xBBA2, 0x1FF5, 0xE931,
+    // M^32
+    0xB1AC, 0x6E68, 0x7CB2, 0xC2DC, 0x5838, 0x61BD, 0xFD6A, 0x8A09,
+    0x29A7, 0x603A, 0x674F, 0x8519, 0xADA1, 0xB1ED, 0xCE7B, 0x35C5,
+    // M^64
+    0x55F4, 0xA3F1, 0xED85, 0x0AB1, 0x1D9A, 0xEA7F, 0x1C60, 0xA396,
+    0x5591, 0xEAA7, 0xCD84, 0x5065, 0x15C1, 0x1932, 0xA025, 0xE8D9,
+    // M^128
+    0x8867, 0x533A, 0x8259, 0xBB45, 0xCAFD, 0x11B8, 0x7E3F, 0xBEA5,
+    0xC609, 0xB965, 0xCE9F, 0xFB8A, 0x67D6, 0x4421, 0xA3E5, 0xFC82,
+    // M^256
+    0x318B, 0x8865, 0xC207, 0x2F92, 0xB72C, 0x7F7A, 0x3566, 0xF626,
+    0x1BBF, 0x874F, 0x450E, 0xAEAC, 0x8D33, 0xF4A5, 0x1CD3, 0xA41A,
+    // M^512
+    0x0273, 0xB326, 0x446F, 0x4A98, 0x969D, 0x48D0, 0x2759, 0x3606,
+    0xD564, 0x1CF9, 0x2792, 0x589B, 0x25BF, 0xFE81, 0xAB13, 0x056A,
+    // M^1024
+    0x54B8, 0xA850, 0x5CAA, 0x0572, 0xB7A1, 0x744A, 0xE9A1, 0x171C,
+    0x52D6, 0xDD4F, 0x0333, 0x8D61, 0x5B9E, 0x22C2, 0x4D25, 0x64C1,
+    // M^2048
+    0xC40D, 0x9562, 0x569D, 0xD3FF, 0xA6D9, 0x73C9, 0xE37F, 0x394D,
+    0x7612, 0xE26F, 0xB09A, 0x7116, 0x4576, 0xA960, 0xEDF9, 0xC6D1,
+    // M^4096
+    0xDADD, 0x40FB, 0x2481, 0x210C, 0x565D, 0x5852, 0xF457, 0x4902,
+    0x60A1, 0x249C, 0xF3CE, 0x12DB, 0xDEE1, 0xF803, 0x2D06, 0xC13B,
+    // M^8192
+    0x30C3, 0x2576, 0x9812, 0x9D2F, 0x59EF, 0x03CD, 0x25BC, 0x1F87,
+    0x1E88, 0x111F, 0x76C1, 0xAA5F, 0xC88F, 0x4222, 0x1DCD, 0x39B9,
+    // M^16384
+    0xA523, 0xE891, 0x27F0, 0x2065, 0x48EB, 0x0052, 0x6AF3, 0x89A6,
+    0x87A6, 0x9F60, 0xFA46, 0xAC00, 0x8124, 0x2A69, 0x055C, 0xD633,
+    // M^32768
+    0xCC5A, 0x3168, 0x6305, 0xC21B, 0x278C, 0xCA89, 0xFA0B, 0xBB00,
+    0x7226, 0x7336, 0xEED0, 0xAA1C, 0x7637, 0xF6EE, 0x586D, 0x3266
+  };
+  __xor16_174_state = __xor16_jump(__xor16_174_state, table, n);
+  return __xor16_174_state;
+}
+
+uint16_t xor16_174_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
     :"+d"((uint16_t)__xor16_174_state)::"r18","r19");
   return __xor16_174_state;
 }
+
+static const uint16_t __xor16_174_checkpoints[256] PROGMEM = {
+  0x0001, 0x318B, 0x0273, 0xC391, 0x54B8, 0xC50C, 0x0BED, 0x5278,
+  0xC40D, 0x21D9, 0x856F, 0xE4CC, 0x27B7, 0x68C2, 0x0DFF, 0xAF70,
+  0xDADD, 0xB46B, 0x44E2, 0x6D82, 0x6628, 0x7ADF, 0x6CB1, 0x0C2F,
+  0xC0A3, 0x887B, 0x61FA, 0x5F28, 0xB65A, 0x3A70, 0xAD45, 0x6648,
+  0x30C3, 0x0338, 0x7B34, 0x5D48, 0x7B09, 0x4900, 0xA9C0, 0x26EC,
+  0x674B, 0x9292, 0x6709, 0x2F91, 0xF376, 0xEAFD, 0xB287, 0xD70C,
+  0x0191, 0x6B3E, 0x778C, 0xA708, 0xA6D3, 0x5F7C, 0xF617, 0xCFDB,
+  0x2D8B, 0x64E2, 0x9927, 0x98A9, 0x10C0, 0x4E73, 0x34E0, 0x80A2,
+  0xA523, 0xC89A, 0xF098, 0xAFC7, 0x9F44, 0xA91A, 0xF577, 0x1937,
+  0x8B9F, 0x8337, 0x8B55, 0xE780, 0x63B4, 0x88F1, 0x302B, 0x9090,
+  0x6823, 0x804E, 0xF48C, 0x9FE2, 0x6A24, 0x7CE8, 0x1D4F, 0x1C33,
+  0x1729, 0x35AE, 0xCB8B, 0xEACF, 0xF2B4, 0xBA67, 0xC59A, 0x0085,
+  0x05AA, 0x701A, 0x759E, 0x1F0E, 0x9F91, 0x2EFA, 0x34A9, 0xABDD,
+  0xCA91, 0xE1AB, 0x48F3, 0x0087, 0x8DCF, 0xC33C, 0x01FA, 0xB75E,
+  0xE3C8, 0x3C4E, 0xC2A2, 0x3EBF, 0x7F70, 0xEF27, 0x3FAD, 0x5B86,
+  0x1FF8, 0xDEE5, 0x16A1, 0xF7A5, 0x6271, 0xA382, 0xB20C, 0xB756,
+  0xCC5A, 0x76D6, 0x990A, 0x3BCD, 0x5494, 0x57E3, 0x4DCA, 0x8879,
+  0xE99F, 0xEC0E, 0xC23E, 0x9220, 0xD11C, 0x74FC, 0xC6C8, 0x965A,
+  0xCED5, 0x53C4, 0x0C57, 0x1201, 0x3BF7, 0x3B35, 0x7010, 0xD269,
+  0xE6B0, 0xB05D, 0x83D8, 0x6314, 0x01AD, 0x4EFD, 0xA736, 0x0B75,
+  0x3CE0, 0x2E0E, 0xFDB8, 0x20A0, 0x7DF9, 0x8057, 0x5DB9, 0x4194,
+  0x8461, 0x9A83, 0x4F02, 0xE3E4, 0xAEA1, 0x8485, 0xE4BE, 0x52E2,
+  0x22F0, 0x78FC, 0x2D6A, 0xE953, 0xC2DB, 0xDD96, 0xCE8F, 0x7679,
+  0x442D, 0xFAB9, 0xC8D5, 0x9185, 0x373C, 0x85AB, 0xE58B, 0x7287,
+  0x6FC5, 0xAFE8, 0xB445, 0x5E68, 0x9883, 0xC84D, 0xFF1D, 0xDD3F,
+  0x59CA, 0x4044, 0xEBB2, 0xC825, 0x9A93, 0xF82E, 0x7579, 0xD8DD,
+  0x3324, 0x581B, 0x1E1C, 0xBB67, 0xDE25, 0xD5E1, 0xE6FA, 0x22CC,
+  0x5D3F, 0xFDD0, 0x452E, 0x58E8, 0xACE4, 0xC520, 0x9902, 0x145F,
+  0x1E0C, 0x0C4B, 0x48B8, 0xA39D, 0x515B, 0x9E69, 0x11C1, 0x6447,
+  0xE3F7, 0xA063, 0xA34D, 0x2537, 0x19AB, 0x2700, 0x2D5B, 0x108E,
+  0x1EE5, 0xAE68, 0x59DC, 0xBD0A, 0x8A66, 0x8D87, 0xD9C8, 0x6C3B,
+  0x5DFE, 0x0F1B, 0x5602, 0xDBC4, 0x06E1, 0x4FF0, 0x6097, 0xD295
+};
+static const uint8_t __xor16_174_order[256] PROGMEM = {
+    0,  95, 107,  48, 156, 110,   2,  33,  96, 252, 159,   6,  23, 225, 146,  14,
+  249, 239,  60, 230, 147, 223, 122,  88,  71, 236,  87,  86, 224, 210, 240,  99,
+  120, 163,   9, 215, 176, 235,  39, 237,  12, 238, 178,  56, 161, 101,  43,  78,
+   32,   1, 208, 102,  62,  89, 188,  29, 149, 131, 148, 113, 160, 115, 118, 201,
+  167, 184,  18, 218, 226, 106,  37, 134,  61, 157, 170, 253, 228,   7, 175, 145,
+  132,   4, 250, 133, 209, 219, 200, 242, 119, 216,  35, 166, 248, 195,  27,  53,
+  254,  26, 124, 155,  76, 231,  57,  20,  31,  42,  40,  80,  13,  84,  49, 247,
+   22,  19, 192, 150,  97, 191, 141, 206,  98, 183, 129,  50, 177,  21,  36,  34,
+   85, 164, 116,  81, 165,  63,  73, 154, 168, 173,  10, 189, 135,  25,  77, 244,
+   74,  72, 245, 108,  79, 187, 139,  41, 143, 196,  59, 222, 130,  58, 169, 204,
+  229,  68, 100,  83, 233, 234, 125, 227,  64,  52,  51, 158,  69,  38, 103, 220,
+   30, 241, 172,  15,  67, 193, 153, 126,  46, 194,  17,  28, 127, 111,  93, 211,
+  243,  24, 138, 114, 180, 109,   3,   8,   5, 221,  94, 142, 203, 197,  65, 186,
+  104,  90, 128, 182, 144,  55, 140, 151, 255, 213,  47, 207, 246,  16, 251, 199,
+  181, 212, 121, 105, 112, 171, 232, 174,  11, 190, 152, 214,  75, 179, 136,  91,
+   45, 202, 137, 117,  66,  92,  44,  82,  70,  54, 123, 205, 185, 162, 217, 198
+};
+
+uint16_t xor16_174_position() {
+  uint16_t saved = __xor16_174_state;
+  uint16_t pos = __xor16_position(saved, xor16_174, __xor16_174_checkpoints, __xor16_174_order);
+  __xor16_174_state = saved;
+  return pos;
+}
+
+void xor16_174_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_174, xor16_174, __xor16_174_checkpoints);
+}
@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: 17b //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_17b_state;
+uint16_t __xor16_17b_state;
+static uint16_t __xor16_17b_weyl_count;
+static uint8_t __xor16_17b_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_17b_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_17b(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_17b(uint16_t seed) {
   }
   if(seed) {
     __xor16_17b_state = seed;
+    __xor16_17b_spare_full = 0;
     return 1;
   }
   return 0;
@@ -39,3 +44,422 @@ uint16_t xor16_17b() {
     :"+d"((uint16_t)__xor16_17b_state)::"r18","r19");
   return __xor16_17b_state;
 }
+
+uint16_t xor16_17b_star() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_17b_state)::"r18","r19");
+  return rng16::star(__xor16_17b_state);
+}
+
+/* The same step as xor16_17b(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_17b_weyl(uint16_t seed) {
+  __xor16_17b_state = seed ? seed : 1;
+  __xor16_17b_weyl_count = seed;
+  __xor16_17b_spare_full = 0;
+}
+
+uint16_t xor16_17b_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_17b_state), "+d"(__xor16_17b_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_17b(). */
+uint8_t xor16_17b_byte() {
+  if (__xor16_17b_spare_full) {
+    __xor16_17b_spare_full = 0;
+    return __xor16_17b_spare;
+  }
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_17b_state)::"r18","r19");
+  __xor16_17b_spare = __xor16_17b_state >> 8;
+  __xor16_17b_spare_full = 1;
+  return __xor16_17b_state;
+}
+
+/* n bytes, the same ones n calls to xor16_17b_byte() would return; whole steps go through xor16_17b_fill(). */
+void xor16_17b_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_17b_spare_full) {
+    __xor16_17b_spare_full = 0;
+    *dst++ = __xor16_17b_spare;
+    n--;
+  }
+  xor16_17b_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_17b_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 29 eors. */
+void xor16_17b_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r16"      "\n\t" // y ^= y << 1
+      "eor    r16, r15"      "\n\t"
+      "eor    r15, r14"      "\n\t"
+      "eor    r14, r13"      "\n\t"
+      "eor    r13, r12"      "\n\t"
+      "eor    r12, r11"      "\n\t"
+      "eor    r11, r10"      "\n\t"
+      "eor    r10, r9"       "\n\t"
+      "eor    r9, r8"        "\n\t"
+      "eor    r8, r7"        "\n\t"
+      "eor    r7, r6"        "\n\t"
+      "eor    r6, r5"        "\n\t"
+      "eor    r5, r4"        "\n\t"
+      "eor    r4, r3"        "\n\t"
+      "eor    r3, r2"        "\n\t"
+      "eor    r2, r9"        "\n\t" // y ^= y >> 7
+      "eor    r3, r10"       "\n\t"
+      "eor    r4, r11"       "\n\t"
+      "eor    r5, r12"       "\n\t"
+      "eor    r6, r13"       "\n\t"
+      "eor    r7, r14"       "\n\t"
+      "eor    r8, r15"       "\n\t"
+      "eor    r9, r16"       "\n\t"
+      "eor    r10, r17"      "\n\t"
+      "eor    r17, r6"       "\n\t" // y ^= y << 11
+      "eor    r16, r5"       "\n\t"
+      "eor    r15, r4"       "\n\t"
+      "eor    r14, r3"       "\n\t"
+      "eor    r13, r2"       "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_17b_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_17b_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_17b_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x1803, 0x3006, 0x600C, 0xC018, 0x8030, 0x0060, 0x08C1, 0x1983,
+    0x3306, 0x660C, 0xCC18, 0x9830, 0x3060, 0x60C0, 0xC180, 0x8100,
+    // M^2
+    0x8055, 0x00AA, 0x0154, 0x00A8, 0x0150, 0x08A1, 0x9171, 0xAAD0,
+    0x55A0, 0xAB40, 0x5480, 0xA900, 0x5801, 0xB002, 0x6A05, 0xB206,
+    // M^4
+    0xA326, 0xA273, 0xC4D5, 0xA2D9, 0xC581, 0x8B24, 0xA772, 0x3AB5,
+    0x9155, 0xC495, 0xCC54, 0xFEA4, 0x1B51, 0x5AAF, 0x5946, 0xF0BB,
+    // M^8
+    0x1256, 0x8603, 0x5A1C, 0x3738, 0x6D6F, 0x142E, 0x7824, 0x682C,
+    0x7FBF, 0xFD6E, 0x3D2B, 0x6B22, 0x71E0, 0xAEEE, 0xEC32, 0x3F9F,
+    // M^16
+    0x45DA, 0x6B8F, 0x0BD5, 0x2E8D, 0xFE11, 0xB3C2, 0x162C, 0x50F4,
+    0x0FF8, 0xA238, 0x41FB, 0x3902, 0x48A5, 0xD517, 0xD408, 0xF7E4,
+    // M^32
+    0x67C0, 0xCE24, 0x6204, 0x3FA0, 0xDF54, 0xEAC1, 0x3DFC, 0x9C73,
+    0xF0BF, 0xE395, 0xD023, 0xC0C7, 0x4033, 0xFEDB, 0x043F, 0xACAA,
+    // M^64
+    0x9862, 0xD321, 0x7B75, 0xCB94, 0x6BC4, 0xB353, 0x970D, 0x5DF0,
+    0x4BDB, 0x0387, 0xAB83, 0xC2FA, 0x984E, 0x0D93, 0x11F6, 0xC5A3,
+    // M^128
+    0x6868, 0x2F76, 0xA200, 0x13B2, 0x274B, 0xAFA8, 0x96B1, 0xB970,
+    0xBABE, 0x259A, 0x5425, 0xDD0D, 0x6BDA, 0x5FD5, 0x69AB, 0x91ED,
+    // M^256
+    0xC1D8, 0xDAFD, 0xEBA2, 0xEA1B, 0x56C9, 0xDD5E, 0xD273, 0xDC03,
+    0xF222, 0x13B1, 0x3394, 0x79D0, 0x4019, 0xD69F, 0x13B9, 0x193A,
+    // M^512
+    0x4A03, 0x657D, 0x9FFF, 0x118A, 0x5636, 0xAD02, 0x1BEA, 0x1BFB,
+    0x8817, 0x37C6, 0x167D, 0x5674, 0x6EB3, 0xFAE9, 0xDDDD, 0x709A,
+    // M^1024
+    0x9311, 0x9DF6, 0xBBDF, 0x89A8, 0x9363, 0x2710, 0x5EF2, 0x42C7,
+    0xC059, 0xC765, 0x6BA0, 0xEDF4, 0x9F4A, 0xAE35, 0x99BB, 0x70BD,
+    // M^2048
+    0xE8B9, 0x2795, 0x18CC, 0xB16F, 0x9FCE, 0x51CA, 0x7270, 0xF7D3,
+    0x3E2E, 0xD4B6, 0xB891, 0x12A7, 0x2433, 0x0304, 0xB3A1, 0xFF16,
+    // M^4096
+    0x3D15, 0xC965, 0x1A94, 0xA33A, 0x901E, 0xBAE5, 0xFC54, 0xECC8,
+    0x864B, 0xD69B, 0x4A22, 0x817C, 0xBABD, 0xF254, 0x7C19, 0x8BB9,
+    // M^8192
+    0xB263, 0x91A7, 0x8B18, 0x6999, 0xD1D1, 0x194F, 0x02C9, 0x7D0C,
+    0xBC1E, 0xFA38, 0x587E, 0x62F3, 0xD63F, 0x1F0C, 0xF19F, 0x0209,
+    // M^16384
+    0x0940, 0xA4B7, 0x9E94, 0x4759, 0x85C0, 0xCB5E, 0x5E07, 0x5CBE,
+    0x5340, 0x0369, 0xFC22, 0x8034, 0x8E34, 0x4815, 0xEB23, 0x21C2,
+    // M^32768
+    0x8D73, 0xB4B6, 0x9763, 0xD2F6, 0x8C19, 0xBC41, 0x290B, 0x765B,
+    0x6B39, 0x8B69, 0x1F3F, 0xF1C8, 0x8EB7, 0x7903, 0x3440, 0xBD5B
+  };
+  __xor16_17b_state = __xor16_jump(__xor16_17b_state, table, n);
+  return __xor16_17b_state;
+}
+
+uint16_t xor16_17b_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_17b_state)::"r18","r19");
+  return __xor16_17b_state;
+}
+
+static const uint16_t __xor16_17b_checkpoints[256] PROGMEM = {
+  0x0001, 0xC1D8, 0x4A03, 0x62FD, 0x9311, 0x2FA1, 0xBDCD, 0xF9CB,
+  0xE8B9, 0xD99B, 0xBA9C, 0x6EAE, 0x46CA, 0x0D0A, 0x8880, 0xBCE9,
+  0x3D15, 0x5253, 0xDF8E, 0xE60A, 0xCCDF, 0x02E2, 0x1A62, 0xFFA8,
+  0xDC94, 0x61B6, 0x51CF, 0xB56E, 0x9A63, 0x274A, 0xE60D, 0x3C58,
+  0xB263, 0x8805, 0x4A90, 0xF312, 0xF1A2, 0xB587, 0x628E, 0xD1D0,
+  0xE001, 0x1DC4, 0x1DAD, 0x3943, 0xD422, 0x7EAD, 0x1DF6, 0x4CC7,
+  0xA70A, 0x2D44, 0x5728, 0xB6E2, 0xA64A, 0x0D15, 0xC4D5, 0x4BD4,
+  0x38E1, 0xFDA0, 0x253E, 0x47FA, 0x74BF, 0xFBA3, 0x1E3E, 0x493F,
+  0x0940, 0x5981, 0xC589, 0x3CF5, 0x735F, 0xFA8A, 0x1A81, 0x37A3,
+  0x5EF9, 0xA471, 0x640D, 0x36D3, 0xF53F, 0xCCB8, 0xFD48, 0x1C0B,
+  0xFB63, 0x104E, 0x492E, 0x9E51, 0x45B4, 0x6E39, 0x3C87, 0xF046,
+  0x7F29, 0xD875, 0x40D4, 0xA0A2, 0x1405, 0x59F7, 0xAD32, 0x26A9,
+  0xDC24, 0x3622, 0xB100, 0x7D9E, 0x6CD7, 0x275C, 0x819B, 0x90EC,
+  0x8BB4, 0x3D4F, 0xE60F, 0xE6A5, 0xD71E, 0x1510, 0xD766, 0xA6EF,
+  0x2632, 0xA7D0, 0x451B, 0x75F8, 0x2B75, 0x3D42, 0x266E, 0x22D3,
+  0x86B2, 0xB476, 0xD493, 0xE8E1, 0xB73A, 0xE6CA, 0xC2AF, 0x02F3,
+  0x8D73, 0xE39D, 0x7724, 0x61C4, 0xD2D6, 0x30CD, 0x5897, 0x503D,
+  0x1856, 0x8C2C, 0x8F99, 0x13E4, 0x9906, 0xE38E, 0x3AC8, 0x188C,
+  0xE473, 0xAD49, 0x8E73, 0x020E, 0xC8F5, 0xDCCE, 0xD5EA, 0x68E4,
+  0x847A, 0x43AC, 0xF2CE, 0x5A80, 0xE5C2, 0xC927, 0xACA8, 0x6EA7,
+  0x6D09, 0x5683, 0xB4A3, 0xA650, 0x6B3A, 0xE614, 0x4152, 0xBFDC,
+  0x7D6B, 0xC34A, 0x0985, 0x7D8B, 0x1064, 0xA496, 0x47A4, 0x2B41,
+  0x5D77, 0x42A5, 0x2B2F, 0x891E, 0x1F45, 0x13C7, 0x5F7D, 0x61F2,
+  0x681E, 0x317B, 0xCC7E, 0xC267, 0xE698, 0x9CE8, 0x2A52, 0xE2B9,
+  0xB3FA, 0xDB2E, 0xD4C3, 0x6C5B, 0xFAE6, 0x1415, 0x0F3E, 0xFB04,
+  0xEFE4, 0x4F47, 0x9A9A, 0x896E, 0x46A1, 0xF319, 0x009C, 0x8B73,
+  0xC3B8, 0x569F, 0xE3D3, 0x7E13, 0x9126, 0x4700, 0xC1BE, 0x7471,
+  0x2E97, 0xF527, 0x706A, 0xBAF4, 0x8B98, 0xE1A8, 0xC578, 0x78CA,
+  0xC279, 0x6B15, 0x21D6, 0x4D5B, 0xDE5B, 0x66EB, 0xC713, 0x9568,
+  0x7DA3, 0x2721, 0x181E, 0xB444, 0x85F9, 0x76A8, 0x4E5C, 0xCF4F,
+  0x69BB, 0xE87E, 0x276C, 0x0A0C, 0x6BD8, 0xEFC7, 0x893C, 0x18E6,
+  0xDBB8, 0x6F56, 0xDB14, 0x6FB2, 0xE398, 0x5D5E, 0xB438, 0xDDA4
+};
+static const uint8_t __xor16_17b_order[256] PROGMEM = {
+    0, 206, 147,  21, 127,  64, 170, 243,  13,  53, 198,  81, 172, 181, 139,  92,
+  197, 109, 234, 136, 143, 247,  22,  70,  79,  42,  41,  46,  62, 180, 226, 119,
+   58, 112, 118,  95, 233,  29, 101, 242, 190, 178, 175, 116,  49, 216,   5, 133,
+  185,  97,  75,  71,  56,  43, 142,  31,  86,  67,  16, 117, 105,  90, 166, 177,
+  153, 114,  84, 204,  12, 213, 174,  59,  82,  63,   2,  34,  55,  47, 227, 238,
+  201, 135,  26,  17, 161, 209,  50, 134,  65,  93, 155, 253, 176,  72, 182,  25,
+  131, 183,  38,   3,  74, 229, 184, 151, 240, 225, 164, 244, 195, 100, 160,  85,
+  159,  11, 249, 251, 218,  68, 215,  60, 115, 237, 130, 223, 168, 171,  99, 232,
+  211,  45,  88, 102, 152, 236, 120,  33,  14, 179, 246, 203, 207, 220, 104, 137,
+  128, 146, 138, 103, 212,   4, 231, 140,  28, 202, 189,  83,  91,  73, 173,  52,
+  163, 111,  48, 113, 158,  94, 145,  98,  32, 192, 254, 235, 121, 162,  27,  37,
+   51, 124,  10, 219,  15,   6, 167, 214,   1, 187, 224, 126, 169, 208,  54, 222,
+   66, 230, 148, 157, 186,  77,  20, 239,  39, 132,  44, 122, 194, 150, 108, 110,
+   89,   9, 250, 193, 248,  96,  24, 149, 255, 228,  18,  40, 221, 191, 141, 252,
+  129, 210, 144, 156,  19,  30, 106, 165, 188, 107, 125, 241,   8, 123, 245, 200,
+   87,  36, 154,  35, 205, 217,  76,   7,  69, 196, 199,  80,  61,  78,  57,  23
+};
+
+uint16_t xor16_17b_position() {
+  uint16_t saved = __xor16_17b_state;
+  uint16_t pos = __xor16_position(saved, xor16_17b, __xor16_17b_checkpoints, __xor16_17b_order);
+  __xor16_17b_state = saved;
+  return pos;
+}
+
+void xor16_17b_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_17b, xor16_17b, __xor16_17b_checkpoints);
+}
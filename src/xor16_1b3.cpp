@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 1b3 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_1b3_state;
+uint16_t __xor16_1b3_state;
 
 bool seed_xor16_1b3(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -40,3 +41,237 @@ uint16_t xor16_1b3() {
     :"+d"((uint16_t)__xor16_1b3_state)::"r18","r19");
   return __xor16_1b3_state;
 }
+
+void xor16_1b3_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_1b3_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_1b3_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x001B, 0x0036, 0x006C, 0x00D8, 0x01B0, 0x0360, 0x06C0, 0x0D80,
+    0x1B00, 0x3600, 0x6C09, 0xD81B, 0xB036, 0x606C, 0xC0D8, 0x8090,
+    // M^2
+    0x0145, 0x028A, 0x0514, 0x0A28, 0x1450, 0x28A0, 0x5149, 0xA292,
+    0x452D, 0x8A53, 0x1465, 0x2920, 0x5240, 0xA5A0, 0x4A60, 0x8CA0,
+    // M^4
+    0x1035, 0x2063, 0x400C, 0x81FB, 0x033C, 0x06B2, 0x0729, 0x171B,
+    0x3DF1, 0x6905, 0x3B9D, 0xE10D, 0xC33A, 0xF27A, 0x90FA, 0x3BD7,
+    // M^8
+    0x968D, 0xC3B7, 0x510D, 0xA237, 0x908D, 0x606E, 0xF815, 0x1EC2,
+    0xD3A8, 0xEE45, 0x415C, 0xB564, 0x5BCF, 0x5057, 0x4CC9, 0xE7ED,
+    // M^16
+    0x684E, 0x7CDF, 0xA119, 0xAD2B, 0xC757, 0xB468, 0x42D5, 0x64D2,
+    0x119D, 0xDE9B, 0x04C3, 0xB7F7, 0xDF58, 0x7BA9, 0x6A9C, 0x64CC,
+    // M^32
+    0x94FA, 0x84AA, 0x0CCA, 0xB01E, 0xF59F, 0x9F68, 0x9C00, 0x8879,
+    0x093C, 0xA698, 0x3655, 0xEB48, 0x8593, 0xA343, 0xD7EE, 0x3FC3,
+    // M^64
+    0xC63F, 0x2A33, 0xFDD0, 0xD4F2, 0x20F6, 0x7B9F, 0x674D, 0x0698,
+    0x3457, 0xC1B5, 0x47B2, 0x239C, 0x6D1C, 0xBF74, 0x4720, 0x5040,
+    // M^128
+    0x0F20, 0xEA38, 0xD452, 0x2D41, 0x522B, 0xA076, 0xC254, 0x749B,
+    0xC3BD, 0x4529, 0x82B2, 0x45DA, 0xA1F9, 0xD210, 0x8EEF, 0x4D71,
+    // M^256
+    0xE18A, 0xCE61, 0x9A92, 0x1BB1, 0x0210, 0x9102, 0xC29A, 0x915D,
+    0x35FF, 0x4DF7, 0x64A6, 0xEC7D, 0x3A2F, 0x7565, 0xC582, 0xB513,
+    // M^512
+    0x7486, 0x07AF, 0x739A, 0x4D9F, 0x4FE7, 0x74A2, 0x7BFB, 0x1AE0,
+    0x700E, 0x0D0A, 0x80ED, 0xBC0E, 0xD10A, 0xF311, 0x7EF4, 0x86FB,
+    // M^1024
+    0xB2D7, 0xDE87, 0x3EDC, 0x2A32, 0x2A19, 0xB5EF, 0xF90D, 0x75B7,
+    0x6545, 0x06DD, 0xD9C1, 0xA1A9, 0x133B, 0x9C71, 0x44C2, 0x6FF4,
+    // M^2048
+    0x124C, 0x6183, 0x43B2, 0x7A74, 0x89F9, 0x1DD1, 0xC6A9, 0xCFC1,
+    0x1131, 0xDF86, 0xC28C, 0xCE7D, 0xA937, 0xD08B, 0xCF3E, 0xEED3,
+    // M^4096
+    0x89DE, 0xB28A, 0x3BE3, 0xB64A, 0xC4E7, 0x262A, 0x86CF, 0xF88F,
+    0x3E62, 0xA76C, 0x086C, 0x8B91, 0x4541, 0x4EA0, 0x2FC6, 0xD14F,
+    // M^8192
+    0xE138, 0x818D, 0x7A40, 0xF7A1, 0xAE38, 0xC34A, 0xB6F2, 0x308B,
+    0x3D1F, 0x23C1, 0xA6DD, 0x7666, 0x16D9, 0xD5F2, 0xA37A, 0xB598,
+    // M^16384
+    0x64DC, 0xD4D5, 0x8304, 0x7F33, 0x09C3, 0xC8E2, 0x9929, 0x64B4,
+    0x6DE3, 0xAC6D, 0xA1EE, 0x6B38, 0xAD1D, 0xF17F, 0xD318, 0x8463,
+    // M^32768
+    0x8BE0, 0x480E, 0xC6E9, 0xF50A, 0x4B4F, 0xDDE9, 0xFCA8, 0xA518,
+    0x0024, 0x76EA, 0x0562, 0x36C3, 0x4301, 0x72CC, 0x4D18, 0xC44F
+  };
+  __xor16_1b3_state = __xor16_jump(__xor16_1b3_state, table, n);
+  return __xor16_1b3_state;
+}
+
+uint16_t xor16_1b3_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_1b3_state)::"r18","r19");
+  return __xor16_1b3_state;
+}
+
+static const uint16_t __xor16_1b3_checkpoints[256] PROGMEM = {
+  0x0001, 0xE18A, 0x7486, 0x2BC0, 0xB2D7, 0x5300, 0x87A5, 0xD2FA,
+  0x124C, 0x3461, 0x99FE, 0xD929, 0xF805, 0xA8BE, 0x6106, 0xD1EB,
+  0x89DE, 0x7204, 0x5DAD, 0x227F, 0xC7D2, 0xF389, 0x2CB5, 0x84E9,
+  0xE94B, 0x2AB6, 0x8253, 0x1785, 0xCCC4, 0x311F, 0xD66D, 0x50DE,
+  0xE138, 0xB8A8, 0x0DCA, 0x3B33, 0x67C6, 0xAB7D, 0x6522, 0xBEDD,
+  0x0E0B, 0xF176, 0x0F5F, 0x9E91, 0x38D7, 0x4799, 0xB05A, 0xEF03,
+  0xDACC, 0x39D0, 0xC71F, 0xC0E7, 0x072D, 0xED05, 0xC3C8, 0x40EF,
+  0xA98F, 0x2661, 0xEE26, 0x0529, 0x3A60, 0xBD58, 0x9C46, 0x918E,
+  0x64DC, 0x04B5, 0x1DF1, 0xA654, 0xB33F, 0xBF8B, 0xAF8D, 0xC151,
+  0x646E, 0xC89B, 0x3BFB, 0x2FB0, 0x87F9, 0x9353, 0x1855, 0x6DC0,
+  0x5E04, 0xA013, 0xED8D, 0x4924, 0x1790, 0xB5CC, 0x79E4, 0x0B1D,
+  0xF6CC, 0xC46E, 0x08ED, 0x4E11, 0xE334, 0x747C, 0x3EC5, 0xA2B9,
+  0x75F5, 0x605C, 0xF14E, 0x87FC, 0xE84B, 0x1F49, 0xF25D, 0xD20F,
+  0xA981, 0x6923, 0xD78C, 0x466E, 0xF009, 0xC5E0, 0xE30D, 0x1D55,
+  0x3C99, 0xAEE7, 0x72E6, 0x5109, 0x3069, 0xE6E9, 0x145B, 0xAA59,
+  0x5B4D, 0xC9EB, 0x5F8C, 0x1F00, 0xCAFC, 0x90ED, 0x2D50, 0x08CB,
+  0x8BE0, 0xE3A3, 0x5248, 0x6B71, 0x9490, 0x78D7, 0x821B, 0xCEAE,
+  0xFAA0, 0x9E0E, 0x0552, 0x5FB2, 0xC350, 0xC813, 0xB117, 0x78CF,
+  0x9BBA, 0xCCD6, 0xFD6E, 0x9E25, 0xA00A, 0x15A6, 0x3FDA, 0x3B9E,
+  0x0730, 0x8FBC, 0xC6AC, 0xD8BC, 0x25AF, 0x8AAB, 0x209C, 0x670B,
+  0x9813, 0x4EBA, 0xD731, 0x2488, 0x9B2F, 0x2483, 0xAF75, 0x1A35,
+  0x73AF, 0x5C57, 0x0285, 0xA7B2, 0x10F6, 0xAE09, 0xFF61, 0x7D1A,
+  0xE02C, 0x15D5, 0x41B9, 0x0809, 0x1646, 0x8517, 0x5323, 0x394C,
+  0xD571, 0xABE5, 0xEDDE, 0xA645, 0x50A5, 0x84EA, 0xC6A0, 0x599F,
+  0x1BAA, 0x7BD5, 0x3472, 0xB405, 0xE5E7, 0x2311, 0xEEF7, 0xB574,
+  0x601A, 0x6727, 0x8832, 0x041D, 0x061F, 0x8589, 0x8F2C, 0x55E1,
+  0x8DBB, 0x3E22, 0xD505, 0x60FF, 0xDEFA, 0x9A97, 0x0882, 0xB341,
+  0xA141, 0xD699, 0x0A99, 0xC8FC, 0xDD1A, 0x205A, 0x603F, 0x8D3D,
+  0xFB8C, 0xBBD0, 0x3FFB, 0x4B16, 0x0714, 0x842C, 0xC194, 0x4CB1,
+  0xAE9C, 0x1734, 0x2F01, 0x643C, 0xC670, 0x0848, 0x3556, 0x8A6A,
+  0x92D1, 0x7296, 0x0081, 0x70D7, 0x6E66, 0x72A0, 0xC760, 0x3FA7,
+  0x0ABF, 0x0D0D, 0xDD8D, 0x066E, 0x358B, 0xBB14, 0xF6AE, 0x5997
+};
+static const uint8_t __xor16_1b3_order[256] PROGMEM = {
+    0, 242, 170, 203,  65,  59, 138, 204, 251, 228,  52, 152, 179, 237, 214, 127,
+   90, 218, 248,  87, 249,  34,  40,  42, 172,   8, 118, 149, 177, 180, 233,  27,
+   84,  78, 167, 192, 111,  66, 123, 101, 221, 158,  19, 197, 165, 163, 156,  57,
+   25,   3,  22, 126, 234,  75, 116,  29,   9, 194, 238, 252,  44, 183,  49,  60,
+   35, 151,  74, 112, 209,  94, 247, 150, 226,  55, 178, 107,  45,  83, 227, 231,
+   91, 161, 188,  31, 115, 130,   5, 182, 207, 255, 191, 120, 169,  18,  80, 122,
+  139, 200, 222,  97, 211,  14, 235,  72,  64,  38, 159, 201,  36, 105, 131,  79,
+  244, 243,  17, 241, 245, 114, 168,  93,   2,  96, 143, 133,  86, 193, 175, 134,
+   26, 229,  23, 189, 181, 205,   6,  76,  99, 202,  16, 239, 157, 128, 223, 208,
+  206, 153, 125,  63, 240,  77, 132, 160,  10, 213, 164, 144,  62, 137, 147,  43,
+  148,  81, 216,  95, 187,  67, 171,  13, 104,  56, 119,  37, 185, 173, 232, 113,
+  166,  70,  46, 142,   4,  68, 215, 195, 199,  85,  33, 253, 225,  61,  39,  69,
+   51,  71, 230, 140,  54,  89, 109, 236, 190, 154,  50, 246,  20, 141,  73, 219,
+  121, 124,  28, 145, 135,  15, 103,   7, 210, 184,  30, 217, 162, 106, 155,  11,
+   48, 220, 250, 212, 176,  32,   1, 110,  92, 129, 196, 117, 100,  24,  53,  82,
+  186,  58, 198,  47, 108,  98,  41, 102,  21, 254,  88,  12, 136, 224, 146, 174
+};
+
+uint16_t xor16_1b3_position() {
+  uint16_t saved = __xor16_1b3_state;
+  uint16_t pos = __xor16_position(saved, xor16_1b3, __xor16_1b3_checkpoints, __xor16_1b3_order);
+  __xor16_1b3_state = saved;
+  return pos;
+}
+
+void xor16_1b3_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_1b3, xor16_1b3, __xor16_1b3_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 1f6 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_1f6_state;
+uint16_t __xor16_1f6_state;
 
 bool seed_xor16_1f6(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -23,25 +24,247 @@ uint16_t xor16_1f6() {
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
       "bst    %B0, 7"        "\n\t"
-      "eor    r18, r18"      "\n\t"
       "bld    r18, 0"        "\n\t"
       "eor    %A0, r18"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_1f6_state)::"r18","r19");
+  return __xor16_1f6_state;
+}
+
+void xor16_1f6_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
       "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_1f6_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_1f6_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x00C3, 0x0186, 0x030C, 0x0618, 0x0C30, 0x1860, 0x30C0, 0x6180,
+    0xC300, 0x8600, 0x0C00, 0x1800, 0x3000, 0x6000, 0xC041, 0x8041,
+    // M^2
+    0x5005, 0xA00A, 0x4014, 0x8028, 0x0050, 0x00A0, 0x0140, 0x02C1,
+    0x0500, 0x0A41, 0x1400, 0x2800, 0x5000, 0xA041, 0x7003, 0xB042,
+    // M^4
+    0x3012, 0x3021, 0x3047, 0x30CA, 0x0110, 0x0261, 0x0440, 0x59C5,
+    0x1100, 0x7304, 0x4400, 0x8841, 0x2003, 0x4146, 0x704D, 0xE149,
+    // M^8
+    0x5074, 0x5336, 0x5571, 0x3C2B, 0x1010, 0x4537, 0x4040, 0x94DF,
+    0x3103, 0x434B, 0x344D, 0x5D5A, 0x4175, 0x656B, 0x25D7, 0xC5DA,
+    // M^16
+    0x24B4, 0x458A, 0x24FF, 0x3757, 0x5165, 0x238D, 0x6597, 0x1E75,
+    0x165F, 0x28B6, 0x693D, 0x03FB, 0x04B6, 0x7FEC, 0xF299, 0x4ED1,
+    // M^32
+    0x5EB3, 0xE153, 0x6D4D, 0x5DBD, 0xA621, 0x686C, 0xF8C6, 0x51F2,
+    0x0359, 0x71FF, 0xDD25, 0x618A, 0x64D5, 0x962B, 0xB357, 0xBEDA,
+    // M^64
+    0x3A8D, 0x79F8, 0x0C0F, 0x9988, 0xB2F4, 0xE4AC, 0xBBD3, 0x52F1,
+    0x2F4F, 0xAA99, 0x8D3C, 0xCB39, 0xC4B2, 0xFCE4, 0xB2C8, 0x328F,
+    // M^128
+    0xA40D, 0x481A, 0x90F7, 0xD932, 0x1335, 0xD245, 0x5C95, 0x5914,
+    0x5216, 0xECCB, 0x981A, 0x3BF5, 0x702A, 0xFF95, 0xD0EA, 0x16CC,
+    // M^256
+    0x9C8B, 0x6902, 0xDEF7, 0x5685, 0x3B7D, 0x32A8, 0x7DF4, 0x4AE1,
+    0x87D3, 0xAAF8, 0xDF0E, 0xFA9C, 0x1C38, 0x2A70, 0xF0E0, 0x48BF,
+    // M^512
+    0x98F8, 0xCEDD, 0x3EB3, 0x91B3, 0x8127, 0xB27C, 0x84DE, 0x39B2,
+    0x437B, 0x5AEE, 0x4DAE, 0x279D, 0x66FA, 0x0E35, 0x8BAA, 0x34B3,
+    // M^1024
+    0x6A50, 0x8477, 0x04DE, 0x4DFE, 0xAD22, 0x1E17, 0x248B, 0xC81D,
+    0xE22C, 0xFEEE, 0x48F1, 0xD563, 0x4386, 0xA5CD, 0xDE1B, 0x79AD,
+    // M^2048
+    0xD9F2, 0x4C1B, 0xC412, 0x3351, 0x39BE, 0x6721, 0x86F8, 0xFC87,
+    0xABA2, 0x1D57, 0x3E8B, 0x9A56, 0x8A6D, 0xB95B, 0x89B7, 0xFA65,
+    // M^4096
+    0xA0B0, 0xB26C, 0x38FC, 0xE377, 0x1B82, 0x0641, 0xCE08, 0x4945,
+    0xB820, 0x6BAF, 0xD083, 0xC046, 0xB20C, 0xE159, 0x3872, 0x3BDC,
+    // M^8192
+    0x8E03, 0x10E4, 0xD216, 0xC893, 0x5AEC, 0xD594, 0x9BB3, 0x1650,
+    0xAE8E, 0x4CB1, 0xEA3B, 0x4736, 0xD8AD, 0xCC9A, 0xF2B4, 0x07D8,
+    // M^16384
+    0x7883, 0x52CC, 0xF96E, 0x6001, 0x636C, 0xF7DE, 0x7DB3, 0xBF78,
+    0x36CF, 0x4892, 0xEB7D, 0xB73A, 0x3DB5, 0xCCAA, 0xE6D4, 0x1798,
+    // M^32768
+    0x35C6, 0xC857, 0xC068, 0x52FD, 0x4721, 0xFF77, 0x7CC6, 0x4D9D,
+    0x231B, 0xDF36, 0xFC6C, 0xD5D8, 0x31B0, 0xD760, 0xC6C0, 0x1480
+  };
+  __xor16_1f6_state = __xor16_jump(__xor16_1f6_state, table, n);
+  return __xor16_1f6_state;
+}
+
+uint16_t xor16_1f6_prev() {
+    __asm__ __volatile__(
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
     :"+d"((uint16_t)__xor16_1f6_state)::"r18","r19");
   return __xor16_1f6_state;
 }
+
+static const uint16_t __xor16_1f6_checkpoints[256] PROGMEM = {
+  0x0001, 0x9C8B, 0x98F8, 0xC65E, 0x6A50, 0xCC7D, 0xFD15, 0x5557,
+  0xD9F2, 0x8EEA, 0xFDEF, 0x5410, 0x08AB, 0x21D9, 0x6BC5, 0x784E,
+  0xA0B0, 0x21FB, 0x306F, 0x04EF, 0xA748, 0xBB9B, 0x7BD0, 0x1D77,
+  0xE126, 0x90A1, 0xB045, 0x417F, 0x7EE9, 0x8671, 0xD5E3, 0x0C8E,
+  0x8E03, 0x325C, 0x524B, 0x98D8, 0xF4F6, 0xD82C, 0xE421, 0xE302,
+  0xD606, 0x6664, 0x3ECD, 0x9ACE, 0xD286, 0xF38B, 0x4AD1, 0x3067,
+  0x526A, 0x36FB, 0xDE72, 0x362E, 0x9066, 0xAC2E, 0x9485, 0x8314,
+  0x801E, 0x92B2, 0xD449, 0xCC93, 0x19D8, 0x3B9A, 0xAFE4, 0xB13C,
+  0x7883, 0x835C, 0xAB6F, 0x87DF, 0xCB09, 0xA5E6, 0x885A, 0xCB2D,
+  0x49B9, 0x0495, 0xECEE, 0x5370, 0xB5D2, 0x4340, 0xA03F, 0x16E1,
+  0xF0F8, 0xE652, 0xC852, 0x6D48, 0x53A0, 0xB9BA, 0x7F0B, 0x6D1D,
+  0x5755, 0x1A08, 0x1AD9, 0x8A3A, 0x2E89, 0x25F5, 0x0E11, 0x289C,
+  0x2902, 0x3E3D, 0xA40E, 0x5CB1, 0x16F5, 0x1572, 0x59C6, 0x1177,
+  0xC4B4, 0xFA92, 0xC6ED, 0xDCED, 0x90B1, 0x8B38, 0xC058, 0xA853,
+  0x2B53, 0x4EC7, 0x63E1, 0x6E8D, 0x0BE2, 0xBB08, 0xFFC5, 0xF3C7,
+  0xBF57, 0x1BB9, 0x42B5, 0x5B50, 0x7DE6, 0xD6A1, 0x3553, 0xDD95,
+  0x35C6, 0xEE75, 0x2B18, 0x903F, 0x20A9, 0x9837, 0x8CB0, 0x2E19,
+  0x5469, 0xB684, 0x9F17, 0x4C3D, 0xC85E, 0xE53A, 0xFCA0, 0xD3CC,
+  0x362B, 0xD21A, 0x0A65, 0x5D44, 0xED9A, 0x7E75, 0x7F9F, 0xC276,
+  0xD173, 0xA21C, 0x7B38, 0x4E4F, 0x7F85, 0xC68C, 0x0F3A, 0x3EEB,
+  0x1F93, 0x9094, 0xFBEC, 0xD46F, 0x49CE, 0x5BCA, 0x33FD, 0x315A,
+  0xC895, 0x7123, 0x865A, 0x4447, 0x7964, 0x2A4C, 0x8F92, 0x5898,
+  0x315D, 0xE3EB, 0x19B5, 0x603F, 0xAEBE, 0x4FE1, 0x616F, 0x6FE4,
+  0x0963, 0xC79A, 0x0461, 0x0CD9, 0xE3F4, 0x5F33, 0x183D, 0xFB88,
+  0x45C4, 0x41DF, 0x06A0, 0x0DBF, 0x9C8E, 0xDA84, 0x6015, 0xA391,
+  0xA2F3, 0x037E, 0xB87A, 0xCFCD, 0x930A, 0x462B, 0x14B2, 0xE900,
+  0xEF60, 0xD5CA, 0xF428, 0x3534, 0xB9B7, 0x6BF2, 0x5AE5, 0xFB7D,
+  0x3978, 0x69A3, 0x2A1F, 0x3C92, 0x0B44, 0x74B4, 0x8465, 0x9A91,
+  0xE9F4, 0x0F57, 0x654E, 0x1EC9, 0x6E49, 0xE200, 0x38D7, 0xEBC2,
+  0x1B8F, 0xFC95, 0x9865, 0xA33B, 0xE53D, 0xD7DE, 0xBB5A, 0xD04E,
+  0x38E3, 0x3CE0, 0x1667, 0x0DEC, 0x2F8E, 0x8958, 0x25FC, 0xC41F,
+  0x21D7, 0x8AB5, 0x1993, 0xE562, 0xECAC, 0x4786, 0xFFD1, 0x164D
+};
+static const uint8_t __xor16_1f6_order[256] PROGMEM = {
+    0, 201, 186,  73,  19, 194,  12, 184, 146, 220, 116,  31, 187, 195, 243,  94,
+  158, 225, 103, 206, 101, 255, 242,  79, 100, 190, 250, 178,  60,  89,  90, 232,
+  121,  23, 227, 160, 132, 248,  13,  17,  93, 246,  95,  96, 218, 173, 130, 112,
+  135,  92, 244,  47,  18, 167, 176,  33, 166, 211, 126, 128, 144,  51,  49, 230,
+  240, 216,  61, 219, 241,  97,  42, 159,  27, 193, 122,  77, 171, 192, 205, 253,
+   72, 164,  46, 139, 155, 113, 181,  34,  48,  75,  84,  11, 136,   7,  88, 175,
+  102, 214, 123, 165,  99, 147, 189, 198, 179, 182, 114, 226,  41, 217,   4,  14,
+  213,  87,  83, 228, 115, 183, 169, 221,  15,  64, 172, 154,  22, 124, 149,  28,
+   86, 156, 150,  56,  55,  65, 222, 170,  29,  67,  70, 245,  91, 249, 109, 134,
+   32,   9, 174, 131,  52, 161,  25, 108,  57, 204,  54, 133, 234,  35,   2, 223,
+   43,   1, 196, 138,  78,  16, 153, 200, 235, 199,  98,  69,  20, 111,  66,  53,
+  180,  62,  26,  63,  76, 137, 202, 212,  85, 117, 238,  21, 120, 110, 151, 247,
+  104,   3, 157, 106, 185,  82, 140, 168,  68,  71,   5,  59, 203, 239, 152, 145,
+   44, 143,  58, 163, 209,  30,  40, 125, 237,  37,   8, 197, 107, 127,  50,  24,
+  229,  39, 177, 188,  38, 141, 236, 251,  81, 207, 224, 231, 252,  74, 148, 129,
+  208,  80,  45, 119, 210,  36, 105, 215, 191, 162, 233, 142,   6,  10, 118, 254
+};
+
+uint16_t xor16_1f6_position() {
+  uint16_t saved = __xor16_1f6_state;
+  uint16_t pos = __xor16_position(saved, xor16_1f6, __xor16_1f6_checkpoints, __xor16_1f6_order);
+  __xor16_1f6_state = saved;
+  return pos;
+}
+
+void xor16_1f6_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_1f6, xor16_1f6, __xor16_1f6_checkpoints);
+}
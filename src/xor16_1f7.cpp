@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 1f7 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_1f7_state;
+uint16_t __xor16_1f7_state;
 
 bool seed_xor16_1f7(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -38,3 +39,222 @@ uint16_t xor16_1f7() {
     :"+d"((uint16_t)__xor16_1f7_state)::"r18","r19");
   return __xor16_1f7_state;
 }
+
+void xor16_1f7_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_1f7_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_1f7_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0183, 0x0306, 0x060C, 0x0C18, 0x1830, 0x3060, 0x60C0, 0xC180,
+    0x8300, 0x0600, 0x0C00, 0x1800, 0x3000, 0x6000, 0xC081, 0x8081,
+    // M^2
+    0x4005, 0x800A, 0x0014, 0x0028, 0x0050, 0x00A0, 0x01C1, 0x0280,
+    0x0581, 0x0A00, 0x1400, 0x2800, 0x5000, 0xA081, 0x8003, 0x4082,
+    // M^4
+    0xC012, 0xC0A0, 0x0044, 0x0088, 0x0191, 0x0220, 0x46C5, 0x0880,
+    0x5304, 0x2200, 0x4400, 0x8881, 0xD003, 0xA286, 0x808D, 0x0289,
+    // M^8
+    0x4335, 0x88A4, 0x4681, 0x0808, 0x9A07, 0x2020, 0x689E, 0x8001,
+    0x21CE, 0x8086, 0xC48D, 0x429A, 0x52B5, 0x4A6B, 0xCAD7, 0xEA1A,
+    // M^16
+    0xD40C, 0x4E20, 0x4DE8, 0x4A92, 0xF7A3, 0x6A4B, 0x1E0D, 0xA92F,
+    0x4517, 0xA43E, 0x69FD, 0xD0FB, 0x2776, 0x83EC, 0x1D59, 0xB211,
+    // M^32
+    0xE6B9, 0x6A2A, 0x76B3, 0x7930, 0xDA4E, 0x24C3, 0xE938, 0x530C,
+    0x11D4, 0x8CB2, 0xF2E5, 0x724A, 0x8B15, 0x892B, 0xAC57, 0x911A,
+    // M^64
+    0xF839, 0xEC5D, 0xF12C, 0x337A, 0xC431, 0x4D69, 0x5045, 0xB5A7,
+    0x8C08, 0xD61E, 0xBD3C, 0xD8F9, 0x3472, 0x23E4, 0x51C8, 0xC28F,
+    // M^128
+    0x1E33, 0x7B7D, 0x87E6, 0x4BBA, 0x5F1A, 0x6E6A, 0x3CEA, 0xF9AB,
+    0x9430, 0x262D, 0x77DA, 0xD835, 0x9FEA, 0x2055, 0x3F2A, 0x26CC,
+    // M^256
+    0x4216, 0x3548, 0xB4BB, 0xAD1E, 0xD2EF, 0xF4FA, 0x8BBC, 0x5369,
+    0xFF8C, 0xCDA7, 0xEFCE, 0xF69C, 0x3F38, 0xDA70, 0xFCE0, 0x78BF,
+    // M^512
+    0x625B, 0xD3A8, 0xDD05, 0xBA13, 0x3414, 0xE84F, 0xD0D1, 0x61BD,
+    0x00A2, 0x06F7, 0x816E, 0xDB5D, 0x453A, 0x2DF5, 0x546A, 0xF4B3,
+    // M^1024
+    0x904D, 0xD057, 0x002C, 0xC431, 0x00B0, 0x5045, 0x02C0, 0xC196,
+    0x5A5A, 0x8658, 0x7831, 0xD963, 0x6046, 0xA50D, 0xC11B, 0x456D,
+    // M^2048
+    0x73BB, 0xA676, 0x9458, 0x3CFF, 0x9163, 0x33FC, 0x450E, 0xCF71,
+    0xE870, 0x7D45, 0x1D8B, 0x7596, 0xB6AD, 0x965B, 0x5AB7, 0xE5A5,
+    // M^4096
+    0x6BA8, 0xC68F, 0xA611, 0x1D61, 0x1847, 0x3584, 0xA19D, 0xD610,
+    0xBB4E, 0x58C1, 0x1083, 0xE386, 0x820C, 0x0E99, 0xC8B2, 0xC7DC,
+    // M^8192
+    0x38D7, 0x876B, 0xF2E8, 0x35F6, 0xCB21, 0x5759, 0x6C84, 0xDD67,
+    0x9722, 0xB51D, 0xF93B, 0x54F6, 0x246D, 0x135A, 0xD1B4, 0x28D8,
+    // M^16384
+    0x5457, 0x424B, 0xA80A, 0x0136, 0xE02B, 0x8459, 0x40AC, 0x9167,
+    0x0783, 0x451E, 0x1BBD, 0x54FA, 0x2E75, 0x136A, 0xF9D4, 0x0898,
+    // M^32768
+    0xD28D, 0xEB4C, 0x0C75, 0x89B0, 0x7155, 0xE6C3, 0x45D6, 0x5B8D,
+    0xDE5B, 0xEEB6, 0x306C, 0x3AD8, 0xC1B0, 0xEB60, 0x06C0, 0x2480
+  };
+  __xor16_1f7_state = __xor16_jump(__xor16_1f7_state, table, n);
+  return __xor16_1f7_state;
+}
+
+uint16_t xor16_1f7_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_1f7_state)::"r18","r19");
+  return __xor16_1f7_state;
+}
+
+static const uint16_t __xor16_1f7_checkpoints[256] PROGMEM = {
+  0x0001, 0x4216, 0x625B, 0x6824, 0x904D, 0x9788, 0x6415, 0xED1C,
+  0x73BB, 0x84BF, 0x8CF6, 0x1EDE, 0xCD1A, 0x2838, 0xA7E7, 0x90E0,
+  0x6BA8, 0xE8AA, 0x9776, 0xB638, 0x3495, 0x7DAD, 0x0356, 0xEA8B,
+  0xEC3D, 0x3ADB, 0x0E09, 0x3BFD, 0x848C, 0xDDBD, 0x7376, 0x07D9,
+  0x38D7, 0xDA0B, 0x5A1C, 0x33A9, 0x9FF8, 0x3F20, 0x3ACB, 0xDCE6,
+  0x0FE9, 0xE85E, 0xDD0D, 0x060A, 0xBA3F, 0xEE22, 0x4B68, 0xEA0F,
+  0x0BEF, 0x8663, 0x52CE, 0xFA47, 0x1275, 0xA99B, 0xF019, 0x5CF0,
+  0x244A, 0x2654, 0x15F1, 0x93AC, 0xCB9A, 0x5938, 0x41C3, 0xACE7,
+  0x5457, 0xB6A0, 0x180D, 0x9217, 0x9B2A, 0xEF9C, 0xED75, 0xE3F5,
+  0x6469, 0x5910, 0x1827, 0xFEBB, 0x1ADE, 0x22D4, 0xA956, 0x737F,
+  0xE8D1, 0xE09F, 0xB152, 0x0E60, 0xABB3, 0x645A, 0x085B, 0x758F,
+  0x3478, 0x0A31, 0x5F38, 0x63AA, 0x2B7E, 0x9F83, 0x48C9, 0x3DA1,
+  0xE613, 0xD9F7, 0x8F52, 0x3FDD, 0x9FB8, 0xB49C, 0xEA1A, 0x2FAD,
+  0x0D29, 0xFD2C, 0x6A96, 0x1DDE, 0xFF31, 0x2E6D, 0x2A70, 0x4CE2,
+  0xFCD5, 0x84D2, 0xA803, 0x230D, 0xB3E8, 0x2EED, 0x7919, 0x2D5F,
+  0x0B06, 0x4544, 0xD3A5, 0xD872, 0xD51A, 0xE19C, 0x3980, 0xBF31,
+  0xD28D, 0x7E1A, 0x87E4, 0x3DCE, 0xF7AE, 0x378C, 0x7261, 0xE95F,
+  0x6097, 0x64F3, 0x40C0, 0x2435, 0xE506, 0xCF9E, 0x024D, 0x1DA8,
+  0xD36B, 0x2C4A, 0xD0C8, 0xCEAC, 0xEE9C, 0x12F9, 0xE357, 0xF6B2,
+  0x034A, 0x21C1, 0xBF3F, 0xFE60, 0xCAA4, 0xAC4C, 0x2984, 0x34B2,
+  0x4AB2, 0x87EF, 0xE78E, 0xFC4E, 0xDF14, 0xF64A, 0x5094, 0xF6E5,
+  0x99FC, 0xA9F2, 0x6057, 0xBC26, 0xF1AC, 0x20AD, 0x2650, 0xA14A,
+  0x4EA9, 0x608E, 0x5914, 0xAC9C, 0x23BE, 0xB1CA, 0x22F8, 0x4409,
+  0xFC26, 0x0D4C, 0x74C7, 0xED56, 0x6051, 0x3DD5, 0xFF01, 0x0878,
+  0xF62B, 0x6DC4, 0xAC20, 0x4F67, 0x6B3A, 0x5C64, 0x1177, 0xAEF8,
+  0x25E4, 0x52A6, 0x281F, 0x90F8, 0x1459, 0x66AD, 0xF8D9, 0x72B9,
+  0x4E7B, 0x5FFC, 0x0FC4, 0x4717, 0x300F, 0x8BB3, 0xBE2A, 0x25AE,
+  0x414C, 0x9175, 0xE30F, 0x02FF, 0x5D9C, 0xBD25, 0x797E, 0x91FC,
+  0x5F6E, 0xBB0A, 0xC116, 0x28CF, 0x9AC2, 0x9121, 0x0EE7, 0x3B3F,
+  0x6911, 0xBF79, 0xF42F, 0x14D8, 0x77D2, 0xFB3F, 0xED4E, 0x1FA0,
+  0xB3D2, 0x90AE, 0xCCF9, 0x8CC5, 0x4F95, 0xA0B2, 0xE2FB, 0xB708,
+  0xED0C, 0xA154, 0xB0AB, 0xE024, 0x1E6E, 0xB866, 0x95DE, 0x7112
+};
+static const uint8_t __xor16_1f7_order[256] PROGMEM = {
+    0, 142, 219, 152,  22,  43,  31,  86, 191,  89, 120,  48, 104, 185,  26,  83,
+  230, 210,  40, 198,  52, 149, 204, 235,  58,  66,  74,  76, 143, 107, 252,  11,
+  239, 173, 153,  77, 182, 115, 180, 139,  56, 215, 200, 174,  57, 202,  13, 227,
+  158, 110,  92, 145, 119, 109, 117, 103, 212,  35,  88,  20, 159, 133,  32, 126,
+   38,  25, 231,  27,  95, 131, 189,  37,  99, 138, 216,  62,   1, 183, 121, 211,
+   94, 160,  46, 111, 208, 176, 195, 244, 166, 201,  50,  64,  73, 178,  61,  34,
+  197,  55, 220,  90, 224, 209, 188, 170, 177, 136,   2,  91,   6,  85,  72, 137,
+  205,   3, 232, 106, 196,  16, 193, 255, 134, 207,  30,  79,   8, 186,  87, 236,
+  118, 222,  21, 129,  28,   9, 113,  49, 130, 161, 213, 243,  10,  98,   4, 241,
+   15, 203, 229, 217, 223,  67,  59, 254,  18,   5, 168, 228,  68,  93, 100,  36,
+  245, 175, 249,  14, 114,  78,  53, 169,  84, 194, 157, 179,  63, 199, 250,  82,
+  181, 240, 116, 101,  19,  65, 247, 253,  44, 225, 171, 221, 214, 127, 154, 233,
+  226, 156,  60, 242,  12, 147, 141, 146, 128, 144, 122, 124, 123,  97,  33,  39,
+   42,  29, 164, 251,  81, 125, 246, 218, 150,  71, 140,  96, 162,  41,  17,  80,
+  135,  47, 102,  23,  24, 248,   7, 238, 187,  70,  45, 148,  69,  54, 172, 234,
+  192, 165, 151, 167, 132, 206,  51, 237, 184, 163, 112, 105, 155,  75, 190, 108
+};
+
+uint16_t xor16_1f7_position() {
+  uint16_t saved = __xor16_1f7_state;
+  uint16_t pos = __xor16_position(saved, xor16_1f7, __xor16_1f7_checkpoints, __xor16_1f7_order);
+  __xor16_1f7_state = saved;
+  return pos;
+}
+
+void xor16_1f7_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_1f7, xor16_1f7, __xor16_1f7_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 251 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_251_state;
+uint16_t __xor16_251_state;
 
 bool seed_xor16_251(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -26,23 +27,266 @@ uint16_t xor16_251() {
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_251_state)::"r18","r19");
+  return __xor16_251_state;
+}
+
+void xor16_251_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_251_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_251_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x000F, 0x001E, 0x003C, 0x007B, 0x00F6, 0x01EF, 0x03DE, 0x07BC,
+    0x0F78, 0x1EF0, 0x3DE0, 0x7BC0, 0xF780, 0xEF00, 0xC600, 0x8C00,
+    // M^2
+    0x0056, 0x00AF, 0x015E, 0x02AD, 0x0559, 0x0AA3, 0x1545, 0x2A8A,
+    0x5514, 0xAA2B, 0x5455, 0xB0AA, 0x7954, 0xF2A8, 0x6910, 0xCA20,
+    // M^4
+    0x11ED, 0x2323, 0x4654, 0x89A7, 0x13A6, 0x3A51, 0x6C58, 0xC0A1,
+    0x1502, 0x2AFE, 0x5505, 0x63F7, 0x1610, 0xA063, 0x7B5F, 0xB312,
+    // M^8
+    0x4BA4, 0x9700, 0x3D0E, 0x4B8D, 0xB66B, 0x9169, 0x1B97, 0x2350,
+    0x7534, 0x80B4, 0x7AF1, 0x1554, 0x7A4D, 0x77B6, 0x13E4, 0x0A18,
+    // M^16
+    0x7C07, 0xFF24, 0xF6E9, 0xED47, 0xE071, 0x8FB6, 0xEE08, 0x2FCA,
+    0x0BD6, 0x3344, 0xDF9E, 0xE57A, 0xAD4F, 0x3F32, 0x1B6D, 0x6806,
+    // M^32
+    0xC63E, 0x9A3F, 0xD2F8, 0xE6A9, 0xB191, 0x23B0, 0xA8BE, 0xEEE5,
+    0xF596, 0xB20E, 0xF763, 0x0BBD, 0x1083, 0x00E8, 0x76B0, 0xC8E8,
+    // M^64
+    0xC77A, 0x9BA9, 0x2E06, 0x161F, 0xB45F, 0x3BB4, 0x1117, 0x814D,
+    0xBB75, 0xC4E3, 0xC9C7, 0xC28E, 0xA267, 0x8342, 0x5F72, 0x36A7,
+    // M^128
+    0xCCCE, 0x4244, 0xF947, 0x7FD6, 0x1FC7, 0xBC9D, 0xDF98, 0x63A6,
+    0xDD1A, 0x572F, 0xF2A1, 0x8FCB, 0x2970, 0xC38F, 0x8C9F, 0xE42D,
+    // M^256
+    0x6D33, 0xFD6F, 0x78C9, 0x89C5, 0x15DC, 0x4586, 0xB52A, 0xA11D,
+    0xC3E7, 0x69FD, 0xC697, 0x5E10, 0xED9C, 0x893A, 0xED3D, 0xAF5E,
+    // M^512
+    0xFF61, 0xEC59, 0x274A, 0x3364, 0x180B, 0xCCF6, 0xFFA4, 0x6C60,
+    0x515D, 0x21A2, 0xB15D, 0xE407, 0xD5F4, 0x1659, 0x5C5C, 0xB86C,
+    // M^1024
+    0xCE0B, 0x8C99, 0xF762, 0xA74A, 0x11AF, 0x3D40, 0x85E4, 0x2C0D,
+    0xD415, 0x0BCB, 0x267C, 0x7746, 0xB1B7, 0x6EA1, 0x2F73, 0xB8BA,
+    // M^2048
+    0x28E0, 0xBD63, 0x8540, 0x818E, 0x6655, 0xDFDD, 0x2918, 0xA1B8,
+    0x28C4, 0xE4A9, 0xBA35, 0xF7D8, 0x06AB, 0xC465, 0x0BDC, 0x3BDB,
+    // M^4096
+    0x64C0, 0xFF7A, 0x8032, 0x0B0A, 0x73C8, 0x75F7, 0xFCA2, 0x4EC4,
+    0x3E5D, 0x995C, 0xFE4C, 0xEBEA, 0x34F4, 0xD157, 0xD18E, 0x0383,
+    // M^8192
+    0x4CF3, 0x8BE4, 0xFAC6, 0xB89B, 0x2A40, 0x5BED, 0xE641, 0x6F20,
+    0x09CB, 0xE692, 0xCCCE, 0x7C50, 0x2F84, 0x4C46, 0xE222, 0x727F,
+    // M^16384
+    0x6D67, 0xC93C, 0x911E, 0x5701, 0x30C5, 0x828D, 0x5CF5, 0xAA4E,
+    0x8376, 0x38C3, 0x601B, 0xFD7F, 0x8667, 0xC5DF, 0xEA80, 0x75D4,
+    // M^32768
+    0xDA70, 0x950A, 0x4F23, 0xDA2E, 0x497A, 0x4C21, 0x4909, 0x2661,
+    0x78FE, 0xEC27, 0xECC0, 0x4E07, 0xC631, 0xD803, 0x3579, 0x1D35
+  };
+  __xor16_251_state = __xor16_jump(__xor16_251_state, table, n);
+  return __xor16_251_state;
+}
+
+uint16_t xor16_251_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
       "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
     :"+d"((uint16_t)__xor16_251_state)::"r18","r19");
   return __xor16_251_state;
 }
+
+static const uint16_t __xor16_251_checkpoints[256] PROGMEM = {
+  0x0001, 0x6D33, 0xFF61, 0x89C7, 0xCE0B, 0xAA80, 0xB094, 0x07F0,
+  0x28E0, 0x869B, 0xAD6C, 0x7CA4, 0x8D4E, 0x4D77, 0xBBB8, 0x4770,
+  0x64C0, 0xB6A7, 0x689C, 0x7FDA, 0xCE47, 0xEEA6, 0x5B1E, 0xED14,
+  0xFD2C, 0xC92F, 0xFB42, 0x9A8A, 0xA098, 0x1B60, 0xE93A, 0x725E,
+  0x4CF3, 0xA18B, 0x5D07, 0xB354, 0xB9DD, 0xCBDB, 0xAE1B, 0xDB5B,
+  0xE29A, 0x62CF, 0x789D, 0xFF75, 0xE4D2, 0xF14A, 0x24A2, 0x5659,
+  0xEBCB, 0x32FD, 0xD509, 0x4E79, 0x1DC1, 0xCFF8, 0xBD56, 0xB5C8,
+  0x537A, 0x3B61, 0x0D33, 0x9B66, 0xC3C2, 0x0121, 0xEB52, 0x62CA,
+  0x6D67, 0x275E, 0x4922, 0xC823, 0xC9A9, 0xDFF9, 0x3DF9, 0x9F5D,
+  0x4C96, 0x44DD, 0xB67E, 0x8D81, 0x3810, 0x2F6A, 0x3FA1, 0xDF93,
+  0xB9FF, 0x7332, 0x8EB4, 0xD7AA, 0x5343, 0x8FCD, 0x15CB, 0xE542,
+  0x866C, 0x0194, 0x0FEF, 0x027C, 0x7D81, 0x1ED5, 0x08F7, 0xF2E8,
+  0x974C, 0x6A69, 0x47B0, 0x70F7, 0x2563, 0xECBA, 0xD633, 0xC093,
+  0x66FE, 0x8363, 0x65B4, 0xE8F9, 0x35D2, 0x9D52, 0x443B, 0x6269,
+  0x19A0, 0x94F0, 0xC038, 0x9BFC, 0x03A9, 0xAA77, 0x1C6C, 0x74BB,
+  0xA7D2, 0xB66D, 0x0801, 0x3323, 0x1B66, 0x6C9C, 0xB94D, 0x7F1A,
+  0xDA70, 0x7D62, 0xDF38, 0x44FD, 0xF3F8, 0x4177, 0x233F, 0x122A,
+  0xB54D, 0xE79D, 0x8F2A, 0xACEF, 0x8E02, 0xA34B, 0x20CD, 0x0132,
+  0x6ED2, 0x69F9, 0x596B, 0x7463, 0x2FFC, 0x0EC6, 0x60EB, 0x2C2F,
+  0x356B, 0x88E3, 0x30A3, 0x1061, 0x7003, 0x19C7, 0x8CC9, 0xC718,
+  0xB2F7, 0x0EFD, 0x2928, 0xD88E, 0x5C91, 0x41D4, 0x57F8, 0xA184,
+  0x3C57, 0xB442, 0x452A, 0xD961, 0xAF97, 0x48AD, 0xCB89, 0xF382,
+  0xD0AD, 0xD75B, 0x7A1D, 0x3795, 0xA910, 0xAE4F, 0x0364, 0x227F,
+  0x64E7, 0x1BB4, 0x9018, 0xDEDB, 0x46F7, 0xEEAF, 0xBFE8, 0x2111,
+  0x3232, 0xA06E, 0xDAAB, 0x6510, 0x74AB, 0xB20E, 0xAE66, 0xA214,
+  0x228C, 0xB0D6, 0x4FB5, 0x3B1D, 0x194F, 0xA411, 0x981C, 0xF802,
+  0x85BA, 0x2FC3, 0x3FCC, 0xB300, 0x61E2, 0x0B3E, 0xA833, 0xB872,
+  0x8DF7, 0x58C6, 0xCF20, 0x3578, 0x0D63, 0x3B90, 0x246D, 0x233E,
+  0x7F19, 0x4A2C, 0x6E5A, 0x4121, 0x066F, 0x3E96, 0xA4BB, 0x082D,
+  0x87A9, 0xC3BE, 0x155D, 0xD425, 0x3914, 0x9444, 0x49B6, 0x042B,
+  0x9A88, 0x5DF7, 0xF739, 0xFEE4, 0xFEC7, 0x2B1D, 0xF4D3, 0x71E5,
+  0x0E37, 0x49B5, 0x9477, 0x89B0, 0xC3EE, 0xB5AB, 0x338A, 0x1B0B
+};
+static const uint8_t __xor16_251_order[256] PROGMEM = {
+    0,  61, 143,  89,  91, 182, 116, 239, 228,   7, 122, 231,  94, 213,  58, 220,
+  248, 149, 161,  90, 155, 135, 234,  86, 204, 112, 157, 255,  29, 124, 185, 118,
+   52,  93, 142, 191, 183, 200, 223, 134, 222,  46, 100,  65,   8, 162, 245, 151,
+   77, 209, 148, 154, 192,  49, 123, 254, 152, 219, 108, 179,  76, 236, 203,  57,
+  221, 168,  70, 229,  78, 210, 227, 133, 165, 110,  73, 131, 170, 188,  15,  98,
+  173,  66, 249, 238, 225,  72,  32,  13,  51, 202,  84,  56,  47, 166, 217, 146,
+   22, 164,  34, 241, 150, 212, 111,  63,  41,  16, 184, 195, 106, 104,  18, 145,
+   97, 125,   1,  64, 226, 144, 156,  99, 247,  31,  81, 147, 196, 119,  42, 178,
+   11, 129,  92, 224, 127,  19, 105, 208,  88,   9, 232, 153, 251,   3, 158,  12,
+   75, 216, 140,  82, 138,  85, 186, 237, 250, 113,  96, 206, 240,  27,  59, 115,
+  109,  71, 193,  28, 167,  33, 199, 141, 205, 230, 120, 214, 180, 117,   5, 139,
+   10,  38, 181, 198, 172,   6, 201, 197, 160, 211,  35, 169, 136, 253,  55, 121,
+   74,  17, 215, 126,  36,  80,  14,  54, 190, 114, 103, 233,  60, 252, 159,  67,
+   25,  68, 174,  37,   4,  20, 218,  53, 176, 235,  50, 102, 177,  83, 163, 171,
+  128, 194,  39, 187, 130,  79,  69,  40,  44,  87, 137, 107,  30,  62,  48, 101,
+   23,  21, 189,  45,  95, 175, 132, 246, 242, 207,  26,  24, 244, 243,   2,  43
+};
+
+uint16_t xor16_251_position() {
+  uint16_t saved = __xor16_251_state;
+  uint16_t pos = __xor16_position(saved, xor16_251, __xor16_251_checkpoints, __xor16_251_order);
+  __xor16_251_state = saved;
+  return pos;
+}
+
+void xor16_251_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_251, xor16_251, __xor16_251_checkpoints);
+}
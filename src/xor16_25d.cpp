@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 25d //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_25d_state;
+uint16_t __xor16_25d_state;
 
 bool seed_xor16_25d(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -26,14 +27,75 @@ uint16_t xor16_25d() {
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_25d_state)::"r18","r19");
+  return __xor16_25d_state;
+}
+
+void xor16_25d_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
@@ -43,6 +105,171 @@ uint16_t xor16_25d() {
       "add    r19, r19"      "\n\t"
       "andi   r19, 0xE0"     "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_25d_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_25d_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xA005, 0x400A, 0x8014, 0x2029, 0x4052, 0xA0A5, 0x414A, 0x8294,
+    0x0528, 0x0A50, 0x14A0, 0x2940, 0x5280, 0xA500, 0x4200, 0x8400,
+    // M^2
+    0x0111, 0x2223, 0x4446, 0x8589, 0x0312, 0x2320, 0x6641, 0xCC82,
+    0x9104, 0x2208, 0x6411, 0xC822, 0x9844, 0x3088, 0x4850, 0x90A0,
+    // M^4
+    0x9307, 0x1292, 0x2C65, 0x2DAF, 0x923D, 0xA0A4, 0x5991, 0x9A62,
+    0xDDA6, 0x9709, 0x1ECA, 0x11D1, 0xE2C1, 0xE1C7, 0xE521, 0xE746,
+    // M^8
+    0xE2D8, 0x6F05, 0xA88B, 0x89E3, 0x32DA, 0x1022, 0x50CF, 0x68F8,
+    0x362A, 0xEF4A, 0x861D, 0xFDAE, 0x245D, 0x5005, 0x136F, 0xD0A3,
+    // M^16
+    0xFF8D, 0xABEA, 0x11CE, 0xBEEF, 0x7719, 0x5B7A, 0xA3B0, 0x2DE8,
+    0xEBCB, 0x8733, 0x489E, 0xCCBA, 0x77BD, 0x7D61, 0x1165, 0x1296,
+    // M^32
+    0x9CB7, 0x0F92, 0x16E5, 0x3539, 0x09A4, 0x5C4C, 0x0284, 0x7943,
+    0xBA00, 0x4EF4, 0x83E5, 0x9359, 0x6EF8, 0x7311, 0x8AFF, 0x105B,
+    // M^64
+    0xC774, 0x9B3D, 0x0E30, 0xD86A, 0x1AB3, 0xD5E3, 0x2152, 0x2FEE,
+    0xD01F, 0xEC7D, 0x4976, 0x28F9, 0xBCB0, 0xF6F1, 0x5320, 0xC3C4,
+    // M^128
+    0x05C2, 0xB591, 0x42A2, 0xB34B, 0xC4C3, 0x322B, 0x8632, 0x3D24,
+    0xBCF4, 0xF8B6, 0xD0C9, 0x00FA, 0x08B4, 0x7936, 0x0611, 0xAC0A,
+    // M^256
+    0x62BA, 0x4D90, 0x4439, 0x1CE0, 0x7197, 0xB807, 0xC70C, 0x6DCC,
+    0x02E7, 0xE79C, 0xAF30, 0x4B24, 0x8994, 0xCA46, 0xE97E, 0x03D5,
+    // M^512
+    0x3188, 0x13D6, 0xF184, 0x7F47, 0xDF03, 0x6030, 0xF839, 0x37D2,
+    0x9E48, 0x2E24, 0x016C, 0xBB1F, 0x1274, 0x88B6, 0x72FB, 0x18AF,
+    // M^1024
+    0x4C1F, 0x50A2, 0xA888, 0xC9C5, 0x5061, 0x457E, 0xBA75, 0x28FC,
+    0x19F2, 0x8D55, 0x8882, 0xFA80, 0x8ADE, 0xC903, 0xEBDC, 0x5214,
+    // M^2048
+    0xB44F, 0x5C22, 0x80AE, 0x2CA4, 0xD216, 0xE429, 0x2DE1, 0xD558,
+    0xBE98, 0x3767, 0xD0CA, 0xA53C, 0xD6C6, 0x4607, 0xBD49, 0x14BE,
+    // M^4096
+    0x3D33, 0xA672, 0xD5E7, 0x822E, 0x46CC, 0x43F8, 0x25B6, 0xC230,
+    0xED04, 0x68FF, 0xF70E, 0xA6DE, 0xBCA9, 0x3227, 0xFA1B, 0x1543,
+    // M^8192
+    0xAC2F, 0x3E65, 0xA323, 0xCFFF, 0xD5A5, 0x1F7C, 0x9CBC, 0x8293,
+    0xB44C, 0x40D8, 0xE298, 0xE864, 0xF4C8, 0xEB2F, 0xF054, 0x1854,
+    // M^16384
+    0x186D, 0xD90F, 0x8AD9, 0x3C08, 0xD8FF, 0x3019, 0xC2F6, 0x9DF0,
+    0x154B, 0xF421, 0xDB3E, 0xCBA8, 0xC4AF, 0xFE35, 0x1DDD, 0xF696,
+    // M^32768
+    0x5354, 0x86B4, 0x6A83, 0x1604, 0x241F, 0xC600, 0xFB5C, 0x8004,
+    0x3546, 0x229B, 0x821E, 0x5068, 0xEA2F, 0x4F34, 0xE837, 0xE817
+  };
+  __xor16_25d_state = __xor16_jump(__xor16_25d_state, table, n);
+  return __xor16_25d_state;
+}
+
+uint16_t xor16_25d_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
     :"+d"((uint16_t)__xor16_25d_state)::"r18","r19");
   return __xor16_25d_state;
 }
+
+static const uint16_t __xor16_25d_checkpoints[256] PROGMEM = {
+  0x0001, 0x62BA, 0x3188, 0x3019, 0x4C1F, 0x0B0E, 0xBB16, 0x9666,
+  0xB44F, 0x5FC8, 0xD7A5, 0xDA3C, 0x5ECE, 0xDCEB, 0xA626, 0x3091,
+  0x3D33, 0x439B, 0x2394, 0x775F, 0x218F, 0xD29E, 0x8DB1, 0x23C0,
+  0x85FD, 0xF731, 0x4818, 0xCF2D, 0x69A0, 0xBF30, 0x88F8, 0x3741,
+  0xAC2F, 0xE273, 0xE6C7, 0xA992, 0xD19B, 0x4E49, 0x53A0, 0x505A,
+  0x8701, 0x2B24, 0x9827, 0x1271, 0x022E, 0x4AD2, 0xD301, 0xE4FE,
+  0xF9C4, 0x0E43, 0xEBAE, 0x4E30, 0x2366, 0x599F, 0x4281, 0x0194,
+  0x5A85, 0x871D, 0x026A, 0xC9E7, 0xDABC, 0x3302, 0xEB39, 0x3978,
+  0x186D, 0x87D8, 0x8E29, 0xC600, 0xA207, 0x451C, 0x6DE7, 0xBC1F,
+  0xA277, 0x4B80, 0x2AED, 0x4E5A, 0x0D1D, 0xAD07, 0x4473, 0x67F8,
+  0x16C3, 0x44D2, 0xD089, 0x70A9, 0x013D, 0xF114, 0x9E30, 0x4059,
+  0x21BF, 0x1B0E, 0x3282, 0x8412, 0x90E2, 0xD516, 0xB6D6, 0xDA55,
+  0x5F9F, 0x0A2D, 0x2EDC, 0x4A40, 0x82CA, 0x1FF9, 0x95F1, 0x267C,
+  0xD4AF, 0x6E37, 0x8233, 0x02F3, 0xABE6, 0x7CA2, 0xD6E3, 0x167E,
+  0xDAED, 0xE723, 0xFD8B, 0x118C, 0xBE66, 0x352D, 0x6C61, 0xDA9D,
+  0xE9BF, 0xBA81, 0xE3C9, 0x110C, 0xD3AA, 0x02FF, 0xF33F, 0xF261,
+  0x5354, 0x7733, 0x065D, 0xC454, 0xB739, 0xBD86, 0xC291, 0x73D6,
+  0x9D29, 0xAAEF, 0x001F, 0x0664, 0x739E, 0x46C5, 0x2D91, 0x5254,
+  0x75D4, 0x9815, 0x9671, 0xAECB, 0x5311, 0x96BC, 0x3E68, 0x23B1,
+  0xE9DB, 0x81B3, 0x8A44, 0x2C58, 0x8429, 0x6AB8, 0x373C, 0x98D0,
+  0x1A32, 0xA12C, 0x2BAA, 0xE0A2, 0xB8B6, 0xA6D6, 0x53C1, 0x4DEB,
+  0x2E80, 0xA402, 0x2B33, 0x82A3, 0x1EA8, 0x4337, 0xAE86, 0xAE7E,
+  0xD1CE, 0xDE51, 0xB496, 0xFAC5, 0x8982, 0x6A4A, 0x19FC, 0xFBDE,
+  0xC938, 0x7618, 0x8F77, 0x6735, 0x8660, 0x3472, 0xAFEE, 0xCF72,
+  0xA8C8, 0x3497, 0x9BAA, 0xA0A5, 0x3ADB, 0x07F7, 0x4208, 0x1202,
+  0x2398, 0x2F86, 0xAF4C, 0x5729, 0xECFC, 0xFF70, 0xA68A, 0xBD83,
+  0xE412, 0xB3DA, 0x2F5B, 0x4E78, 0xF88A, 0xDEE1, 0x10CA, 0x7224,
+  0xB10E, 0x57A9, 0x8130, 0xC8A2, 0x39D4, 0x957F, 0x5EF9, 0x7E68,
+  0xCACF, 0x9B20, 0x9C19, 0x6198, 0x2164, 0xF393, 0x7F73, 0x8A75,
+  0x8772, 0x0A92, 0xFD73, 0x6E3C, 0xB1F9, 0x5FEA, 0x2232, 0xA9DA,
+  0x0A77, 0xC937, 0x01EB, 0x23EA, 0x6C8A, 0xFB90, 0x1B7D, 0x1334,
+  0xE146, 0xECAF, 0x66C1, 0xA3EE, 0x2B66, 0x12BB, 0xF99E, 0xE9A8
+};
+static const uint8_t __xor16_25d_order[256] PROGMEM = {
+    0, 138,  84,  55, 242,  44,  58, 107, 125, 130, 139, 197,  97, 240, 233,   5,
+   76,  49, 214, 123, 115, 199,  43, 253, 247, 111,  80,  64, 182, 160,  89, 246,
+  172, 101, 228,  20,  88, 238,  52,  18, 200, 151,  23, 243, 103,  74,  41, 170,
+  252, 162, 155, 142, 168,  98, 210, 201,   3,  15,   2,  90,  61, 189, 193, 117,
+  158,  31,  63, 220, 196,  16, 150,  87, 198,  54, 173,  17,  78,  81,  69, 141,
+   26,  99,  45,  73,   4, 167,  51,  37,  75, 211,  39, 143, 148, 128,  38, 166,
+  203, 217,  53,  56,  12, 222,  96,   9, 237, 227,   1, 250, 187,  79,  28, 181,
+  157, 118, 244,  70, 105, 235,  83, 215, 140, 135, 144, 185, 129,  19, 109, 223,
+  230, 218, 153, 106, 171, 100,  91, 156,  24, 188,  40,  57, 232,  65,  30, 180,
+  154, 231,  22,  66, 186,  92, 221, 102,   7, 146, 149, 145,  42, 159, 225, 194,
+  226, 136,  86, 195, 161,  68,  72, 251, 169,  14, 206, 165, 192,  35, 239, 137,
+  108,  32,  77, 175, 174, 147, 202, 190, 216, 236, 209,   8, 178,  94, 132, 164,
+  121,   6,  71, 207, 133, 116,  29, 134, 131,  67, 219, 241, 184,  59, 224,  27,
+  191,  82,  36, 176,  21,  46, 124, 104,  93, 110,  10,  11,  95, 119,  60, 112,
+   13, 177, 213, 163, 248,  33, 122, 208,  47,  34, 113, 255, 120, 152,  62,  50,
+  249, 204,  85, 127, 126, 229,  25, 212, 254,  48, 179, 245, 183, 234, 114, 205
+};
+
+uint16_t xor16_25d_position() {
+  uint16_t saved = __xor16_25d_state;
+  uint16_t pos = __xor16_position(saved, xor16_25d, __xor16_25d_checkpoints, __xor16_25d_order);
+  __xor16_25d_state = saved;
+  return pos;
+}
+
+void xor16_25d_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_25d, xor16_25d, __xor16_25d_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 25f //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_25f_state;
+uint16_t __xor16_25f_state;
 
 bool seed_xor16_25f(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -26,22 +27,245 @@ uint16_t xor16_25f() {
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_25f_state)::"r18","r19");
+  return __xor16_25f_state;
+}
+
+void xor16_25f_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
-      "eor    r19, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_25f_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_25f_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x8005, 0x000A, 0x0014, 0x8029, 0x0052, 0x80A5, 0x014A, 0x0294,
+    0x0528, 0x0A50, 0x14A0, 0x2940, 0x5280, 0xA500, 0x4200, 0x8400,
+    // M^2
+    0x0411, 0x8023, 0x0046, 0x0489, 0x0112, 0x8620, 0x8441, 0x0882,
+    0x1104, 0x2208, 0xC411, 0x8822, 0x1844, 0x3088, 0x4850, 0x90A0,
+    // M^4
+    0xC112, 0x92B2, 0x0424, 0xCC0B, 0x9035, 0xF099, 0xD4E1, 0x0083,
+    0x0906, 0x1609, 0x19E2, 0x1E81, 0x1461, 0x24C7, 0x4521, 0x0646,
+    // M^8
+    0x48E6, 0xF6B3, 0xED5F, 0xDBAF, 0xB7BD, 0xEE6E, 0xAB0D, 0x5323,
+    0x8111, 0x1693, 0xB5AF, 0xC49A, 0xE8E9, 0xBEC3, 0x644E, 0x4D9C,
+    // M^16
+    0xAD78, 0x6861, 0xF320, 0xA7CB, 0x4D7D, 0x7597, 0xDE51, 0x4B1E,
+    0x33D6, 0x111E, 0x1AE0, 0x55FF, 0xD682, 0x3A6B, 0x046C, 0x4604,
+    // M^32
+    0x41D6, 0x6D46, 0xF9DE, 0xB3DA, 0x678D, 0xF1E9, 0xF4BF, 0x02AC,
+    0x8D52, 0x94A3, 0x72BB, 0xC78F, 0xBC6B, 0x611C, 0xE5CD, 0xFCB2,
+    // M^64
+    0x6D99, 0xDC90, 0x3809, 0x7736, 0xE6E5, 0xBCAC, 0x44EF, 0x2DE2,
+    0x3AA0, 0xEDB7, 0xA79B, 0x160D, 0x0EED, 0x240A, 0x7A4B, 0x88B2,
+    // M^128
+    0x04DF, 0x8685, 0x2645, 0x9EF0, 0x1CEE, 0xCDB2, 0xF647, 0xA60D,
+    0x4013, 0xA36E, 0xD10C, 0x6667, 0xAB26, 0x2837, 0x29C6, 0x3584,
+    // M^256
+    0xA747, 0xC371, 0x8E88, 0x0BB1, 0xBF85, 0x1AEE, 0xBF69, 0xD3BB,
+    0xB772, 0xFB0B, 0x4FC2, 0xEC79, 0xF5DB, 0x3B13, 0xFEC9, 0x9246,
+    // M^512
+    0xFF39, 0x9DB3, 0x12FC, 0x7197, 0x4938, 0xD2DD, 0xBA3D, 0xCC7A,
+    0x8646, 0x6DC0, 0xBEA8, 0x42D3, 0xE627, 0xB57B, 0x3AD3, 0x6E06,
+    // M^1024
+    0x053F, 0xC709, 0x052E, 0x1AFD, 0x1434, 0x7C1F, 0x15FE, 0x6552,
+    0x881C, 0x83D2, 0xC3D1, 0x0AE6, 0x906D, 0x3771, 0x21BA, 0x915C,
+    // M^2048
+    0xFE03, 0x673B, 0xEF08, 0x1B32, 0x3EB9, 0x8640, 0x1BFD, 0x9BC5,
+    0x905D, 0x3903, 0xDA8F, 0x47A0, 0x723C, 0x17E9, 0x6FE0, 0x9734,
+    // M^4096
+    0xA015, 0x312B, 0xC07E, 0x4300, 0x07F4, 0x6F45, 0xAE3A, 0x9AC5,
+    0xCA75, 0x2B10, 0x028C, 0x01B4, 0x7FF5, 0xE2A4, 0x4A00, 0xC128,
+    // M^8192
+    0x4413, 0xEA5F, 0xFFF6, 0xAB65, 0x7FD9, 0x84A8, 0x113E, 0xC0ED,
+    0x076C, 0x0581, 0x32AB, 0xF87F, 0x0929, 0x7762, 0x60A4, 0x6D18,
+    // M^16384
+    0x839A, 0x1318, 0x84C5, 0xCE9B, 0x97AA, 0xB093, 0x4BF8, 0x4847,
+    0xF143, 0xB139, 0x3AA6, 0x9B18, 0x94CD, 0x5160, 0xAC75, 0x0EC2,
+    // M^32768
+    0x4CD6, 0x8D86, 0x3084, 0x33C4, 0xC584, 0x8400, 0x9D0A, 0x68D2,
+    0x4D23, 0x5014, 0x8085, 0x185C, 0x6AD2, 0x3290, 0x9582, 0x0020
+  };
+  __xor16_25f_state = __xor16_jump(__xor16_25f_state, table, n);
+  return __xor16_25f_state;
+}
+
+uint16_t xor16_25f_prev() {
+    __asm__ __volatile__(
+      "clr    r19"           "\n\t"
       "bst    %A0, 0"        "\n\t"
       "bld    r19, 7"        "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
     :"+d"((uint16_t)__xor16_25f_state)::"r18","r19");
   return __xor16_25f_state;
 }
+
+static const uint16_t __xor16_25f_checkpoints[256] PROGMEM = {
+  0x0001, 0xA747, 0xFF39, 0x4418, 0x053F, 0xBCD4, 0xA2EA, 0xECA2,
+  0xFE03, 0x9EC1, 0xF4B8, 0x90E4, 0x9F29, 0x3E47, 0xC3AF, 0x08AC,
+  0xA015, 0x3F1F, 0x7F80, 0x0C78, 0xB208, 0xAC34, 0x210D, 0xAE1F,
+  0xAF6F, 0x021F, 0xA581, 0x2519, 0xD0D0, 0x4A03, 0x8D8D, 0x774A,
+  0x4413, 0x6AB8, 0xAFC9, 0x86B3, 0x3469, 0x887B, 0x0BBA, 0x1E10,
+  0x12EE, 0x3EA4, 0xD1A5, 0xCEBC, 0xC7D6, 0xF19A, 0xB1CB, 0xE8A9,
+  0xDE46, 0x3374, 0x163B, 0x8BFE, 0xBDB7, 0xD429, 0x608E, 0x5029,
+  0xBD0A, 0x8087, 0xAB43, 0xD20A, 0xAA9F, 0x3316, 0x70CD, 0x7EAD,
+  0x839A, 0x7AC1, 0xECE6, 0xCFE2, 0x3600, 0x7A01, 0x8034, 0xB9A5,
+  0xE71F, 0x0AAD, 0xFC59, 0xADE6, 0x8659, 0x8A95, 0xC0C5, 0x2992,
+  0xCF57, 0x691F, 0xC05B, 0x03E4, 0xB4CD, 0x5DE0, 0x69E7, 0x0253,
+  0x9FD1, 0xFC4F, 0x5F9A, 0x402E, 0xA26F, 0x16D6, 0xDFBC, 0x857F,
+  0x91FB, 0x76D1, 0xF0D8, 0x7AA1, 0x4961, 0xA702, 0x699F, 0x13E0,
+  0xCF9E, 0xA93B, 0x38B2, 0x9710, 0xDBA3, 0x9437, 0x678A, 0xDD1A,
+  0xFAD8, 0x6DD3, 0x6672, 0xA860, 0xE0AB, 0xF14E, 0xEC14, 0xC52A,
+  0x4611, 0x52C2, 0x5FBA, 0x5AC0, 0x70B2, 0x85A0, 0xA3A3, 0x484F,
+  0x4CD6, 0xC3DC, 0x7698, 0xE347, 0x4E32, 0xC063, 0xAD3E, 0x5EBF,
+  0xC47D, 0x1B31, 0x57F7, 0x2BAE, 0x140E, 0xFC51, 0xA657, 0xF7CE,
+  0x8B66, 0xDA38, 0x20FC, 0x7793, 0x3BB2, 0xDB69, 0x3025, 0xFDE9,
+  0x6C44, 0x5780, 0xDB12, 0x45A0, 0xCF2C, 0x1C9A, 0xF29E, 0x733A,
+  0x11D3, 0xF5C8, 0x3D94, 0x38B7, 0xBEDF, 0x3666, 0x927F, 0x679B,
+  0xC5D8, 0x4CD9, 0x22D3, 0x7779, 0x854E, 0x93D7, 0x120D, 0x2CAE,
+  0x17B5, 0xA97F, 0x0953, 0x3FD1, 0x551A, 0x84E7, 0x4106, 0x0442,
+  0x33DA, 0x9926, 0x6B81, 0x1126, 0x15BE, 0x3DF3, 0x778E, 0xA649,
+  0x0E03, 0x3C86, 0xF331, 0xEC12, 0x88D3, 0xC95E, 0x7120, 0x9D9D,
+  0x3D14, 0xEB0C, 0x72A5, 0x2B90, 0xF72D, 0x996C, 0x1C28, 0x473F,
+  0xB916, 0xF5F9, 0x3FB8, 0x5C6B, 0x62A9, 0x5B72, 0x7261, 0xC9CA,
+  0x9396, 0x0A23, 0x69AA, 0x9F44, 0xB9BE, 0x371D, 0x5088, 0xD318,
+  0x6119, 0x61DB, 0xCE78, 0x258C, 0x9521, 0x2284, 0x9D2B, 0x063D,
+  0x33DC, 0xD4DF, 0xE4CE, 0x32C4, 0xD799, 0x5A27, 0xEC30, 0x514C,
+  0x8630, 0x83E4, 0x268B, 0x33E6, 0xB974, 0x930F, 0xCAEB, 0x6246,
+  0xCC41, 0xD71A, 0xEDAA, 0x42C0, 0x6910, 0x2154, 0x0205, 0xD2C4
+};
+static const uint8_t __xor16_25f_order[256] PROGMEM = {
+    0, 254,  25,  87,  83, 183,   4, 231,  15, 178, 217,  73,  38,  19, 192, 187,
+  160, 174,  40, 103, 140, 188,  50,  93, 176, 137, 206, 157,  39, 146,  22, 253,
+  229, 170,  27, 227, 242,  79, 203, 139, 175, 150, 235,  61,  49, 184, 232, 243,
+   36,  68, 165, 221, 106, 163, 148, 193, 200, 162, 189,  13,  41,  17, 210, 179,
+   91, 182, 251,  32,   3, 155, 120, 207, 127, 100,  29, 128, 169, 132,  55, 222,
+  239, 121, 180, 153, 138, 237, 123, 213, 211,  85, 135,  90, 122,  54, 224, 225,
+  247, 212, 114, 110, 167, 252,  81, 102, 218,  86,  33, 186, 152, 113, 124,  62,
+  198, 214, 202, 159, 130,  97,  31, 171, 190, 147,  69,  99,  65,  63,  18,  70,
+   57,  64, 241, 181, 172,  95, 125, 240,  76,  35,  37, 196,  77, 144,  51,  30,
+   11,  96, 166, 245, 216, 173, 109, 228, 107, 185, 205, 230, 199,   9,  12, 219,
+   88,  16,  92,   6, 126,  26, 191, 142, 101,   1, 115, 105, 177,  60,  58,  21,
+  134,  75,  23,  24,  34,  46,  20,  84, 208, 244,  71, 220,   5,  56,  52, 164,
+   82, 133,  78,  14, 129, 136, 119, 168,  44, 197, 215, 246, 248, 226,  43, 156,
+   80, 104,  67,  28,  42,  59, 255, 223,  53, 233, 249, 236, 145, 154, 149, 108,
+  111,  48,  94, 116, 131, 234,  72,  47, 201, 195, 118, 238,   7,  66, 250,  98,
+  117,  45, 158, 194,  10, 161, 209, 204, 143, 112,  89, 141,  74, 151,   8,   2
+};
+
+uint16_t xor16_25f_position() {
+  uint16_t saved = __xor16_25f_state;
+  uint16_t pos = __xor16_position(saved, xor16_25f, __xor16_25f_checkpoints, __xor16_25f_order);
+  __xor16_25f_state = saved;
+  return pos;
+}
+
+void xor16_25f_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_25f, xor16_25f, __xor16_25f_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 27d //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_27d_state;
+uint16_t __xor16_27d_state;
 
 bool seed_xor16_27d(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -41,3 +42,224 @@ uint16_t xor16_27d() {
     :"+d"((uint16_t)__xor16_27d_state)::"r18","r19");
   return __xor16_27d_state;
 }
+
+void xor16_27d_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_27d_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_27d_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xA005, 0x400A, 0x8014, 0x0028, 0x0050, 0x20A1, 0x4142, 0xA285,
+    0x450A, 0x8A14, 0x1428, 0x2850, 0x50A0, 0xA140, 0x4080, 0x8100,
+    // M^2
+    0x0051, 0x00A2, 0x0144, 0x2089, 0x4112, 0x8361, 0x04C2, 0x28C0,
+    0x5180, 0xA300, 0x6401, 0xC802, 0x9204, 0x2408, 0xE205, 0xC40A,
+    // M^4
+    0x4581, 0xAB03, 0x5406, 0x2C10, 0xF235, 0xB178, 0x48A1, 0xC008,
+    0x0941, 0x1282, 0xA25D, 0xEEAF, 0xF44A, 0x6080, 0xA012, 0x6225,
+    // M^8
+    0x8E87, 0x194B, 0x0900, 0xDE47, 0x16B5, 0xD852, 0x7A4C, 0xEE27,
+    0xEACE, 0x8DC3, 0x9724, 0x1B23, 0x3B12, 0x009A, 0x5B93, 0x72EF,
+    // M^16
+    0x03C0, 0xF938, 0xF1ED, 0xF72A, 0x86B2, 0x7CFF, 0x5BF0, 0x6EBC,
+    0xE561, 0x1781, 0x6886, 0x08A2, 0x4858, 0x3F9E, 0x73F1, 0xE16A,
+    // M^32
+    0xC7AC, 0x05F9, 0x4C88, 0x0DD6, 0xF3A4, 0x572D, 0x0EEA, 0xA9FC,
+    0x042D, 0xBF42, 0x22A4, 0xE3D9, 0x513B, 0xF2F3, 0x3A16, 0x6179,
+    // M^64
+    0x7D2B, 0xEF6C, 0x5F41, 0xD893, 0xF191, 0x2339, 0x862B, 0x36BF,
+    0xF37B, 0xB3B0, 0xFFE8, 0x8C3B, 0x040A, 0x862F, 0x4586, 0xACD1,
+    // M^128
+    0x2EE6, 0x7EA0, 0x8994, 0x340F, 0x220C, 0xB1F4, 0x8964, 0x3FFF,
+    0x35EE, 0x8A28, 0x1354, 0x477E, 0xC817, 0xD625, 0xCF87, 0x6503,
+    // M^256
+    0xF87C, 0x81BC, 0x83F4, 0xE0BB, 0xE196, 0xE228, 0xA697, 0x3D60,
+    0xFCDC, 0x2DAE, 0x552D, 0xBAB2, 0x1624, 0xED69, 0xA745, 0x6F5E,
+    // M^512
+    0x4F82, 0xCE13, 0xA591, 0x82D7, 0x0710, 0x0A4F, 0xDC76, 0xACB1,
+    0xC5E7, 0xC391, 0x618B, 0xBC6D, 0x0F7B, 0x6A49, 0xDB77, 0xD133,
+    // M^1024
+    0x6245, 0x92B2, 0xFB35, 0x4175, 0x60ED, 0x055D, 0x6272, 0x88F0,
+    0xF0A0, 0xE811, 0xDB2E, 0xD71A, 0x09FF, 0xDFE1, 0x4A0D, 0x4C16,
+    // M^2048
+    0x86FF, 0xD20A, 0xE36E, 0x241F, 0xA236, 0xF114, 0xE88D, 0x143E,
+    0x5DA8, 0x0C48, 0xEDE0, 0x7F51, 0xE23F, 0x96FB, 0xAD03, 0x4F53,
+    // M^4096
+    0x92EE, 0xFA32, 0x29A9, 0x4AA9, 0xB7A6, 0x8A64, 0x5E4A, 0x4986,
+    0x4110, 0x5E23, 0xB615, 0xD6D2, 0xB845, 0x93BF, 0x4244, 0x701C,
+    // M^8192
+    0x92E0, 0x56A3, 0x1FD8, 0xD110, 0xE2B9, 0x056A, 0x2A34, 0x4F9B,
+    0xB4F2, 0x265D, 0xBF31, 0x3873, 0x6839, 0xA8F2, 0x6B84, 0xBD18,
+    // M^16384
+    0x93B9, 0x1463, 0x2BD2, 0xE8EE, 0xB38B, 0xA32E, 0x4ED7, 0xC618,
+    0x163D, 0xA53B, 0x1D0D, 0xF11C, 0x5F26, 0xF946, 0x39E9, 0x7DCA,
+    // M^32768
+    0x3C00, 0x2808, 0x947B, 0xB0C7, 0xC180, 0x43FB, 0xE78F, 0xA770,
+    0xA730, 0xF02D, 0xF58F, 0x84C9, 0xA547, 0x7404, 0x11F7, 0x11E7
+  };
+  __xor16_27d_state = __xor16_jump(__xor16_27d_state, table, n);
+  return __xor16_27d_state;
+}
+
+uint16_t xor16_27d_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_27d_state)::"r18","r19");
+  return __xor16_27d_state;
+}
+
+static const uint16_t __xor16_27d_checkpoints[256] PROGMEM = {
+  0x0001, 0xF87C, 0x4F82, 0x2574, 0x6245, 0xBA9D, 0x44CA, 0x0898,
+  0x86FF, 0x951B, 0xA866, 0x7E72, 0xBAAC, 0xBF08, 0x4A45, 0xED46,
+  0x92EE, 0xCFF8, 0x8E04, 0x2E9B, 0x6AD5, 0xDCD9, 0x5306, 0x625B,
+  0xB9F8, 0xAA8F, 0x32C4, 0xCEE0, 0x73F5, 0x6EBB, 0x2FB8, 0x0DE1,
+  0x92E0, 0x2D0B, 0x6751, 0x710E, 0x4227, 0x92F7, 0x36A9, 0x4441,
+  0xAC83, 0x2908, 0x4BBC, 0x9114, 0xE7C4, 0xB92E, 0xD2A6, 0x2E91,
+  0x0BD2, 0x901D, 0x03DF, 0xB19C, 0xD776, 0xFD01, 0xD869, 0x38F5,
+  0xA23E, 0x4ED4, 0x9CE1, 0x1746, 0x36A4, 0xDF72, 0xC447, 0xC195,
+  0x93B9, 0x8E11, 0xB485, 0x87D6, 0x9328, 0xAA9B, 0x50A6, 0x6C61,
+  0x1970, 0xF563, 0xA7D8, 0x9CB2, 0x2987, 0x6C53, 0x9B72, 0x362F,
+  0x7B69, 0x6BB0, 0x1F32, 0xAACB, 0x17A7, 0xB707, 0xEA78, 0xF7FC,
+  0x4C0F, 0x5255, 0xA046, 0x26E8, 0x0C8E, 0x300C, 0x9802, 0x4274,
+  0xAC36, 0x6C5E, 0x0041, 0x5EEB, 0x93F4, 0xB3B5, 0x0037, 0xF98A,
+  0x295F, 0xF689, 0x6E72, 0xAC88, 0xB073, 0x48FA, 0xE4B9, 0x5646,
+  0x6D3D, 0xC1E2, 0xCCA4, 0x7B38, 0xD4CD, 0x8BD6, 0x7CB7, 0x777D,
+  0xE64D, 0x6055, 0x76A5, 0x804B, 0x50B2, 0x0E03, 0xBBF1, 0x9FE6,
+  0x3C00, 0x14D2, 0xB8D4, 0xD734, 0xDA2A, 0xCA0C, 0x3C48, 0x52FE,
+  0xE675, 0x8350, 0xF92D, 0x0C23, 0x7477, 0x5638, 0x2AE7, 0xF99E,
+  0x4B3D, 0x5408, 0x04F7, 0x3750, 0x3813, 0xD9A9, 0x5FDE, 0x171E,
+  0x911E, 0x86C3, 0xF5EA, 0x827F, 0xFD56, 0x655C, 0xC793, 0xE972,
+  0x4789, 0x06BD, 0xDD6E, 0x6B30, 0x2252, 0x067A, 0xBCAD, 0x3FF7,
+  0xA7DD, 0xE73A, 0xC394, 0x466B, 0x0202, 0xAC12, 0x0D82, 0xAF9F,
+  0x7AA3, 0x6D9C, 0xE6D6, 0x25D8, 0xDE42, 0x3B25, 0x092D, 0x3F75,
+  0x1B01, 0x8598, 0xFAE2, 0x5C29, 0xA411, 0xCEF0, 0x9263, 0x69AB,
+  0x4A71, 0x6D0C, 0x3A20, 0x8E79, 0x1081, 0xD338, 0xEC48, 0x8CC1,
+  0xE34A, 0x3390, 0xF6C9, 0xC8E5, 0x70FE, 0x26B2, 0x2A88, 0xA7AE,
+  0x3BD3, 0x932C, 0x296F, 0xF537, 0x632D, 0xE245, 0xD5C3, 0x95F9,
+  0x5005, 0xCAE9, 0x3E1F, 0xC265, 0xDA82, 0xF5FF, 0x1861, 0x1055,
+  0x2AAD, 0x3E0E, 0xDB8F, 0x9210, 0xB542, 0x1AC9, 0x0208, 0xCD15,
+  0x4146, 0xFF46, 0xA964, 0x0312, 0xB158, 0xCF75, 0x2857, 0xEAEE,
+  0x2942, 0x8C2C, 0x01A6, 0x21DC, 0x089B, 0xFF3F, 0x148A, 0x1F6E,
+  0x8E85, 0xEB87, 0x89E6, 0x52A7, 0xB9B3, 0x9563, 0xEDF4, 0x2D8C
+};
+static const uint8_t __xor16_27d_order[256] PROGMEM = {
+    0, 102,  98, 242, 172, 230, 235,  50, 146, 165, 161,   7, 244, 182,  48, 139,
+   92, 174,  31, 125, 223, 196, 246, 129, 151,  59,  84, 222,  72, 229, 184,  82,
+  247, 243, 164,   3, 179, 205,  91, 238,  41, 240, 104, 210,  76, 206, 224, 142,
+   33, 255,  47,  19,  30,  93,  26, 201,  79,  60,  38, 147, 148,  55, 194, 181,
+  208, 128, 134, 225, 218, 183, 167, 232,  36,  95,  39,   6, 171, 160, 109,  14,
+  192, 144,  42,  88,  57,   2, 216,  70, 124,  89, 251, 135,  22, 145, 141, 111,
+  187,  99, 150, 121,   4,  23, 212, 157,  34, 191,  20, 163,  81,  77,  97,  71,
+  193, 112, 177, 106,  29, 204,  35,  28, 140, 122, 119, 176, 115,  80, 118,  11,
+  123, 155, 137, 185, 153,   8,  67, 250, 117, 241, 199,  18,  65, 195, 248,  49,
+   43, 152, 227, 190,  32,  16,  37,  68, 209,  64, 100,   9, 253, 215,  94,  78,
+   75,  58, 127,  90,  56, 188, 207,  74, 168,  10, 234,  25,  69,  83, 173,  96,
+   40, 107, 175, 108, 236,  51, 101,  66, 228,  85, 130,  45, 252,  24,   5,  12,
+  126, 166,  13,  63, 113, 219, 170,  62, 158, 203, 133, 217, 114, 231,  27, 189,
+  237,  17,  46, 197, 116, 214, 131,  52,  54, 149, 132, 220, 226,  21, 162, 180,
+   61, 213, 200, 110, 120, 136, 178, 169,  44, 159,  86, 239, 249, 198,  15, 254,
+  211,  73, 154, 221, 105, 202,  87,   1, 138, 103, 143, 186,  53, 156, 245, 233
+};
+
+uint16_t xor16_27d_position() {
+  uint16_t saved = __xor16_27d_state;
+  uint16_t pos = __xor16_position(saved, xor16_27d, __xor16_27d_checkpoints, __xor16_27d_order);
+  __xor16_27d_state = saved;
+  return pos;
+}
+
+void xor16_27d_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_27d, xor16_27d, __xor16_27d_checkpoints);
+}
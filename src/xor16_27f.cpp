@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 27f //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_27f_state;
+uint16_t __xor16_27f_state;
 
 bool seed_xor16_27f(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -40,3 +41,221 @@ uint16_t xor16_27f() {
     :"+d"((uint16_t)__xor16_27f_state)::"r18","r19");
   return __xor16_27f_state;
 }
+
+void xor16_27f_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_27f_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_27f_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x8005, 0x000A, 0x0014, 0x0028, 0x0050, 0x80A1, 0x0142, 0x8285,
+    0x050A, 0x0A14, 0x1428, 0x2850, 0x50A0, 0xA140, 0x4080, 0x8100,
+    // M^2
+    0x0111, 0x0022, 0x0044, 0x8089, 0x0112, 0x0321, 0x0442, 0x8980,
+    0x1100, 0x2200, 0xC401, 0x8802, 0x1204, 0x2408, 0xC205, 0x840A,
+    // M^4
+    0x1103, 0x0303, 0x0406, 0x8C12, 0x1030, 0x3130, 0xC061, 0x9488,
+    0x0304, 0x0608, 0x831F, 0x0C2A, 0x3040, 0x6080, 0x655A, 0xC0A0,
+    // M^8
+    0x2144, 0x170C, 0x841A, 0x5CA6, 0x1140, 0x72C4, 0x45A8, 0x6B65,
+    0x010A, 0x0905, 0x4F88, 0x3114, 0x90A1, 0x9152, 0xDA81, 0x0042,
+    // M^16
+    0x51EA, 0x0F9A, 0x1520, 0xBE0B, 0xD403, 0x78A0, 0xD104, 0xE0FA,
+    0x4AA0, 0x9540, 0x9BD1, 0x95A3, 0xA806, 0xD20D, 0x3852, 0x52A4,
+    // M^32
+    0x223B, 0x54FA, 0x01D7, 0x53E6, 0x0751, 0x4FA0, 0x9D70, 0x9437,
+    0xA0EB, 0xFAD7, 0x04F6, 0xEDF9, 0x0FB0, 0xAD71, 0xE535, 0x886E,
+    // M^64
+    0x3A70, 0xA8D9, 0xD9EB, 0xA373, 0xE6D0, 0x8D91, 0x1BBB, 0xBCCF,
+    0x46DF, 0xA1B4, 0x106D, 0xB9A5, 0x6FF5, 0x9B41, 0x0F2A, 0xB18C,
+    // M^128
+    0x9C5F, 0x4BCF, 0x3516, 0x2FF5, 0xD59A, 0x3EF4, 0xD76F, 0xA3B5,
+    0x1766, 0x6277, 0xB937, 0x6887, 0xF566, 0xA17C, 0xC898, 0xC5B0,
+    // M^256
+    0x2EE0, 0x6CA7, 0x5108, 0x3320, 0x440A, 0x4D7F, 0x1080, 0xF04F,
+    0xAE02, 0xD514, 0xE7A3, 0x4050, 0x6021, 0x5548, 0x3C75, 0xEBA2,
+    // M^512
+    0x8A1F, 0x60B1, 0xC176, 0x0300, 0x8451, 0x0C1E, 0x906E, 0xD251,
+    0xA0AA, 0xEB55, 0xE15D, 0x68FF, 0x0AA2, 0x3655, 0xF487, 0x684E,
+    // M^1024
+    0x476D, 0x12D3, 0x8585, 0x4BFF, 0x1733, 0xAF34, 0x5C5B, 0xE31E,
+    0xE3E5, 0xD6CA, 0x5660, 0x4885, 0x3D54, 0x69A9, 0xB8EA, 0x9884,
+    // M^2048
+    0xA1DD, 0x1656, 0x0CF7, 0x59C6, 0xB3A2, 0xE765, 0xCE72, 0xB772,
+    0xAE71, 0x7BF9, 0xF67B, 0xD199, 0x6710, 0x3A9B, 0xCDA1, 0x8BCE,
+    // M^4096
+    0x216A, 0x8DE3, 0xB159, 0xB6F8, 0x458C, 0xDB3A, 0x9697, 0x7955,
+    0xD626, 0x41E7, 0xE29E, 0x73C5, 0x676B, 0x1D76, 0x3E36, 0xB5B8,
+    // M^8192
+    0xBDE6, 0x6AB4, 0x5D0A, 0xAB50, 0x747A, 0xAD4C, 0x50A3, 0xA2E0,
+    0xA81C, 0xC138, 0x6184, 0xAC1B, 0x01C3, 0x148D, 0x08AD, 0xAA06,
+    // M^16384
+    0xB27A, 0x57DF, 0xAD09, 0x5F6D, 0x3416, 0x7DF1, 0xD190, 0x20BC,
+    0x90B0, 0x78D1, 0x4BD6, 0x7B6C, 0x8D0D, 0x891B, 0xE80B, 0xE416,
+    // M^32768
+    0x0814, 0x144A, 0x2010, 0x51A2, 0x8100, 0x46A6, 0x050A, 0x1224,
+    0x0040, 0xE031, 0x44EA, 0x2115, 0x0402, 0x8114, 0x44A2, 0x0010
+  };
+  __xor16_27f_state = __xor16_jump(__xor16_27f_state, table, n);
+  return __xor16_27f_state;
+}
+
+uint16_t xor16_27f_prev() {
+    __asm__ __volatile__(
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_27f_state)::"r18","r19");
+  return __xor16_27f_state;
+}
+
+static const uint16_t __xor16_27f_checkpoints[256] PROGMEM = {
+  0x0001, 0x2EE0, 0x8A1F, 0x1A83, 0x476D, 0xB1F7, 0x8A3C, 0x15BB,
+  0xA1DD, 0xF8E5, 0x70B6, 0xCD89, 0x33A9, 0xEE8F, 0x2058, 0x32E2,
+  0x216A, 0xF932, 0x693E, 0x8095, 0x200F, 0x7527, 0x1E8D, 0xAE41,
+  0xF26D, 0x269D, 0x9F72, 0x2234, 0xD821, 0x9439, 0x7895, 0x82E1,
+  0xBDE6, 0x4725, 0x9257, 0x1952, 0xB65E, 0xB679, 0xE849, 0xCF8F,
+  0xDB12, 0xA41D, 0x518B, 0x737E, 0x6570, 0x3969, 0x9B04, 0xE1CD,
+  0x809A, 0x0060, 0x5DFF, 0x9C70, 0x3585, 0xF36F, 0xE438, 0x5F69,
+  0xC08E, 0x2917, 0xEC5F, 0x5189, 0x1FD9, 0x05C1, 0x878E, 0x89D7,
+  0xB27A, 0x4DAD, 0xC47C, 0x4BA9, 0xA7C3, 0x80D7, 0x5C28, 0x85F8,
+  0x7899, 0xE0C9, 0x7F90, 0x61BC, 0x5C2D, 0xFA10, 0x33F0, 0xA7C5,
+  0xBD78, 0xFDEF, 0x6690, 0xEFCF, 0x9EDA, 0x0226, 0xA5C4, 0x468C,
+  0x9CA5, 0xEEA8, 0x7E68, 0x1524, 0x35F7, 0x863D, 0x9CA8, 0xA260,
+  0x3601, 0x293E, 0xBCE0, 0xD488, 0x933A, 0xA667, 0xC2ED, 0xE3BB,
+  0x71D4, 0x52D3, 0x6FC2, 0x39B0, 0x2201, 0xAEBC, 0x571F, 0xA484,
+  0xF80E, 0xAC61, 0x6A06, 0xC1D6, 0xE0BF, 0x5BCA, 0xD85A, 0xFCAB,
+  0x891A, 0x1E7D, 0x47FB, 0x381D, 0x7DFB, 0x9830, 0xC2A6, 0x825C,
+  0x0814, 0x5552, 0x2DD8, 0xCB5C, 0xDA33, 0x6980, 0x7720, 0xD8D6,
+  0x6ECC, 0x993D, 0x206C, 0x6A9F, 0x6853, 0x3FA0, 0x54BC, 0x20E5,
+  0x8710, 0x331D, 0x46BD, 0xBB30, 0xECF8, 0xFFF6, 0xEA4E, 0x09D4,
+  0x1B9F, 0xCF4D, 0x577A, 0x8693, 0x2F17, 0xDEE8, 0x5B81, 0xB9BD,
+  0x856B, 0x8E9B, 0x5C67, 0xB517, 0xC02F, 0xBAC7, 0xB80F, 0xBEF4,
+  0x149E, 0x3D48, 0x1F38, 0x8691, 0x43B0, 0xBE59, 0xE566, 0xAB6E,
+  0xD6DC, 0x43AC, 0x987B, 0xA341, 0xFB9C, 0x0F95, 0x1748, 0xDF34,
+  0x336E, 0x1D0F, 0x49BF, 0x0B72, 0x4E14, 0x5B90, 0xD357, 0x8B25,
+  0xE273, 0x0C39, 0xB346, 0x88F2, 0x2EEF, 0xAA70, 0x325B, 0xC590,
+  0x2A33, 0x8B3E, 0xD71E, 0x61C6, 0x1A5F, 0x8180, 0xB5EF, 0x1AB5,
+  0x73B7, 0x987F, 0xF249, 0x3AEA, 0x521A, 0x92CD, 0xF290, 0x83EF,
+  0x1D6B, 0x4548, 0x5674, 0x261E, 0x2D7A, 0x1ACB, 0x64CD, 0x2299,
+  0x29D9, 0x021F, 0xB171, 0x47DC, 0x662D, 0x5A3D, 0x8CAD, 0xBDA9,
+  0x77CA, 0x2AE1, 0x435C, 0x71C1, 0x6931, 0xA0FA, 0x08D7, 0xF7DA,
+  0x8549, 0xAF43, 0x30C8, 0xE686, 0x7DC8, 0xD302, 0xA047, 0xBD25,
+  0xE5AD, 0x3AC6, 0x7D4D, 0x5CA5, 0x397F, 0xE2A1, 0xC45B, 0x1599
+};
+static const uint8_t __xor16_27f_order[256] PROGMEM = {
+    0,  49, 225,  85,  61, 128, 238, 151, 187, 193, 181, 168,  91, 255,   7, 182,
+   35, 204,   3, 207, 221, 152, 185, 216, 121,  22, 170,  60,  20,  14, 138, 143,
+   16, 108,  27, 223, 219,  25,  57,  97, 224, 200, 233, 220, 130,   1, 196, 156,
+  242, 198,  15, 145, 184,  12,  78,  52,  92,  96, 123,  45, 252, 107, 249, 211,
+  169, 141, 234, 177, 172, 217,  87, 146,  33,   4, 227, 122, 186,  67,  65, 188,
+   59,  42, 212, 105, 142, 129, 218, 110, 154, 229, 158, 189, 117,  70,  76, 162,
+  251,  50,  55,  75, 203, 222,  44, 228,  82, 140, 236,  18, 133, 114, 139, 136,
+  106,  10, 235, 104,  43, 208,  21, 134, 232,  30,  72, 250, 244, 124,  90,  74,
+   19,  48,  69, 205, 127,  31, 215, 240, 160,  71,  93, 171, 155, 144,  62, 195,
+  120,  63,   2,   6, 191, 201, 230, 161,  34, 213, 100,  29, 125, 178, 209, 137,
+   46,  51,  88,  94,  84,  26, 246, 237,   8,  95, 179,  41, 111,  86, 101,  68,
+   79, 197, 175, 113,  23, 109, 241, 226,   5,  64, 194, 163, 206,  36,  37, 166,
+  159, 165, 147,  98, 247,  80, 231,  32, 173, 167, 164,  56, 115, 126, 102, 254,
+   66, 199, 131,  11, 153,  39, 245, 190,  99, 176, 202,  28, 118, 135, 132,  40,
+  157, 183, 116,  73,  47, 192, 253, 103,  54, 174, 248, 243,  38, 150,  58, 148,
+   13,  89,  83, 210,  24, 214,  53, 239, 112,   9,  17,  77, 180, 119,  81, 149
+};
+
+uint16_t xor16_27f_position() {
+  uint16_t saved = __xor16_27f_state;
+  uint16_t pos = __xor16_position(saved, xor16_27f, __xor16_27f_checkpoints, __xor16_27f_order);
+  __xor16_27f_state = saved;
+  return pos;
+}
+
+void xor16_27f_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_27f, xor16_27f, __xor16_27f_checkpoints);
+}
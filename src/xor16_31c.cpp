@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 31c //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_31c_state;
+uint16_t __xor16_31c_state;
 
 bool seed_xor16_31c(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -39,3 +40,234 @@ uint16_t xor16_31c() {
     :"+d"((uint16_t)__xor16_31c_state)::"r18","r19");
   return __xor16_31c_state;
 }
+
+void xor16_31c_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_31c_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_31c_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xD00D, 0xB01B, 0x6036, 0xC06C, 0x80D8, 0x01B0, 0x0360, 0x06C0,
+    0x0D80, 0x1B00, 0x3600, 0x6C00, 0xD800, 0x3000, 0x6000, 0xC000,
+    // M^2
+    0x0857, 0x08A2, 0x0145, 0x028A, 0x8514, 0x8A28, 0x1450, 0x28A0,
+    0x5140, 0xA280, 0xC500, 0x0A00, 0x1400, 0xE800, 0x5000, 0xA000,
+    // M^4
+    0x9AF4, 0xA02A, 0x4C02, 0x8008, 0xB011, 0x8022, 0x4044, 0x4088,
+    0x0110, 0xC220, 0x6440, 0xA880, 0xD100, 0x1200, 0x4400, 0x4800,
+    // M^8
+    0x8F5D, 0xFA00, 0x28EA, 0xC808, 0xA1E5, 0x6808, 0x4846, 0x8480,
+    0xB101, 0x4E02, 0x7204, 0xB208, 0xDC10, 0x1320, 0x2040, 0xEC80,
+    // M^16
+    0x5593, 0xFFFA, 0x37EE, 0xB6C0, 0x4DD8, 0x4960, 0x08E4, 0x1A04,
+    0x1DEC, 0x544E, 0x8998, 0xA5BA, 0x7139, 0x4B1B, 0x5B66, 0x9B6C,
+    // M^32
+    0x439E, 0xC0CA, 0xDF4C, 0x6E78, 0x8350, 0xA2B4, 0xC9D4, 0xB723,
+    0x9A59, 0xD5F7, 0xC226, 0x1385, 0x9B43, 0xE60F, 0x4FD7, 0xC6E7,
+    // M^64
+    0x45F4, 0x5975, 0xF49E, 0x2BC4, 0xC3CD, 0xBC94, 0x2207, 0x17C3,
+    0xFCB4, 0x4907, 0xE1F5, 0xFF1C, 0x4B0F, 0x4A8E, 0x7065, 0x1EBA,
+    // M^128
+    0xD327, 0xD4F6, 0xDC8A, 0xC17B, 0x7406, 0x2142, 0xEB96, 0x360C,
+    0xEDB3, 0x9BD2, 0x2312, 0xD893, 0xF911, 0x5792, 0x5E1D, 0x06CA,
+    // M^256
+    0x2DBE, 0x0276, 0x79C6, 0xCD1C, 0xDBF0, 0x8541, 0xEBC1, 0x0BB2,
+    0x7DEE, 0x2C43, 0x8103, 0x3C8E, 0x6455, 0x6483, 0x7D8F, 0x70D7,
+    // M^512
+    0x474F, 0xE283, 0xA7FA, 0xA211, 0xBAEC, 0x4A45, 0xC935, 0x3A56,
+    0x6EA4, 0x1D07, 0x22F1, 0x0045, 0xFC46, 0xBC75, 0x2D9A, 0x10D4,
+    // M^1024
+    0x15DA, 0x03A6, 0xBEAB, 0x4C05, 0xF168, 0x1958, 0x43B3, 0x6BD1,
+    0x79B5, 0xB260, 0xE5F7, 0x2980, 0xD385, 0xAB7A, 0x304D, 0x1233,
+    // M^2048
+    0xD96E, 0x0451, 0x3C2B, 0x574B, 0x35DA, 0x7D6E, 0x6E05, 0xB5B2,
+    0x3017, 0x8247, 0x7DC3, 0x909E, 0xFA8E, 0xBF3C, 0xDC38, 0x9FA9,
+    // M^4096
+    0x65CC, 0xFF72, 0x5FF5, 0x0D54, 0xB511, 0x389A, 0xE95B, 0x6E98,
+    0x917C, 0x92FF, 0x4248, 0x8A7E, 0xCE79, 0xA6C2, 0x4BBD, 0x7CD3,
+    // M^8192
+    0xEB29, 0x0FC2, 0x7E00, 0x5AF5, 0x1781, 0xCB6A, 0x410E, 0x616B,
+    0x15A7, 0xE202, 0x3D4D, 0xAD51, 0x61EF, 0x7217, 0x163E, 0x435C,
+    // M^16384
+    0x0737, 0x481E, 0x77D8, 0x5125, 0x2145, 0xD0C5, 0x28AE, 0x45F4,
+    0x79EF, 0xCAB5, 0x1891, 0x0956, 0x5A9F, 0x6AAE, 0x497C, 0x93E1,
+    // M^32768
+    0x62BA, 0x0F8C, 0xCFBC, 0xCA26, 0x4B00, 0x9DB7, 0x982A, 0xC300,
+    0xDDBF, 0xDDE5, 0x304F, 0x4694, 0xDD65, 0x1BE3, 0xC616, 0xC08C
+  };
+  __xor16_31c_state = __xor16_jump(__xor16_31c_state, table, n);
+  return __xor16_31c_state;
+}
+
+uint16_t xor16_31c_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_31c_state)::"r18","r19");
+  return __xor16_31c_state;
+}
+
+static const uint16_t __xor16_31c_checkpoints[256] PROGMEM = {
+  0x0001, 0x2DBE, 0x474F, 0xDDF2, 0x15DA, 0x6C51, 0xB90E, 0x87CD,
+  0xD96E, 0xF041, 0xCBF1, 0xF307, 0x0A2D, 0x0CE8, 0x15A3, 0x3983,
+  0x65CC, 0xB148, 0x2B32, 0x5567, 0xDDB9, 0x1CCF, 0xA2B9, 0x8DB6,
+  0x9E07, 0xD342, 0xD117, 0x991D, 0x1776, 0x7A3B, 0xD1F1, 0x879F,
+  0xEB29, 0x611B, 0x5DC6, 0x427A, 0x2BD6, 0x4993, 0xC365, 0x660D,
+  0x2D28, 0xECBD, 0x1831, 0x2BD4, 0x4BE5, 0x21E6, 0x07EF, 0x2E8E,
+  0x4853, 0x5EF8, 0xFBCA, 0x4FB4, 0xBD6A, 0x1188, 0xDF15, 0x0AA5,
+  0xCA46, 0x8DE4, 0xAC40, 0x4218, 0x4720, 0x2860, 0x368D, 0x3F40,
+  0x0737, 0xD811, 0xA3CD, 0x3CEE, 0x6EC5, 0x3CC9, 0xBD8A, 0x74BA,
+  0x6633, 0xC535, 0xFB7C, 0x6107, 0x32EC, 0xFD7D, 0xE1F9, 0x4A55,
+  0x090B, 0xA3B4, 0x693C, 0xB207, 0x0A4C, 0x4FD6, 0xD19C, 0x707B,
+  0x2AFD, 0x53E8, 0xE059, 0xB948, 0x17BC, 0x5522, 0x6200, 0x354F,
+  0x8CE8, 0x6574, 0x2957, 0x43DC, 0xA37B, 0x125D, 0xE143, 0xD03C,
+  0x8366, 0x344A, 0xA57E, 0xEB65, 0x3E00, 0x9118, 0x7F80, 0x9ACB,
+  0x06E8, 0x056E, 0x24C1, 0x284D, 0x2AA8, 0x37A1, 0x7335, 0x263D,
+  0x0E16, 0x318E, 0xC026, 0xF3A9, 0x3272, 0x9B93, 0x862B, 0xBA02,
+  0x62BA, 0xAF26, 0x0685, 0xF28A, 0xE515, 0x1ABE, 0x9737, 0xCC93,
+  0x4F5F, 0x3A8C, 0xAF73, 0x62CC, 0x61E6, 0x7A60, 0x0314, 0xF39B,
+  0x6EB5, 0x89B9, 0x8416, 0x5194, 0xCDB0, 0x9838, 0xBBA1, 0xBE6F,
+  0x145D, 0x4C03, 0xEFCA, 0xAAE2, 0x63DD, 0xEA46, 0xE967, 0x1035,
+  0x6E9C, 0xEC5A, 0x2B0D, 0x90C4, 0x8D37, 0xB80B, 0xAE5B, 0x577F,
+  0xE716, 0x1935, 0x2FFC, 0x82BB, 0xEB43, 0xC0F1, 0x9E24, 0x79CB,
+  0x3E9E, 0xF7F6, 0x1852, 0x6A9C, 0x6D59, 0x09FC, 0x4B78, 0x68C0,
+  0xC5F1, 0x62C9, 0x359E, 0x9AD5, 0x6BB4, 0x58EA, 0x8F0C, 0x282D,
+  0x4428, 0xB4D1, 0xE73F, 0x7CD6, 0x80E7, 0x43EB, 0xABC4, 0xE0C2,
+  0x8BDE, 0x90DB, 0xCDD5, 0xA2C0, 0xD864, 0x42C5, 0xE5C7, 0x234B,
+  0x3C3B, 0x013E, 0x95F3, 0x7965, 0x06C1, 0x608D, 0x8BDA, 0xE91D,
+  0x6A2F, 0x1792, 0x66CF, 0xCF2D, 0xFD5D, 0x64B8, 0x0010, 0xDBF0,
+  0xBAEC, 0xB124, 0xF168, 0xD3FC, 0x32B8, 0xB48A, 0x35DA, 0x08D2,
+  0x057B, 0xAB49, 0x7214, 0xF32C, 0x6DB8, 0x4170, 0xB511, 0x7AA2,
+  0xE111, 0xE27B, 0x123C, 0xA27D, 0x1403, 0xCA9E, 0x7B7B, 0x47DE,
+  0x200E, 0xD22F, 0x5B1D, 0x366D, 0x5A72, 0xBE11, 0x1781, 0x92F7
+};
+static const uint8_t __xor16_31c_order[256] PROGMEM = {
+    0, 222, 209, 142, 113, 232, 130, 212, 112,  64,  46, 231,  80, 181,  12,  84,
+   55,  13, 120, 159,  53, 242, 101, 244, 152,  14,   4,  28, 254, 217,  92,  42,
+  178, 169, 133,  21, 248,  45, 207, 114, 119, 191, 115,  61,  98, 116,  88, 162,
+   18,  43,  36,  40,   1,  47, 170, 121, 124, 228,  76, 105,  95, 186, 230, 251,
+   62, 117,  15, 137, 208,  69,  67, 108, 176,  63, 237,  59,  35, 205,  99, 197,
+  192,  60,   2, 247,  48,  37,  79, 182,  44, 153, 136,  51,  85, 147,  89,  93,
+   19, 167, 189, 252, 250,  34,  49, 213,  75,  33, 140,  94, 128, 185, 139, 156,
+  221,  97,  16,  39,  72, 218, 183,  82, 216, 179, 188,   5, 180, 236, 160, 144,
+   68,  87, 234, 118,  71, 211, 175,  29, 141, 239, 246, 195, 110, 196, 171, 104,
+  146, 126,  31,   7, 145, 214, 200,  96, 164,  23,  57, 190, 163, 201, 109, 255,
+  210, 134, 149,  27, 111, 187, 125,  24, 174, 243,  22, 203, 100,  81,  66, 106,
+  155, 233, 198,  58, 166, 129, 138, 225,  17,  83, 229, 193, 238, 165,   6,  91,
+  127, 224, 150,  52,  70, 253, 151, 122, 173,  38,  73, 184,  56, 245,  10, 135,
+  148, 202, 219, 103,  26,  86,  30, 249,  25, 227,  65, 204,   8, 223,  20,   3,
+   54,  90, 199, 240, 102,  78, 241, 132, 206, 168, 194, 215, 158, 157,  32, 172,
+  107, 161,  41, 154,   9, 226, 131,  11, 235, 143, 123, 177,  74,  50, 220,  77
+};
+
+uint16_t xor16_31c_position() {
+  uint16_t saved = __xor16_31c_state;
+  uint16_t pos = __xor16_position(saved, xor16_31c, __xor16_31c_checkpoints, __xor16_31c_order);
+  __xor16_31c_state = saved;
+  return pos;
+}
+
+void xor16_31c_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_31c, xor16_31c, __xor16_31c_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 31f //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_31f_state;
+uint16_t __xor16_31f_state;
 
 bool seed_xor16_31f(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -39,3 +40,234 @@ uint16_t xor16_31f() {
     :"+d"((uint16_t)__xor16_31f_state)::"r18","r19");
   return __xor16_31f_state;
 }
+
+void xor16_31f_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_31f_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_31f_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x800D, 0x801B, 0x0036, 0x006C, 0x00D8, 0x01B0, 0x0360, 0x06C0,
+    0x0D80, 0x1B00, 0x3600, 0x6C00, 0xD800, 0x3000, 0x6000, 0xC000,
+    // M^2
+    0x4057, 0xC0A2, 0x8145, 0x028A, 0x0514, 0x0A28, 0x1450, 0x28A0,
+    0x5140, 0xA280, 0xC500, 0x0A00, 0x1400, 0xE800, 0x5000, 0xA000,
+    // M^4
+    0x40F4, 0x122A, 0x2402, 0x4808, 0x1011, 0xA022, 0xC044, 0xC088,
+    0x0110, 0xC220, 0x6440, 0xA880, 0xD100, 0x1200, 0x4400, 0x4800,
+    // M^8
+    0xD0FD, 0xE920, 0x646A, 0xA488, 0x81E5, 0xE808, 0xE846, 0x8480,
+    0x1101, 0x6E02, 0xF204, 0x3208, 0xDC10, 0x1320, 0x2040, 0xEC80,
+    // M^16
+    0x05E4, 0x14E1, 0x8C82, 0x2DAC, 0xCDD8, 0x4960, 0x88E4, 0x9A04,
+    0x1DEC, 0x744E, 0x0998, 0x05BA, 0x5139, 0x4B1B, 0xFB66, 0x9B6C,
+    // M^32
+    0xC376, 0x06C5, 0x19AB, 0x289F, 0x8350, 0x22B4, 0x49D4, 0x3723,
+    0xBA59, 0xD5F7, 0x6226, 0x3385, 0x1B43, 0x660F, 0x4FD7, 0xC6E7,
+    // M^64
+    0x11C0, 0x13FB, 0x6A24, 0x157E, 0x63CD, 0x3C94, 0x2207, 0x97C3,
+    0x7CB4, 0x4907, 0xC1F5, 0xFF1C, 0xCB0F, 0x6A8E, 0x5065, 0xBEBA,
+    // M^128
+    0x027F, 0x0364, 0xDA40, 0x67B1, 0xD406, 0x0142, 0x4B96, 0x360C,
+    0x6DB3, 0xBBD2, 0x0312, 0x5893, 0x5911, 0x7792, 0xFE1D, 0xA6CA,
+    // M^256
+    0x99EA, 0x46F5, 0xA911, 0xBDCB, 0xDBF0, 0x2541, 0x4BC1, 0x2BB2,
+    0x5DEE, 0xAC43, 0x0103, 0x1C8E, 0x4455, 0xE483, 0xFD8F, 0x70D7,
+    // M^512
+    0xCBEE, 0xFEF6, 0x972E, 0x92C5, 0xBAEC, 0x6A45, 0xE935, 0x9A56,
+    0xEEA4, 0x1D07, 0x82F1, 0x2045, 0x5C46, 0x9C75, 0x8D9A, 0x90D4,
+    // M^1024
+    0x2C93, 0xA8DC, 0x2C98, 0xFE36, 0x7168, 0x9958, 0xC3B3, 0xCBD1,
+    0x59B5, 0xB260, 0xE5F7, 0x2980, 0xF385, 0x0B7A, 0x904D, 0x9233,
+    // M^2048
+    0xF9FB, 0x1B6D, 0x8382, 0xE8E2, 0x95DA, 0x5D6E, 0x4E05, 0x95B2,
+    0x3017, 0x8247, 0xFDC3, 0xB09E, 0xDA8E, 0xBF3C, 0x5C38, 0xBFA9,
+    // M^4096
+    0x1FDD, 0x59B0, 0x8326, 0x7187, 0x1511, 0x989A, 0xE95B, 0xEE98,
+    0x917C, 0x12FF, 0xC248, 0xAA7E, 0xEE79, 0x86C2, 0xEBBD, 0xFCD3,
+    // M^8192
+    0xFA62, 0x5DD5, 0x3D5C, 0x39A9, 0xB781, 0x6B6A, 0x610E, 0x616B,
+    0x15A7, 0xC202, 0x9D4D, 0x0D51, 0xE1EF, 0x7217, 0x363E, 0x435C,
+    // M^16384
+    0x7E78, 0x22B0, 0xC439, 0x42C4, 0x0145, 0xF0C5, 0x08AE, 0xC5F4,
+    0xF9EF, 0xEAB5, 0xB891, 0xA956, 0xDA9F, 0x4AAE, 0x497C, 0x33E1,
+    // M^32768
+    0x99D5, 0x946F, 0x0F30, 0xAAAA, 0x4B00, 0x9DB7, 0x382A, 0xC300,
+    0x5DBF, 0xFDE5, 0xB04F, 0xC694, 0xFD65, 0x9BE3, 0x6616, 0xC08C
+  };
+  __xor16_31f_state = __xor16_jump(__xor16_31f_state, table, n);
+  return __xor16_31f_state;
+}
+
+uint16_t xor16_31f_prev() {
+    __asm__ __volatile__(
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_31f_state)::"r18","r19");
+  return __xor16_31f_state;
+}
+
+static const uint16_t __xor16_31f_checkpoints[256] PROGMEM = {
+  0x0001, 0x99EA, 0xCBEE, 0x7766, 0x2C93, 0xD653, 0x2B63, 0xB83F,
+  0xF9FB, 0x90F8, 0x178B, 0xFD9D, 0x109F, 0x7FD2, 0x4C0F, 0x2BC7,
+  0x1FDD, 0x9EC6, 0x0ADB, 0x699A, 0x5310, 0x9387, 0x9893, 0x0751,
+  0xF975, 0xE965, 0x76C0, 0x906A, 0xA13C, 0x23D1, 0x3747, 0x6DB7,
+  0xFA62, 0xB536, 0x9DB9, 0x85C3, 0x9356, 0xBAFA, 0x0530, 0xA25C,
+  0xBCFC, 0x4794, 0x5472, 0x4B5C, 0x9447, 0x084E, 0x0560, 0x326D,
+  0xEF25, 0x9041, 0xE6A9, 0xEE49, 0xB7F5, 0x8E96, 0xDEBF, 0x6605,
+  0x84B7, 0xD2D9, 0xFAEC, 0xCCAB, 0xFCF2, 0xE834, 0x22F5, 0xE6F9,
+  0x7E78, 0xE42C, 0x5943, 0x6C64, 0xC310, 0xA705, 0x5401, 0x2133,
+  0x98C3, 0x9760, 0xAAAC, 0x3EB0, 0xC41B, 0x357F, 0x828E, 0xA509,
+  0xEC98, 0x39DF, 0x91F0, 0xF7AE, 0x81FC, 0xA721, 0xD851, 0xDC58,
+  0xF97A, 0x22A0, 0x4633, 0x7161, 0xF7DD, 0xEB93, 0xABA5, 0x477F,
+  0x7394, 0xF5A7, 0x099E, 0xE30D, 0x1546, 0xBC9D, 0xB0FE, 0x1CEC,
+  0x0830, 0xE23F, 0xF0EC, 0x7C66, 0xC1B0, 0x05B5, 0xB915, 0x7A6A,
+  0x782A, 0x9FA8, 0x6B9A, 0xFF53, 0x8E80, 0xEAAB, 0xB531, 0xEBB7,
+  0x27F5, 0xBA14, 0x122D, 0x4067, 0xE501, 0xACDC, 0x2680, 0x6271,
+  0x99D5, 0xFE9A, 0x973C, 0x2E47, 0x6882, 0x68C5, 0x550A, 0x1E09,
+  0xD1BA, 0xBADE, 0x8960, 0x5F37, 0xDD45, 0xF254, 0xB8ED, 0x048D,
+  0xA781, 0xD6A2, 0x2C4B, 0xD01B, 0x7029, 0x5C39, 0x7EC7, 0xFAEA,
+  0x234F, 0x952A, 0xB610, 0xA6B1, 0x75FD, 0x1246, 0x4C33, 0xC1AC,
+  0xCA9F, 0x0612, 0x3045, 0xDBEC, 0x75C6, 0x8E23, 0x3B47, 0x703A,
+  0x58D6, 0xF133, 0x51CE, 0xD668, 0xB706, 0xCF4B, 0x486D, 0x02B1,
+  0xE0AA, 0x9C16, 0x1D1B, 0xBD12, 0x0D67, 0x58ED, 0x6D56, 0x26BA,
+  0x67FE, 0x254F, 0x386A, 0x29E6, 0x0F35, 0x226A, 0xDD7E, 0x6E31,
+  0xCF99, 0xB51B, 0x35C8, 0x2183, 0x4DC0, 0xDD9F, 0xB2E9, 0x1D51,
+  0x0DED, 0x8861, 0x9B33, 0xF80F, 0xFAC5, 0xCDCB, 0xCF9C, 0x85E0,
+  0x6908, 0xE5A7, 0x4DCB, 0xBF4B, 0x1534, 0x4F18, 0x7794, 0xF4A4,
+  0x8B6F, 0x38B1, 0xF0B1, 0x6167, 0x5C6C, 0xDE0D, 0xF5F3, 0x30BE,
+  0x27FA, 0x71D1, 0x22DE, 0xA16C, 0xB3E0, 0x649E, 0xBA62, 0x48B9,
+  0x1023, 0xBE0B, 0x031B, 0x4889, 0xEE92, 0x6EA2, 0xE0C4, 0xA0B9,
+  0x6576, 0x1F75, 0x2DFE, 0x680D, 0x88B2, 0xFFAF, 0x0498, 0x4C8A,
+  0x308E, 0xD94B, 0xA178, 0xC101, 0x495C, 0x3804, 0x1549, 0x7758
+};
+static const uint8_t __xor16_31f_order[256] PROGMEM = {
+    0, 175, 234, 143, 246,  38,  46, 109, 161,  23, 104,  45,  98,  18, 180, 200,
+  188, 232,  12, 122, 157, 212, 100, 254,  10, 103, 178, 199, 135, 241,  16,  71,
+  195, 189,  89, 226,  62, 152,  29, 185, 126, 183, 120, 224, 187,   6,  15, 146,
+    4, 242, 131, 162, 248, 223,  47,  77, 194,  30, 253, 186, 217,  81, 166,  75,
+  123,  90,  95,  41, 174, 235, 231, 252,  43,  14, 158, 247, 196, 210, 213, 170,
+   20,  70,  42, 134, 168, 181,  66, 149, 220, 139, 219, 127, 229, 240,  55, 184,
+  243, 132, 133, 208,  19, 114,  67, 182,  31, 191, 237, 148, 167,  91, 225,  96,
+  164, 156,  26, 255,   3, 214, 112, 111, 107,  64, 150,  13,  84,  78,  56,  35,
+  207, 201, 244, 138, 216, 165, 116,  53,  49,  27,   9,  82,  36,  21,  44, 153,
+  130,  73,  22,  72, 128,   1, 202, 177,  34,  17, 113, 239,  28, 227, 250,  39,
+   79, 155,  69,  85, 144,  74,  94, 125, 102, 198, 228, 193, 118,  33, 154, 172,
+   52,   7, 142, 110, 121, 230, 137,  37, 101,  40, 179, 233, 211, 251, 159, 108,
+   68,  76, 160,   2,  59, 205, 173, 192, 206, 147, 136,  57,   5, 171, 145,  86,
+  249, 163,  87, 140, 190, 197, 221,  54, 176, 238, 105,  99,  65, 124, 209,  50,
+   63,  61,  25, 117,  93, 119,  80,  51, 236,  48, 218, 106, 169, 141, 215,  97,
+  222,  83,  92, 203,  24,  88,   8,  32, 204, 151,  58,  60,  11, 129, 115, 245
+};
+
+uint16_t xor16_31f_position() {
+  uint16_t saved = __xor16_31f_state;
+  uint16_t pos = __xor16_position(saved, xor16_31f, __xor16_31f_checkpoints, __xor16_31f_order);
+  __xor16_31f_state = saved;
+  return pos;
+}
+
+void xor16_31f_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_31f, xor16_31f, __xor16_31f_checkpoints);
+}
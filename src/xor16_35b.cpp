@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 35b //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_35b_state;
+uint16_t __xor16_35b_state;
 
 bool seed_xor16_35b(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -28,14 +29,79 @@ uint16_t xor16_35b() {
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_35b_state)::"r18","r19");
+  return __xor16_35b_state;
+}
+
+void xor16_35b_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
@@ -45,6 +111,178 @@ uint16_t xor16_35b() {
       "add    r19, r19"      "\n\t"
       "add    r19, r19"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_35b_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_35b_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x4809, 0x9012, 0x2825, 0x504A, 0xA094, 0x4929, 0x9252, 0x24A4,
+    0x4948, 0x9290, 0x2520, 0x4A40, 0x9480, 0x2100, 0x4200, 0x8400,
+    // M^2
+    0x1003, 0x2006, 0x4245, 0x848A, 0x0915, 0x1062, 0x20C4, 0x4188,
+    0x8310, 0x0620, 0x0441, 0x0882, 0x1104, 0x6848, 0xD090, 0xA120,
+    // M^4
+    0x2101, 0x0A0B, 0xA432, 0x4065, 0xD0C1, 0x01A4, 0x4B41, 0x9682,
+    0x2D05, 0x1203, 0x3486, 0x690C, 0xD051, 0x1414, 0x2829, 0x5A1A,
+    // M^8
+    0x1810, 0x1060, 0xA1E6, 0xE7FF, 0x5EA0, 0x1E11, 0x1463, 0x3047,
+    0xE1A8, 0xE958, 0xC878, 0x9C63, 0x18E3, 0x9024, 0x1DD8, 0x19D8,
+    // M^16
+    0xDA20, 0x1291, 0xE3E7, 0x7E50, 0x962E, 0xE310, 0xD299, 0x3532,
+    0xBC25, 0x44D3, 0x2B4E, 0x5722, 0xB6C5, 0xBECC, 0x302B, 0xF853,
+    // M^32
+    0x8E5C, 0x8B2A, 0xA1AF, 0x442A, 0x4D3D, 0x186C, 0x3D02, 0xF8CD,
+    0x56E1, 0xA251, 0x4CA7, 0xA4D7, 0x41AB, 0xB2F9, 0x5DF8, 0x1B55,
+    // M^64
+    0xC4CE, 0x9C5E, 0xFF1F, 0xC633, 0xDDE1, 0x2597, 0xC6E9, 0xBF3E,
+    0xA15A, 0xF59E, 0xF1F0, 0xC920, 0xAAE4, 0x10BE, 0x7676, 0x4E00,
+    // M^128
+    0x1523, 0x624E, 0x5265, 0x9CFE, 0x9396, 0x8544, 0x62A5, 0xC54A,
+    0xBE81, 0x152B, 0xA2D7, 0x759B, 0xC15F, 0x48DE, 0x959C, 0xBB38,
+    // M^256
+    0x2F20, 0x0619, 0xE14F, 0xB0C3, 0xB73A, 0x97AE, 0xCF21, 0xAEE7,
+    0x20B7, 0xB3DE, 0xF7BC, 0xBD04, 0xD8E0, 0x78AB, 0xFE76, 0x66A4,
+    // M^512
+    0x36D4, 0x6CBB, 0x775A, 0x8E10, 0x3474, 0xB44D, 0xF98D, 0xD977,
+    0x3EAE, 0xD4EF, 0x83B3, 0x4DAF, 0x0B5E, 0x438A, 0xC91C, 0x1AB9,
+    // M^1024
+    0x7C5C, 0xC9BB, 0xC768, 0x343E, 0xC589, 0xE7CD, 0xFE99, 0xFF7B,
+    0xAAEC, 0x6CDA, 0xF3D9, 0xF7B1, 0xFFE6, 0x1881, 0x6D9A, 0x7394,
+    // M^2048
+    0x46D3, 0x1FB5, 0x068B, 0x0C17, 0xF022, 0xBD88, 0xE34B, 0x6633,
+    0xE507, 0x489D, 0xB356, 0x6DE5, 0xD3CB, 0x8B70, 0x1CE8, 0xB151,
+    // M^4096
+    0xCB1F, 0xCB23, 0xC889, 0x717C, 0x573F, 0xB87A, 0x3D69, 0x789F,
+    0x2F75, 0xAB53, 0x4E27, 0xD484, 0x03E1, 0xDFCF, 0x399F, 0x5957,
+    // M^8192
+    0xDE9C, 0x882C, 0x76B0, 0xA11D, 0xA6F3, 0x398E, 0x5688, 0xA75C,
+    0x10F0, 0xBC50, 0x78A0, 0x9D18, 0xB2B5, 0x8193, 0xB1B6, 0x636C,
+    // M^16384
+    0xEF85, 0x1057, 0x7E41, 0x5DCD, 0x1E16, 0x4613, 0xC1B2, 0x1129,
+    0xDC1C, 0x4589, 0x815A, 0x237F, 0x7C17, 0x2483, 0x8607, 0x242E,
+    // M^32768
+    0x3DF7, 0x2220, 0x1708, 0x98BB, 0xEBBB, 0xA310, 0x274E, 0x5450,
+    0x4181, 0x7820, 0x6A0C, 0xF8FF, 0xE333, 0x4B22, 0x616E, 0xD011
+  };
+  __xor16_35b_state = __xor16_jump(__xor16_35b_state, table, n);
+  return __xor16_35b_state;
+}
+
+uint16_t xor16_35b_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_35b_state)::"r18","r19");
   return __xor16_35b_state;
 }
+
+static const uint16_t __xor16_35b_checkpoints[256] PROGMEM = {
+  0x0001, 0x2F20, 0x36D4, 0xD39A, 0x7C5C, 0x3D12, 0x7B67, 0xE0A9,
+  0x46D3, 0x45D1, 0xD0A1, 0x565B, 0x8315, 0x8C98, 0x8502, 0xB7B6,
+  0xCB1F, 0x7930, 0xE31A, 0x72F0, 0xACB1, 0xF5E4, 0xF8B5, 0xC581,
+  0xCE1E, 0x811B, 0x68D3, 0xC41C, 0x89D8, 0x9D28, 0xF326, 0xDB08,
+  0xDE9C, 0xF105, 0xD641, 0xE451, 0x40FE, 0xE8B1, 0xFC2E, 0xB21A,
+  0x74D1, 0x505D, 0x2021, 0xC025, 0xC113, 0x2666, 0x8310, 0x42F7,
+  0xC48C, 0x9005, 0x702B, 0x5069, 0xE1FA, 0x3746, 0xECE9, 0xC34A,
+  0x7240, 0x22C2, 0xACAA, 0xDB24, 0x18BE, 0xBC02, 0x8A4E, 0xF0CA,
+  0xEF85, 0x5920, 0x2C8B, 0x050E, 0x809E, 0x28EC, 0x624B, 0x63D8,
+  0x738B, 0xFA49, 0x6681, 0x4378, 0x3269, 0xD4F9, 0x693F, 0x434F,
+  0xDA8B, 0x79F5, 0x4CB3, 0x1384, 0x0421, 0x4F32, 0x012A, 0x01C3,
+  0x6848, 0x443B, 0xB0A4, 0x1EE9, 0x480D, 0x3DDE, 0x4B2D, 0x3919,
+  0x1521, 0xB765, 0x34DA, 0x37D1, 0x3D42, 0x037C, 0x2D50, 0x6ABF,
+  0x7EC1, 0xE9BD, 0x8D15, 0x75FE, 0x9FF1, 0x09E7, 0xA3AD, 0xCA83,
+  0x11D6, 0xC9FD, 0x3A9F, 0xCFF9, 0x9FB2, 0xEFFF, 0x004F, 0xB794,
+  0x5AA8, 0xA1C6, 0xB828, 0x5C86, 0x259F, 0xCEC8, 0xB0B1, 0x67BC,
+  0x3DF7, 0x4360, 0x3590, 0x6E9D, 0x18CA, 0xB2F8, 0x84A0, 0xA851,
+  0xF430, 0xEFB1, 0x98FB, 0xDBE8, 0x28F4, 0x65B2, 0xD9BC, 0x027E,
+  0x0BFE, 0x38AA, 0x92DC, 0x8AEA, 0x28CC, 0xF5E5, 0xD795, 0xF355,
+  0x1D84, 0xFD47, 0x55C1, 0xBF7B, 0x6971, 0xDBFB, 0xB6F7, 0x0BA9,
+  0x88C7, 0x7210, 0x5AD9, 0x6153, 0xF748, 0x23AE, 0x851E, 0x5100,
+  0x0621, 0xFCEC, 0xD5C5, 0x3890, 0x0492, 0xE878, 0x020B, 0x2A24,
+  0x0090, 0x19DD, 0xED03, 0xA34F, 0x3AF2, 0xE9DA, 0x1DEC, 0x150B,
+  0x9611, 0x623C, 0x441B, 0x270A, 0xAAA4, 0xC8D3, 0xDA13, 0xD0EB,
+  0x2FA0, 0x9833, 0x0AED, 0x861E, 0xC269, 0xEC60, 0xF24E, 0x13F3,
+  0x23E2, 0x1BB3, 0x51C7, 0xAF91, 0xF123, 0xA6B9, 0x4BFD, 0xEFE5,
+  0x01AF, 0x614B, 0xF0B1, 0x99CA, 0xF4EB, 0xA0B7, 0x580A, 0x2D48,
+  0x6D46, 0xC4A5, 0x9848, 0x7CA2, 0x2BD5, 0x4E55, 0xB164, 0x5F98,
+  0x5659, 0x850C, 0xE023, 0x5EEE, 0x7E0D, 0xD9F7, 0x54A5, 0x260C,
+  0x6D45, 0xED9C, 0xC227, 0x74D4, 0x9E32, 0x61AF, 0xE796, 0x7A27,
+  0x0F3F, 0x81F0, 0x0741, 0x84D4, 0xA6AB, 0xFADE, 0xB72A, 0x834E,
+  0x6D79, 0x9C84, 0xBB54, 0x71D6, 0x4F20, 0xB009, 0x590C, 0xEAA9
+};
+static const uint8_t __xor16_35b_order[256] PROGMEM = {
+    0, 118, 176,  86, 208,  87, 174, 143, 101,  84, 172,  67, 168, 242, 109, 194,
+  159, 144, 240, 112,  83, 199, 183,  96,  60, 132, 177, 201, 152, 182,  91,  42,
+   57, 165, 200, 124, 231,  45, 187, 148,  69, 140, 175, 220,  66, 215, 102,   1,
+  192,  76,  98, 130,   2,  53,  99, 171, 145,  95, 114, 180,   5, 100,  93, 128,
+   36,  47,  79, 129,  75, 186,  89,   9,   8,  92,  94, 206,  82, 221, 252,  85,
+   41,  51, 167, 202, 230, 154, 224,  11, 214, 254,  65, 120, 162, 123, 227, 223,
+  209, 163, 237, 185,  70,  71, 141,  74, 127,  88,  26,  78, 156, 103, 232, 216,
+  248, 131,  50, 251, 161,  56,  19,  72,  40, 235, 107,  17,  81, 239,   6,   4,
+  219, 228, 104,  68,  25, 241,  46,  12, 247, 134, 243,  14, 225, 166, 195, 160,
+   28,  62, 147,  13, 106,  49, 146, 184, 193, 218, 138, 211, 249,  29, 236, 116,
+  108, 213, 121, 179, 110, 244, 205, 135, 188,  58,  20, 203, 253,  90, 126, 222,
+   39, 133, 158, 246,  97, 119,  15, 122, 250,  61, 155,  43,  44, 234, 196,  55,
+   27,  48, 217,  23, 189, 113, 111,  16,  24, 125, 115,  10, 191,   3,  77, 170,
+   34, 150, 142, 229, 190,  80,  31,  59, 139, 157,  32, 226,   7,  52,  18,  35,
+  238, 173,  37, 105, 181, 255, 197,  54, 178, 233,  64, 137, 207, 117, 210,  63,
+   33, 204, 198,  30, 151, 136, 212,  21, 149, 164,  22,  73, 245,  38, 169, 153
+};
+
+uint16_t xor16_35b_position() {
+  uint16_t saved = __xor16_35b_state;
+  uint16_t pos = __xor16_position(saved, xor16_35b, __xor16_35b_checkpoints, __xor16_35b_order);
+  __xor16_35b_state = saved;
+  return pos;
+}
+
+void xor16_35b_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_35b, xor16_35b, __xor16_35b_checkpoints);
+}
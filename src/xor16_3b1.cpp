@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 3b1 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_3b1_state;
+uint16_t __xor16_3b1_state;
 
 bool seed_xor16_3b1(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -40,3 +41,237 @@ uint16_t xor16_3b1() {
     :"+d"((uint16_t)__xor16_3b1_state)::"r18","r19");
   return __xor16_3b1_state;
 }
+
+void xor16_3b1_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_3b1_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_3b1_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x001B, 0x0036, 0x006C, 0x00D8, 0x01B0, 0x0360, 0x06C0, 0x0D80,
+    0x1B03, 0x3606, 0x6C0C, 0xD81B, 0xB036, 0x600C, 0xC018, 0x8030,
+    // M^2
+    0x0145, 0x028A, 0x0514, 0x0A28, 0x1453, 0x28A5, 0x514A, 0xA294,
+    0x4505, 0x8A6A, 0x14B7, 0x2940, 0x5280, 0xA0A0, 0x4140, 0x82E0,
+    // M^4
+    0x101E, 0x205C, 0x40F5, 0x81A7, 0x00E1, 0x0780, 0x0F2D, 0x1BF9,
+    0x14A3, 0x5087, 0xDE8E, 0x9DAF, 0x3B3E, 0xA871, 0x550F, 0xD3F1,
+    // M^8
+    0xDAD1, 0x66EF, 0x1651, 0xAB9C, 0x034A, 0x8153, 0xD1C9, 0x60B9,
+    0xC98B, 0x057F, 0x5491, 0x5224, 0xACAB, 0xFE7D, 0x550C, 0xFA4F,
+    // M^16
+    0x3C58, 0xCB4F, 0xF517, 0x44DC, 0xD04E, 0x5D79, 0x0A5E, 0x389C,
+    0x43F7, 0xCF39, 0x1414, 0x6BDA, 0xF4CF, 0xCA93, 0xD970, 0x7AF4,
+    // M^32
+    0xDF5E, 0x0812, 0x1875, 0x9E23, 0x2791, 0xEE6B, 0x0477, 0x0C9F,
+    0xE84B, 0xA537, 0xC582, 0x99E8, 0xFDD2, 0x18A2, 0xF80F, 0x092D,
+    // M^64
+    0xB044, 0xB66B, 0x6E9C, 0x3485, 0x640C, 0xB3AE, 0xC736, 0x267E,
+    0x3D70, 0x3A85, 0xD866, 0xFDFC, 0x8718, 0x8EDC, 0xDCA0, 0xC6C0,
+    // M^128
+    0x66AE, 0x6BD5, 0x5508, 0x2904, 0xD003, 0xB153, 0xCAA6, 0x90D9,
+    0x01BA, 0x361B, 0xCCEB, 0x67BD, 0x49DA, 0x0682, 0x2D32, 0x19CB,
+    // M^256
+    0xE713, 0xC276, 0x80BD, 0x358D, 0x7058, 0x40F7, 0x7A08, 0x95C7,
+    0xB2E2, 0x41D4, 0x50FC, 0x3BD1, 0x8398, 0x01FC, 0xA6EB, 0x51DD,
+    // M^512
+    0x003D, 0xBE8E, 0xA696, 0xA79E, 0x1B52, 0xDC53, 0x6B07, 0x7A4C,
+    0xFF23, 0x0B23, 0x4F23, 0x3207, 0x72F9, 0xD8B2, 0xFED9, 0x5A25,
+    // M^1024
+    0xC634, 0x43A3, 0xBF91, 0xE72C, 0x7A25, 0x65C7, 0xF849, 0x07B9,
+    0xE573, 0xA4E7, 0x151D, 0xB94D, 0x2E58, 0xE7C1, 0xD50A, 0xCFFC,
+    // M^2048
+    0x0B7F, 0x7377, 0x5009, 0x94C4, 0x1D5B, 0x0753, 0xB373, 0x6DCA,
+    0x6F65, 0x9D11, 0x3A9A, 0x3C9B, 0x8A36, 0x907A, 0x604F, 0x4F9D,
+    // M^4096
+    0xDB51, 0x090D, 0x75C2, 0x7181, 0xA1B6, 0x1ECE, 0x76D6, 0xA05B,
+    0xEB16, 0xBAEB, 0x2CE4, 0x8010, 0xD761, 0x8B63, 0xFF83, 0x2B19,
+    // M^8192
+    0xDE27, 0xB414, 0xBBF3, 0x339D, 0x2880, 0x1ABD, 0x3E7A, 0xD4C7,
+    0x536D, 0x267E, 0x9A16, 0x8AAF, 0xCDAB, 0x40B0, 0x0796, 0x51E8,
+    // M^16384
+    0x666F, 0xD596, 0x91FC, 0x5206, 0x1ED8, 0xD1C9, 0x3012, 0x3ABE,
+    0xCDA0, 0xCCE5, 0x17F5, 0xD11E, 0x827E, 0xE16C, 0x1CA5, 0x5ACD,
+    // M^32768
+    0xB701, 0x7E4F, 0x1354, 0x1654, 0xCE02, 0x3773, 0xA85C, 0x9D2A,
+    0xA654, 0xAC75, 0xA6E0, 0x0102, 0x7F47, 0x4885, 0x5871, 0x2C19
+  };
+  __xor16_3b1_state = __xor16_jump(__xor16_3b1_state, table, n);
+  return __xor16_3b1_state;
+}
+
+uint16_t xor16_3b1_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_3b1_state)::"r18","r19");
+  return __xor16_3b1_state;
+}
+
+static const uint16_t __xor16_3b1_checkpoints[256] PROGMEM = {
+  0x0001, 0xE713, 0x003D, 0x628C, 0xC634, 0x560C, 0x816B, 0xC928,
+  0x0B7F, 0x1215, 0xD5BA, 0xC423, 0xC258, 0x893F, 0x7814, 0xEFBB,
+  0xDB51, 0x510A, 0x606A, 0x6A13, 0x882F, 0xBAAE, 0x0BCA, 0xD0D3,
+  0xCE5C, 0x62AF, 0xA3A6, 0x34EC, 0xC890, 0x2978, 0xF7E5, 0x1E0E,
+  0xDE27, 0xBB78, 0x6474, 0x3DF1, 0x63D8, 0xFE3B, 0x7FEC, 0xA69C,
+  0x11A6, 0xA681, 0x33DD, 0xBCE6, 0x5567, 0x584A, 0x9351, 0xCC30,
+  0xACB4, 0x1ED9, 0xE468, 0xA944, 0x23A7, 0x8222, 0x9288, 0x33DB,
+  0xFE2D, 0x4D7F, 0xA5D6, 0x6F63, 0x2096, 0xA6A8, 0xA1B4, 0xC716,
+  0x666F, 0x1C95, 0x6A84, 0xC868, 0xC395, 0x8631, 0x9749, 0xD919,
+  0x5F5B, 0xA7D0, 0x6C7C, 0x33AD, 0xF641, 0xF961, 0x218D, 0x74FA,
+  0x5CE8, 0xD4EB, 0x9B82, 0x4D13, 0x2A19, 0xD93F, 0x5D67, 0x639B,
+  0xA156, 0xAA58, 0x15F9, 0x6C78, 0xB310, 0x50D7, 0x1F3C, 0x9E1C,
+  0x3DD4, 0x4481, 0x84C3, 0xCB8B, 0xBAFE, 0x019A, 0xA086, 0x872D,
+  0xE0C3, 0x3C60, 0xD3B6, 0x603B, 0x8750, 0xF847, 0x9153, 0x4F92,
+  0x1919, 0xA86D, 0x032C, 0x06F1, 0x295B, 0x9277, 0x7CEE, 0x97DC,
+  0x5B28, 0x98EE, 0x31EA, 0x6845, 0x8160, 0xD9C0, 0x1252, 0x0A6A,
+  0xB701, 0x9760, 0x4B70, 0x24AB, 0x94D8, 0x28A3, 0xCA78, 0xF219,
+  0x9640, 0xB965, 0x07DB, 0x2CB5, 0xA817, 0xBE70, 0xB3E7, 0x2A6F,
+  0xD153, 0xE979, 0xE7C0, 0xBACF, 0xD626, 0x67BA, 0x564E, 0x3915,
+  0x1CA1, 0xDA96, 0xA9FF, 0x9627, 0x2642, 0xA8AA, 0x493B, 0x0F9F,
+  0xEDD1, 0x5781, 0xF46D, 0x4D72, 0xF7F5, 0x6E56, 0xC575, 0x3821,
+  0x1E51, 0x4422, 0x7496, 0xD327, 0x62B7, 0xE673, 0x8820, 0x2AFB,
+  0xB471, 0x2EF1, 0x1376, 0x78C2, 0x32E7, 0xC950, 0x7455, 0x198D,
+  0xCD4F, 0xC4A4, 0xF247, 0xEB56, 0x76B6, 0xD204, 0xB5C7, 0x7BB0,
+  0x4900, 0x2FD8, 0x33FD, 0xFC11, 0x8934, 0x68FC, 0xF696, 0xC32E,
+  0x33B1, 0x3329, 0xE33B, 0x25BB, 0x5662, 0xCCD2, 0xC1FA, 0x6D4F,
+  0x9485, 0x70D0, 0xBB18, 0x5E8B, 0x8AA5, 0x9946, 0x63B5, 0x96E7,
+  0xC98D, 0xB9E1, 0x12A1, 0xF06F, 0xDFF8, 0x0658, 0x2EF5, 0x93CB,
+  0xDE54, 0xD4BA, 0x76C1, 0x3D7B, 0x01E4, 0x9D67, 0x94AD, 0x05AA,
+  0xC0D5, 0x0F0F, 0x084E, 0x369F, 0xE686, 0x30EE, 0x5A1A, 0xD8D5,
+  0xB746, 0x48B0, 0x3852, 0x7193, 0x5697, 0x741C, 0xB11B, 0x01EB,
+  0x0D32, 0x2B16, 0xFB88, 0x1DFF, 0x1562, 0x990F, 0xCB23, 0x5A43
+};
+static const uint8_t __xor16_3b1_order[256] PROGMEM = {
+    0,   2, 101, 228, 247, 114, 231, 221, 115, 138, 234, 127,   8,  22, 248, 233,
+  159,  40,   9, 126, 218, 178, 252,  90, 112, 183,  65, 152, 251,  31, 168,  49,
+   94,  60,  78,  52, 131, 203, 156, 133, 116,  29,  84, 143, 175, 249, 139, 177,
+  222, 193, 237, 122, 180, 201,  75, 200,  55,  42, 194,  27, 235, 167, 242, 151,
+  105, 227,  96,  35, 169,  97, 241, 192, 158, 130,  83, 163,  57, 111,  93,  17,
+   44,   5, 150, 204, 244, 161,  45, 238, 255, 120,  80,  86, 211,  72, 107,  18,
+    3,  25, 172,  87, 214,  36,  34,  64, 149, 123, 197,  19,  66,  91,  74, 207,
+  165,  59, 209, 243, 245, 182, 170,  79, 188, 226,  14, 179, 191, 118,  38, 124,
+    6,  53,  98,  69, 103, 108, 174,  20, 196,  13, 212, 110, 117,  54,  46, 223,
+  208, 230, 132, 155, 136, 215,  70, 129, 119, 121, 253, 213,  82, 229,  95, 102,
+   88,  62,  26,  58,  41,  39,  61,  73, 140, 113, 157,  51, 154,  89,  48, 246,
+   92, 142, 176, 190, 128, 240, 137, 217,  21, 147, 100, 210,  33,  43, 141, 232,
+  206,  12, 199,  68,  11, 185, 166,   4,  63,  67,  28,   7, 181, 216, 134, 254,
+   99,  47, 205, 184,  24,  23, 144, 189, 171, 106, 225,  81,  10, 148, 239,  71,
+   85, 125, 153,  16,  32, 224, 220, 104, 202,  50, 173, 236,   1, 146, 145, 187,
+  160,  15, 219, 135, 186, 162,  76, 198,  30, 164, 109,  77, 250, 195,  56,  37
+};
+
+uint16_t xor16_3b1_position() {
+  uint16_t saved = __xor16_3b1_state;
+  uint16_t pos = __xor16_position(saved, xor16_3b1, __xor16_3b1_checkpoints, __xor16_3b1_order);
+  __xor16_3b1_state = saved;
+  return pos;
+}
+
+void xor16_3b1_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_3b1, xor16_3b1, __xor16_3b1_checkpoints);
+}
@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: 3bb //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_3bb_state;
+uint16_t __xor16_3bb_state;
+static uint16_t __xor16_3bb_weyl_count;
+static uint8_t __xor16_3bb_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_3bb_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_3bb(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_3bb(uint16_t seed) {
   }
   if(seed) {
     __xor16_3bb_state = seed;
+    __xor16_3bb_spare_full = 0;
     return 1;
   }
   return 0;
@@ -40,3 +45,414 @@ uint16_t xor16_3bb() {
     :"+d"((uint16_t)__xor16_3bb_state)::"r18","r19");
   return __xor16_3bb_state;
 }
+
+uint16_t xor16_3bb_star() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_3bb_state)::"r18","r19");
+  return rng16::star(__xor16_3bb_state);
+}
+
+/* The same step as xor16_3bb(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_3bb_weyl(uint16_t seed) {
+  __xor16_3bb_state = seed ? seed : 1;
+  __xor16_3bb_weyl_count = seed;
+  __xor16_3bb_spare_full = 0;
+}
+
+uint16_t xor16_3bb_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_3bb_state), "+d"(__xor16_3bb_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_3bb(). */
+uint8_t xor16_3bb_byte() {
+  if (__xor16_3bb_spare_full) {
+    __xor16_3bb_spare_full = 0;
+    return __xor16_3bb_spare;
+  }
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_3bb_state)::"r18","r19");
+  __xor16_3bb_spare = __xor16_3bb_state >> 8;
+  __xor16_3bb_spare_full = 1;
+  return __xor16_3bb_state;
+}
+
+/* n bytes, the same ones n calls to xor16_3bb_byte() would return; whole steps go through xor16_3bb_fill(). */
+void xor16_3bb_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_3bb_spare_full) {
+    __xor16_3bb_spare_full = 0;
+    *dst++ = __xor16_3bb_spare;
+    n--;
+  }
+  xor16_3bb_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_3bb_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 23 eors. */
+void xor16_3bb_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r14"      "\n\t" // y ^= y << 3
+      "eor    r16, r13"      "\n\t"
+      "eor    r15, r12"      "\n\t"
+      "eor    r14, r11"      "\n\t"
+      "eor    r13, r10"      "\n\t"
+      "eor    r12, r9"       "\n\t"
+      "eor    r11, r8"       "\n\t"
+      "eor    r10, r7"       "\n\t"
+      "eor    r9, r6"        "\n\t"
+      "eor    r8, r5"        "\n\t"
+      "eor    r7, r4"        "\n\t"
+      "eor    r6, r3"        "\n\t"
+      "eor    r5, r2"        "\n\t"
+      "eor    r2, r13"       "\n\t" // y ^= y >> 11
+      "eor    r3, r14"       "\n\t"
+      "eor    r4, r15"       "\n\t"
+      "eor    r5, r16"       "\n\t"
+      "eor    r6, r17"       "\n\t"
+      "eor    r17, r6"       "\n\t" // y ^= y << 11
+      "eor    r16, r5"       "\n\t"
+      "eor    r15, r4"       "\n\t"
+      "eor    r14, r3"       "\n\t"
+      "eor    r13, r2"       "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_3bb_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_3bb_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_3bb_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x4809, 0x9012, 0x2024, 0x4048, 0x8090, 0x0120, 0x0240, 0x0480,
+    0x0101, 0x0202, 0x0404, 0x0009, 0x0012, 0x0004, 0x0008, 0x0010,
+    // M^2
+    0x0840, 0x1080, 0x2100, 0x4200, 0x8400, 0x0021, 0x0042, 0x0084,
+    0x4908, 0x9210, 0x2420, 0x0841, 0x1082, 0x2024, 0x4048, 0x8090,
+    // M^4
+    0x0803, 0x1006, 0x692C, 0xD258, 0xA4B0, 0x0861, 0x10C2, 0x2184,
+    0x4301, 0x8602, 0x0425, 0x0043, 0x0086, 0x0105, 0x020A, 0x0414,
+    // M^8
+    0x1846, 0x79AC, 0xF358, 0xE6B0, 0x8C61, 0x10E3, 0x21C6, 0x0AAC,
+    0xCF0A, 0x9635, 0x6D6B, 0x08C7, 0x58AE, 0x222E, 0x445C, 0xC9B9,
+    // M^16
+    0xFB5B, 0xF6B6, 0xE54D, 0xC2BB, 0x8576, 0x02CD, 0x4CBA, 0x9155,
+    0x2E6A, 0x1DD5, 0x7AAB, 0xB11F, 0x623E, 0xC8BC, 0x9178, 0x22F0,
+    // M^32
+    0x9D30, 0x7B61, 0xBFE2, 0x77E5, 0xAECB, 0x1C97, 0x782F, 0xB97E,
+    0x64A7, 0xC16F, 0xCBFE, 0x0975, 0x12EA, 0x338F, 0x671E, 0x8F3D,
+    // M^64
+    0x89A7, 0x134E, 0x6FBC, 0xD759, 0xEFB3, 0x9E67, 0x7DCF, 0xBA9F,
+    0x6335, 0xC66A, 0x84F5, 0x8573, 0x02C7, 0x1385, 0x270A, 0x0F15,
+    // M^128
+    0x38FE, 0x71FC, 0xE3F8, 0xC7F0, 0xCEE1, 0xDCC3, 0xB1A7, 0x2A6E,
+    0x061F, 0x4D3F, 0xDB7F, 0x7E27, 0xF46F, 0xFB1C, 0xF638, 0xAD71,
+    // M^256
+    0xAD4B, 0x52B7, 0xA56E, 0x42FD, 0xCCDA, 0xD8B5, 0xF84A, 0xF094,
+    0x35AB, 0x2A57, 0x54AE, 0x6715, 0x8F2B, 0x8BD4, 0x17A8, 0x6E51,
+    // M^512
+    0xA6DE, 0x0CBD, 0x115B, 0x6B96, 0x9E0C, 0x7D19, 0xF213, 0xE426,
+    0xF0DA, 0xA894, 0x5128, 0x13D1, 0x27A2, 0x77D2, 0xAEA5, 0x1C4B,
+    // M^1024
+    0x6C6C, 0x99D9, 0x7A92, 0xF524, 0xAB49, 0x1FB2, 0x7E65, 0xF4EB,
+    0x0D8C, 0x1339, 0x6F52, 0x510B, 0xEB36, 0x7337, 0xAF4E, 0x56BD,
+    // M^2048
+    0x0C41, 0x5983, 0xB306, 0x660C, 0x8D19, 0x1213, 0x6D06, 0x9B0D,
+    0x4888, 0xD830, 0xB060, 0x4965, 0x92CA, 0x1226, 0x6D6C, 0x9BD9,
+    // M^4096
+    0x9842, 0x3084, 0x6108, 0xC210, 0xCD00, 0x9221, 0x2442, 0x0985,
+    0xD908, 0xB210, 0x6420, 0xACD3, 0x18A7, 0xB26C, 0x64D8, 0xC191,
+    // M^8192
+    0x6123, 0xC246, 0xCDAC, 0xDA59, 0xB4B2, 0x6145, 0xC28A, 0x8514,
+    0x0A25, 0x144A, 0x20B5, 0xF30F, 0xE61E, 0xCC31, 0x9043, 0x2086,
+    // M^16384
+    0x9477, 0x69EF, 0x9AFE, 0x7CDC, 0xB8B9, 0x3852, 0x3984, 0x7308,
+    0x2A8F, 0x1C3E, 0x305D, 0x3015, 0x290A, 0xD7AB, 0xA777, 0x46CF,
+    // M^32768
+    0x8191, 0x0322, 0x0644, 0x4D89, 0x9333, 0x2666, 0x0DCD, 0x13BB,
+    0x9332, 0x2664, 0x0DC9, 0x4891, 0xD802, 0x0440, 0x4981, 0xDA22
+  };
+  __xor16_3bb_state = __xor16_jump(__xor16_3bb_state, table, n);
+  return __xor16_3bb_state;
+}
+
+uint16_t xor16_3bb_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_3bb_state)::"r18","r19");
+  return __xor16_3bb_state;
+}
+
+static const uint16_t __xor16_3bb_checkpoints[256] PROGMEM = {
+  0x0001, 0xAD4B, 0xA6DE, 0xEA5C, 0x6C6C, 0x68AB, 0x6E49, 0x926C,
+  0x0C41, 0x66BA, 0x1634, 0x40D3, 0x2C50, 0x8CFF, 0x5934, 0x7B3C,
+  0x9842, 0x2C92, 0xD696, 0x43BC, 0x0B3C, 0x8B15, 0xD247, 0x7E5D,
+  0x74F3, 0xA4B4, 0xF0BE, 0x2CD9, 0x93DD, 0x705A, 0x378D, 0xF5E1,
+  0x6123, 0x8E9E, 0xFED7, 0xFA7C, 0x3BF2, 0x3210, 0xE272, 0x66E8,
+  0x7013, 0x2071, 0xCABA, 0xC00A, 0x69B3, 0xD5C5, 0x972C, 0x950E,
+  0x355B, 0xEC6B, 0x5C68, 0xC93A, 0x2F62, 0xD5DB, 0xEED2, 0x7D72,
+  0xABD5, 0x514D, 0x1FBA, 0x57DD, 0x5D0D, 0xD44B, 0xE737, 0xF782,
+  0x9477, 0x0363, 0xC0FF, 0x7D27, 0x9760, 0x8AD7, 0xBD85, 0x940F,
+  0xADBB, 0xBA6F, 0x1F7C, 0xA8DA, 0x56DE, 0x975A, 0x8EF2, 0x39BB,
+  0x0FBB, 0x75BD, 0xDC71, 0x8407, 0x606D, 0xF65B, 0x8A6E, 0xB6C8,
+  0x5E74, 0xC824, 0x6337, 0xCD7D, 0xD914, 0xCDD8, 0xF910, 0xE362,
+  0x9F99, 0x1EC5, 0x963C, 0x6C7F, 0x5B8D, 0x5A26, 0xFAAD, 0x52BD,
+  0x1CF7, 0xFAB3, 0x2B43, 0xF48B, 0x643D, 0x9665, 0xB759, 0xFADA,
+  0xE40A, 0xB6C9, 0xF33F, 0x6EFA, 0x896B, 0xA111, 0xB1BF, 0xA391,
+  0x6B7C, 0xEF23, 0xF923, 0x08F1, 0xD6EF, 0x402F, 0xD772, 0x0312,
+  0x8191, 0xCAFF, 0x3065, 0x2C25, 0x68FF, 0xFFB7, 0xEF28, 0x4422,
+  0xC904, 0x8E29, 0x40BE, 0x4677, 0xDFE6, 0xFD27, 0xF931, 0x969C,
+  0x445E, 0xC2B2, 0xE5E2, 0x11F4, 0x035F, 0x3303, 0xE4FF, 0xA25D,
+  0xB19A, 0x7301, 0xA1E0, 0x0045, 0xF06F, 0x4596, 0xBD3A, 0x689B,
+  0x7A26, 0x7179, 0x256F, 0xD241, 0x8984, 0x6915, 0x0A3D, 0x13F5,
+  0x8443, 0x3D49, 0x1513, 0xDD08, 0xB23F, 0x4CF9, 0xD714, 0xD434,
+  0x137D, 0x362A, 0xB2F9, 0xB3FE, 0xDCC7, 0x9725, 0x7AB8, 0xF813,
+  0x2935, 0xC520, 0xC049, 0x6E05, 0x8DB5, 0x849F, 0x1EDE, 0xE7E7,
+  0x3386, 0x1C4E, 0xF1FE, 0xE138, 0x9114, 0xBD65, 0x4464, 0xC697,
+  0x61DC, 0x8A40, 0xDB59, 0x551D, 0x7F84, 0x6AEA, 0x111F, 0x6E35,
+  0x99DA, 0x678A, 0x37F0, 0x531C, 0xAC36, 0x3588, 0xD793, 0x7E32,
+  0x4C63, 0xFB10, 0xC935, 0x370D, 0x0575, 0x8505, 0x0771, 0x0A3C,
+  0xBEBE, 0x229D, 0xD715, 0x797F, 0xB5A3, 0xDC76, 0xDE95, 0xDB55,
+  0xB28E, 0x0549, 0x76F9, 0x9EA9, 0x3F01, 0x85F3, 0xEC19, 0xE2FA,
+  0xD481, 0xFFA3, 0x869C, 0xCB75, 0xE510, 0x5FF2, 0xFAC2, 0x6A2D,
+  0x4353, 0xC338, 0x3097, 0x6223, 0x9162, 0xA699, 0x4884, 0x2547
+};
+static const uint8_t __xor16_3bb_order[256] PROGMEM = {
+    0, 155, 127, 148,  65, 233, 220, 222, 123, 223, 166,  20,   8,  80, 206, 147,
+  176, 167, 170,  10, 193, 104,  97, 190,  74,  58,  41, 225, 255, 162, 184, 106,
+  131,  12,  17,  27,  52, 130, 250,  37, 149, 192,  48, 213, 177, 219,  30, 210,
+   79,  36, 169, 236, 125, 138,  11, 248,  19, 135, 144, 198, 157, 139, 254, 216,
+  173,  57, 103, 211, 203,  76,  59,  14, 101, 100,  50,  60,  88, 245,  84,  32,
+  200, 251,  90, 108,   9,  39, 209, 159,   5, 132, 165,  44, 247, 205, 120,   4,
+   99, 187, 207,   6, 115,  40,  29, 161, 153,  24,  81, 234, 227, 160, 182,  15,
+   67,  55, 215,  23, 204, 128,  83, 168, 189, 221, 237, 242, 116, 164, 201,  86,
+   69,  21,  13, 188, 137,  33,  78, 196, 252,   7,  28,  71,  64,  47,  98, 109,
+  143, 181,  46,  77,  68,  16, 208, 235,  96, 117, 154, 151, 119,  25, 253,   2,
+   75,  56, 212,   1,  72, 152, 118, 172, 232, 178, 179, 228,  87, 113, 110,  73,
+  158, 197,  70, 224,  43, 186,  66, 145, 249, 185, 199,  89, 136, 218,  51,  42,
+  129, 243,  91,  93, 163,  22, 175,  61, 240,  45,  53,  18, 124, 174, 226, 126,
+  214,  92, 231, 202,  82, 229, 180, 171, 230, 140, 195,  38, 239,  95, 112, 150,
+  244, 146,  62, 191,   3, 238,  49,  54, 121, 134, 156,  26, 194, 114, 107,  31,
+   85,  63, 183,  94, 122, 142,  35, 102, 105, 246, 111, 217, 141,  34, 241, 133
+};
+
+uint16_t xor16_3bb_position() {
+  uint16_t saved = __xor16_3bb_state;
+  uint16_t pos = __xor16_position(saved, xor16_3bb, __xor16_3bb_checkpoints, __xor16_3bb_order);
+  __xor16_3bb_state = saved;
+  return pos;
+}
+
+void xor16_3bb_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_3bb, xor16_3bb, __xor16_3bb_checkpoints);
+}
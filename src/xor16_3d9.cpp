@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: 3d9 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_3d9_state;
+uint16_t __xor16_3d9_state;
+static uint16_t __xor16_3d9_weyl_count;
+static uint8_t __xor16_3d9_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_3d9_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_3d9(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_3d9(uint16_t seed) {
   }
   if(seed) {
     __xor16_3d9_state = seed;
+    __xor16_3d9_spare_full = 0;
     return 1;
   }
   return 0;
@@ -38,3 +43,405 @@ uint16_t xor16_3d9() {
     :"+d"((uint16_t)__xor16_3d9_state)::"r18","r19");
   return __xor16_3d9_state;
 }
+
+uint16_t xor16_3d9_star() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_3d9_state)::"r18","r19");
+  return rng16::star(__xor16_3d9_state);
+}
+
+/* The same step as xor16_3d9(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_3d9_weyl(uint16_t seed) {
+  __xor16_3d9_state = seed ? seed : 1;
+  __xor16_3d9_weyl_count = seed;
+  __xor16_3d9_spare_full = 0;
+}
+
+uint16_t xor16_3d9_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_3d9_state), "+d"(__xor16_3d9_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_3d9(). */
+uint8_t xor16_3d9_byte() {
+  if (__xor16_3d9_spare_full) {
+    __xor16_3d9_spare_full = 0;
+    return __xor16_3d9_spare;
+  }
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_3d9_state)::"r18","r19");
+  __xor16_3d9_spare = __xor16_3d9_state >> 8;
+  __xor16_3d9_spare_full = 1;
+  return __xor16_3d9_state;
+}
+
+/* n bytes, the same ones n calls to xor16_3d9_byte() would return; whole steps go through xor16_3d9_fill(). */
+void xor16_3d9_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_3d9_spare_full) {
+    __xor16_3d9_spare_full = 0;
+    *dst++ = __xor16_3d9_spare;
+    n--;
+  }
+  xor16_3d9_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_3d9_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 23 eors. */
+void xor16_3d9_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r14"      "\n\t" // y ^= y << 3
+      "eor    r16, r13"      "\n\t"
+      "eor    r15, r12"      "\n\t"
+      "eor    r14, r11"      "\n\t"
+      "eor    r13, r10"      "\n\t"
+      "eor    r12, r9"       "\n\t"
+      "eor    r11, r8"       "\n\t"
+      "eor    r10, r7"       "\n\t"
+      "eor    r9, r6"        "\n\t"
+      "eor    r8, r5"        "\n\t"
+      "eor    r7, r4"        "\n\t"
+      "eor    r6, r3"        "\n\t"
+      "eor    r5, r2"        "\n\t"
+      "eor    r2, r15"       "\n\t" // y ^= y >> 13
+      "eor    r3, r16"       "\n\t"
+      "eor    r4, r17"       "\n\t"
+      "eor    r17, r8"       "\n\t" // y ^= y << 9
+      "eor    r16, r7"       "\n\t"
+      "eor    r15, r6"       "\n\t"
+      "eor    r14, r5"       "\n\t"
+      "eor    r13, r4"       "\n\t"
+      "eor    r12, r3"       "\n\t"
+      "eor    r11, r2"       "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_3d9_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_3d9_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+/* Shared with xor16_jump(), since xor16() is 3d9 */
+const uint16_t __xor16_3d9_jump_table[256] PROGMEM = {
+  // M^1
+  0x1209, 0x2412, 0x4824, 0x9048, 0x2090, 0x4120, 0x8240, 0x0480,
+  0x0900, 0x1200, 0x2601, 0x4C02, 0x9804, 0x2201, 0x4402, 0x8804,
+  // M^2
+  0x0845, 0x0082, 0x0104, 0x0208, 0x0611, 0x0C22, 0x1844, 0x2281,
+  0x4502, 0x8A04, 0x0409, 0x0A13, 0x1426, 0x2208, 0x4611, 0x8C22,
+  // M^4
+  0x1B16, 0x2203, 0x4406, 0x880C, 0x8059, 0x02BA, 0x0775, 0x82C8,
+  0x0798, 0x0D31, 0x0E44, 0x8EC1, 0x1D8B, 0xAA04, 0xC648, 0x8E98,
+  // M^8
+  0x7FBF, 0x9E20, 0xAE09, 0xCC53, 0x9AAE, 0xA715, 0xDE6B, 0x8E18,
+  0x8E70, 0x1EE8, 0xCEC7, 0x9D87, 0xA947, 0xE36A, 0xC4DC, 0x89B1,
+  // M^16
+  0x7D4F, 0xCA4B, 0x949F, 0xBB77, 0x76EE, 0x7F9C, 0xFD30, 0x92E4,
+  0x27C9, 0xDFDA, 0x1F20, 0x3C48, 0xE8D1, 0x1592, 0x2B2D, 0x565A,
+  // M^32
+  0xB713, 0x6FA6, 0xDD4D, 0xB89B, 0xE37F, 0xC6F7, 0x8DE7, 0xE586,
+  0x5B4D, 0x26DB, 0x4C36, 0x986C, 0x30D8, 0xFE79, 0xFCF2, 0xF9E4,
+  // M^64
+  0x3D2F, 0x3ADD, 0xE5FB, 0xC9FE, 0x93F5, 0x27EA, 0xDD9D, 0xBB79,
+  0x76F2, 0x7FA4, 0xBFCB, 0x7F96, 0xFD24, 0x9ED1, 0x3DA2, 0x7B4D,
+  // M^128
+  0xD947, 0x87FC, 0x0DF0, 0x8BA8, 0x8510, 0x9A61, 0x34C2, 0xF32B,
+  0x761E, 0xEE34, 0x795B, 0x60F6, 0x51A4, 0xF1AE, 0x7314, 0xE420,
+  // M^256
+  0xB7F1, 0x5B91, 0xB72B, 0xFE1E, 0x6E75, 0x4CA2, 0x9944, 0xE066,
+  0xC0C5, 0x8382, 0xA137, 0xD02E, 0x3014, 0x29CE, 0xC3D4, 0x85A0,
+  // M^512
+  0x920E, 0x594B, 0x20D6, 0xD1E4, 0xA3C8, 0x4598, 0x8B30, 0x56E6,
+  0x3F8C, 0x7D10, 0x1537, 0x2866, 0xC084, 0x52A3, 0xA54F, 0x4896,
+  // M^1024
+  0x5D7B, 0xE3B0, 0x5520, 0xAA49, 0x549B, 0xAB3E, 0xC43C, 0xEC3F,
+  0x4A3E, 0x967D, 0xE7FC, 0xCDF0, 0x9BE9, 0xC0E0, 0x81C9, 0x019A,
+  // M^2048
+  0x5509, 0x8F6A, 0x1CDC, 0xA9F9, 0x51FA, 0x33B5, 0x6763, 0xD4B8,
+  0x3938, 0x7279, 0x53C3, 0x37C7, 0xFFCF, 0x036E, 0x9495, 0xBB63,
+  // M^4096
+  0xFD51, 0xE663, 0xCCCF, 0x9B96, 0xA565, 0x48C2, 0x01CC, 0x9CF4,
+  0x39E8, 0xE391, 0x49A3, 0x9147, 0x208F, 0x25D8, 0xDBF8, 0xB5F1,
+  // M^8192
+  0xD3AA, 0xB3DF, 0x67BE, 0xCD7D, 0x98F2, 0x31E4, 0xF389, 0xF1CA,
+  0xE394, 0x5568, 0xBC53, 0x7AA7, 0xF547, 0xF658, 0xEEB1, 0x4D23,
+  // M^16384
+  0x5EA5, 0xA8C7, 0x5386, 0xA504, 0xDA49, 0xB492, 0xF96C, 0x3FF8,
+  0xEDB0, 0x4B21, 0x83C6, 0x0584, 0x0B08, 0xEFB0, 0x4D20, 0x9A40,
+  // M^32768
+  0x0D02, 0x1304, 0x2400, 0x4800, 0x9000, 0xB048, 0x6090, 0xC920,
+  0x0201, 0x0402, 0x0104, 0x0208, 0x0611, 0x4920, 0x9240, 0x2681
+};
+
+uint16_t xor16_3d9_jump(uint16_t n) {
+  __xor16_3d9_state = __xor16_jump(__xor16_3d9_state, __xor16_3d9_jump_table, n);
+  return __xor16_3d9_state;
+}
+
+uint16_t xor16_3d9_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_3d9_state)::"r18","r19");
+  return __xor16_3d9_state;
+}
+
+/* Shared with xor16_position(), like the jump table */
+const uint16_t __xor16_3d9_checkpoints[256] PROGMEM = {
+  0x0001, 0xB7F1, 0x920E, 0x2492, 0x5D7B, 0xEBF1, 0x10D7, 0x7C08,
+  0x5509, 0xDBDD, 0x0C9A, 0x5A85, 0x40D0, 0xD483, 0xDB51, 0xA5C9,
+  0xFD51, 0xAEB2, 0xC7D5, 0xB389, 0x76B4, 0x8D21, 0xCF2F, 0x9DDD,
+  0xEDFB, 0x97ED, 0x9C80, 0x24CB, 0xE3A5, 0x80E3, 0x5C40, 0x1B9D,
+  0xD3AA, 0x3C6C, 0xF410, 0x90EC, 0xC901, 0xE16E, 0x683D, 0xE627,
+  0x5AE6, 0x7956, 0xD16E, 0x71E7, 0x7400, 0x7B39, 0x225F, 0xF828,
+  0x3D3C, 0xC3E4, 0x8798, 0x17DD, 0x3BF7, 0x8A0D, 0x28C8, 0x7EDC,
+  0x76F7, 0xF805, 0x8F5A, 0xE540, 0x970C, 0x1EF1, 0x2E8B, 0x294D,
+  0x5EA5, 0xAD45, 0x842C, 0x2100, 0xE90B, 0x6D2F, 0xB231, 0x8ADE,
+  0xD3FF, 0xCB87, 0x6E30, 0x3A56, 0x51FD, 0x9634, 0x02FD, 0x26B3,
+  0x25AA, 0x4177, 0xE3C9, 0x1C30, 0x63DA, 0x1B85, 0x43C1, 0x4E40,
+  0xA80B, 0x6E3E, 0x28F2, 0xF984, 0x1808, 0x1E24, 0x3906, 0xE58B,
+  0xFC50, 0xD986, 0x6A57, 0x15CC, 0x61F1, 0xC6DB, 0x61E8, 0xE141,
+  0x81CA, 0x99C8, 0x2263, 0x93CA, 0x2A5E, 0x9FF7, 0x8754, 0x27CA,
+  0x1713, 0x5071, 0xFFA2, 0x9AA5, 0x4A06, 0x7CC2, 0x89A4, 0x8EA4,
+  0x6CD4, 0x3B7F, 0x9475, 0xAFCA, 0x429D, 0x3081, 0x4E4D, 0x56CF,
+  0x0D02, 0xEA4D, 0x5B96, 0x0200, 0x8382, 0x7D10, 0x05A7, 0x967D,
+  0xD256, 0xEE69, 0x0128, 0x7279, 0xABF0, 0x64F2, 0x4B49, 0x8016,
+  0x076F, 0x92C3, 0xA374, 0xE391, 0x151F, 0x9AC6, 0x7380, 0x792F,
+  0x2312, 0x5F6D, 0xEABC, 0xB792, 0xAB88, 0x217F, 0xF7CD, 0x3A38,
+  0x96BF, 0xF0E5, 0x6AF4, 0x5568, 0xB9CA, 0x503C, 0x9822, 0x72A9,
+  0xBCA7, 0x1AEC, 0x1F0D, 0xFC8E, 0xDC75, 0xBC30, 0xCFB4, 0x01B0,
+  0x0274, 0x8F3A, 0x30A6, 0x59A4, 0xF8C4, 0x4189, 0xAA98, 0x8FCF,
+  0x6B89, 0xD0FA, 0x881A, 0x9E74, 0x4B97, 0x85E5, 0xD108, 0x48BB,
+  0xC335, 0x273E, 0xFBCD, 0x4B21, 0xABEE, 0x1823, 0x40F8, 0x663F,
+  0x4F2D, 0x43EC, 0xFC26, 0x8EAF, 0x7EAA, 0x21DE, 0xECF8, 0xBB48,
+  0x6849, 0xEA9F, 0x1750, 0x2555, 0xBFD7, 0xE238, 0x30F1, 0xF5DE,
+  0x3BAF, 0x8322, 0xD1D4, 0x16D9, 0x4C19, 0x9557, 0x783C, 0x61C2,
+  0x086C, 0x4CFD, 0x17FC, 0xC0A4, 0x5D9B, 0xDE71, 0x8899, 0x9272,
+  0xD634, 0xC129, 0x83FC, 0xD427, 0xC0BE, 0x9661, 0xF516, 0xBC93,
+  0x8F10, 0xD98B, 0x9493, 0x76F0, 0xA34E, 0x64C9, 0x7BE0, 0x7CE7,
+  0xC5DC, 0x79E4, 0x484E, 0x981A, 0xAE60, 0x8B13, 0x94DC, 0x4AE1
+};
+const uint8_t __xor16_3d9_order[256] PROGMEM = {
+    0, 138, 175, 131, 176,  78, 134, 144, 224,  10, 128,   6, 148,  99, 219, 112,
+  210,  51, 226,  92, 197, 169,  85,  31,  83,  93,  61, 170,  67, 157, 205,  46,
+  106, 152,   3,  27, 211,  80,  79, 193, 111,  54,  90,  63, 108,  62, 125, 178,
+  214,  94, 159,  75, 121, 216,  52,  33,  48,  12, 198,  81, 181, 124,  86, 201,
+  250, 191, 116, 255, 195, 142, 188, 220, 225,  87, 126, 200, 165, 113,  76,   8,
+  163, 127, 179,  11,  40, 130,  30,   4, 228,  64, 153, 223, 102, 100,  84, 245,
+  141, 199,  38, 208,  98, 162, 184, 120,  69,  74,  89,  43, 139, 167, 150,  44,
+   20, 243,  56, 222, 151,  41, 249,  45, 246,   7, 117, 247, 133, 204,  55, 143,
+   29, 104, 217, 132, 234,  66, 189, 110,  50, 186, 230, 118,  53,  71, 253,  21,
+  119, 203, 240, 177,  58, 183,  35,   2, 231, 145, 107, 122, 242, 254, 221,  77,
+  237, 135, 160,  60,  25, 251, 166, 105, 115, 149,  26,  23, 187, 109, 244, 146,
+   15,  88, 182, 156, 196, 140,  65, 252,  17, 123,  70,  19, 155,   1, 164, 207,
+  173, 239, 168, 212, 227, 236, 233, 192,  49, 248, 101,  18,  36,  73,  22, 174,
+  185, 190,  42, 218, 136,  32,  72, 235,  13, 232,  97, 241,  14,   9, 172, 229,
+  103,  37, 213, 147,  28,  82,  59,  95,  39,  68, 129, 209, 154,   5, 206,  24,
+  137, 161,  34, 238, 215, 158,  57,  47, 180,  91, 194, 202,  96, 171,  16, 114
+};
+
+uint16_t xor16_3d9_position() {
+  uint16_t saved = __xor16_3d9_state;
+  uint16_t pos = __xor16_position(saved, xor16_3d9, __xor16_3d9_checkpoints, __xor16_3d9_order);
+  __xor16_3d9_state = saved;
+  return pos;
+}
+
+void xor16_3d9_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_3d9, xor16_3d9, __xor16_3d9_checkpoints);
+}
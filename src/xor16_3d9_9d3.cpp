@@ -0,0 +1,67 @@
+// XOR 16 // two full period generators, 3d9 and 9d3, with 9d3 clocked by 3d9 //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+static uint16_t __xor16_3d9_9d3_a;
+static uint16_t __xor16_3d9_9d3_b;
+
+bool seed_xor16_3d9_9d3(uint32_t seed) {
+  if (__builtin_constant_p(seed)) {
+    if((uint16_t)seed == 0 || (uint16_t)(seed >> 16) == 0) {
+      badArg("both halves of the seed must be non-zero, but one of them is always zero");
+    }
+  }
+  if((uint16_t)seed && (uint16_t)(seed >> 16)) {
+    __xor16_3d9_9d3_a = seed;
+    __xor16_3d9_9d3_b = seed >> 16;
+    return 1;
+  }
+  return 0;
+}
+
+uint16_t xor16_3d9_9d3() {
+  uint16_t ret;
+  __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "sbrs   %B0, 7"        "\n\t" // 9d3 only steps when bit 15 of 3d9 is set
+      "rjmp   1f"            "\n\t"
+      "mov    r19, %A1"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B1, r19"      "\n\t"
+      "mov    r18, %B1"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A1, r18"      "\n\t"
+      "movw   r18, %A1"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A1, r18"      "\n\t"
+      "eor    %B1, r19"      "\n\t"
+    "1:"                             "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "eor    %A2, %A1"      "\n\t"
+      "eor    %B2, %B1"      "\n\t"
+    :"+d"(__xor16_3d9_9d3_a), "+d"(__xor16_3d9_9d3_b), "=&r"(ret)::"r18","r19");
+  return ret;
+}
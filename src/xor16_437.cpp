@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 437 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_437_state;
+uint16_t __xor16_437_state;
 
 bool seed_xor16_437(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -19,14 +20,12 @@ bool seed_xor16_437(uint16_t seed) {
 uint16_t xor16_437() {
     __asm__ __volatile__(
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
@@ -41,7 +40,7 @@ uint16_t xor16_437() {
       "movw   r18, %A0"      "\n\t"
       "lsr    r19"           "\n\t"
       "mov    r19, r18"      "\n\t"
-      "eor    r18, r18"      "\n\t"
+      "clr    r18"           "\n\t"
       "ror    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
@@ -49,3 +48,248 @@ uint16_t xor16_437() {
     :"+d"((uint16_t)__xor16_437_state)::"r18","r19");
   return __xor16_437_state;
 }
+
+void xor16_437_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_437_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_437_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0993, 0x1326, 0x264C, 0x4C19, 0x9832, 0x3064, 0x60C8, 0xC190,
+    0x8320, 0x0640, 0x0C80, 0x1900, 0x1200, 0x2400, 0x4800, 0x9000,
+    // M^2
+    0xD937, 0x926E, 0x245D, 0x8038, 0x2070, 0x40E0, 0x8141, 0x0282,
+    0x2504, 0x6A08, 0xD410, 0x8820, 0x1440, 0x2880, 0x5100, 0x8200,
+    // M^4
+    0x65F0, 0x0BE2, 0x20F3, 0x62A8, 0xC951, 0x9223, 0xFF72, 0xFAE4,
+    0xFDC9, 0x1B90, 0x3320, 0x4AC0, 0x4111, 0xA222, 0x6044, 0xE808,
+    // M^8
+    0x526B, 0x30CE, 0x92D4, 0xD399, 0x6C96, 0x4EB8, 0x5B24, 0x8D69,
+    0xED98, 0xDE3D, 0x9749, 0x3482, 0x312C, 0xC87B, 0x1DE7, 0x0206,
+    // M^16
+    0x5656, 0x5E99, 0xC518, 0x7D65, 0x35B2, 0x1CCF, 0xF780, 0xD83B,
+    0xABAF, 0x6233, 0x4D10, 0xD3B9, 0x1B3A, 0xE355, 0x17FB, 0x7C27,
+    // M^32
+    0x7A51, 0x36E1, 0xC5B4, 0xA293, 0xB10F, 0x1A9A, 0xCF04, 0xFF88,
+    0xF111, 0xB72F, 0x174F, 0x630F, 0x0B9E, 0x1069, 0xECDA, 0xA025,
+    // M^64
+    0x2757, 0xEBD0, 0x3B08, 0x0554, 0x6154, 0x054B, 0xBB35, 0x386D,
+    0x6D47, 0xDBAE, 0xBE7C, 0x911A, 0x3A70, 0x06C2, 0x3D27, 0x1533,
+    // M^128
+    0x23B9, 0xEB29, 0x1E15, 0x3252, 0xB7CB, 0xA1DD, 0x7632, 0x0ADD,
+    0x357E, 0xDD3D, 0x3C3F, 0xCDD4, 0xA92C, 0x0D5A, 0x8C57, 0x41D3,
+    // M^256
+    0xE839, 0x557F, 0x0F9D, 0x539B, 0xB7F4, 0xBD2D, 0x341C, 0xD433,
+    0x0A7D, 0xB9D5, 0xA75C, 0xDC20, 0x39B9, 0xDC17, 0xA744, 0xBA9D,
+    // M^512
+    0xAC95, 0xEC59, 0x1F2C, 0xA04F, 0xAEAC, 0x2720, 0xA900, 0x34A3,
+    0xEF0F, 0x3911, 0xAD90, 0xE231, 0x56BB, 0x5A33, 0x49FF, 0xED3E,
+    // M^1024
+    0xD11A, 0xBA25, 0x5747, 0xE1A2, 0x6D5D, 0x069D, 0xBA33, 0xF257,
+    0x98E2, 0x038F, 0x8DAC, 0xE2FA, 0xD669, 0x0D24, 0xAF41, 0x84EA,
+    // M^2048
+    0x53FA, 0x3E12, 0xE9A2, 0xF082, 0xE540, 0x76D6, 0xBE2D, 0x187F,
+    0x44A5, 0xB4E0, 0x3171, 0x5D23, 0xFFF7, 0xA66E, 0x16DC, 0x1C38,
+    // M^4096
+    0xE23A, 0x5A79, 0xE5B7, 0x7510, 0x6773, 0x5E76, 0xA11F, 0xFBA7,
+    0xF35C, 0xA454, 0x637D, 0xDAE2, 0x7EE4, 0xD00E, 0x2054, 0xF0B1,
+    // M^8192
+    0xB2D3, 0x2F36, 0x0F9C, 0x79EC, 0xE476, 0x64AF, 0x9C74, 0x0BC0,
+    0x7FCC, 0x6019, 0x4DD5, 0x8E00, 0x720C, 0x64DF, 0xF3D5, 0x5E97,
+    // M^16384
+    0xC67A, 0x18AC, 0x45C6, 0x91A1, 0xB84F, 0x5E25, 0xFC7F, 0x0661,
+    0xD8C2, 0xB843, 0x8141, 0xFD5B, 0xF36F, 0x4288, 0x6AC9, 0x5FDA,
+    // M^32768
+    0x9F09, 0x8217, 0x943E, 0xEA49, 0xE5A8, 0x8066, 0xE84A, 0x5D22,
+    0xD995, 0x31CF, 0xBD1D, 0x2B6B, 0x4C9E, 0x454A, 0xC09C, 0x4E61
+  };
+  __xor16_437_state = __xor16_jump(__xor16_437_state, table, n);
+  return __xor16_437_state;
+}
+
+uint16_t xor16_437_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %A0"       "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "clr    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_437_state)::"r18","r19");
+  return __xor16_437_state;
+}
+
+static const uint16_t __xor16_437_checkpoints[256] PROGMEM = {
+  0x0001, 0xE839, 0xAC95, 0x9995, 0xD11A, 0x9F0D, 0xFFCF, 0x31CC,
+  0x53FA, 0xC147, 0x9163, 0xBD2E, 0x9A66, 0x3502, 0x1DF0, 0xA24E,
+  0xE23A, 0x7426, 0x0279, 0x3CB2, 0x1547, 0x125F, 0xE2C4, 0x97A9,
+  0x456C, 0xDF52, 0x3A23, 0x8030, 0xB044, 0x64B2, 0x579A, 0xEF2A,
+  0xB2D3, 0x0C7B, 0xAB64, 0x8FAE, 0x122E, 0x3438, 0x1BB0, 0x88DB,
+  0xDFBB, 0xDC83, 0x3669, 0xC9B4, 0x1AF3, 0x0BFC, 0xD978, 0x9F63,
+  0x7F87, 0xECD6, 0xB78B, 0x7129, 0x4E18, 0x8182, 0x31AC, 0xDACB,
+  0x4F67, 0x547A, 0x0180, 0xDE4E, 0xDBAC, 0x7EF0, 0x6AB5, 0x27E8,
+  0xC67A, 0x3B71, 0x5CDA, 0xB4BE, 0x2FFC, 0xA233, 0x68C0, 0x475C,
+  0x6C5E, 0x8ABE, 0x08FB, 0xD80B, 0x169D, 0xF0C8, 0x4BC3, 0x95A5,
+  0xA0BF, 0x5920, 0xF58D, 0x355A, 0xCD83, 0x05AD, 0x7000, 0x42EA,
+  0x4577, 0x867B, 0x740C, 0xB9B0, 0x5784, 0x51A7, 0x4F45, 0xBC28,
+  0xCAF9, 0x2978, 0x6714, 0xD7CE, 0xD9C2, 0x476D, 0x8EBE, 0xAFA7,
+  0x759B, 0x62D1, 0x7D64, 0xB547, 0x74D5, 0x55C9, 0x6851, 0xCCA2,
+  0x5AC4, 0x14BA, 0x46EB, 0x0A12, 0x877E, 0x99D5, 0xE506, 0x360D,
+  0x4F18, 0x8BFF, 0xDEA3, 0x3291, 0xD785, 0x0303, 0x0EEE, 0x96D2,
+  0x9F09, 0xF052, 0x2EE0, 0x43BC, 0x9600, 0x9DAD, 0x2F04, 0x1B5E,
+  0xDCA0, 0x3602, 0xAE58, 0x7450, 0x665E, 0xEF4B, 0xD3DB, 0x2ECE,
+  0xF7E8, 0xE21A, 0xC90B, 0x2559, 0x497C, 0x13DA, 0xDB2E, 0xFFBC,
+  0xB24F, 0x33BA, 0x8E08, 0x2BAF, 0x3BC1, 0x8230, 0x0991, 0x5DA3,
+  0x3BA4, 0xECA5, 0x3408, 0x1169, 0x0157, 0x3B4E, 0xB743, 0xC29D,
+  0x73F4, 0x1429, 0x986A, 0xD0D1, 0x9B82, 0x6DE0, 0x5750, 0x09E1,
+  0x6366, 0x1B28, 0xB887, 0xE5FB, 0x68C4, 0x48C1, 0x7372, 0x9AF8,
+  0x5FBC, 0xD4C5, 0x84B7, 0x71F0, 0xA261, 0xBE57, 0xACA9, 0xCF4A,
+  0xE7F5, 0xD868, 0x22EA, 0x3E24, 0x95B7, 0x4234, 0x1BD5, 0xE64E,
+  0xE222, 0x9049, 0x0C9A, 0x1E5F, 0x99B8, 0xD808, 0xABDB, 0xB004,
+  0x50AE, 0xFE9A, 0x5FFD, 0x08E0, 0x8122, 0x58B2, 0xC948, 0xAC03,
+  0xA0B0, 0xB860, 0x0A22, 0x8DA7, 0x1059, 0x01F3, 0x5DCD, 0xBBEC,
+  0x31BF, 0xD079, 0xA107, 0xDE2C, 0x07E2, 0x1C89, 0x2D54, 0x2163,
+  0xE21D, 0x7BD0, 0x7AB9, 0x4257, 0x2FA2, 0x28A2, 0x3C56, 0x47D8,
+  0xB7F0, 0xA131, 0x8E17, 0x7D1B, 0x6AC2, 0xABF6, 0xB916, 0x6478,
+  0xB151, 0x3E9F, 0xA580, 0x1F98, 0xC131, 0xF544, 0x6ED7, 0x5CFA
+};
+static const uint8_t __xor16_437_order[256] PROGMEM = {
+    0, 164,  58, 221,  18, 125,  85, 228, 211,  74, 158, 175, 115, 218,  45,  33,
+  202, 126, 220, 163,  36,  21, 149, 169, 113,  20,  76,  44, 177, 135,  38, 198,
+  229,  14, 203, 251, 231, 194, 147,  63, 237,  97, 155, 230, 143, 130, 134, 236,
+   68,  54, 224,   7, 123, 153, 162,  37,  13,  83, 137, 119,  42,  26, 165,  65,
+  160, 156, 238,  19, 195, 249, 197, 235,  87, 131,  24,  88, 114,  71, 101, 239,
+  181, 148,  78,  52, 120,  94,  56, 208,  93,   8,  57, 109, 174,  92,  30, 213,
+   81, 112,  66, 255, 159, 222, 184, 210, 105, 176, 247,  29, 140,  98, 110,  70,
+  180,  62, 244,  72, 173, 254,  86,  51, 187, 182, 168,  90,  17, 139, 108, 104,
+  234, 233, 243, 106,  61,  48,  27, 212,  53, 157, 186,  89, 116,  39,  73, 121,
+  219, 154, 242, 102,  35, 201,  10,  79, 196, 132, 127,  23, 170,   3, 204, 117,
+   12, 183, 172, 133, 128,   5,  47, 216,  80, 226, 241,  69,  15, 188, 250,  34,
+  206, 245, 215,   2, 190, 138, 103, 207,  28, 248, 152,  32,  67, 107, 166,  50,
+  240, 217, 178, 246,  91, 223,  95,  11, 189, 252,   9, 167,  64, 146, 214,  43,
+   96, 111,  84, 191, 225, 171,   4, 142, 185, 124,  99, 205,  75, 193,  46, 100,
+   55, 150,  60,  41, 136, 227,  59, 122,  25,  40, 145, 232, 200,  16,  22, 118,
+  179, 199, 192,   1, 161,  49,  31, 141, 129,  77, 253,  82, 144, 209, 151,   6
+};
+
+uint16_t xor16_437_position() {
+  uint16_t saved = __xor16_437_state;
+  uint16_t pos = __xor16_position(saved, xor16_437, __xor16_437_checkpoints, __xor16_437_order);
+  __xor16_437_state = saved;
+  return pos;
+}
+
+void xor16_437_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_437, xor16_437, __xor16_437_checkpoints);
+}
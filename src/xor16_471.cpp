@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 471 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_471_state;
+uint16_t __xor16_471_state;
 
 bool seed_xor16_471(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -18,30 +19,263 @@ bool seed_xor16_471(uint16_t seed) {
 
 uint16_t xor16_471() {
     __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_471_state)::"r18","r19");
+  return __xor16_471_state;
+}
+
+void xor16_471_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_471_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_471_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0033, 0x0066, 0x00CC, 0x019B, 0x0336, 0x066C, 0x0CD8, 0x19B3,
+    0x3366, 0x66CC, 0xCD98, 0x9B30, 0x3060, 0x60C0, 0xC180, 0x8300,
+    // M^2
+    0x050F, 0x0A1E, 0x143C, 0x282D, 0x505A, 0xA0B7, 0x416E, 0x848A,
+    0x0F14, 0x1E28, 0x3C50, 0x78A0, 0x5A14, 0xB42B, 0x6855, 0xD6AA,
+    // M^4
+    0x0044, 0x00DD, 0xAAB8, 0x5522, 0x0146, 0x0DCB, 0xB097, 0x4C43,
+    0x11AA, 0x8856, 0xBBFB, 0xDAF7, 0x10AF, 0x834E, 0xA4D9, 0xC09D,
+    // M^8
+    0x1A2F, 0x024C, 0x049E, 0x1331, 0x0B58, 0xD9C9, 0xB458, 0x75DB,
+    0x1572, 0x01DE, 0xB595, 0x7C32, 0xAE24, 0x16B1, 0x50DC, 0xD69F,
+    // M^16
+    0x05CD, 0xA229, 0xDEF5, 0x7236, 0xC4AF, 0x89BA, 0x77AE, 0x8927,
+    0x6A46, 0xCA4A, 0xAEDF, 0xF133, 0xD500, 0xA70A, 0x238C, 0xED63,
+    // M^32
+    0x931E, 0x7E62, 0xE6ED, 0xAA05, 0x6B8A, 0x623B, 0x5122, 0x86BD,
+    0xB48D, 0x5227, 0xEECE, 0x3C52, 0xDF76, 0x94A5, 0x22E2, 0x05BF,
+    // M^64
+    0x6563, 0xA4F1, 0x6543, 0x8A9C, 0x3E65, 0xAAA8, 0x5540, 0xE9AC,
+    0xF9E9, 0xC619, 0xD656, 0xDD85, 0x0C01, 0xA572, 0x0D44, 0x74DB,
+    // M^128
+    0xB9F3, 0x4ABD, 0x135B, 0x5751, 0x9B71, 0x03AD, 0x7BBA, 0x545A,
+    0x0D3B, 0xB84A, 0xCF46, 0x6E28, 0x6EB0, 0x9B6A, 0xC239, 0xBBE6,
+    // M^256
+    0x695D, 0x2524, 0x9F15, 0x8F86, 0x549A, 0x1F7F, 0x3DD0, 0x9EE8,
+    0x9096, 0x4642, 0x4F9C, 0x148B, 0x8CF1, 0x6BF4, 0xB7EB, 0xE0CE,
+    // M^512
+    0x4886, 0x3494, 0x432E, 0x49D4, 0x1456, 0x2BED, 0xDB26, 0x42AB,
+    0x1C7C, 0xA6C1, 0xE0C9, 0x9E7A, 0x3A59, 0x6988, 0xE13B, 0xAA5E,
+    // M^1024
+    0x4A50, 0xA6CB, 0x4E05, 0xADC8, 0x625A, 0xBD53, 0x09AC, 0x1B7A,
+    0xAA8D, 0x54D5, 0xBA32, 0xD1A8, 0xA548, 0x01CA, 0x34EC, 0x0A73,
+    // M^2048
+    0xDA67, 0xB6DB, 0x0FF6, 0x75B0, 0x0106, 0xE88B, 0x3EC1, 0x571E,
+    0x3C23, 0x5F4F, 0x524E, 0x3ABB, 0xBF62, 0xB358, 0x52F8, 0xBF43,
+    // M^4096
+    0x822D, 0xCFAD, 0x32E6, 0x8E3C, 0x850E, 0x2A4A, 0x8838, 0x1123,
+    0xE0F8, 0xCE38, 0x4089, 0xCE51, 0xD871, 0x9A62, 0x4737, 0xEA9D,
+    // M^8192
+    0x3018, 0x082C, 0xC231, 0xB9E3, 0x399B, 0x53A2, 0x05B4, 0x5F43,
+    0x8FAB, 0xCC32, 0x5A05, 0x6251, 0x1EDB, 0x5F5A, 0xF95C, 0x9D7B,
+    // M^16384
+    0xC1F9, 0x4A21, 0xF234, 0x0061, 0x4B74, 0xA0D3, 0x22E5, 0xA1CA,
+    0x6B80, 0x3E66, 0xBBCD, 0x6603, 0x0806, 0x11AA, 0x8FA1, 0xDA05,
+    // M^32768
+    0x9734, 0xB6EE, 0x6BFD, 0x43CF, 0x8732, 0x882C, 0x3FFD, 0x6940,
+    0x0C24, 0xC027, 0x40CF, 0x9078, 0xDE16, 0x28DF, 0x92CD, 0x360A
+  };
+  __xor16_471_state = __xor16_jump(__xor16_471_state, table, n);
+  return __xor16_471_state;
+}
+
+uint16_t xor16_471_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
       "mov    r18, r19"      "\n\t"
-      "adc    r18, r18"      "\n\t"
-      "sbc    r19, r19"      "\n\t"
-      "neg    r19"           "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
     :"+d"((uint16_t)__xor16_471_state)::"r18","r19");
   return __xor16_471_state;
 }
+
+static const uint16_t __xor16_471_checkpoints[256] PROGMEM = {
+  0x0001, 0x695D, 0x4886, 0x87B9, 0x4A50, 0x8C68, 0x16F0, 0x6DF2,
+  0xDA67, 0x78DE, 0x8670, 0x9F25, 0x08CB, 0x744C, 0x3231, 0x83FF,
+  0x822D, 0xC03D, 0x650E, 0x36A2, 0x4A68, 0x480B, 0x609F, 0x4A87,
+  0xA8A6, 0xA417, 0x4350, 0x0875, 0x94F6, 0x714F, 0xA142, 0x0358,
+  0x3018, 0x3C19, 0x0E53, 0x3866, 0x6B10, 0x4ADA, 0xB822, 0x291B,
+  0x788C, 0xCA1E, 0x64C1, 0x59E6, 0xB971, 0x9CBE, 0xD792, 0xADCA,
+  0x4921, 0x45D4, 0x0056, 0xD37B, 0xB8CA, 0x1ADA, 0x8338, 0xF279,
+  0x668C, 0x5BBA, 0x86EA, 0xFFF5, 0x2376, 0x7124, 0x4012, 0xC655,
+  0xC1F9, 0xC9B5, 0xF07D, 0xBFDB, 0xBE55, 0x859C, 0xE525, 0x0AEC,
+  0xFE1D, 0x8021, 0x96EC, 0xC935, 0x6E95, 0xFD70, 0x0D94, 0x9EE6,
+  0x771C, 0x8DAF, 0xF632, 0xD73F, 0x5593, 0x621B, 0x0D38, 0x0FE2,
+  0x14A0, 0x42FA, 0xB3D6, 0x9C8C, 0xB953, 0xA6E5, 0xC8EB, 0x3C16,
+  0x52B9, 0x4E8E, 0x01E1, 0x458C, 0xE69A, 0x55DF, 0x4F58, 0xDCE4,
+  0xA391, 0xFEC1, 0x6710, 0x11CD, 0xC691, 0xFDD4, 0x1316, 0xB48E,
+  0xE308, 0x6583, 0xD184, 0x4ABF, 0x6CC5, 0xD278, 0x6425, 0x7AB4,
+  0x483F, 0xB46F, 0x3612, 0x9F65, 0x351B, 0xAF6A, 0x8EF4, 0x8A53,
+  0x9734, 0x2187, 0xB6E6, 0x0863, 0x7A5D, 0x12A3, 0x075D, 0x89CC,
+  0xD778, 0xBB2F, 0x8601, 0x804D, 0xA4D0, 0x3304, 0xAEC4, 0xAA42,
+  0xC107, 0x14DF, 0x6825, 0x21A3, 0x368C, 0x60A0, 0x5D88, 0xE1F5,
+  0xB2D2, 0x930F, 0xE601, 0x5C52, 0x2C63, 0x5E35, 0x9BE2, 0x3703,
+  0x3234, 0x75B7, 0x8985, 0x0C73, 0x615B, 0xE63C, 0x6E79, 0x51A4,
+  0xB50E, 0xED76, 0x3B54, 0xD305, 0xFB48, 0xC029, 0xAE81, 0x61DA,
+  0x1189, 0x6454, 0x65DC, 0xE424, 0xF327, 0xAAE7, 0xB6D8, 0x7631,
+  0x7B88, 0x83DF, 0x9D52, 0xEBD0, 0x092C, 0x8BF1, 0xA311, 0x6029,
+  0x25BB, 0xA20C, 0xDDEB, 0x6FED, 0x9455, 0xBCA1, 0xB416, 0xA6FC,
+  0x7AAA, 0x2912, 0x9E57, 0xCB4C, 0xB839, 0xBE7E, 0x591C, 0xFB0E,
+  0x47C8, 0x021D, 0x6B16, 0xF0EB, 0xCF98, 0x9F12, 0x9042, 0x74CB,
+  0x7FB5, 0xFE68, 0x005C, 0x79D9, 0xC58A, 0xBC65, 0x883B, 0x7C5F,
+  0x3E59, 0x75C1, 0x4581, 0x9F54, 0x17A3, 0xD857, 0x7579, 0x1F0A,
+  0xAB90, 0x8317, 0xB1EC, 0x3B89, 0x5D69, 0x34EF, 0x4834, 0x7790,
+  0x03D4, 0xBE63, 0x7448, 0xAD24, 0xC0D1, 0xC9DA, 0x8E38, 0x39F8,
+  0x0443, 0x3E35, 0x47FD, 0xBFB0, 0x5F05, 0x4091, 0x14C4, 0xFF40
+};
+static const uint8_t __xor16_471_order[256] PROGMEM = {
+    0,  50, 218,  98, 209,  31, 240, 248, 134, 131,  27,  12, 188,  71, 163,  86,
+   78,  34,  87, 176, 107, 133, 110,  88, 254, 145,   6, 228,  53, 231, 129, 147,
+   60, 192, 201,  39, 156,  32,  14, 160, 141, 237, 124, 122, 148,  19, 159,  35,
+  247, 170, 235,  95,  33, 249, 224,  62, 253,  89,  26, 226,  99,  49, 208, 250,
+   21, 238, 120,   2,  48,   4,  20,  23, 115,  37,  97, 102, 167,  96,  84, 101,
+  206,  43,  57, 155, 236, 150, 157, 252, 191,  22, 149, 164, 175,  85, 118, 177,
+   42,  18, 113, 178,  56, 106, 146,   1,  36, 210, 116,   7, 166,  76, 195,  61,
+   29, 242,  13, 215, 230, 161, 225, 183,  80, 239,  40,   9, 219, 132, 200, 119,
+  184, 223, 216,  73, 139,  16, 233,  54, 185,  15,  69, 138,  10,  58,   3, 222,
+  162, 135, 127, 189,   5,  81, 246, 126, 214, 153, 196,  28,  74, 128, 158,  91,
+   45, 186, 202,  79, 213,  11, 227, 123,  30, 193, 190, 104,  25, 140,  93, 199,
+   24, 143, 181, 232, 243,  47, 174, 142, 125, 234, 152,  90, 198, 121, 111, 168,
+  182, 130,  38, 204,  52,  92,  44, 137, 221, 197,  68, 241, 205, 251,  67, 173,
+   17, 244, 144,  64, 220,  63, 108,  94,  75,  65, 245,  41, 203, 212, 114, 117,
+  171,  51,  83, 136,  46, 229,   8, 103, 194, 151, 112, 179,  70, 154, 165, 100,
+  187, 169,  66, 211,  55, 180,  82, 207, 172,  77, 109,  72, 217, 105, 255,  59
+};
+
+uint16_t xor16_471_position() {
+  uint16_t saved = __xor16_471_state;
+  uint16_t pos = __xor16_position(saved, xor16_471, __xor16_471_checkpoints, __xor16_471_order);
+  __xor16_471_state = saved;
+  return pos;
+}
+
+void xor16_471_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_471, xor16_471, __xor16_471_checkpoints);
+}
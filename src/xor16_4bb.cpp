@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: 4bb //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_4bb_state;
+uint16_t __xor16_4bb_state;
+static uint16_t __xor16_4bb_weyl_count;
+static uint8_t __xor16_4bb_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_4bb_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_4bb(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_4bb(uint16_t seed) {
   }
   if(seed) {
     __xor16_4bb_state = seed;
+    __xor16_4bb_spare_full = 0;
     return 1;
   }
   return 0;
@@ -19,14 +24,12 @@ bool seed_xor16_4bb(uint16_t seed) {
 uint16_t xor16_4bb() {
     __asm__ __volatile__(
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "mov    r18, %B0"      "\n\t"
@@ -42,3 +45,399 @@ uint16_t xor16_4bb() {
     :"+d"((uint16_t)__xor16_4bb_state)::"r18","r19");
   return __xor16_4bb_state;
 }
+
+uint16_t xor16_4bb_star() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_4bb_state)::"r18","r19");
+  return rng16::star(__xor16_4bb_state);
+}
+
+/* The same step as xor16_4bb(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_4bb_weyl(uint16_t seed) {
+  __xor16_4bb_state = seed ? seed : 1;
+  __xor16_4bb_weyl_count = seed;
+  __xor16_4bb_spare_full = 0;
+}
+
+uint16_t xor16_4bb_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_4bb_state), "+d"(__xor16_4bb_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_4bb(). */
+uint8_t xor16_4bb_byte() {
+  if (__xor16_4bb_spare_full) {
+    __xor16_4bb_spare_full = 0;
+    return __xor16_4bb_spare;
+  }
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_4bb_state)::"r18","r19");
+  __xor16_4bb_spare = __xor16_4bb_state >> 8;
+  __xor16_4bb_spare_full = 1;
+  return __xor16_4bb_state;
+}
+
+/* n bytes, the same ones n calls to xor16_4bb_byte() would return; whole steps go through xor16_4bb_fill(). */
+void xor16_4bb_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_4bb_spare_full) {
+    __xor16_4bb_spare_full = 0;
+    *dst++ = __xor16_4bb_spare;
+    n--;
+  }
+  xor16_4bb_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_4bb_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 22 eors. */
+void xor16_4bb_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r13"      "\n\t" // y ^= y << 4
+      "eor    r16, r12"      "\n\t"
+      "eor    r15, r11"      "\n\t"
+      "eor    r14, r10"      "\n\t"
+      "eor    r13, r9"       "\n\t"
+      "eor    r12, r8"       "\n\t"
+      "eor    r11, r7"       "\n\t"
+      "eor    r10, r6"       "\n\t"
+      "eor    r9, r5"        "\n\t"
+      "eor    r8, r4"        "\n\t"
+      "eor    r7, r3"        "\n\t"
+      "eor    r6, r2"        "\n\t"
+      "eor    r2, r13"       "\n\t" // y ^= y >> 11
+      "eor    r3, r14"       "\n\t"
+      "eor    r4, r15"       "\n\t"
+      "eor    r5, r16"       "\n\t"
+      "eor    r6, r17"       "\n\t"
+      "eor    r17, r6"       "\n\t" // y ^= y << 11
+      "eor    r16, r5"       "\n\t"
+      "eor    r15, r4"       "\n\t"
+      "eor    r14, r3"       "\n\t"
+      "eor    r13, r2"       "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_4bb_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_4bb_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_4bb_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x8811, 0x1022, 0x2044, 0x4088, 0x8110, 0x0220, 0x0440, 0x0081,
+    0x0102, 0x0204, 0x0408, 0x0011, 0x0002, 0x0004, 0x0008, 0x0010,
+    // M^2
+    0x0900, 0x1200, 0x2400, 0x4001, 0x8002, 0x0024, 0x0048, 0x8890,
+    0x1120, 0x2240, 0x4480, 0x0901, 0x1022, 0x2044, 0x4088, 0x8110,
+    // M^4
+    0x1821, 0x3262, 0x64C4, 0x4988, 0x9310, 0x2424, 0x4049, 0x8083,
+    0x0126, 0x024C, 0x8C98, 0x1121, 0x0206, 0x040C, 0x8819, 0x1032,
+    // M^8
+    0x2F22, 0x5249, 0xA483, 0x5115, 0x824E, 0xC874, 0x99F9, 0xBAF2,
+    0x73A4, 0x6F49, 0xD790, 0x3F25, 0x54EA, 0xA1D4, 0xC3AA, 0x8750,
+    // M^16
+    0xCFB1, 0x1FC7, 0x368D, 0xED0B, 0xD63F, 0x0C9F, 0x883D, 0x197A,
+    0xFC7C, 0x71E8, 0xE3D1, 0x42B3, 0xA8F3, 0x50E6, 0x29CD, 0x579A,
+    // M^32
+    0x5ECA, 0xF3B9, 0x6761, 0x4ED2, 0x95CD, 0x65D7, 0xDBBE, 0xB66D,
+    0xAE3B, 0x5D77, 0x2BEC, 0x4B89, 0xDE5E, 0x35AC, 0x6B59, 0xD2F2,
+    // M^64
+    0x58AD, 0xF77A, 0x66F6, 0x5DEC, 0x93D1, 0xE92E, 0x434D, 0x868B,
+    0xC9F7, 0x9AEF, 0xACDE, 0x75E9, 0xCE9E, 0x942C, 0xB85B, 0x54F2,
+    // M^128
+    0x0F3E, 0xDAF9, 0x34F3, 0x71F7, 0xC7CE, 0xE1D5, 0xCBB9, 0x1673,
+    0x26AF, 0xCD4F, 0x839E, 0xAE69, 0x764B, 0xE486, 0x590E, 0x9258,
+    // M^256
+    0x7FF1, 0x5B23, 0x3F45, 0xF789, 0xE11F, 0x28B6, 0xC07E, 0x00FF,
+    0xCD32, 0x9B74, 0x37F8, 0xC2C3, 0xEA9B, 0x5437, 0x387E, 0x54DC,
+    // M^512
+    0x5376, 0x4A04, 0x9D1B, 0x3B37, 0xF8A6, 0x3BC4, 0xF69A, 0xE536,
+    0xC621, 0x1C50, 0x21B3, 0x1385, 0x5399, 0x3723, 0xE657, 0x0C4F,
+    // M^1024
+    0x8D58, 0x7499, 0x7122, 0xEA45, 0x94CA, 0x23F9, 0xDFE2, 0x2ED4,
+    0xBF49, 0x6F93, 0xCE24, 0xA2B3, 0x1A6E, 0xBDCE, 0x6A8D, 0x7BF2,
+    // M^2048
+    0x0941, 0xDE0A, 0x2504, 0x4209, 0xC052, 0x4C0C, 0x110A, 0xAA14,
+    0xD8E0, 0x28D1, 0x40A0, 0xC989, 0xC4AB, 0x1144, 0x2288, 0x8DD8,
+    // M^4096
+    0x0922, 0x5600, 0xAC00, 0x4111, 0xA002, 0xCCAC, 0x8048, 0x9892,
+    0x5560, 0xAAC0, 0xC490, 0x5F65, 0x9CAA, 0x2845, 0xD188, 0xE554,
+    // M^8192
+    0x90A9, 0x2372, 0x56E4, 0x2DC8, 0x9B11, 0x1606, 0x240D, 0x480B,
+    0x9036, 0x206E, 0xC8DC, 0xC0B1, 0xA124, 0x524A, 0x2495, 0x0123,
+    // M^16384
+    0x436B, 0x687A, 0x41E7, 0x8BDF, 0xDB56, 0x3C00, 0x7113, 0x7A37,
+    0x5886, 0x381F, 0x693C, 0x7003, 0x83BD, 0x8F68, 0x8FC1, 0x35EB,
+    // M^32768
+    0x0285, 0x054A, 0x8A95, 0x142A, 0xAAD5, 0x15EA, 0x2BD5, 0x46A8,
+    0x2FD5, 0x46A9, 0x0542, 0xA805, 0x4140, 0x8A81, 0x0402, 0xAA85
+  };
+  __xor16_4bb_state = __xor16_jump(__xor16_4bb_state, table, n);
+  return __xor16_4bb_state;
+}
+
+uint16_t xor16_4bb_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_4bb_state)::"r18","r19");
+  return __xor16_4bb_state;
+}
+
+static const uint16_t __xor16_4bb_checkpoints[256] PROGMEM = {
+  0x0001, 0x7FF1, 0x5376, 0xE912, 0x8D58, 0xBA3D, 0xCD53, 0x5118,
+  0x0941, 0xB07E, 0x7048, 0xB125, 0x4F40, 0x5B7D, 0xF88A, 0xBC98,
+  0x0922, 0x7C64, 0xA464, 0xE09E, 0x4A9A, 0x2C83, 0x8521, 0xF951,
+  0x836F, 0x064C, 0xA43E, 0x6D55, 0x3595, 0xE532, 0x50D5, 0xB3CF,
+  0x90A9, 0x1E76, 0xE965, 0x9F18, 0x0BAC, 0x7400, 0xB12A, 0xA35E,
+  0xE423, 0x0309, 0xDE3E, 0xB230, 0xB8AD, 0xB7C7, 0x50D8, 0x04F2,
+  0x65F3, 0xBB79, 0xFF5A, 0xFCB8, 0x19EA, 0xA1F7, 0xDF66, 0xA9EA,
+  0x4B87, 0xB793, 0x4EFC, 0x97D5, 0xBED3, 0x8173, 0xB4EB, 0xE6E4,
+  0x436B, 0x55AB, 0xD33D, 0xAEEB, 0x55C8, 0x1F27, 0x7AC7, 0x0473,
+  0x1AFD, 0x0D39, 0x79D8, 0x5F34, 0x8774, 0x03F0, 0x5F6E, 0x0ABF,
+  0x7CFF, 0x96DF, 0xDF4B, 0x3661, 0x8519, 0xC771, 0x7B3A, 0x7754,
+  0xF948, 0xEA08, 0x96AB, 0xE9D9, 0x9E82, 0x8BD4, 0xDE82, 0xB3AA,
+  0x38D5, 0x1D45, 0x5258, 0x9F79, 0x9C95, 0xEA28, 0xBE1D, 0xD21D,
+  0x4B6F, 0xA82D, 0x5DA3, 0xE677, 0x8659, 0x5149, 0x57D1, 0xED34,
+  0xF670, 0x7755, 0x86B9, 0xB97E, 0x7FB9, 0x6481, 0x24BF, 0x4687,
+  0x8F9A, 0xBAEB, 0x88AB, 0x6D0D, 0xE37D, 0xD039, 0xC7E8, 0x12A2,
+  0x0285, 0xDB3F, 0x370B, 0x0C49, 0xBD3D, 0xACED, 0xAADA, 0xD468,
+  0xAE80, 0x6E5B, 0xF03C, 0xD36B, 0xEBEC, 0x8CEB, 0x9A8B, 0x3454,
+  0x9770, 0xD62E, 0x91EC, 0x538E, 0x17B3, 0x66A1, 0x977D, 0x6113,
+  0x64B6, 0xF681, 0x018C, 0x0501, 0x853B, 0xB4E4, 0x0AFA, 0xFC35,
+  0xAE28, 0xB19B, 0x15F9, 0x9101, 0x0C84, 0xCA81, 0x4A1B, 0x538D,
+  0x3361, 0x7FD3, 0x20E3, 0x98D2, 0x0639, 0xED5D, 0x96C0, 0xD24A,
+  0x7199, 0x2278, 0x311D, 0x25BC, 0xAF67, 0x50C9, 0x9A1C, 0xCE23,
+  0x0E89, 0xE6C8, 0xA311, 0xC843, 0x4ACD, 0x1675, 0x0F74, 0x95EF,
+  0x40A4, 0x2F72, 0xA5BE, 0xA098, 0x1682, 0x1DCB, 0xC148, 0x9667,
+  0xE194, 0x2B02, 0x9B91, 0xB4D3, 0xD8C4, 0xBB3E, 0x24B3, 0x8E4B,
+  0x29B6, 0xF6F6, 0x13CC, 0xB490, 0x3C68, 0x54D6, 0xA0E5, 0xA868,
+  0xDD69, 0xDE80, 0xE889, 0x72D1, 0x43C9, 0x26C1, 0x47CB, 0x4A1A,
+  0x2C7C, 0x6017, 0x96C1, 0xADBB, 0x22EF, 0xCB6A, 0xBC45, 0x9F81,
+  0x6234, 0x01D1, 0x935D, 0x7E5D, 0x7EC1, 0x57ED, 0xEC51, 0x933E,
+  0xB247, 0xAAED, 0x0656, 0xE98B, 0xE4C0, 0xCFEC, 0xEF24, 0x8C1B,
+  0x93A3, 0xE49A, 0x4227, 0x902B, 0x45AA, 0x4657, 0xAE04, 0x51E1
+};
+static const uint8_t __xor16_4bb_order[256] PROGMEM = {
+    0, 154, 233, 128,  41,  77,  71,  47, 155, 172,  25, 242,  16,   8,  79, 158,
+   36, 131, 164,  73, 184, 190, 127, 210, 162, 189, 196, 148,  52,  72,  97, 197,
+   33,  69, 170, 177, 228, 206, 118, 179, 221, 208, 201, 224,  21, 193, 178, 168,
+  143,  28,  83, 130,  96, 212, 192, 250,  64, 220, 252, 253, 119, 222, 223, 166,
+   20, 188, 104,  56,  58,  12, 181,  30,  46,   7, 109, 255,  98,   2, 167, 147,
+  213,  65,  68, 110, 237,  13, 106,  75,  78, 225, 151, 232, 117, 152,  48, 149,
+  123,  27, 137,  10, 176, 219,  37,  87, 113,  74,  70,  86,  17,  80, 235, 236,
+  116, 169,   1,  61,  24,  84,  22, 156, 108, 114,  76, 122,  93, 247, 141,   4,
+  207, 120, 251,  32, 163, 146, 239, 234, 248, 191, 199,  90, 174, 226,  81, 144,
+  150,  59, 171, 182, 142, 202, 100,  92,  35,  99, 231, 195, 214,  53, 186,  39,
+   26,  18, 194, 105, 215,  55, 134, 241, 133, 227, 254, 160, 136,  67, 180,   9,
+   11,  38, 161,  43, 240,  95,  31, 211, 203, 157,  62,  57,  45,  44, 115,   5,
+  121, 205,  49, 230,  15, 132, 102,  60, 198,  85, 126, 187, 165, 229,   6, 183,
+  245, 125, 103, 175,  66, 139, 135, 145, 204, 129, 216,  42, 217,  94,  82,  54,
+   19, 200, 124,  40, 249, 244,  29, 107, 185,  63, 218,   3,  34, 243,  91,  89,
+  101, 140, 238, 111, 173, 246, 138, 112, 153, 209,  14,  88,  23, 159,  51,  50
+};
+
+uint16_t xor16_4bb_position() {
+  uint16_t saved = __xor16_4bb_state;
+  uint16_t pos = __xor16_position(saved, xor16_4bb, __xor16_4bb_checkpoints, __xor16_4bb_order);
+  __xor16_4bb_state = saved;
+  return pos;
+}
+
+void xor16_4bb_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_4bb, xor16_4bb, __xor16_4bb_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 57e //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_57e_state;
+uint16_t __xor16_57e_state;
 
 bool seed_xor16_57e(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -19,32 +20,260 @@ bool seed_xor16_57e(uint16_t seed) {
 uint16_t xor16_57e() {
     __asm__ __volatile__(
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_57e_state)::"r18","r19");
+  return __xor16_57e_state;
+}
+
+void xor16_57e_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
+      "lsl    r18"           "\n\t"
       "mov    r18, r19"      "\n\t"
-      "adc    r18, r18"      "\n\t"
-      "sbc    r19, r19"      "\n\t"
-      "neg    r19"           "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
-      "eor    r19, r19"      "\n\t"
+      "clr    r19"           "\n\t"
       "bst    %A0, 0"        "\n\t"
       "bld    r19, 6"        "\n\t"
       "bst    %A0, 1"        "\n\t"
       "bld    r19, 7"        "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_57e_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_57e_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x4021, 0x8042, 0x4085, 0x810A, 0x0214, 0x0428, 0x0850, 0x50A1,
+    0xA142, 0x4284, 0x8508, 0x0810, 0x1020, 0x2040, 0x4080, 0x8100,
+    // M^2
+    0x0489, 0x0912, 0x1085, 0x210A, 0x0015, 0x002A, 0x0254, 0x4408,
+    0x8810, 0x1220, 0x2440, 0x0A04, 0x1408, 0x2810, 0x1021, 0x2042,
+    // M^4
+    0x45CB, 0x8B13, 0x440C, 0x8818, 0x1419, 0x2832, 0x00E4, 0x156B,
+    0x2A53, 0x0602, 0x0E04, 0x08A1, 0x1142, 0x2201, 0x10AB, 0x2356,
+    // M^8
+    0x67B3, 0xDD67, 0xD2BB, 0xB7F6, 0xC68C, 0x9D98, 0x79B1, 0x5B03,
+    0xF687, 0x8315, 0x44AB, 0x7033, 0xB0E6, 0x61C8, 0x6ADB, 0xD5B2,
+    // M^16
+    0x80E9, 0x41D6, 0x81AF, 0x43DF, 0x4699, 0x8D32, 0x5AE5, 0x6548,
+    0x9A95, 0xD3A4, 0xE5C9, 0x5A35, 0xB46A, 0x68D0, 0x1129, 0x60D3,
+    // M^32
+    0x117A, 0x32F1, 0x1173, 0x2263, 0xC7A3, 0xCFC7, 0x9F0B, 0x1F9F,
+    0x7FBF, 0xE574, 0x9AED, 0xE63F, 0x8C7E, 0x5AF8, 0x60FB, 0xC1F2,
+    // M^64
+    0x743C, 0xAA78, 0x4725, 0xCCCB, 0x52FC, 0xF57C, 0xAA7D, 0xA2C0,
+    0x5704, 0x98BF, 0x23FE, 0x9C97, 0x2BAE, 0x455D, 0xB31B, 0x64B7,
+    // M^128
+    0xD278, 0xE4F4, 0x993B, 0x72F7, 0x24D9, 0x4BB6, 0xD7ED, 0xB1E8,
+    0x33D5, 0x8364, 0x044D, 0x992D, 0x605B, 0xC0B2, 0x858C, 0x4999,
+    // M^256
+    0xE55F, 0x98BB, 0xA82E, 0x00DC, 0x26AC, 0x0F58, 0x0CB5, 0x85E1,
+    0x19C7, 0xFC48, 0xEA14, 0xF138, 0xF271, 0xF666, 0x2425, 0x1ACA,
+    // M^512
+    0xC455, 0xC8AE, 0x2285, 0x070A, 0xC271, 0xD466, 0xFA48, 0x8A4A,
+    0x4610, 0x2DBD, 0x4B7B, 0x0A17, 0x06AE, 0x1FDC, 0x5E5B, 0xEE32,
+    // M^1024
+    0x25FB, 0x0973, 0x5EFB, 0xEF72, 0xB5DE, 0x39B9, 0x73F3, 0xFC74,
+    0xFAEC, 0x6527, 0xD84F, 0xCBA5, 0xD5CB, 0xBB93, 0x07EC, 0x1DDD,
+    // M^2048
+    0x592A, 0xE255, 0x64F0, 0xDB64, 0xD385, 0xE58B, 0xD917, 0xC6EC,
+    0xDD5C, 0xD516, 0xEAAD, 0xF092, 0xA124, 0x42C9, 0x4033, 0x92E6,
+    // M^4096
+    0x1063, 0x7242, 0xC1A2, 0xD345, 0x808D, 0x011A, 0x5235, 0xA88A,
+    0x0194, 0x1120, 0x7041, 0xC604, 0x8C08, 0x0890, 0xCD42, 0x9A01,
+    // M^8192
+    0xBD06, 0x788D, 0x8D05, 0x480B, 0x300F, 0x201E, 0x003C, 0x5D18,
+    0xE831, 0x8C86, 0x0B8C, 0xF780, 0xFF01, 0xEE03, 0xC0E5, 0xD14E,
+    // M^16384
+    0x21F9, 0x0377, 0xF570, 0xBAE5, 0x1187, 0x638F, 0xD51F, 0x53DD,
+    0xA53F, 0x85D2, 0x0B21, 0x328A, 0x2514, 0x4AA9, 0x5C92, 0xBB24,
+    // M^32768
+    0x8040, 0x5004, 0x8102, 0x5205, 0x0408, 0x0810, 0x1020, 0xA042,
+    0x4080, 0x8108, 0x5011, 0x0020, 0x0040, 0x4084, 0x0100, 0x5001
+  };
+  __xor16_57e_state = __xor16_jump(__xor16_57e_state, table, n);
+  return __xor16_57e_state;
+}
+
+uint16_t xor16_57e_prev() {
+    __asm__ __volatile__(
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_57e_state)::"r18","r19");
   return __xor16_57e_state;
 }
+
+static const uint16_t __xor16_57e_checkpoints[256] PROGMEM = {
+  0x0001, 0xE55F, 0xC455, 0xB393, 0x25FB, 0xD82D, 0x7F53, 0x896C,
+  0x592A, 0xA994, 0x0F30, 0xD757, 0x3CD6, 0x8056, 0x0046, 0x3C20,
+  0x1063, 0x8C78, 0x247B, 0x440B, 0xB309, 0x1ED1, 0x5FB2, 0x1C59,
+  0x26C7, 0xBCA4, 0x2766, 0xCA85, 0xFB0F, 0xFB59, 0xE1D5, 0x33C7,
+  0xBD06, 0x2CA3, 0x1A17, 0x0C67, 0xCD0B, 0x413C, 0xBCE4, 0x2BD3,
+  0x30CD, 0xC0EE, 0x88AA, 0xF92C, 0x75AD, 0x14F5, 0xF5B4, 0xCD10,
+  0x1AA8, 0x7564, 0x7822, 0x46E9, 0x51F6, 0x5FA6, 0x92DB, 0xC633,
+  0x7CA3, 0xCC43, 0x5492, 0x07B6, 0x931B, 0x56A0, 0x4AB1, 0x601F,
+  0x21F9, 0xAA82, 0xFC86, 0x94A0, 0x8816, 0xFDCB, 0xCC7F, 0xD594,
+  0x342E, 0xD112, 0x6B4E, 0xFA08, 0x3754, 0x89BB, 0x2318, 0x3599,
+  0xB10A, 0x9F7D, 0x7EF4, 0xCFD8, 0x6F68, 0x2FD1, 0x4262, 0x433B,
+  0x9566, 0x2810, 0x21F2, 0xD7BA, 0xF777, 0xC5E8, 0x4BEC, 0x1E6C,
+  0xBE0A, 0x61DE, 0x5435, 0x58C5, 0xE349, 0xC430, 0xFD0F, 0xED05,
+  0x8713, 0x4E19, 0x006E, 0x33A4, 0xC30F, 0x0E76, 0xF2B0, 0x6AA5,
+  0x18FB, 0xDED1, 0x615D, 0xAC30, 0xDE74, 0xA695, 0x14CC, 0x39C3,
+  0x1858, 0x298C, 0x338A, 0xFC1E, 0x3731, 0xC727, 0xEBE6, 0x6AA7,
+  0x8040, 0x167F, 0x147A, 0xA543, 0x6E2E, 0x0A36, 0x1411, 0xDB96,
+  0x4BF1, 0x756D, 0x9DA1, 0x85B6, 0x7599, 0x952F, 0xC126, 0x18E5,
+  0xC834, 0x4E0D, 0x8EEC, 0xD350, 0x0308, 0xE553, 0x6CA7, 0x961C,
+  0x70B9, 0x69A4, 0x182B, 0x7129, 0xD32E, 0x1600, 0xE42D, 0x6068,
+  0xD172, 0x68A3, 0xD426, 0x1947, 0xC3F1, 0x9E9F, 0x7984, 0xE502,
+  0xA3E1, 0x6A70, 0xFA72, 0x8A72, 0xAA40, 0xED69, 0x2C0C, 0x45B8,
+  0x7B3F, 0xC867, 0x19F0, 0xBA2E, 0x2CBC, 0xE9AD, 0xE762, 0x5C44,
+  0x69E3, 0xC154, 0xA51F, 0xECC5, 0x1780, 0x780B, 0xAC32, 0x46CF,
+  0x6E3B, 0x61EB, 0x30B0, 0xA802, 0x852F, 0x3357, 0x1E4B, 0x6498,
+  0x9BC6, 0x45CD, 0x130F, 0xC2E8, 0x4477, 0x3EBA, 0xD701, 0x265A,
+  0x5244, 0x8E87, 0xAD85, 0x26D7, 0x9A08, 0xE517, 0xC83C, 0x4ED1,
+  0x89E6, 0x44AC, 0xEC7A, 0x6E83, 0xCD22, 0xABE7, 0xABDD, 0x1A4E,
+  0xC3FD, 0x366D, 0x5C0B, 0xB040, 0x1268, 0x0D08, 0x0237, 0x0076,
+  0x15D4, 0x0674, 0x9B33, 0xA81C, 0x93CA, 0x1C07, 0x3C97, 0x69BC,
+  0x3E5B, 0xB452, 0x466B, 0x4CAC, 0x1D42, 0x6494, 0x3334, 0x6042,
+  0x464D, 0x7361, 0x230F, 0xC6FF, 0x5D05, 0x99CE, 0xB959, 0x39B8
+};
+static const uint8_t __xor16_57e_order[256] PROGMEM = {
+    0,  14, 106, 231, 230, 148, 233,  59, 133,  35, 229, 109,  10,  16, 228, 202,
+  134, 130, 118,  45, 232, 157, 129, 188, 154, 120, 143, 112, 163, 178,  34, 223,
+   48, 237,  23, 244, 198,  95,  21,  90,  64, 250,  78,  18,   4, 207,  24, 211,
+   26,  89, 121,  39, 174,  33, 180,  85, 194,  40, 246, 197, 122, 107,  31,  72,
+   79, 225, 124,  76, 255, 119,  15, 238,  12, 240, 205,  37,  86,  87,  19, 204,
+  217, 175, 201, 248, 242, 191,  51,  62,  94, 136, 243, 145, 105, 215,  52, 208,
+   98,  58,  61,  99,   8, 226, 183, 252,  53,  22,  63, 247, 159, 114,  97, 193,
+  245, 199, 161, 153, 239, 184, 169, 111, 127,  74, 150, 132, 192, 219,  84, 152,
+  155, 249,  49, 137, 140,  44, 189,  50, 166, 176,  56,  82,   6, 128,  13, 196,
+  139, 104,  68,  42,   7,  77, 216, 171,  17, 209, 146,  54,  60, 236,  67, 141,
+   88, 151, 253, 212, 234, 200, 138, 165,  81, 168, 186, 131, 117, 195, 235,   9,
+  172,  65, 222, 221, 115, 190, 210, 227,  80,  20,   3, 241, 254, 179,  25,  38,
+   32,  96,  41, 142, 185, 203, 108, 164, 224, 101,   2,  93,  55, 251, 125, 144,
+  214, 177,  27,  57,  70,  36,  47, 220,  83,  73, 160, 156, 147, 162,  71, 206,
+   11,  91,   5, 135, 116, 113,  30, 100, 158, 167, 213, 149,   1, 182, 181, 126,
+  218, 187, 103, 173, 110,  46,  92,  43,  75, 170,  28,  29, 123,  66, 102,  69
+};
+
+uint16_t xor16_57e_position() {
+  uint16_t saved = __xor16_57e_state;
+  uint16_t pos = __xor16_position(saved, xor16_57e, __xor16_57e_checkpoints, __xor16_57e_order);
+  __xor16_57e_state = saved;
+  return pos;
+}
+
+void xor16_57e_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_57e, xor16_57e, __xor16_57e_checkpoints);
+}
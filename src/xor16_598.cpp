@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: 598 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_598_state;
+uint16_t __xor16_598_state;
+static uint16_t __xor16_598_weyl_count;
+static uint8_t __xor16_598_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_598_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_598(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_598(uint16_t seed) {
   }
   if(seed) {
     __xor16_598_state = seed;
+    __xor16_598_spare_full = 0;
     return 1;
   }
   return 0;
@@ -19,14 +24,244 @@ bool seed_xor16_598(uint16_t seed) {
 uint16_t xor16_598() {
     __asm__ __volatile__(
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_598_state)::"r18","r19");
+  return __xor16_598_state;
+}
+
+uint16_t xor16_598_star() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_598_state)::"r18","r19");
+  return rng16::star(__xor16_598_state);
+}
+
+/* The same step as xor16_598(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_598_weyl(uint16_t seed) {
+  __xor16_598_state = seed ? seed : 1;
+  __xor16_598_weyl_count = seed;
+  __xor16_598_spare_full = 0;
+}
+
+uint16_t xor16_598_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_598_state), "+d"(__xor16_598_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_598(). */
+uint8_t xor16_598_byte() {
+  if (__xor16_598_spare_full) {
+    __xor16_598_spare_full = 0;
+    return __xor16_598_spare;
+  }
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_598_state)::"r18","r19");
+  __xor16_598_spare = __xor16_598_state >> 8;
+  __xor16_598_spare_full = 1;
+  return __xor16_598_state;
+}
+
+/* n bytes, the same ones n calls to xor16_598_byte() would return; whole steps go through xor16_598_fill(). */
+void xor16_598_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_598_spare_full) {
+    __xor16_598_spare_full = 0;
+    *dst++ = __xor16_598_spare;
+    n--;
+  }
+  xor16_598_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_598_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 26 eors. */
+void xor16_598_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r12"      "\n\t" // y ^= y << 5
+      "eor    r16, r11"      "\n\t"
+      "eor    r15, r10"      "\n\t"
+      "eor    r14, r9"       "\n\t"
+      "eor    r13, r8"       "\n\t"
+      "eor    r12, r7"       "\n\t"
+      "eor    r11, r6"       "\n\t"
+      "eor    r10, r5"       "\n\t"
+      "eor    r9, r4"        "\n\t"
+      "eor    r8, r3"        "\n\t"
+      "eor    r7, r2"        "\n\t"
+      "eor    r2, r11"       "\n\t" // y ^= y >> 9
+      "eor    r3, r12"       "\n\t"
+      "eor    r4, r13"       "\n\t"
+      "eor    r5, r14"       "\n\t"
+      "eor    r6, r15"       "\n\t"
+      "eor    r7, r16"       "\n\t"
+      "eor    r8, r17"       "\n\t"
+      "eor    r17, r9"       "\n\t" // y ^= y << 8
+      "eor    r16, r8"       "\n\t"
+      "eor    r15, r7"       "\n\t"
+      "eor    r14, r6"       "\n\t"
+      "eor    r13, r5"       "\n\t"
+      "eor    r12, r4"       "\n\t"
+      "eor    r11, r3"       "\n\t"
+      "eor    r10, r2"       "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_598_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
@@ -34,8 +269,154 @@ uint16_t xor16_598() {
       "mov    r18, %B0"      "\n\t"
       "lsr    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_598_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_598_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x2121, 0x4242, 0x8484, 0x0908, 0x1311, 0x2622, 0x4C44, 0x9888,
+    0x3110, 0x6321, 0xC642, 0x0C04, 0x1808, 0x3010, 0x6020, 0xC040,
+    // M^2
+    0x0603, 0x0D07, 0x1A0E, 0x341C, 0x7809, 0xF113, 0x62A6, 0x45CC,
+    0x0A19, 0x0502, 0x0B05, 0x4EC2, 0x1D04, 0x3B09, 0x7612, 0xEC24,
+    // M^4
+    0x0503, 0x5ED4, 0x75D1, 0x7B13, 0x2CC2, 0xC52F, 0xEBCF, 0x7E76,
+    0x01D6, 0x0C1B, 0x5DD4, 0x1CBA, 0x48D4, 0x55CB, 0x2B16, 0x0FE5,
+    // M^8
+    0x07D5, 0xE21D, 0xD673, 0x506B, 0xDFC8, 0xE8CB, 0xA0E3, 0x525B,
+    0x93A8, 0x4D68, 0xEFD0, 0xBBE6, 0xFB06, 0x8ABD, 0x437B, 0x6CE7,
+    // M^16
+    0xCDC6, 0xB64C, 0x040A, 0x45F6, 0xFCBF, 0x59DC, 0x19E1, 0x3F9D,
+    0xA3DA, 0x9CA6, 0x02A7, 0x5667, 0x0F6F, 0x7EFC, 0xBFF8, 0xB438,
+    // M^32
+    0x68E0, 0x03B7, 0xF11D, 0x2FDC, 0x8E1B, 0xDE15, 0x48B4, 0x5537,
+    0xDCC1, 0x3B90, 0x8567, 0x112B, 0x11F7, 0xC4EE, 0x68FE, 0x2799,
+    // M^64
+    0x7EAD, 0x7822, 0x7E85, 0xFAAA, 0x42D5, 0xE6AA, 0x8DF1, 0xEAEB,
+    0xBFBF, 0xF84F, 0x72D4, 0x57A8, 0x1AF1, 0xD4E0, 0x2DC0, 0x3AC8,
+    // M^128
+    0xC821, 0x2AF1, 0xD421, 0xF837, 0xF068, 0xC7BA, 0x1DC3, 0x119A,
+    0x5A61, 0x81E0, 0x40D4, 0xF4FE, 0x08DE, 0xFE9D, 0x2939, 0xFC46,
+    // M^256
+    0x2E1A, 0x7829, 0x92EE, 0xD6E1, 0x0172, 0xBAA4, 0x081C, 0x618B,
+    0x46A1, 0x6DC4, 0x0129, 0x5E84, 0x0E28, 0x1333, 0x57C6, 0x7405,
+    // M^512
+    0x8EE0, 0x5606, 0xF8FC, 0xBC2F, 0x8D42, 0x139F, 0x1BF9, 0xE30D,
+    0xCE1E, 0xA680, 0x04FE, 0x98E2, 0x5E2C, 0xC8A8, 0xF0F2, 0xF700,
+    // M^1024
+    0x26F7, 0xA25A, 0x2B6E, 0x7232, 0xE8FD, 0xC4C8, 0xFAB6, 0x6DF7,
+    0xA2F9, 0x7EDB, 0x7002, 0x8CA3, 0xC30E, 0xD3AD, 0xA159, 0xFD16,
+    // M^2048
+    0xC9C3, 0x9243, 0x4654, 0x414E, 0xC79E, 0xC93E, 0x7662, 0x381B,
+    0xBFD1, 0xBAA3, 0x13A0, 0x2C25, 0x7B6B, 0x95F7, 0xCACC, 0x737D,
+    // M^4096
+    0x3FBC, 0x9F57, 0x9467, 0x9626, 0xC5BF, 0xB1BC, 0xA04C, 0x1FE9,
+    0xE732, 0xA1C2, 0x8F3C, 0xECDB, 0xA895, 0xF96A, 0x6654, 0x9739,
+    // M^8192
+    0x1D43, 0x4BC4, 0x95EC, 0xABDE, 0x5023, 0x485F, 0xCC5E, 0x2A01,
+    0x2A9F, 0xA993, 0xC46C, 0x2737, 0xF305, 0xB3FA, 0x4054, 0x2BF9,
+    // M^16384
+    0xA018, 0x97DC, 0xA63D, 0xFFB2, 0xAD89, 0x93AB, 0x617D, 0x201D,
+    0x2FC9, 0xB90E, 0x15F2, 0x2F8D, 0x20F1, 0xF633, 0x49C5, 0x5F7F,
+    // M^32768
+    0xFB77, 0x49DD, 0xC205, 0xE523, 0xC34D, 0x9289, 0x36F7, 0xA22D,
+    0x4441, 0x47AA, 0xF254, 0x8301, 0x2969, 0x6562, 0x0EC4, 0xF498
+  };
+  __xor16_598_state = __xor16_jump(__xor16_598_state, table, n);
+  return __xor16_598_state;
+}
+
+uint16_t xor16_598_prev() {
+    __asm__ __volatile__(
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
       "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
       "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_598_state)::"r18","r19");
   return __xor16_598_state;
 }
+
+static const uint16_t __xor16_598_checkpoints[256] PROGMEM = {
+  0x0001, 0x2E1A, 0x8EE0, 0x955F, 0x26F7, 0x6942, 0x2CE5, 0x2359,
+  0xC9C3, 0x0442, 0x711C, 0x4901, 0x61F9, 0x28EE, 0xA2A2, 0xA9F4,
+  0x3FBC, 0xF781, 0x5B05, 0x90FB, 0x28BE, 0xABCC, 0x3F4F, 0x73F3,
+  0xE5CA, 0xB027, 0x1767, 0x5201, 0x1A30, 0x86BE, 0xFE93, 0x3A7B,
+  0x1D43, 0x490B, 0xCF31, 0xC2C7, 0xE34D, 0x799C, 0x760E, 0x1A16,
+  0xD6DD, 0x43F6, 0x4425, 0x50BF, 0x918F, 0x4F3B, 0x180A, 0xFE64,
+  0x2CE7, 0x5B70, 0x9FC5, 0xDB86, 0xD346, 0xE455, 0x8443, 0x2B03,
+  0x30E1, 0xE032, 0xF30F, 0x0781, 0x65DD, 0x018D, 0x4D3F, 0xE720,
+  0xA018, 0xB0A5, 0x0EC5, 0xE70A, 0xB474, 0x4913, 0x18A2, 0xF3AA,
+  0x605A, 0xE353, 0x44C8, 0xE999, 0xB0D7, 0xC526, 0x3428, 0x7077,
+  0x3DCA, 0xC348, 0xD65B, 0xC8BA, 0x09D2, 0x08E9, 0x754C, 0x4146,
+  0xF3BC, 0x8BEF, 0xC0EB, 0x7022, 0x8850, 0x23EF, 0xF959, 0xD768,
+  0x63FE, 0x81F7, 0x2438, 0x7F2D, 0xEEA4, 0x4B58, 0xFDA8, 0x2A1A,
+  0x8FC9, 0x91A1, 0xC9B9, 0x1940, 0x1E11, 0x1329, 0x6712, 0x17E2,
+  0x8F7E, 0x8F21, 0x9473, 0x9EFD, 0xF010, 0x3FAA, 0x1C34, 0x78BD,
+  0xA411, 0x4977, 0x38F4, 0x0330, 0x90B3, 0xF643, 0x0C1A, 0xF017,
+  0xFB77, 0x3C2E, 0xC434, 0x0BD2, 0x652D, 0xD3CC, 0x2B16, 0x8D67,
+  0x1B6C, 0x8D7E, 0xE2E5, 0x32F3, 0xF4AD, 0x8ECB, 0xAF29, 0x51A1,
+  0xEA7A, 0x1EB2, 0x9E35, 0x4F66, 0x7B71, 0xA2EC, 0x9DCE, 0x3690,
+  0x110F, 0x5AB5, 0x0C07, 0x9B70, 0xBC06, 0xDC74, 0x5362, 0xB81A,
+  0x9820, 0x9E0D, 0x2251, 0x5983, 0x7673, 0xC3C9, 0x99CA, 0xA557,
+  0xED0D, 0x43E9, 0x576B, 0x41C8, 0xAE11, 0x7A37, 0x0696, 0xE6D3,
+  0x62CB, 0xC074, 0x02E7, 0x7A2A, 0x6DF1, 0xA1A2, 0x8291, 0x5722,
+  0xB12F, 0x8727, 0x2030, 0xA8E5, 0x5675, 0x3A3D, 0xFF98, 0xFC08,
+  0xB794, 0xB145, 0x9B57, 0xC27F, 0xEFF1, 0xB863, 0xD311, 0x29E6,
+  0x32E2, 0xDBC5, 0x8D69, 0x274A, 0x9FAB, 0x5518, 0xC9F5, 0x5553,
+  0x413B, 0x2A63, 0xC4F8, 0x264A, 0xD90A, 0x9B06, 0xE50B, 0xF7AA,
+  0x6173, 0xE7AD, 0xAB86, 0x999B, 0x8223, 0xF556, 0x9AF9, 0x63D7,
+  0xC3A8, 0x0568, 0x23D1, 0x7EA9, 0x5B60, 0x9EB7, 0x56C4, 0xCE7A,
+  0x0CA8, 0x5263, 0xD0A1, 0xD8DE, 0x27AC, 0xA65F, 0x1089, 0x9758,
+  0x8FEE, 0xEFD8, 0xFA3C, 0xF241, 0x751A, 0xA2EF, 0xCBFD, 0xEE76,
+  0x5B94, 0xDE18, 0xC811, 0x522F, 0x9CB2, 0x87F4, 0x1EE6, 0x05B5
+};
+static const uint8_t __xor16_598_order[256] PROGMEM = {
+    0,  61, 178, 123,   9, 225, 255, 174,  59,  85,  84, 131, 154, 126, 232,  66,
+  238, 152, 109,  26, 111,  46,  70, 107,  39,  28, 136, 118,  32, 108, 145, 254,
+  186, 162,   7, 226,  93,  98, 211,   4, 203, 236,  20,  13, 199, 103, 209,  55,
+  134,   6,  48,   1,  56, 200, 139,  78, 151, 122, 189,  31, 129,  80,  22, 117,
+   16, 208,  87, 171, 169,  41,  42,  74,  11,  33,  69, 121, 101,  62,  45, 147,
+   43, 143,  27, 251, 233, 158, 205, 207, 188, 230, 183, 170, 163, 153,  18, 228,
+   49, 248,  72, 216,  12, 176, 223,  96, 132,  60, 110,   5, 180,  91,  79,  10,
+   23, 244,  86,  38, 164, 119,  37, 179, 173, 148, 227,  99,  97, 220, 182,  54,
+   29, 185, 253,  92,  89, 135, 202, 137, 141,   2, 113, 112, 104, 240, 124,  19,
+   44, 105, 114,   3, 239, 160, 219, 166, 222, 213, 194, 155, 252, 150, 161, 146,
+  229, 115, 204,  50,  64, 181,  14, 149, 245, 120, 167, 237, 187,  15, 218,  21,
+  172, 142,  25,  65,  76, 184, 193,  68, 192, 159, 197, 156, 177,  90, 195,  35,
+   81, 224, 165, 130, 210,  77, 250,  83, 106,   8, 206, 246, 231,  34, 234, 198,
+   52, 133,  82,  40,  95, 235, 212,  51, 201, 157, 249,  57, 138,  36,  73,  53,
+  214,  24, 175,  67,  63, 217,  75, 144, 168, 247, 100, 241, 196, 116, 127, 243,
+   58,  71,  88, 140, 221, 125,  17, 215,  94, 242, 128, 191, 102,  47,  30, 190
+};
+
+uint16_t xor16_598_position() {
+  uint16_t saved = __xor16_598_state;
+  uint16_t pos = __xor16_position(saved, xor16_598, __xor16_598_checkpoints, __xor16_598_order);
+  __xor16_598_state = saved;
+  return pos;
+}
+
+void xor16_598_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_598, xor16_598, __xor16_598_checkpoints);
+}
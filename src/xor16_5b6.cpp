@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 5b6 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_5b6_state;
+uint16_t __xor16_5b6_state;
 
 bool seed_xor16_5b6(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -19,14 +20,12 @@ bool seed_xor16_5b6(uint16_t seed) {
 uint16_t xor16_5b6() {
     __asm__ __volatile__(
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
@@ -36,21 +35,251 @@ uint16_t xor16_5b6() {
       "lsr    r18"           "\n\t"
       "lsr    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_5b6_state)::"r18","r19");
+  return __xor16_5b6_state;
+}
+
+void xor16_5b6_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_5b6_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_5b6_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0861, 0x10C2, 0x2184, 0x4308, 0x8610, 0x0C20, 0x1801, 0x3002,
+    0x6004, 0xC008, 0x8010, 0x0841, 0x1082, 0x2104, 0x4208, 0x8410,
+    // M^2
+    0x1401, 0x2843, 0x5086, 0xA10C, 0x4218, 0x8471, 0x10A2, 0x2144,
+    0x4288, 0x8510, 0x0200, 0x1821, 0x3042, 0x6084, 0xC108, 0x8210,
+    // M^4
+    0x2643, 0x5445, 0xA8CB, 0x5196, 0xA70C, 0x42DA, 0xBD34, 0x6228,
+    0xC450, 0x8080, 0x8510, 0xB813, 0x6827, 0xD04E, 0xA09C, 0x4518,
+    // M^8
+    0x1AEC, 0x7E17, 0xD1C9, 0x3541, 0xADCB, 0x5DDF, 0x493F, 0xE31E,
+    0x7AAC, 0x2730, 0xA354, 0x9068, 0x50D6, 0x9D8F, 0xA92F, 0x1746,
+    // M^16
+    0xF4F8, 0x6883, 0x119F, 0x4772, 0x38C2, 0x37F0, 0x338C, 0x492E,
+    0x8967, 0x9353, 0xE268, 0x6631, 0x51CD, 0x6D6D, 0xBDA1, 0x48FF,
+    // M^32
+    0x1974, 0x63A8, 0x63D0, 0x11C0, 0x48B0, 0xB16C, 0x3957, 0x5B69,
+    0x2E31, 0x9433, 0x486E, 0x5A3D, 0xBDBC, 0x7B9B, 0xF347, 0x6496,
+    // M^64
+    0x6AEB, 0xC91B, 0x1850, 0xF1B3, 0x0BCF, 0x76AB, 0xDAC0, 0x2E4B,
+    0x1D53, 0x1244, 0x30F9, 0x124D, 0x4E76, 0xAD9A, 0xCBAF, 0xD313,
+    // M^128
+    0xB65F, 0x4E2E, 0x8D34, 0x16DC, 0xA3C2, 0x005D, 0xA248, 0x15E9,
+    0x036E, 0x9EA2, 0xF15B, 0x05FA, 0x8DB0, 0x5C42, 0x1715, 0xF1E2,
+    // M^256
+    0x2DFA, 0xA88D, 0x2886, 0x6DC2, 0xC9E3, 0x2C3D, 0x8796, 0x68FA,
+    0xEA1F, 0x4DCB, 0xDB4C, 0xBEF9, 0xB05B, 0x8262, 0x798E, 0xCDB9,
+    // M^512
+    0xC235, 0xF166, 0xD46A, 0x33A7, 0xA6F7, 0x6AB7, 0x9033, 0x8AE8,
+    0xCCB7, 0xF1FD, 0xDF93, 0x9D74, 0x5940, 0x8354, 0x9A62, 0xF681,
+    // M^1024
+    0x4701, 0xA5C8, 0xD275, 0xE038, 0x6A19, 0xD42E, 0x50D2, 0xD9C3,
+    0x8F95, 0x8923, 0x5542, 0xA988, 0x02D2, 0x2965, 0xC8AA, 0xD044,
+    // M^2048
+    0xDC5F, 0x4ADF, 0xE88E, 0x6F84, 0x0C44, 0x0CD5, 0x8CB8, 0x57F9,
+    0x0C96, 0xC0BE, 0xE5B5, 0xE6C7, 0xCFE3, 0x1EF0, 0xF97B, 0x989B,
+    // M^4096
+    0x3C07, 0x198D, 0x03FB, 0x97A6, 0x6744, 0xE0A6, 0xA305, 0x770E,
+    0xFA9E, 0xFB5D, 0xF58A, 0xFF54, 0xEFAE, 0xD7FF, 0x2F8F, 0x1306,
+    // M^8192
+    0x14FE, 0x3530, 0xE006, 0x853F, 0xACC7, 0x66A8, 0xFAC6, 0x6E47,
+    0x9D4B, 0x9654, 0xF2E9, 0xC87F, 0xFA13, 0xC550, 0x1A3B, 0xF41B,
+    // M^16384
+    0x061D, 0x9A8E, 0xFE46, 0x1521, 0x5E94, 0x3606, 0xCEFF, 0x48A7,
+    0xF7E2, 0xDCB2, 0x24DF, 0x5201, 0x0241, 0xD783, 0xCAA6, 0x2BBC,
+    // M^32768
+    0x4B83, 0x9E00, 0x3483, 0xE167, 0x8AFE, 0x4967, 0xD248, 0x84D3,
+    0x1187, 0x2F3E, 0x5C64, 0x1248, 0x1450, 0x38E0, 0x75C0, 0x6580
+  };
+  __xor16_5b6_state = __xor16_jump(__xor16_5b6_state, table, n);
+  return __xor16_5b6_state;
+}
+
+uint16_t xor16_5b6_prev() {
+    __asm__ __volatile__(
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_5b6_state)::"r18","r19");
   return __xor16_5b6_state;
 }
+
+static const uint16_t __xor16_5b6_checkpoints[256] PROGMEM = {
+  0x0001, 0x2DFA, 0xC235, 0x195E, 0x4701, 0x28EC, 0xBA8E, 0x8981,
+  0xDC5F, 0xEF9F, 0x951E, 0x689B, 0x0CB9, 0xA8A9, 0xF5DD, 0xF96C,
+  0x3C07, 0xFA7D, 0x7FCA, 0xA3F5, 0xE7C1, 0x885B, 0xD580, 0x5DC5,
+  0xAC6F, 0x41F6, 0x1928, 0xA542, 0x5193, 0x07A4, 0x10D9, 0xD6EC,
+  0x14FE, 0x8C6C, 0x46E3, 0xA92F, 0xF733, 0x9A3F, 0xAB3D, 0xDB96,
+  0x3C53, 0x9C8E, 0x9D64, 0x7165, 0x0F7F, 0x601A, 0xF740, 0x7D00,
+  0xC41D, 0xCE26, 0x307F, 0x9042, 0x52F9, 0xCE94, 0x15D6, 0x278C,
+  0xD344, 0x0CA8, 0x4CB0, 0x911F, 0x9E2D, 0x111F, 0x5394, 0xE79E,
+  0x061D, 0x37DA, 0xAD61, 0x4620, 0xC334, 0xDEBB, 0x4983, 0xC0E5,
+  0x721A, 0x0AD0, 0xD5BD, 0xD0A5, 0x45D7, 0xC3A3, 0xD253, 0x82A5,
+  0xC1C9, 0xF17C, 0x4B1D, 0xC1FE, 0xB953, 0x6064, 0x78C1, 0x37D8,
+  0x05EC, 0xB746, 0x8485, 0x7B73, 0xB5A5, 0x8F68, 0xC9B1, 0x400F,
+  0xB9BD, 0x4EFC, 0x1E06, 0x182E, 0xCF56, 0xB828, 0x0086, 0xE8F1,
+  0xAFE4, 0x666D, 0xAE7E, 0xE824, 0x8C17, 0xCC1E, 0xF5A8, 0x9E58,
+  0x762B, 0x19B8, 0x045B, 0x7D8C, 0xE9A3, 0xA303, 0x6D78, 0x7BCC,
+  0xF8B2, 0x1D5E, 0x9C4D, 0xF77F, 0x58ED, 0xDCC3, 0x0BC2, 0x5ECC,
+  0x4B83, 0x8D2E, 0x83E7, 0x04CD, 0x5C9E, 0xE0B0, 0xBB71, 0xA91F,
+  0x12ED, 0x567F, 0xFD29, 0x65A1, 0xA382, 0x2878, 0x3311, 0x71F4,
+  0x839C, 0x8E30, 0x0019, 0x89DB, 0x5765, 0x1B9A, 0xCD20, 0x17A0,
+  0x8804, 0x5BC6, 0xBF9F, 0x5CCB, 0xABB9, 0x9BEA, 0x62D1, 0xBD52,
+  0x96D2, 0x6567, 0xCCE5, 0x17AF, 0x4837, 0x8F58, 0x2C6F, 0x8C4F,
+  0xEFA9, 0xF0CB, 0x81D7, 0xACD8, 0x6123, 0xB8B9, 0x8C65, 0x06DB,
+  0x58BD, 0x92B6, 0x3D06, 0x3D98, 0x7148, 0x4BFC, 0x2F55, 0x0B0A,
+  0xDC62, 0x62FF, 0x7CA6, 0xEACE, 0xC7C2, 0x8F4E, 0x6587, 0x0FB4,
+  0x67C3, 0xED6F, 0xD267, 0x4FFD, 0xD9E3, 0x16AC, 0x275F, 0x70BC,
+  0x83D7, 0xE113, 0x90DE, 0xB6A4, 0x0546, 0x36CE, 0xA61B, 0xF80A,
+  0xFDB8, 0xE942, 0x4DA8, 0xDF21, 0xC7CA, 0xE28C, 0x5620, 0x736F,
+  0x87FB, 0x5326, 0xC237, 0xB1D3, 0xB667, 0x6F5D, 0x1F46, 0x75A7,
+  0x93D2, 0x5434, 0xDFC1, 0x049B, 0x92E0, 0xF378, 0x2E50, 0xE469,
+  0x068A, 0x3B32, 0x6647, 0x470C, 0x4052, 0x9F76, 0x5DC0, 0xA913,
+  0x57A9, 0xB1B2, 0x3036, 0x57EC, 0x3358, 0xB65A, 0xE23D, 0xF6FE,
+  0xF7F2, 0x58A9, 0x73D3, 0x4F9B, 0xF243, 0xC924, 0xE46A, 0x83FD
+};
+static const uint8_t __xor16_5b6_order[256] PROGMEM = {
+    0, 146, 102, 114, 227, 131, 204,  88,  64, 232, 175,  29,  73, 183, 126,  57,
+   12,  44, 191,  30,  61, 136,  32,  54, 197, 151, 163,  99,  26,   3, 113, 149,
+  121,  98, 222, 198,  55, 141,   5, 166,   1, 230, 182, 242,  50, 142, 244, 205,
+   87,  65, 233,  16,  40, 178, 179,  95, 236,  25,  76,  67,  34,   4, 235, 164,
+   70,  82, 128, 181,  58, 210,  97, 251, 195,  28,  52, 217,  62, 225, 214, 137,
+  148, 240, 243, 249, 176, 124, 153, 132, 155, 238,  23, 127,  45,  85, 172, 158,
+  185, 161, 190, 139, 234, 105, 192,  11, 118, 221, 199, 180,  43, 143,  72, 215,
+  250, 223, 112,  86,  91, 119, 186,  47, 115,  18, 170,  79, 144, 200, 130, 255,
+   90, 216, 152,  21,   7, 147, 108, 167, 174,  33, 129, 145, 189, 165,  93,  51,
+  202,  59, 177, 228, 224,  10, 160,  37, 157, 122,  41,  42,  60, 111, 237, 117,
+  140,  19,  27, 206,  13, 239, 135,  35,  38, 156,  24, 171,  66, 106, 104, 241,
+  219,  92, 245, 220, 203,  89, 101, 173,  84,  96,   6, 134, 159, 154,  71,  80,
+   83,   2, 218,  68,  77,  48, 188, 212, 253,  94, 109, 162, 150,  49,  53, 100,
+   75,  78, 194,  56,  22,  74,  31, 196,  39,   8, 184, 125,  69, 211, 226, 133,
+  201, 246, 213, 231, 254,  63,  20, 107, 103, 209, 116, 187, 193,   9, 168, 169,
+   81, 252, 229, 110,  14, 247,  36,  46, 123, 248, 207, 120,  15,  17, 138, 208
+};
+
+uint16_t xor16_5b6_position() {
+  uint16_t saved = __xor16_5b6_state;
+  uint16_t pos = __xor16_position(saved, xor16_5b6, __xor16_5b6_checkpoints, __xor16_5b6_order);
+  __xor16_5b6_state = saved;
+  return pos;
+}
+
+void xor16_5b6_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_5b6, xor16_5b6, __xor16_5b6_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 5bb //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_5bb_state;
+uint16_t __xor16_5bb_state;
 
 bool seed_xor16_5bb(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -19,14 +20,71 @@ bool seed_xor16_5bb(uint16_t seed) {
 uint16_t xor16_5bb() {
     __asm__ __volatile__(
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_5bb_state)::"r18","r19");
+  return __xor16_5bb_state;
+}
+
+void xor16_5bb_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
@@ -41,6 +99,159 @@ uint16_t xor16_5bb() {
       "add    r19, r19"      "\n\t"
       "add    r19, r19"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_5bb_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_5bb_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0821, 0x1042, 0x2084, 0x4108, 0x8210, 0x0420, 0x0041, 0x0082,
+    0x0104, 0x0208, 0x0410, 0x0001, 0x0002, 0x0004, 0x0008, 0x0010,
+    // M^2
+    0x0C00, 0x1001, 0x2002, 0x4004, 0x8008, 0x0030, 0x0860, 0x10C0,
+    0x2180, 0x4300, 0x8600, 0x0821, 0x1042, 0x2084, 0x4108, 0x8210,
+    // M^4
+    0x8E21, 0x1C42, 0x3085, 0x610A, 0xC214, 0x8038, 0x0071, 0x08E2,
+    0x11C4, 0x2388, 0x4710, 0x0411, 0x0823, 0x1046, 0x208C, 0x4118,
+    // M^8
+    0x2F88, 0x5711, 0xAE23, 0x5C46, 0xB08D, 0x623E, 0xCC7C, 0x90F8,
+    0x21F1, 0x4BE2, 0x97C4, 0x0B25, 0x164A, 0x2495, 0x492B, 0x9256,
+    // M^16
+    0x1ED9, 0x3DB3, 0x7B67, 0xF6CE, 0xED9C, 0x519B, 0xAB36, 0x566D,
+    0xA4DB, 0x41B6, 0x8B6C, 0x82A3, 0x0D47, 0x128F, 0x251E, 0x4A3D,
+    // M^32
+    0xBDEE, 0x7BDC, 0xFFB8, 0xF770, 0xE6E0, 0xE2D7, 0xC5AF, 0x8B5E,
+    0x16BD, 0x2D7B, 0x5AF7, 0x2F17, 0x5E2F, 0xB45F, 0x60BE, 0xC97C,
+    // M^64
+    0x9F63, 0x3EC6, 0x758D, 0xE31B, 0xC637, 0xA17D, 0x42FB, 0x8DF6,
+    0x13EC, 0x27D8, 0x4FB1, 0x2513, 0x4A27, 0x944E, 0x289C, 0x5938,
+    // M^128
+    0x0FAA, 0x1755, 0x2EAB, 0x5557, 0xAAAF, 0xF2DE, 0xE5BD, 0xC37A,
+    0x86F5, 0x05EA, 0x03D5, 0xAF81, 0x5F02, 0xB605, 0x6C0A, 0xD015,
+    // M^256
+    0x5CED, 0xB1DB, 0x63B7, 0xCF6E, 0x9EDC, 0xB033, 0x6067, 0xC0CE,
+    0x899D, 0x133B, 0x2E76, 0x858B, 0x0B16, 0x1E2C, 0x3459, 0x68B3,
+    // M^512
+    0x741C, 0xE839, 0xD073, 0xA0E7, 0x49CF, 0xBE50, 0x74A0, 0xE141,
+    0xCA83, 0x9D07, 0x3A0E, 0x2DCE, 0x539D, 0xAF3A, 0x5674, 0xACE9,
+    // M^1024
+    0xA986, 0x5B0D, 0xB61A, 0x6434, 0xC869, 0xE7E6, 0xCFCC, 0x9F98,
+    0x3730, 0x6E61, 0xD4C3, 0x7F35, 0xFE6B, 0xFCD6, 0xF1AC, 0xEB59,
+    // M^2048
+    0x2D05, 0x520B, 0xA416, 0x402C, 0x8058, 0x3114, 0x6A28, 0xD450,
+    0xA0A0, 0x4941, 0x9282, 0x31A5, 0x634A, 0xC694, 0x8528, 0x0A50,
+    // M^4096
+    0x4C00, 0x9001, 0x2803, 0x5006, 0xA00C, 0x2130, 0x4A60, 0x94C0,
+    0x2980, 0x5300, 0xA600, 0x6929, 0xD252, 0xA4A5, 0x494A, 0x9294,
+    // M^8192
+    0x8663, 0x0CC6, 0x118D, 0x231A, 0x4E34, 0x0C19, 0x1833, 0x3866,
+    0x70CC, 0xE198, 0xC331, 0x9070, 0x20E1, 0x41C2, 0x8384, 0x0F09,
+    // M^16384
+    0xB32F, 0x6E5F, 0xDCBF, 0xB17E, 0x62FD, 0xB80C, 0x7819, 0xF832,
+    0xF065, 0xE8CB, 0xD997, 0x75F6, 0xEBED, 0xDFDB, 0xB7B6, 0x676C,
+    // M^32768
+    0x4349, 0x8692, 0x0524, 0x0249, 0x0492, 0x4B6D, 0x96DA, 0x25B4,
+    0x4B69, 0x96D2, 0x25A4, 0x4248, 0x8490, 0x0120, 0x0240, 0x0480
+  };
+  __xor16_5bb_state = __xor16_jump(__xor16_5bb_state, table, n);
+  return __xor16_5bb_state;
+}
+
+uint16_t xor16_5bb_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_5bb_state)::"r18","r19");
   return __xor16_5bb_state;
 }
+
+static const uint16_t __xor16_5bb_checkpoints[256] PROGMEM = {
+  0x0001, 0x5CED, 0x741C, 0x3D10, 0xA986, 0x682B, 0x3D95, 0x5612,
+  0x2D05, 0x0316, 0xD616, 0x2601, 0x7F8C, 0x7C2F, 0x7B42, 0xEFF2,
+  0x4C00, 0x9FA4, 0x41B4, 0x3052, 0x5A5A, 0x29F1, 0xC091, 0x5E15,
+  0x260F, 0x628E, 0xE482, 0x1DA5, 0x66D1, 0x75A0, 0xF675, 0x054F,
+  0x8663, 0x689C, 0x5D35, 0x0C9A, 0x8B5A, 0xF790, 0xA312, 0xC33E,
+  0xF5A1, 0xC22B, 0xDDBA, 0xE508, 0x2A43, 0x05CD, 0xF776, 0x61E4,
+  0xD0C5, 0xC80F, 0x988E, 0x3BE2, 0xAB56, 0x4565, 0x7CBC, 0xC866,
+  0xDB59, 0x25E9, 0x3ADE, 0xA0FD, 0x08ED, 0x6525, 0x02F7, 0x13FC,
+  0xB32F, 0x16F3, 0x552B, 0x0ACF, 0x77F6, 0xC999, 0x9D6D, 0x61A5,
+  0xEC4F, 0xC8B3, 0xDA76, 0x5DA8, 0xA2BC, 0x275C, 0xF89E, 0x8F4B,
+  0x1BD7, 0xA4CF, 0xB9AF, 0x408D, 0x04A3, 0xB3BD, 0xF93A, 0x159C,
+  0x5E36, 0x7B0A, 0x40FB, 0x9847, 0x08C8, 0xEA4C, 0x18C8, 0xE15A,
+  0x4B55, 0xEA95, 0xB53E, 0xE98F, 0xCFF1, 0xBF1A, 0xACBB, 0x111B,
+  0x3E0F, 0xEC13, 0x9AD1, 0x978D, 0xE78F, 0x7737, 0x35DD, 0x7C90,
+  0xD48C, 0x159D, 0x02DB, 0x0F16, 0x7DEB, 0x31C1, 0x60E3, 0xD7D9,
+  0x4EDA, 0xCC5F, 0x4843, 0x3C83, 0x933F, 0x9603, 0xB3DE, 0xC458,
+  0x4349, 0x5D1B, 0xA1AB, 0xADA7, 0xAA83, 0xCDD7, 0xCE7E, 0xB7A6,
+  0x6BC8, 0x5A9F, 0xB602, 0xF11F, 0x1F7E, 0x69C7, 0x084B, 0xC7B4,
+  0x65AC, 0x51BA, 0x2646, 0x916A, 0x44D9, 0xB7D9, 0x64AF, 0x3511,
+  0x70E0, 0x31F9, 0x8162, 0x80A1, 0x44A3, 0x87E4, 0xAF4E, 0x3AA1,
+  0xAF9A, 0x6763, 0xA3C7, 0xC211, 0x8DE0, 0x5A49, 0x5A1B, 0x157B,
+  0xC02D, 0x1CED, 0x4045, 0x6B64, 0x86BB, 0x9987, 0x21FC, 0xB52E,
+  0x7753, 0x863E, 0x6613, 0x64D2, 0x8BAD, 0xF757, 0x8D3A, 0x1A89,
+  0xCEEB, 0xD6EE, 0x6729, 0xBD15, 0xFE6F, 0x60AD, 0xAABC, 0xA2D7,
+  0xD550, 0x0EAC, 0x64E2, 0xA542, 0x00C8, 0x6FC7, 0x3506, 0x60BD,
+  0x3460, 0xEB18, 0x0C59, 0xC6C5, 0xFE54, 0x6C1A, 0x61E1, 0xEF9F,
+  0x6C60, 0x51DC, 0x247E, 0x63D0, 0x8EA6, 0x72E4, 0x4175, 0xCC16,
+  0xBBA7, 0x9CD8, 0x3943, 0x947D, 0xF36F, 0x42CD, 0x77FF, 0x5A1A,
+  0x4996, 0xB431, 0x21FD, 0xE9C3, 0x034F, 0xBB2E, 0xCF95, 0x0CF9,
+  0xB638, 0xA145, 0xA03F, 0x199F, 0x18FD, 0xF0EF, 0x18A5, 0xC13A,
+  0x852D, 0x8F5F, 0xE6BC, 0x3D73, 0x94E4, 0x3EFE, 0x3EB8, 0x8CB3,
+  0xC059, 0x31D2, 0x1309, 0x0233, 0xD0E2, 0xF6BD, 0x6A88, 0xB365
+};
+static const uint8_t __xor16_5bb_order[256] PROGMEM = {
+    0, 196, 251, 114,  62,   9, 228,  84,  31,  45, 142,  92,  60,  67, 202,  35,
+  231, 193, 115, 103, 250,  63, 167,  87, 113,  65, 238,  94, 236, 235, 183,  80,
+  169,  27, 140, 174, 226, 210,  57,  11,  24, 146,  77,  21,  44,   8,  19, 117,
+  249, 153, 200, 198, 151, 110, 218, 159,  58,  51, 123,   3, 243,   6, 104, 246,
+  245, 170,  83,  90, 214,  18, 221, 128, 156, 148,  53, 122, 224,  96,  16, 120,
+  145, 209,  66,   7, 223, 166, 165,  20, 137,   1, 129,  34,  75,  23,  88, 189,
+  199, 118,  71, 206,  47,  25, 211, 150, 179, 194,  61, 144, 178,  28, 186, 161,
+    5,  33, 141, 254, 171, 136, 205, 208, 197, 152, 213,   2,  29, 109, 176,  68,
+  222,  89,  14,  13, 111,  54, 116,  12, 155, 154, 240, 177,  32, 172, 157,  36,
+  180, 247, 182, 164, 212,  79, 241, 147, 124, 219, 244, 125, 107,  91,  50, 173,
+  106, 217,  70,  17, 234,  59, 233, 130,  76, 191,  38, 162,  81, 195,   4, 132,
+  190,  52, 102, 131, 158, 160,  64, 255,  85, 126, 225, 175,  98, 138, 232, 135,
+  149,  82, 229, 216, 187, 101, 168, 248,  22, 239, 163,  41,  39, 127, 203, 143,
+   49,  55,  73,  69, 215, 121, 133, 134, 184, 230, 100,  48, 252, 112, 192,  10,
+  185, 119,  74,  56,  42,  95,  26,  43, 242, 108,  99, 227,  93,  97, 201, 105,
+   72, 207,  15, 237, 139, 220,  40,  30, 253, 181,  46,  37,  78,  86, 204, 188
+};
+
+uint16_t xor16_5bb_position() {
+  uint16_t saved = __xor16_5bb_state;
+  uint16_t pos = __xor16_position(saved, xor16_5bb, __xor16_5bb_checkpoints, __xor16_5bb_order);
+  __xor16_5bb_state = saved;
+  return pos;
+}
+
+void xor16_5bb_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_5bb, xor16_5bb, __xor16_5bb_checkpoints);
+}
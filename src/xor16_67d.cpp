@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 67d //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_67d_state;
+uint16_t __xor16_67d_state;
 
 bool seed_xor16_67d(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -18,27 +19,88 @@ bool seed_xor16_67d(uint16_t seed) {
 
 uint16_t xor16_67d() {
     __asm__ __volatile__(
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_67d_state)::"r18","r19");
+  return __xor16_67d_state;
+}
+
+void xor16_67d_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
+      "lsl    r18"           "\n\t"
       "mov    r18, r19"      "\n\t"
-      "adc    r18, r18"      "\n\t"
-      "sbc    r19, r19"      "\n\t"
-      "neg    r19"           "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "mov    r19, %A0"      "\n\t"
@@ -46,6 +108,168 @@ uint16_t xor16_67d() {
       "add    r19, r19"      "\n\t"
       "andi   r19, 0xE0"     "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_67d_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_67d_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x2041, 0x6083, 0xC106, 0x820C, 0x0418, 0x0830, 0x1060, 0x00C1,
+    0x0182, 0x0304, 0x0408, 0x0810, 0x1020, 0x2040, 0x4080, 0x8100,
+    // M^2
+    0x1061, 0x20C3, 0x6187, 0xC10E, 0x821C, 0x0438, 0x0870, 0x30E0,
+    0x61C0, 0xC380, 0x8604, 0x0C08, 0x1810, 0x3020, 0x4041, 0x8082,
+    // M^4
+    0x0439, 0x3812, 0x7064, 0x2149, 0x6197, 0xC12E, 0x825C, 0x1498,
+    0x2931, 0x5263, 0xA481, 0x4B02, 0x9604, 0x2C08, 0x5850, 0x90A1,
+    // M^8
+    0x2148, 0xA88B, 0xD14A, 0xA215, 0x6429, 0x49D1, 0x7024, 0x66C3,
+    0xEABB, 0xE36E, 0x0889, 0x5012, 0x8023, 0xE2C2, 0x669D, 0xD72A,
+    // M^16
+    0xDA48, 0x28EF, 0xA195, 0x42AD, 0x465A, 0x8FB2, 0x9CE7, 0xF09C,
+    0x80E4, 0xB881, 0xB58C, 0x2A1C, 0x1738, 0x0E77, 0x3F45, 0x7387,
+    // M^32
+    0x172D, 0xD63D, 0x300F, 0xC19A, 0x82B7, 0xC5E9, 0x4BD4, 0x0073,
+    0x31DB, 0x6A00, 0x4C04, 0x3988, 0x1194, 0x212C, 0x5980, 0xBDC1,
+    // M^64
+    0x251A, 0x7237, 0x003D, 0x40F9, 0x61F3, 0xC167, 0xC2CC, 0xCD9A,
+    0xC8F9, 0x2B24, 0x1C03, 0xF902, 0x9284, 0x248B, 0x4034, 0x95A4,
+    // M^128
+    0xA34C, 0x2A9B, 0xC54A, 0x8A15, 0x54A9, 0x49D2, 0xB126, 0x66CF,
+    0xE6B3, 0xFF0E, 0x20A8, 0x2053, 0xE1A3, 0xE2C6, 0xE09D, 0xDF1A,
+    // M^256
+    0xDA18, 0x0C3F, 0xE834, 0x32E8, 0x27D2, 0x8FA6, 0x9CCF, 0xCC9C,
+    0xF084, 0x4060, 0x47CE, 0x8E9E, 0x9D38, 0x1A77, 0x0334, 0x3345,
+    // M^512
+    0x768D, 0x6DDF, 0xE4D8, 0x2A32, 0x96E3, 0xEDC0, 0x3B85, 0xC8B3,
+    0x9396, 0x105D, 0x72AE, 0x87D8, 0x0D35, 0x596E, 0xF0A4, 0x9948,
+    // M^1024
+    0xB6D8, 0x7F47, 0x0DCB, 0xD817, 0xF32A, 0xA554, 0x0AAE, 0x46F6,
+    0xC0E1, 0x1834, 0x32E4, 0x27CA, 0x8F96, 0x9CAF, 0xFC1C, 0x9184,
+    // M^2048
+    0xCF08, 0xEC24, 0x881F, 0xF2BA, 0xA470, 0x0B61, 0x76C7, 0xBE66,
+    0x324C, 0xF3E9, 0xEFCA, 0x9D96, 0x9B2F, 0xF4DD, 0x4D79, 0x95CE,
+    // M^4096
+    0x99F4, 0xDD48, 0xF5A1, 0x4B45, 0x570F, 0xEE9D, 0x5D3A, 0x6214,
+    0x9079, 0x8892, 0x49AC, 0x30DC, 0x003A, 0x81F3, 0xE90D, 0x8D47,
+    // M^8192
+    0x5EC5, 0x9B06, 0x292B, 0xF055, 0x4228, 0x0650, 0x2FA1, 0x42C2,
+    0xBB64, 0x55C8, 0x7BC5, 0x570C, 0x2F9F, 0xDF3E, 0x620C, 0x8869,
+    // M^16384
+    0x2E1F, 0xAC7B, 0x0090, 0x00A3, 0xC1C1, 0x4384, 0x070C, 0xC1A1,
+    0xC1B2, 0x1004, 0x3180, 0x0184, 0x010C, 0x019F, 0x3184, 0x5804,
+    // M^32768
+    0x6209, 0x6E11, 0x0060, 0x0041, 0x4080, 0x2103, 0xE005, 0x0408,
+    0x47AD, 0x019C, 0x0080, 0x0083, 0xC181, 0x4385, 0x0010, 0x319C
+  };
+  __xor16_67d_state = __xor16_jump(__xor16_67d_state, table, n);
+  return __xor16_67d_state;
+}
+
+uint16_t xor16_67d_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_67d_state)::"r18","r19");
   return __xor16_67d_state;
 }
+
+static const uint16_t __xor16_67d_checkpoints[256] PROGMEM = {
+  0x0001, 0xDA18, 0x768D, 0x4F8D, 0xB6D8, 0xF6CD, 0xE007, 0x1415,
+  0xCF08, 0x7B2D, 0x3563, 0xF54B, 0x7874, 0xD66A, 0x8759, 0x9782,
+  0x99F4, 0xC074, 0xECFE, 0xCD92, 0xEED4, 0x3C83, 0x54A4, 0x72CC,
+  0x4E94, 0x897E, 0xAF07, 0x6E95, 0x4911, 0x80E4, 0x0484, 0x6366,
+  0x5EC5, 0x7543, 0x79D9, 0x6510, 0x89DB, 0xDE11, 0xD9B3, 0x619C,
+  0xD855, 0xAAE6, 0xDC32, 0xC052, 0x8753, 0xA955, 0xDE19, 0xEB5B,
+  0x4BAE, 0xA897, 0x72F1, 0xE624, 0x4A3A, 0x5B69, 0x5BEF, 0x7378,
+  0x32CC, 0x4DA0, 0x79DA, 0xB337, 0x9289, 0xCA71, 0x102C, 0xC842,
+  0x2E1F, 0xB86E, 0xFF1E, 0x3FBB, 0x7EDC, 0xA016, 0xEAEB, 0xDFC2,
+  0x8891, 0x8C8D, 0x364D, 0x1CEA, 0xB54A, 0xA158, 0x5043, 0xD4E4,
+  0xDD46, 0xEC59, 0xB0BB, 0x342D, 0x4FE3, 0x7352, 0x83BD, 0xE78D,
+  0x1174, 0xB133, 0x3ADD, 0x3EF4, 0x1E6C, 0xDDBD, 0xF0B1, 0x09CE,
+  0xF8AA, 0x444D, 0xD8F1, 0x01E8, 0x1D99, 0xA752, 0x693A, 0xF1FA,
+  0x814A, 0x61D9, 0x76B6, 0x0336, 0xFC9B, 0x71EF, 0xA7F1, 0xFC27,
+  0xCFDB, 0xDA8B, 0x4BE4, 0x0A8F, 0x0E99, 0x8A8E, 0xE7C4, 0x654B,
+  0xD609, 0x4217, 0x5A95, 0x8990, 0xA611, 0xD356, 0x42BB, 0xC373,
+  0x6209, 0xB1D3, 0xE528, 0x2002, 0x1648, 0x34B1, 0x7E71, 0xE3E8,
+  0x77FF, 0x878D, 0x0837, 0x18F9, 0x0371, 0x5E47, 0xB5E0, 0xDCB5,
+  0x32DD, 0xB06A, 0x99B4, 0x5CBB, 0xD77B, 0x8A17, 0xE47A, 0x67A4,
+  0x4567, 0x9904, 0x3853, 0x64EB, 0x65B7, 0xF4F2, 0x04E8, 0xAAD3,
+  0x466A, 0x2924, 0x03FF, 0x4438, 0xDE66, 0xD31B, 0xDEB0, 0x4091,
+  0x3262, 0xD879, 0xFF9C, 0xFF18, 0xDBB0, 0xF7DB, 0xD35A, 0x9867,
+  0x0D99, 0x3A6A, 0x640F, 0x5276, 0x0EDC, 0x246D, 0x4E14, 0x45E2,
+  0x67B4, 0x62B5, 0x0FE7, 0x9852, 0x97C1, 0xD31C, 0xE0A3, 0xBF1B,
+  0x0EA3, 0x1C2D, 0xDB0A, 0xADE4, 0x2727, 0x5CE8, 0xBA41, 0x3C23,
+  0x179E, 0x57BF, 0x0135, 0x6ADC, 0x7AE0, 0x9570, 0x2D8C, 0x35E3,
+  0x39D7, 0xB0C7, 0xDA4A, 0xC1AF, 0x8F34, 0x0AB1, 0x700E, 0x5298,
+  0x07CA, 0x99AE, 0x45BE, 0x0675, 0x0139, 0xB000, 0xB40A, 0xCD13,
+  0xF850, 0x82BD, 0x1709, 0x82E2, 0xA0EF, 0xFA3C, 0x0B68, 0x1FFB,
+  0xF864, 0xC2FD, 0x88F2, 0x49C3, 0xFB5A, 0x0C8E, 0xD32F, 0x9EF0,
+  0xDF6A, 0xF943, 0x83CC, 0x092E, 0x275F, 0x5ABB, 0xD0D5, 0xE8E4,
+  0x9359, 0x4D74, 0xE66F, 0x323A, 0x518C, 0x78C8, 0x685E, 0xFA23
+};
+static const uint8_t __xor16_67d_order[256] PROGMEM = {
+    0, 202, 220,  99, 107, 140, 162,  30, 158, 219, 216, 138, 243,  95, 115, 213,
+  230, 237, 176, 116, 192, 180, 186,  62,  88,   7, 132, 226, 200, 139, 193,  75,
+  100,  92, 231, 131, 181, 196, 244, 161, 206,  64, 251, 168,  56, 144,  83, 133,
+   10, 207,  74, 154, 208, 177,  90, 199,  21,  91,  67, 167, 121, 126, 163,  97,
+  152, 218, 183, 160,  28, 235,  52,  48, 114, 249,  57, 182,  24,   3,  84,  78,
+  252, 179, 215,  22, 201, 122, 245,  53,  54, 147, 197, 141,  32,  39, 105, 128,
+  185,  31, 178, 155,  35, 119, 156, 151, 184, 254, 102, 203,  27, 214, 109,  23,
+   50,  85,  55,  33,   2, 106, 136,  12, 253,  34,  58, 204,   9, 134,  68,  29,
+  104, 225, 227,  86, 242,  44,  14, 137,  72, 234,  25, 123,  36, 149, 117,  73,
+  212,  60, 248, 205,  15, 188, 187, 175, 153, 217, 146,  16, 239,  69, 228,  77,
+  124, 101, 110,  49,  45, 159,  41, 195,  26, 221, 145,  82, 209,  89, 129,  59,
+  222,  76, 142,   4,  65, 198, 191,  43,  17, 211, 233, 127,  63,  61, 223,  19,
+    8, 112, 246, 165, 189, 238, 125, 174,  79, 120,  13, 148,  40, 169,  98,  38,
+    1, 210, 113, 194, 172,  42, 143,  80,  93,  37,  46, 164, 166, 240,  71,   6,
+  190, 135, 150, 130,  51, 250,  87, 118, 247,  70,  47,  81,  18,  20,  94, 103,
+  157,  11,   5, 173, 224, 232,  96, 241, 255, 229, 236, 111, 108, 171,  66, 170
+};
+
+uint16_t xor16_67d_position() {
+  uint16_t saved = __xor16_67d_state;
+  uint16_t pos = __xor16_position(saved, xor16_67d, __xor16_67d_checkpoints, __xor16_67d_order);
+  __xor16_67d_state = saved;
+  return pos;
+}
+
+void xor16_67d_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_67d, xor16_67d, __xor16_67d_checkpoints);
+}
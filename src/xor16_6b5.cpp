@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 6b5 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_6b5_state;
+uint16_t __xor16_6b5_state;
 
 bool seed_xor16_6b5(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -18,19 +19,56 @@ bool seed_xor16_6b5(uint16_t seed) {
 
 uint16_t xor16_6b5() {
     __asm__ __volatile__(
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_6b5_state)::"r18","r19");
+  return __xor16_6b5_state;
+}
+
+void xor16_6b5_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "mov    r18, %B0"      "\n\t"
@@ -39,18 +77,209 @@ uint16_t xor16_6b5() {
       "lsr    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_6b5_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_6b5_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0861, 0x10C2, 0x2184, 0x4308, 0x8610, 0x0C01, 0x1802, 0x3004,
+    0x6008, 0xC010, 0x8400, 0x0821, 0x1042, 0x2084, 0x4108, 0x8210,
+    // M^2
+    0x1443, 0x2886, 0x510C, 0xA218, 0x4010, 0x8440, 0x08A1, 0x1142,
+    0x2284, 0x4508, 0x0610, 0x0C41, 0x1882, 0x3104, 0x6208, 0xC410,
+    // M^4
+    0x2AF6, 0x558D, 0xAB1A, 0x5214, 0x2218, 0xCAA1, 0x8D00, 0x1A21,
+    0x3442, 0xE484, 0x0308, 0x16B3, 0x2D07, 0x5A0E, 0xB41C, 0xE018,
+    // M^8
+    0x2936, 0x6788, 0x59E2, 0xF49D, 0xCE86, 0x5C45, 0xC1E1, 0x3F67,
+    0xAC8C, 0xBC39, 0x82D2, 0x4768, 0xAF96, 0xC7AF, 0x4F0F, 0x7E06,
+    // M^16
+    0x80E2, 0xD13D, 0xCE36, 0xAE4A, 0x4987, 0x9416, 0x1670, 0x37CE,
+    0xEE0B, 0x9CED, 0x95B7, 0xB451, 0xA32D, 0x238D, 0x79C1, 0x60DF,
+    // M^32
+    0x044A, 0x6937, 0x668F, 0x975E, 0x8BBC, 0x00C9, 0x6196, 0xF70E,
+    0x780D, 0xB722, 0xCDF8, 0xAADD, 0x453C, 0x863B, 0x0267, 0x03D6,
+    // M^64
+    0x5207, 0xD60B, 0x9524, 0x36F1, 0xEB8E, 0x058C, 0x8F5B, 0x5887,
+    0x9E26, 0xABF8, 0x942A, 0x70AD, 0xCD36, 0x085A, 0xDD8F, 0xDDB3,
+    // M^128
+    0xAA69, 0x4025, 0x8A21, 0x9167, 0x604C, 0xF15E, 0xDAC2, 0x29BB,
+    0x1959, 0x9FB5, 0x61D9, 0xB43A, 0xD7B0, 0xF482, 0xC8F5, 0x8522,
+    // M^256
+    0x4ABD, 0x19E3, 0xF59A, 0x003A, 0xFDF3, 0x9651, 0x02B4, 0x9A63,
+    0xFB53, 0x997C, 0x8D15, 0x8799, 0xC5FB, 0x66A2, 0xBBCE, 0x4CD9,
+    // M^512
+    0xEBF7, 0xE4E9, 0x5C41, 0x727B, 0x05BA, 0x28B1, 0x9D27, 0x507C,
+    0x1DE1, 0x695E, 0xFFD2, 0x8EF4, 0x2140, 0xDCD4, 0x7EA2, 0x9EE1,
+    // M^1024
+    0x75D3, 0xBF23, 0x5814, 0x2721, 0x09D6, 0xC4A0, 0xA888, 0xC1F4,
+    0x439A, 0x632D, 0x3446, 0x3A88, 0x5C12, 0x2485, 0x076A, 0xA9C4,
+    // M^2048
+    0xA27B, 0xF17A, 0x3032, 0x8107, 0xFE8F, 0x9FBC, 0x511C, 0x112A,
+    0x77FD, 0xCD1E, 0x036E, 0xC7E7, 0xE343, 0xFCF0, 0xE0DB, 0xC53B,
+    // M^4096
+    0x16FC, 0x0DFC, 0x8FFA, 0xD1F5, 0xC0DA, 0x993E, 0x3BDF, 0x7B7F,
+    0x74AE, 0x2854, 0x340C, 0x20D4, 0x61EE, 0xDFDF, 0xB5AF, 0xE246,
+    // M^8192
+    0x3AFD, 0x273D, 0x6F29, 0xC2EB, 0x0B9A, 0xDDC5, 0x076A, 0x5084,
+    0x8E20, 0x8BF4, 0xD432, 0xD05F, 0x94B3, 0xBB50, 0xBB9B, 0x19BB,
+    // M^16384
+    0x62C6, 0x2BD6, 0x24A1, 0x7CD4, 0x6B43, 0xBEE4, 0xEE9F, 0x1085,
+    0x4BE7, 0x22A8, 0x13C3, 0x8A61, 0xC221, 0xEF23, 0x67E6, 0x933C,
+    // M^32768
+    0x5B00, 0x9623, 0x3047, 0x62BE, 0xCC64, 0x616B, 0xCA50, 0x94C3,
+    0xA987, 0x1F3E, 0x1C64, 0x0948, 0x0A50, 0x1CE0, 0xBDC0, 0xB580
+  };
+  __xor16_6b5_state = __xor16_jump(__xor16_6b5_state, table, n);
+  return __xor16_6b5_state;
+}
+
+uint16_t xor16_6b5_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_6b5_state)::"r18","r19");
   return __xor16_6b5_state;
 }
+
+static const uint16_t __xor16_6b5_checkpoints[256] PROGMEM = {
+  0x0001, 0x4ABD, 0xEBF7, 0x21B2, 0x75D3, 0x58AB, 0xA6FA, 0xD4BE,
+  0xA27B, 0x8975, 0xE622, 0x0A6E, 0x6643, 0x98EF, 0xA6C3, 0xF59B,
+  0x16FC, 0xD747, 0x79A6, 0x8416, 0xD046, 0xDC21, 0xE48C, 0x7363,
+  0xBD03, 0x4D01, 0x00AC, 0xF992, 0x56F7, 0x3FED, 0x7A61, 0xD82A,
+  0x3AFD, 0xF1D4, 0x3FA3, 0x9496, 0x8FDE, 0xAD1D, 0x994A, 0xEE85,
+  0x2701, 0xC325, 0xBC4E, 0x0BFB, 0x45A7, 0x677E, 0xB703, 0x53E4,
+  0xE706, 0x92F6, 0x0F52, 0x8E07, 0x79ED, 0xD5C6, 0x3004, 0x56C3,
+  0xA1D5, 0x0B2B, 0x2083, 0xAF9F, 0x83B6, 0x334E, 0x2F81, 0xDEDF,
+  0x62C6, 0x30BE, 0xBEDB, 0x4A30, 0xCE89, 0xB403, 0x31CB, 0x93B9,
+  0x504B, 0x2FE5, 0xBFA0, 0x8B11, 0x1E21, 0x8AE7, 0xFA7E, 0xCFFE,
+  0x8082, 0xCF59, 0x2A74, 0xE4CB, 0xD713, 0x737B, 0x40CA, 0x3AC0,
+  0x256B, 0xD765, 0xF614, 0x484E, 0xD2A0, 0xA7A2, 0xD090, 0x557C,
+  0x94C5, 0x23C7, 0x3A9E, 0x366F, 0x852B, 0xFFAA, 0x2906, 0xF611,
+  0xF769, 0x6516, 0xBAA0, 0xFD57, 0xFC12, 0xBAD2, 0x8DA2, 0xA8D7,
+  0x6E02, 0x577F, 0x5EE7, 0x4587, 0xF12F, 0x9FB2, 0x09A3, 0x23A6,
+  0xE4C6, 0x680E, 0xB6B6, 0xE651, 0x3026, 0xD971, 0x6D8D, 0x09CD,
+  0x5B00, 0x9B83, 0xA5A9, 0x1A88, 0x4147, 0xE4ED, 0xAD3B, 0xE362,
+  0x7E9C, 0x1957, 0xE0B2, 0x7997, 0xA509, 0x16BA, 0x398A, 0x5C29,
+  0xA86F, 0x9FF9, 0x5873, 0xC3E4, 0x6E24, 0x2D57, 0xCEFE, 0x7BD1,
+  0xD2B8, 0x5A6B, 0xA751, 0x70BB, 0xBA32, 0x8324, 0x4D3D, 0x9EAE,
+  0xFAA3, 0x15C7, 0x8DAE, 0x5D77, 0x4038, 0xD056, 0x21D2, 0xE136,
+  0xED3D, 0xB4D5, 0xB896, 0xE3F0, 0x00EF, 0xA878, 0xC4CE, 0x0E96,
+  0x1819, 0xF516, 0x3382, 0x42F6, 0x3DBE, 0x4F04, 0x26F7, 0x277A,
+  0xF957, 0x7107, 0x4500, 0xCD88, 0x9C91, 0xAE83, 0x70B6, 0x052F,
+  0x46E9, 0xEBA6, 0x9448, 0x06B9, 0xAF2F, 0x7277, 0x4E39, 0x091B,
+  0xD25D, 0xEBCA, 0xF50D, 0x9D15, 0x3A29, 0x616A, 0xAB03, 0x9C93,
+  0xB760, 0x945F, 0x5D8E, 0xF9CA, 0xA98A, 0xD50B, 0x17CE, 0x5E55,
+  0xADA5, 0x68B1, 0xE189, 0xBA02, 0xE886, 0x6036, 0x5AB7, 0x37D5,
+  0x9660, 0x09AE, 0x9CBB, 0x210B, 0xCE95, 0xBC50, 0x1A4B, 0x8ACE,
+  0x26A8, 0x7EC3, 0x40EE, 0x590B, 0x519B, 0xB192, 0x6AA0, 0xCFBB,
+  0x3D11, 0xE5C8, 0x7F1E, 0x6184, 0x49C6, 0xB3AA, 0x9844, 0xF995,
+  0xF033, 0x6CB2, 0x3FC2, 0x4ACE, 0xD1BF, 0x9E80, 0x80B1, 0xF7A5
+};
+static const uint8_t __xor16_6b5_order[256] PROGMEM = {
+    0,  26, 172, 191, 195, 199, 118, 225, 127,  11,  57,  43, 175,  50, 161, 141,
+   16, 214, 176, 137, 230, 131,  76,  58, 227,   3, 166, 119,  97,  88, 232, 182,
+   40, 183, 102,  82, 149,  62,  73,  54, 124,  65,  70,  61, 178,  99, 223, 142,
+  204,  98,  87,  32, 240, 180,  34, 250,  29, 164,  86, 234, 132, 179, 186, 115,
+   44, 192,  91, 244,  67,   1, 251,  25, 158, 198, 181,  72, 236,  47,  95,  55,
+   28, 113, 146,   5, 235, 153, 222, 128, 143, 163, 210, 215, 114, 221, 205, 243,
+   64, 105,  12,  45, 121, 217, 238, 249, 126, 112, 148, 190, 155, 185, 197,  23,
+   85,   4, 139,  18,  52,  30, 151, 136, 233, 242,  80, 254, 157,  60,  19, 100,
+    9, 231,  77,  75, 110, 162,  51,  36,  49,  71, 194, 209,  35,  96, 224, 246,
+   13,  38, 129, 188, 207, 226, 203, 253, 159, 117, 145,  56,   8, 140, 130,  14,
+    6, 154,  93, 144, 173, 111, 212, 206,  37, 134, 216, 189, 196,  59, 237, 245,
+   69, 169, 122,  46, 208, 170, 219, 156, 106, 109,  42, 229,  24,  66,  74,  41,
+  147, 174, 187,  68, 228, 150,  81, 239,  79,  20, 165,  94, 252, 200,  92, 152,
+    7, 213,  53,  84,  17,  89,  31, 125,  21,  63, 138, 167, 218, 135, 171,  22,
+  120,  83, 133, 241,  10, 123,  48, 220, 193, 201,   2, 168,  39, 248, 116,  33,
+  202, 177,  15, 103,  90, 104, 255, 184,  27, 247, 211,  78, 160, 108, 107, 101
+};
+
+uint16_t xor16_6b5_position() {
+  uint16_t saved = __xor16_6b5_state;
+  uint16_t pos = __xor16_position(saved, xor16_6b5, __xor16_6b5_checkpoints, __xor16_6b5_order);
+  __xor16_6b5_state = saved;
+  return pos;
+}
+
+void xor16_6b5_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_6b5, xor16_6b5, __xor16_6b5_checkpoints);
+}
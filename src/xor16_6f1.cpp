@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 6f1 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_6f1_state;
+uint16_t __xor16_6f1_state;
 
 bool seed_xor16_6f1(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -18,30 +19,252 @@ bool seed_xor16_6f1(uint16_t seed) {
 
 uint16_t xor16_6f1() {
     __asm__ __volatile__(
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
       "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_6f1_state)::"r18","r19");
+  return __xor16_6f1_state;
+}
+
+void xor16_6f1_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_6f1_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_6f1_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x00C3, 0x0186, 0x030C, 0x0618, 0x0C30, 0x1860, 0x30C0, 0x6180,
+    0xC300, 0x8603, 0x0C00, 0x1800, 0x3000, 0x6000, 0xC000, 0x8003,
+    // M^2
+    0x5005, 0xA00A, 0x4017, 0x802B, 0x0050, 0x00A0, 0x0140, 0x0280,
+    0x0500, 0x0B45, 0x1400, 0x2800, 0x5000, 0xA000, 0x4003, 0x8146,
+    // M^4
+    0x0011, 0x0167, 0xF04B, 0xF1C2, 0x0110, 0x0220, 0x0440, 0x09C5,
+    0x1100, 0x3717, 0x4400, 0x8800, 0x1003, 0x2146, 0xB00C, 0x651B,
+    // M^8
+    0x0101, 0xE65D, 0x10A6, 0xF9B0, 0x1010, 0x3537, 0x4040, 0x64DF,
+    0x0103, 0xA37F, 0xF40C, 0xED1B, 0x1175, 0xC52A, 0x55D7, 0x35EE,
+    // M^16
+    0x0002, 0x4A27, 0xB666, 0x1986, 0x0165, 0xF38D, 0x1597, 0x5E34,
+    0xE65F, 0x3995, 0xA97C, 0xB3FB, 0x64B6, 0xBFEC, 0x72D8, 0x3FB3,
+    // M^32
+    0x4A27, 0xF778, 0x6E5B, 0x9367, 0xB621, 0xB82D, 0x8887, 0x71F2,
+    0x9359, 0x67CB, 0x9D64, 0xD1CB, 0x34D5, 0x366A, 0xC357, 0xF8EE,
+    // M^64
+    0x1E7E, 0x451C, 0xCEC7, 0xDB07, 0xF2F4, 0x24AC, 0x8BD3, 0x52B0,
+    0xDF4F, 0x4B86, 0x4D3C, 0x4B78, 0xF4F3, 0xACA5, 0x2289, 0xA3D1,
+    // M^128
+    0xB466, 0x57CE, 0x805C, 0x3FBF, 0x5374, 0x8245, 0x0C95, 0x1914,
+    0x2257, 0x2453, 0x381A, 0x7BB4, 0xC06B, 0xAF95, 0x70EA, 0xAE54,
+    // M^256
+    0xA0F2, 0x7333, 0x4E56, 0xBE3A, 0xEB7D, 0xB2A8, 0x3DF4, 0x4AA0,
+    0xB7D3, 0x2BC6, 0x2F4F, 0x2ADD, 0x8C79, 0x3A31, 0xE0A1, 0xB981,
+    // M^512
+    0xDE02, 0x40E8, 0x2519, 0xB541, 0xE166, 0x623D, 0x64DE, 0x19B2,
+    0xF37B, 0xC6C8, 0xBDEF, 0xF79D, 0xC6FA, 0x4E74, 0x3BEB, 0x7895,
+    // M^1024
+    0x49D6, 0x91FB, 0x8AC5, 0x0453, 0x9D63, 0x7E56, 0x84CA, 0x181D,
+    0x326D, 0xF074, 0x58F1, 0xF522, 0x33C7, 0x75CD, 0x7E5A, 0x4737,
+    // M^2048
+    0xA39F, 0xE501, 0x1DA5, 0x9975, 0xC9FF, 0x6760, 0x16B9, 0x9CC6,
+    0x8BA2, 0x925D, 0x8E8B, 0xFA56, 0x4A2C, 0x095B, 0xE9F6, 0x556F,
+    // M^4096
+    0xD2BC, 0x1374, 0xF0CF, 0x68AB, 0x2BC3, 0x0600, 0x5E49, 0x1945,
+    0xA861, 0x7517, 0xF0C2, 0xB007, 0x624D, 0x7159, 0x1872, 0x1564,
+    // M^8192
+    0xB6AE, 0x3C7E, 0x00A2, 0x6F0A, 0x9AEC, 0x85D5, 0xABB3, 0x0611,
+    0x5ECF, 0x4901, 0x4A7A, 0x3777, 0x08AD, 0x6C9A, 0xB2B4, 0x9268,
+    // M^16384
+    0x2536, 0xFE66, 0xBFBA, 0xE799, 0xA36C, 0x079F, 0x4DB3, 0x2F39,
+    0xC6CF, 0x6DA2, 0x2B3C, 0x077B, 0x6DB5, 0x6CAA, 0xA6D4, 0x92A8,
+    // M^32768
+    0x6476, 0x7F76, 0x86A8, 0x967D, 0x4760, 0x8F77, 0x1CC6, 0x8DDC,
+    0x931B, 0xF636, 0x3C6C, 0x55D8, 0x31B0, 0xD760, 0xC6C0, 0x5D80
+  };
+  __xor16_6f1_state = __xor16_jump(__xor16_6f1_state, table, n);
+  return __xor16_6f1_state;
+}
+
+uint16_t xor16_6f1_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
       "bst    %B0, 7"        "\n\t"
-      "eor    r18, r18"      "\n\t"
       "bld    r18, 0"        "\n\t"
       "eor    %A0, r18"      "\n\t"
-      "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_6f1_state)::"r18","r19");
   return __xor16_6f1_state;
 }
+
+static const uint16_t __xor16_6f1_checkpoints[256] PROGMEM = {
+  0x0001, 0xA0F2, 0xDE02, 0x883E, 0x49D6, 0xDCE3, 0xC6F6, 0x4E4D,
+  0xA39F, 0x9DD5, 0xF534, 0x6077, 0x2326, 0x29E9, 0x7C0B, 0x3E80,
+  0xD2BC, 0x1D86, 0x49FD, 0x03B0, 0x8F60, 0xAF5A, 0x01B7, 0x3931,
+  0xD261, 0xD131, 0x9BAD, 0x2BA6, 0x4994, 0x9224, 0xE2C0, 0x3F83,
+  0xB6AE, 0x7017, 0x2003, 0xE9F0, 0xD09E, 0xF7DB, 0xADE0, 0xF40D,
+  0x90B9, 0x3845, 0x4FC5, 0xE0D6, 0xC25D, 0xF4F1, 0x4E54, 0x562A,
+  0x17F0, 0x11A2, 0xB091, 0x0EE6, 0xD6CD, 0xF61A, 0xCD95, 0xA418,
+  0xF9B8, 0xDF29, 0xE0BE, 0xF33B, 0x4753, 0x56B3, 0xA8E5, 0x8235,
+  0x2536, 0xC61D, 0xE64A, 0x9765, 0xE75A, 0xCBCB, 0xF547, 0xD797,
+  0x5A49, 0x4EFF, 0xC3D9, 0x47D4, 0x8184, 0x0AA4, 0xB745, 0x6FC3,
+  0xE782, 0xE9D8, 0xDC0C, 0x20A7, 0x5FAE, 0x8E08, 0x29EF, 0x416E,
+  0x5B71, 0x1EC3, 0x06B8, 0xA9C6, 0x548F, 0x2A9A, 0x57FE, 0x725C,
+  0x5BCA, 0x604D, 0xB7FA, 0x5F1B, 0x73D9, 0x481D, 0x719F, 0x634A,
+  0xB678, 0xD15B, 0xD9F8, 0xD8EC, 0xCA14, 0xFD10, 0xB654, 0x939F,
+  0x2B9D, 0x7DBA, 0x3AD4, 0x652C, 0x00C8, 0xC96E, 0xC82D, 0x91CB,
+  0x9884, 0x1BD3, 0x7559, 0x0634, 0x130A, 0xDD65, 0x06E0, 0xC175,
+  0x6476, 0xAC9B, 0x4A04, 0xAFEC, 0x2FA7, 0xC629, 0xF1C9, 0x3127,
+  0x2EA4, 0xA23B, 0x9C58, 0x58D9, 0xC4E4, 0xFDC5, 0xC4D9, 0xF48E,
+  0x09D8, 0xBF1D, 0x2DAD, 0x20E6, 0xC2A8, 0x34D4, 0x4B78, 0x8C72,
+  0xAB01, 0x958A, 0x2ACD, 0x1CE0, 0x4C17, 0x93D9, 0x2B0C, 0x7C95,
+  0x1C02, 0xFAD8, 0xCC60, 0xD3EE, 0x0FEF, 0x7FD6, 0x6E22, 0x355F,
+  0xDBF0, 0x4D10, 0xB99D, 0x6384, 0x4273, 0x7C87, 0x844C, 0x5B56,
+  0x31FC, 0xDF76, 0x159A, 0x7831, 0x8513, 0x19A1, 0x498D, 0x6791,
+  0x68E5, 0xDB15, 0x6648, 0x5DD7, 0xDF27, 0x63E1, 0x238B, 0x817F,
+  0x49DE, 0x62D9, 0x73B7, 0x441E, 0xA7CC, 0xB7D2, 0x5389, 0xA4A5,
+  0xBA53, 0x0B9A, 0xDA1C, 0xCF53, 0xC5EF, 0x27ED, 0x1C09, 0x9723,
+  0xE7CB, 0xCAE4, 0xD391, 0x4863, 0x96E1, 0x547F, 0x041B, 0xA9C9,
+  0x7722, 0x2428, 0x19EC, 0x24E7, 0x4D15, 0x5739, 0x989F, 0x9D55,
+  0xBF94, 0x79C5, 0x5217, 0x31F4, 0x614C, 0xA0DB, 0x7262, 0x8140,
+  0x33A6, 0xEF30, 0xA343, 0xF190, 0xF966, 0xC05F, 0xAC04, 0xC874,
+  0x598A, 0x767F, 0x15EC, 0x2175, 0x0767, 0xA191, 0x354C, 0xE34C,
+  0x329C, 0xCC3F, 0x26CA, 0x84E5, 0xBD96, 0x2130, 0xD437, 0x3E54
+};
+static const uint8_t __xor16_6f1_order[256] PROGMEM = {
+    0, 116,  22,  19, 214, 123,  90, 126, 244, 144,  77, 201,  51, 164,  49, 124,
+  178, 242,  48, 181, 218, 121, 160, 206, 155,  17,  89,  34,  83, 147, 253, 243,
+   12, 190, 217, 219,  64, 250, 205,  13,  86,  93, 154, 158, 112,  27, 146, 136,
+  132, 135, 227, 176, 248, 232, 149, 246, 167,  41,  23, 114, 255,  15,  31,  87,
+  172, 195,  60,  75, 101, 211, 182,  28,   4, 192,  18, 130, 150, 156, 169, 220,
+    7,  46,  73,  42, 226, 198, 213,  92,  47,  61, 221,  94, 139, 240,  72, 175,
+   88,  96, 187,  99,  84,  97,  11, 228, 193, 103, 171, 189, 128, 115, 186, 183,
+  184, 166,  79,  33, 102,  95, 230, 194, 100, 122, 241, 216, 179, 225,  14, 173,
+  159, 113, 165, 231, 191,  76,  63, 174, 251, 180,   3, 151,  85,  20,  40, 119,
+   29, 111, 157, 153, 212, 207,  67, 120, 222,  26, 138, 223,   9, 229,   1, 245,
+  137, 234,   8,  55, 199, 196,  62,  91, 215, 152, 238, 129,  38,  21, 131,  50,
+  110, 104,  32,  78, 197,  98, 170, 200, 252, 145, 224, 237, 127,  44, 148,  74,
+  142, 140, 204,  65, 133,   6, 118, 239, 117, 108, 209,  69, 249, 162,  54, 203,
+   36,  25, 105,  24,  16, 210, 163, 254,  52,  71, 107, 106, 202, 185, 168,  82,
+    5, 125,   2, 188,  57, 177,  58,  43,  30, 247,  66,  68,  80, 208,  81,  35,
+  233, 235, 134,  59,  39, 143,  45,  10,  70,  53,  37, 236,  56, 161, 109, 141
+};
+
+uint16_t xor16_6f1_position() {
+  uint16_t saved = __xor16_6f1_state;
+  uint16_t pos = __xor16_position(saved, xor16_6f1, __xor16_6f1_checkpoints, __xor16_6f1_order);
+  __xor16_6f1_state = saved;
+  return pos;
+}
+
+void xor16_6f1_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_6f1, xor16_6f1, __xor16_6f1_checkpoints);
+}
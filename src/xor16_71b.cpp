@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 71b //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_71b_state;
+uint16_t __xor16_71b_state;
 
 bool seed_xor16_71b(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -39,3 +40,225 @@ uint16_t xor16_71b() {
     :"+d"((uint16_t)__xor16_71b_state)::"r18","r19");
   return __xor16_71b_state;
 }
+
+void xor16_71b_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_71b_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_71b_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x08C1, 0x1983, 0x3306, 0x660C, 0xCC18, 0x9830, 0x3060, 0x60C0,
+    0xC180, 0x0300, 0x0600, 0x0C00, 0x1800, 0x3000, 0x6000, 0xC000,
+    // M^2
+    0x5461, 0xA402, 0xC005, 0x000A, 0x0014, 0x8028, 0x8050, 0x00A0,
+    0x0140, 0xC280, 0x0500, 0x0A00, 0x1400, 0x2800, 0x5000, 0xA000,
+    // M^4
+    0x1519, 0x2902, 0x6464, 0xA408, 0xC011, 0x2022, 0x2044, 0x8088,
+    0x8110, 0x3220, 0x0440, 0xC880, 0x1100, 0x2200, 0x4400, 0x8800,
+    // M^8
+    0xE550, 0x4292, 0x0642, 0x0A48, 0x1908, 0x2B20, 0x6620, 0xAC80,
+    0xC901, 0x2102, 0x2404, 0x8408, 0x9010, 0x1020, 0x4040, 0x4080,
+    // M^16
+    0x82CD, 0x9658, 0x21B4, 0xC962, 0xD751, 0x570B, 0x7E46, 0x5C2C,
+    0xA899, 0x9BB3, 0x3266, 0x6ECC, 0xC998, 0xBB30, 0x2660, 0xECC0,
+    // M^32
+    0x3F02, 0xECF8, 0xEE6B, 0xB3E0, 0x29AE, 0x3343, 0x5A7B, 0x0C8F,
+    0xF9EE, 0xB05D, 0x77BA, 0x90F5, 0x4EEA, 0x43D4, 0x3BA8, 0x0F50,
+    // M^64
+    0x4F3A, 0x6F9A, 0x291C, 0x2E6A, 0xA470, 0xCD0C, 0x7566, 0x65B1,
+    0x8419, 0x1332, 0x41E5, 0xDCCA, 0x5615, 0xE32A, 0x5854, 0xDD29,
+    // M^128
+    0x7ADC, 0x314B, 0x18FF, 0x94AD, 0x63FC, 0x9B3D, 0xD67B, 0x3D75,
+    0x59EC, 0xC7D8, 0x67B0, 0x1F60, 0x9EC0, 0x7D80, 0x2A81, 0x6602,
+    // M^256
+    0x15D9, 0xB3ED, 0x55AA, 0xCFB4, 0x56A8, 0x77D9, 0x83AB, 0x8EE5,
+    0x0EAC, 0xA958, 0x6B31, 0x3562, 0xACC4, 0xD588, 0xE291, 0xC622,
+    // M^512
+    0x48D2, 0xEDCA, 0xAEAD, 0x272A, 0xBAB4, 0xD693, 0xF16A, 0x0BCD,
+    0x9429, 0x32D3, 0x9127, 0x5B4E, 0x151D, 0xACBB, 0x95F7, 0x22EE,
+    // M^1024
+    0x6360, 0x75A5, 0x6AE4, 0x8715, 0x3B92, 0x1591, 0x778F, 0xC646,
+    0x1FBF, 0x6E7E, 0x7EFC, 0xE879, 0x6BF2, 0xA1E4, 0xAFC8, 0xD611,
+    // M^2048
+    0x1DF3, 0xDECE, 0x4697, 0xEB3A, 0xDBDF, 0x9405, 0x5791, 0x0195,
+    0x9FC7, 0x370F, 0xEF1E, 0x8DBD, 0x7DFB, 0xA6F6, 0xA66D, 0x5A5B,
+    // M^4096
+    0x5A7C, 0xF106, 0x219C, 0x059B, 0x47F3, 0x93DA, 0x5BF9, 0x1EE9,
+    0x3E65, 0xF24B, 0x3817, 0x592E, 0xB1DD, 0xA53B, 0x5776, 0xC56D,
+    // M^8192
+    0xE619, 0x6802, 0xE643, 0xF189, 0x990C, 0x4EE0, 0xBD75, 0xAB82,
+    0x3457, 0x81AE, 0x80DD, 0xC73B, 0x9376, 0x1CEC, 0x4DD8, 0x2231,
+    // M^16384
+    0xFCEA, 0xFE0D, 0x4118, 0x6836, 0x55E1, 0xD387, 0xB4D9, 0x8F9F,
+    0x4366, 0x8CCC, 0x5C19, 0xF2B3, 0xE066, 0x9B4D, 0x401B, 0xACB7,
+    // M^32768
+    0x47D7, 0x6025, 0x3EAA, 0x1096, 0xAB29, 0x0F00, 0x71FE, 0x3C00,
+    0x57FA, 0x1075, 0xCFEA, 0x1055, 0xAFAA, 0x10D5, 0x7F2B, 0xD356
+  };
+  __xor16_71b_state = __xor16_jump(__xor16_71b_state, table, n);
+  return __xor16_71b_state;
+}
+
+uint16_t xor16_71b_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_71b_state)::"r18","r19");
+  return __xor16_71b_state;
+}
+
+static const uint16_t __xor16_71b_checkpoints[256] PROGMEM = {
+  0x0001, 0x15D9, 0x48D2, 0x3FF8, 0x6360, 0x649F, 0xB84F, 0x358D,
+  0x1DF3, 0x7630, 0x78C5, 0xE382, 0x6BC7, 0x5B5F, 0x35EA, 0x1A1F,
+  0x5A7C, 0xEAAB, 0xFDBD, 0x2D53, 0xF640, 0x1C3D, 0x5C21, 0x7206,
+  0xD4C2, 0x5DE5, 0x244E, 0x14E1, 0xA8BB, 0xE0DC, 0x30C3, 0xD236,
+  0xE619, 0xBF97, 0x6D1A, 0x4D17, 0x1758, 0x7AB6, 0x4E34, 0x6141,
+  0xAFC7, 0x14DD, 0x13D4, 0x057C, 0x5D59, 0x11C4, 0xFA8C, 0xD53E,
+  0xE568, 0xAF60, 0x1E7F, 0xC53F, 0x5C75, 0xF2AF, 0x31B1, 0xCDAD,
+  0x02B7, 0xF552, 0x5E8C, 0xADA5, 0xFA1A, 0xEB34, 0x1776, 0x249C,
+  0xFCEA, 0x0562, 0x2202, 0xCF3D, 0x73A2, 0x76F8, 0xBA3F, 0x3E0F,
+  0xB26D, 0x6D83, 0x4F37, 0xC9D9, 0x9EF6, 0x5795, 0x1AAE, 0xE031,
+  0xC593, 0x3F57, 0xA676, 0x955E, 0xF38B, 0x1D6E, 0x21BA, 0x08E9,
+  0x9598, 0x1882, 0xA4AE, 0xA854, 0xA661, 0x3068, 0x428A, 0xB975,
+  0x6609, 0x2F1D, 0xF540, 0xBBC9, 0xFADB, 0xF3A3, 0xA503, 0xD003,
+  0x2E43, 0x071C, 0x0073, 0x04EE, 0x3855, 0xD95E, 0x4F49, 0x42F0,
+  0x67F6, 0x31A4, 0xDB76, 0x5E7C, 0x819A, 0x6C9A, 0xCD5E, 0x88BC,
+  0xC6CA, 0x97CD, 0x24AA, 0x3BDC, 0x2A22, 0x8D86, 0xFE7F, 0x3404,
+  0x47D7, 0x862C, 0xE98C, 0xDE0E, 0x568F, 0x3EF3, 0x044C, 0x7284,
+  0xE9CA, 0xBBE2, 0xE482, 0xA702, 0x6C82, 0x5442, 0x1522, 0x0D6D,
+  0x2B4A, 0xB8EC, 0x6A85, 0x65B5, 0xBD63, 0xBDD7, 0x47E9, 0x8EAE,
+  0xE1E6, 0x6347, 0xE0D8, 0x6569, 0x7C9B, 0x7443, 0xD573, 0xE904,
+  0x9F5F, 0x7A68, 0x3C21, 0x451F, 0xED8E, 0x06D2, 0x2A62, 0x0E2D,
+  0x0F15, 0xEF7C, 0x3058, 0x63FB, 0xD552, 0x8B04, 0x011E, 0x71F7,
+  0x4AD0, 0x254D, 0xBC79, 0x998A, 0xA394, 0x39B9, 0x377B, 0x7ED3,
+  0x9104, 0x31E0, 0x0D77, 0x01BB, 0xC8B8, 0x71F1, 0xAC97, 0x662A,
+  0xFEF0, 0x86CB, 0x6085, 0xF98F, 0xD4FE, 0xE68A, 0xC1EE, 0x797B,
+  0x6B49, 0xFC49, 0x5A6A, 0x5A44, 0x046E, 0xB6B0, 0xD293, 0x5F56,
+  0x84B6, 0xE4C0, 0x9744, 0x7022, 0x5FE9, 0x1708, 0xAFB5, 0x05EA,
+  0x6353, 0xE3DA, 0x7170, 0x37AB, 0x2535, 0xD117, 0x23ED, 0x872C,
+  0xE720, 0x4A27, 0xFAEC, 0x214C, 0xC291, 0x407F, 0x7C61, 0x2425,
+  0x8913, 0x0D70, 0xF225, 0xC30D, 0x0C80, 0xD0B6, 0xC1A4, 0x8689,
+  0x50C3, 0xE52F, 0xDF55, 0xE4A0, 0x6336, 0x57DB, 0xB0F6, 0x7516,
+  0x4EAF, 0xD08C, 0x9C8C, 0x204E, 0x7FD0, 0x399C, 0x00D1, 0x4E3F
+};
+static const uint8_t __xor16_71b_order[256] PROGMEM = {
+    0, 106, 254, 174, 187,  56, 134, 204, 107,  65,  43, 215, 165, 105,  87, 236,
+  143, 233, 186, 167, 168,  45,  42,  41,  27, 142,   1, 213,  36,  62,  89,  15,
+   78,  21,  85,   8,  50, 251, 227,  86,  66, 222, 231,  26,  63, 122, 220, 177,
+  124, 166, 144,  19, 104,  97, 170,  93,  30, 113,  54, 185, 127,   7,  14, 182,
+  219, 108, 253, 181, 123, 162,  71, 133,  81,   3, 229,  94, 111, 163, 128, 150,
+    2, 225, 176,  35,  38, 255, 248,  74, 110, 240, 141, 132,  77, 245, 203, 202,
+   16,  13,  22,  52,  44,  25, 115,  58, 207, 212, 194,  39, 244, 153, 216,   4,
+  171,   5, 155, 147,  96, 191, 112, 146, 200,  12, 140, 117,  34,  73, 211, 218,
+  189, 175,  23, 135,  68, 157, 247,   9,  69,  10, 199, 161,  37, 230, 156, 183,
+  252, 116, 208, 129, 239, 193, 223, 119, 232, 173, 125, 151, 184,  83,  88, 210,
+  121, 179, 250,  76, 160, 180,  90, 102,  92,  82, 139,  91,  28, 190,  59,  49,
+  214,  40, 246,  72, 205,   6, 145,  95,  70,  99, 137, 178, 148, 149,  33, 238,
+  198, 228, 235,  51,  80, 120, 188,  75, 118,  55,  67, 103, 249, 237, 221,  31,
+  206,  24, 196,  47, 172, 158, 109, 114, 131, 242,  79, 154,  29, 152,  11, 217,
+  138, 243, 209, 241,  48,  32, 197, 224, 159, 130, 136,  17,  61, 164, 169, 234,
+   53,  84, 101,  98,  57,  20, 195,  60,  46, 100, 226, 201,  64,  18, 126, 192
+};
+
+uint16_t xor16_71b_position() {
+  uint16_t saved = __xor16_71b_state;
+  uint16_t pos = __xor16_position(saved, xor16_71b, __xor16_71b_checkpoints, __xor16_71b_order);
+  __xor16_71b_state = saved;
+  return pos;
+}
+
+void xor16_71b_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_71b, xor16_71b, __xor16_71b_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 734 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_734_state;
+uint16_t __xor16_734_state;
 
 bool seed_xor16_734(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -21,7 +22,7 @@ uint16_t xor16_734() {
       "movw   r18, %A0"      "\n\t"
       "lsr    r19"           "\n\t"
       "mov    r19, r18"      "\n\t"
-      "eor    r18, r18"      "\n\t"
+      "clr    r18"           "\n\t"
       "ror    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
@@ -36,16 +37,259 @@ uint16_t xor16_734() {
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_734_state)::"r18","r19");
   return __xor16_734_state;
 }
+
+void xor16_734_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_734_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_734_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0981, 0x1302, 0x2604, 0x4C19, 0x9832, 0x3064, 0x60C8, 0xC190,
+    0x8320, 0x2640, 0x4C80, 0x9900, 0x3200, 0x6400, 0xC800, 0x9000,
+    // M^2
+    0xD231, 0x8462, 0x28C4, 0xC02A, 0x8054, 0x20A8, 0x4141, 0x8282,
+    0x0504, 0x6E08, 0xDC10, 0xB820, 0x7040, 0xE080, 0xC100, 0xA200,
+    // M^4
+    0x0F85, 0x9B9B, 0xB3A7, 0x07E0, 0x4BD1, 0x8280, 0x5774, 0xCAE8,
+    0xF1D0, 0xEB92, 0xF724, 0xAA48, 0x1081, 0x0102, 0x6604, 0x2C88,
+    // M^8
+    0x31E4, 0x9EC4, 0x4898, 0xF27A, 0x0FC6, 0x0DF2, 0xB661, 0x13AA,
+    0x7C92, 0xE126, 0x874E, 0x3CC4, 0xD5EC, 0x6A4B, 0xC817, 0x9166,
+    // M^16
+    0x2394, 0xF375, 0x1AC5, 0xDF1B, 0x55A9, 0xFE23, 0xC2DE, 0x3ABE,
+    0x4E92, 0x9406, 0x19DB, 0xE97E, 0x659A, 0x9485, 0x8DCB, 0x55D7,
+    // M^32
+    0x3BC3, 0xA392, 0xD9D3, 0xCDE4, 0x870A, 0x6362, 0xD778, 0x2BF8,
+    0x750A, 0xC026, 0x6045, 0xB48A, 0x0D7E, 0x2A79, 0x1C7A, 0xD8F5,
+    // M^64
+    0x4270, 0x48C0, 0xEBAA, 0x237B, 0x63EA, 0x94A7, 0xE26C, 0xFED3,
+    0x4044, 0xDDAC, 0x036B, 0xDA39, 0x2570, 0x9BE2, 0x84D7, 0x8783,
+    // M^128
+    0x4C5A, 0x4251, 0xDEA8, 0x3AE0, 0x617E, 0x2AF6, 0xFB00, 0xCCDD,
+    0x8D11, 0x1D97, 0xC2E8, 0xB7F7, 0xCDEC, 0x25FA, 0x1AA7, 0xED63,
+    // M^256
+    0x8D77, 0xD114, 0x8E6B, 0x5F5D, 0xA4DD, 0x6F36, 0x38A3, 0x7C6A,
+    0x3849, 0x48E2, 0xCD98, 0xFBED, 0xF6A9, 0x6EE7, 0x5104, 0xF5CD,
+    // M^512
+    0xDAB1, 0x409F, 0xDFF1, 0x214C, 0xEAE7, 0xEDA9, 0x2C9C, 0x26E3,
+    0x892A, 0x5002, 0x2D1F, 0xC07F, 0x788B, 0xB883, 0x118F, 0xD1DE,
+    // M^1024
+    0xD3BB, 0xB918, 0x5B12, 0xE388, 0x4AA6, 0x2C2F, 0x675A, 0xB866,
+    0x14F1, 0x299B, 0x52BD, 0x8F10, 0x8C79, 0x6D64, 0xB3D1, 0x6F4A,
+    // M^2048
+    0x3A4C, 0xBC98, 0x7E6C, 0xD77B, 0x6319, 0x4EDF, 0xC60E, 0xA838,
+    0xB4CA, 0x8D6E, 0xA3FD, 0xC52B, 0x8307, 0x078E, 0xF51C, 0x03B8,
+    // M^4096
+    0xA3D5, 0xFDBD, 0xBBEB, 0x559D, 0x4518, 0x3C48, 0xCDB8, 0x3BA0,
+    0x2119, 0x4CFA, 0xED39, 0xFEE3, 0xC2A4, 0x27EE, 0xAF14, 0x6B21,
+    // M^8192
+    0x8A12, 0x1CEF, 0xDCCE, 0x928B, 0x73B1, 0x6EB5, 0xE19B, 0x71A2,
+    0xB5A7, 0x9BA6, 0x5E00, 0xEA67, 0x34CC, 0x7EAF, 0xCC05, 0x8467,
+    // M^16384
+    0x9AF8, 0xA69F, 0x0A5A, 0x5ED9, 0x4ED3, 0xA711, 0x850F, 0x3039,
+    0x7087, 0xABFB, 0xD708, 0x8211, 0xCA1F, 0x6E08, 0xAAD9, 0x1F7A,
+    // M^32768
+    0xFEA2, 0x1B8F, 0x1A70, 0xA1E0, 0x93B9, 0xA92D, 0xD011, 0x89F4,
+    0x08CA, 0x1655, 0x2D11, 0x60AA, 0xBA7E, 0x64EA, 0x675C, 0xD0F1
+  };
+  __xor16_734_state = __xor16_jump(__xor16_734_state, table, n);
+  return __xor16_734_state;
+}
+
+uint16_t xor16_734_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %A0"       "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "clr    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_734_state)::"r18","r19");
+  return __xor16_734_state;
+}
+
+static const uint16_t __xor16_734_checkpoints[256] PROGMEM = {
+  0x0001, 0x8D77, 0xDAB1, 0xDB99, 0xD3BB, 0x9674, 0xFB3D, 0x206B,
+  0x3A4C, 0xC2D4, 0x8254, 0xAF3A, 0x9856, 0x3B88, 0x303F, 0xDEF0,
+  0xA3D5, 0x0889, 0x55AD, 0x1D61, 0x2277, 0x0745, 0x868C, 0xDDEB,
+  0x749D, 0x8024, 0x1490, 0xE386, 0x9990, 0x1877, 0x2C04, 0xD6F9,
+  0x8A12, 0x330B, 0xEBDB, 0xA242, 0x3A7F, 0x555C, 0x1F34, 0xF5F7,
+  0x947C, 0xEC82, 0x5125, 0xF3CE, 0x08C7, 0x6D2C, 0x8FDF, 0xDE52,
+  0x619D, 0x835C, 0xC82E, 0x3030, 0x53A5, 0xC746, 0x7E26, 0x8794,
+  0x1E22, 0x361C, 0x68DF, 0xA94F, 0xED78, 0x6807, 0x1606, 0x2CAC,
+  0x9AF8, 0x6014, 0x1555, 0x9C1A, 0x1F85, 0xCF01, 0x6F60, 0x2EA8,
+  0x5C71, 0xEFE7, 0x7507, 0xEE93, 0x306D, 0x939A, 0x2531, 0xDDAA,
+  0xC149, 0x7609, 0x9E1A, 0x5767, 0x9F03, 0x19D9, 0x0733, 0x2ABB,
+  0x6957, 0xB231, 0x63FD, 0x9C2B, 0x5919, 0x12FE, 0x314B, 0x9B9A,
+  0xDEDC, 0x1DD5, 0x1B9D, 0xF919, 0x89D4, 0x5816, 0xA7E2, 0xDCF2,
+  0x3A23, 0x1814, 0x27F2, 0x8DE2, 0x011A, 0x12DD, 0x021E, 0xEC1D,
+  0x04C7, 0x5B59, 0x62BF, 0x4DD5, 0xBC30, 0x901D, 0xFBF8, 0x67BE,
+  0x3573, 0xC2B4, 0xD5C1, 0x6E0F, 0xCC21, 0x70FD, 0x1A29, 0xF8BA,
+  0xFEA2, 0x8058, 0x36EE, 0x36E9, 0xE4E1, 0xA13E, 0x68AA, 0x591B,
+  0xC3EA, 0x71D4, 0x9F7C, 0x67C4, 0x4872, 0x88B5, 0xBABD, 0x354C,
+  0x840A, 0xB61C, 0x9D12, 0x7891, 0x6767, 0x074D, 0xD9D1, 0xFCA7,
+  0xCBA6, 0x63AC, 0x8D22, 0x45D3, 0x18A2, 0xCF0C, 0x3321, 0x0AA4,
+  0x2E38, 0x84C6, 0x23E3, 0x69D0, 0x1C53, 0x00C1, 0xC9BE, 0xD0CE,
+  0x168B, 0x0C87, 0x9817, 0x8E5C, 0xC612, 0x547A, 0x1734, 0x0E1A,
+  0x5403, 0x3656, 0xDE35, 0xE400, 0x07B6, 0x55CD, 0x4AF4, 0xE342,
+  0x5332, 0xCDF9, 0xF7FD, 0x52D7, 0xDD53, 0x9C41, 0x80C5, 0xB218,
+  0xDEE1, 0x8A7F, 0x38DF, 0x0EE2, 0x847C, 0x1A2B, 0x29AE, 0xBE3D,
+  0x84BE, 0x8FF6, 0x634E, 0x77C9, 0xE29A, 0xD432, 0x8507, 0xD214,
+  0x3034, 0xDDCE, 0x18B7, 0x68CD, 0xDC86, 0x4700, 0xEC37, 0xE5B8,
+  0xD723, 0xDC06, 0x3B6A, 0xCAD4, 0x79B9, 0x6F45, 0x4282, 0xB498,
+  0x27F1, 0xD181, 0x9B34, 0xCDA2, 0x68BD, 0x2FCE, 0x6CD2, 0x3896,
+  0xE46B, 0x531D, 0x2F9A, 0x7EC7, 0x211C, 0x2345, 0x25F3, 0x4877,
+  0x8BA9, 0xBFFD, 0xF83E, 0x0CA3, 0x794A, 0xBC04, 0xD59D, 0x2347,
+  0xF4E7, 0x08E8, 0x8F4F, 0x06E5, 0xAD99, 0x9F8B, 0x3AEE, 0x009C
+};
+static const uint8_t __xor16_734_order[256] PROGMEM = {
+    0, 255, 165, 108, 110, 112, 251,  86,  21, 149, 180,  17,  44, 249, 159, 169,
+  243, 175, 195, 109,  93,  26,  66,  62, 168, 174, 105,  29, 156, 210,  85, 126,
+  197,  98, 164,  19,  97,  56,  38,  68,   7, 236,  20, 237, 247, 162,  78, 238,
+  224, 106, 198,  87,  30,  63, 160,  71, 234, 229,  51, 208,  14,  76,  94,  33,
+  158, 143, 120,  57, 177, 131, 130, 231, 194, 104,   8,  36, 254, 218,  13, 222,
+  155, 213, 140, 239, 182, 115,  42, 187, 233, 184,  52, 176, 173,  37,  18, 181,
+   83, 101,  92, 135, 113,  72,  65,  48, 114, 202, 153,  90, 148, 119, 139,  61,
+  134, 228, 211,  58,  88, 163, 230,  45, 123, 221,  70, 125, 137,  24,  74,  81,
+  203, 147, 244, 220,  54, 235,  25, 129, 190,  10,  49, 144, 196, 200, 161, 206,
+   22,  55, 141, 100,  32, 193, 240, 154,   1, 107, 171, 250,  46, 201, 117,  77,
+   40,   5, 170,  12,  28,  64, 226,  95,  67,  91, 189, 146,  82,  84, 138, 253,
+  133,  35,  16, 102,  59, 252,  11, 191,  89, 223, 145, 142, 245, 116, 199, 241,
+   80, 121,   9, 136, 172,  53,  50, 166, 219, 152, 124, 227, 185,  69, 157, 167,
+  225, 207,   4, 205, 246, 122,  31, 216, 150,   2,   3, 217, 212, 103, 188,  79,
+  209,  23, 178,  47,  96, 192,  15, 204, 183,  27, 179, 232, 132, 215,  34, 111,
+  214,  41,  60,  75,  73,  43, 248,  39, 186, 242, 127,  99,   6, 118, 151, 128
+};
+
+uint16_t xor16_734_position() {
+  uint16_t saved = __xor16_734_state;
+  uint16_t pos = __xor16_position(saved, xor16_734, __xor16_734_checkpoints, __xor16_734_order);
+  __xor16_734_state = saved;
+  return pos;
+}
+
+void xor16_734_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_734, xor16_734, __xor16_734_checkpoints);
+}
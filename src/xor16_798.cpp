@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: 798 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_798_state;
+uint16_t __xor16_798_state;
+static uint16_t __xor16_798_weyl_count;
+static uint8_t __xor16_798_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_798_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_798(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_798(uint16_t seed) {
   }
   if(seed) {
     __xor16_798_state = seed;
+    __xor16_798_spare_full = 0;
     return 1;
   }
   return 0;
@@ -21,7 +26,7 @@ uint16_t xor16_798() {
       "movw   r18, %A0"      "\n\t"
       "lsr    r19"           "\n\t"
       "mov    r19, r18"      "\n\t"
-      "eor    r18, r18"      "\n\t"
+      "clr    r18"           "\n\t"
       "ror    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
@@ -29,8 +34,368 @@ uint16_t xor16_798() {
       "mov    r18, %B0"      "\n\t"
       "lsr    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
-      "mov    r19, %A0"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_798_state)::"r18","r19");
+  return __xor16_798_state;
+}
+
+uint16_t xor16_798_star() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_798_state)::"r18","r19");
+  return rng16::star(__xor16_798_state);
+}
+
+/* The same step as xor16_798(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_798_weyl(uint16_t seed) {
+  __xor16_798_state = seed ? seed : 1;
+  __xor16_798_weyl_count = seed;
+  __xor16_798_spare_full = 0;
+}
+
+uint16_t xor16_798_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_798_state), "+d"(__xor16_798_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_798(). */
+uint8_t xor16_798_byte() {
+  if (__xor16_798_spare_full) {
+    __xor16_798_spare_full = 0;
+    return __xor16_798_spare;
+  }
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+    :"+d"((uint16_t)__xor16_798_state)::"r18","r19");
+  __xor16_798_spare = __xor16_798_state >> 8;
+  __xor16_798_spare_full = 1;
+  return __xor16_798_state;
+}
+
+/* n bytes, the same ones n calls to xor16_798_byte() would return; whole steps go through xor16_798_fill(). */
+void xor16_798_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_798_spare_full) {
+    __xor16_798_spare_full = 0;
+    *dst++ = __xor16_798_spare;
+    n--;
+  }
+  xor16_798_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_798_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 24 eors. */
+void xor16_798_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r10"      "\n\t" // y ^= y << 7
+      "eor    r16, r9"       "\n\t"
+      "eor    r15, r8"       "\n\t"
+      "eor    r14, r7"       "\n\t"
+      "eor    r13, r6"       "\n\t"
+      "eor    r12, r5"       "\n\t"
+      "eor    r11, r4"       "\n\t"
+      "eor    r10, r3"       "\n\t"
+      "eor    r9, r2"        "\n\t"
+      "eor    r2, r11"       "\n\t" // y ^= y >> 9
+      "eor    r3, r12"       "\n\t"
+      "eor    r4, r13"       "\n\t"
+      "eor    r5, r14"       "\n\t"
+      "eor    r6, r15"       "\n\t"
+      "eor    r7, r16"       "\n\t"
+      "eor    r8, r17"       "\n\t"
+      "eor    r17, r9"       "\n\t" // y ^= y << 8
+      "eor    r16, r8"       "\n\t"
+      "eor    r15, r7"       "\n\t"
+      "eor    r14, r6"       "\n\t"
+      "eor    r13, r5"       "\n\t"
+      "eor    r12, r4"       "\n\t"
+      "eor    r11, r3"       "\n\t"
+      "eor    r10, r2"       "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_798_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_798_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_798_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x8181, 0x0302, 0x0705, 0x0E0A, 0x1C14, 0x3828, 0x7050, 0xE0A0,
+    0xC140, 0x0301, 0x0602, 0x0C04, 0x1808, 0x3010, 0x6020, 0xC040,
+    // M^2
+    0x6021, 0xC143, 0x42C7, 0x040F, 0x091F, 0x123E, 0x247C, 0x48F8,
+    0x1170, 0x43C0, 0x0601, 0x0D03, 0x1A06, 0x340C, 0x6818, 0xD030,
+    // M^4
+    0x2E0B, 0x2C46, 0xA4F9, 0xE1AB, 0xF2C6, 0xC56C, 0x4B98, 0x16B1,
+    0x342B, 0x562C, 0x25E0, 0xBB10, 0xD741, 0x6EC3, 0x5C07, 0xB90F,
+    // M^8
+    0x45F9, 0x3314, 0x570F, 0x8FDB, 0xDF30, 0x3F65, 0x80CC, 0xAB9D,
+    0xBAE8, 0x78B4, 0xE74D, 0x2B5C, 0x103D, 0xA57C, 0xB302, 0xC8A9,
+    // M^16
+    0xEF81, 0xFF22, 0x2817, 0xCBB3, 0x858E, 0x1653, 0x3B2C, 0x6D55,
+    0xB5EF, 0x31D8, 0xE627, 0xCB54, 0x6D45, 0x883D, 0x8CA0, 0x0E2D,
+    // M^32
+    0x2120, 0x27C0, 0xFE53, 0x23C5, 0x2C36, 0x14BB, 0x5FEC, 0xE535,
+    0x0BB0, 0x48D3, 0xF3A8, 0x5B5B, 0x60BB, 0x5A81, 0x5858, 0x06DD,
+    // M^64
+    0x458A, 0x5093, 0xF1A5, 0x7C48, 0x136C, 0x6B8E, 0xA087, 0x1BE2,
+    0xC580, 0x930C, 0xF597, 0x7624, 0xFA44, 0xEF7E, 0x33A7, 0xD122,
+    // M^128
+    0x3489, 0xD474, 0xF67C, 0x79E1, 0xEA2C, 0x3AED, 0xC102, 0x5A94,
+    0xC970, 0xF007, 0x2B9A, 0xDA2D, 0x43B5, 0xDDDF, 0xD766, 0xE65C,
+    // M^256
+    0xA20C, 0xBEAA, 0xEA93, 0xCFA3, 0x73BF, 0xAE2F, 0x2C3E, 0xF83D,
+    0x33A4, 0xB9D1, 0x23A8, 0xD95C, 0xA6B1, 0x5492, 0xB985, 0x93CB,
+    // M^512
+    0x5BB8, 0x05D6, 0x8975, 0x107B, 0xDDE8, 0x13C5, 0xE86C, 0x5B9D,
+    0xC4D7, 0x8EA0, 0x4756, 0x1CB6, 0xDA81, 0x09B4, 0x3BB2, 0xB809,
+    // M^1024
+    0x3239, 0x613B, 0x94E4, 0xB2D5, 0x7642, 0xF1CA, 0xF41E, 0xF331,
+    0x7DEF, 0x2511, 0x8FB4, 0x9872, 0xCB09, 0xC4A4, 0x1592, 0x3C49,
+    // M^2048
+    0x2DD8, 0xCA86, 0x1AF5, 0xC145, 0x25BF, 0x8F58, 0x988A, 0xCB39,
+    0xF3C0, 0x7284, 0x932C, 0x7D9F, 0x69BB, 0x3070, 0xDD1A, 0x6C99,
+    // M^4096
+    0x9A4A, 0xA5D2, 0xA8D9, 0xEDE4, 0x0DAC, 0x7F1E, 0xB847, 0x0B22,
+    0x3ABF, 0x2799, 0xD08E, 0x4BCA, 0x24F0, 0x6BA6, 0xEB37, 0x01C2,
+    // M^8192
+    0xB910, 0x9B4E, 0xE8C9, 0x440A, 0x90FA, 0xCF40, 0x2A58, 0x8C20,
+    0x2030, 0xD72E, 0x25C8, 0x4688, 0x7AFF, 0xAF4A, 0x324C, 0x2C08,
+    // M^16384
+    0x0FFF, 0xFAB4, 0xACE4, 0xC8C0, 0x7071, 0xA042, 0xC044, 0x8008,
+    0xF0F0, 0x4EA0, 0x48C0, 0x0880, 0x0100, 0xE200, 0x8400, 0x8800,
+    // M^32768
+    0xFF00, 0x55FF, 0x66AA, 0x44CC, 0x7888, 0x50F0, 0x60A0, 0x40C0,
+    0x7F7F, 0xAAAA, 0xCCCC, 0x8888, 0xF0F0, 0xA0A0, 0xC0C0, 0x8080
+  };
+  __xor16_798_state = __xor16_jump(__xor16_798_state, table, n);
+  return __xor16_798_state;
+}
+
+uint16_t xor16_798_prev() {
+    __asm__ __volatile__(
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
       "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_798_state)::"r18","r19");
   return __xor16_798_state;
 }
+
+static const uint16_t __xor16_798_checkpoints[256] PROGMEM = {
+  0x0001, 0xA20C, 0x5BB8, 0xA613, 0x3239, 0xFBCD, 0xD87B, 0x7708,
+  0x2DD8, 0xF5DD, 0xE8E1, 0x7FA0, 0x6D35, 0xB148, 0xB1D1, 0x57FC,
+  0x9A4A, 0x08C0, 0x0D5F, 0xAF47, 0x6DD3, 0x9F5D, 0x9D46, 0x842D,
+  0x9970, 0x2E2C, 0x9CA8, 0x563F, 0x614B, 0x2188, 0x50A8, 0x8685,
+  0xB910, 0xF8AF, 0x6EB5, 0xC300, 0xA03B, 0xC9CC, 0x3185, 0x7125,
+  0x9EB2, 0xED58, 0x27AE, 0x30C7, 0xD015, 0xB7DF, 0x561F, 0xCF64,
+  0x324D, 0xE0F0, 0x774F, 0xF7D3, 0xCAAA, 0x6DD8, 0x4C58, 0xD353,
+  0x45AD, 0x78A7, 0x32DD, 0x6B72, 0xF13A, 0x4750, 0x4FD9, 0x0317,
+  0x0FFF, 0x4084, 0xAB2B, 0xE95A, 0xBAAC, 0x7247, 0x287C, 0x5950,
+  0xAA4D, 0x0CD6, 0x0971, 0xB95A, 0xA598, 0x9374, 0xA432, 0x87CB,
+  0x3D10, 0x48CC, 0x91EA, 0x0DFB, 0x13C6, 0xACFE, 0xAFA4, 0x0B59,
+  0x6107, 0x2886, 0x21CA, 0xC23C, 0x6B3F, 0x5A38, 0x6D8A, 0xAD73,
+  0xE301, 0x56A5, 0x9BC0, 0xB250, 0x87B8, 0xD018, 0x30E3, 0x94A9,
+  0x2D6F, 0x2645, 0xAA4A, 0xFAE3, 0xDE6A, 0x3CC2, 0x627E, 0x3EF2,
+  0x063F, 0x7E7F, 0xC0BB, 0xDCE6, 0x581E, 0x2E4D, 0xBCB5, 0xF62E,
+  0x77A1, 0x1665, 0xF646, 0x3A13, 0xFDB7, 0xC2A5, 0x8D12, 0x978E,
+  0xFF00, 0xA8EC, 0x4119, 0x9431, 0x694E, 0xB04B, 0x9ED3, 0xCD45,
+  0x87BF, 0x262D, 0xE7F8, 0x1131, 0xEA89, 0x8BC3, 0x0847, 0x0357,
+  0x23C1, 0xA8E8, 0xAB8A, 0x1D44, 0xA94C, 0x24AF, 0x18BE, 0xC1DA,
+  0xCF5F, 0x3CD8, 0x60C8, 0xF6B7, 0x918C, 0xDBD3, 0x64CC, 0x3F8C,
+  0x5FAF, 0x0031, 0x7F9C, 0x9595, 0xE66B, 0xB5B1, 0xF645, 0x26B5,
+  0xA3D9, 0x873F, 0xDE10, 0xBC65, 0x5192, 0x19B8, 0xA647, 0x872B,
+  0x473C, 0xE8F8, 0x61B0, 0xFB1E, 0x6361, 0x477F, 0xD860, 0xD7B2,
+  0xBE25, 0xC47D, 0x7F74, 0x201A, 0x5624, 0xC1F1, 0xB275, 0x6108,
+  0x1110, 0xE6AA, 0xC3BE, 0x1E0C, 0xC0A4, 0x96CF, 0x4296, 0xDFEF,
+  0xBFC4, 0x2FF9, 0x402F, 0x2E3C, 0xEF17, 0x8BD7, 0x916B, 0x57CA,
+  0x13E3, 0x4A4E, 0x6EAC, 0xDD10, 0x3610, 0x1BE5, 0xC72B, 0xFEB9,
+  0xD34A, 0x5BBD, 0xEE8C, 0xE0F4, 0x9DDC, 0x7EA6, 0x0AA8, 0xF93C,
+  0xCA35, 0xDFCC, 0x0D4D, 0x6252, 0xB5ED, 0x8CF4, 0x8A3F, 0x1740,
+  0x2352, 0x3FCC, 0x7391, 0xE85D, 0x7F3D, 0x618B, 0xF58B, 0xE359,
+  0xC687, 0xBE3F, 0xC6CB, 0xB731, 0xB7A9, 0xF388, 0x6586, 0x511F,
+  0x66B9, 0x3F6C, 0x2583, 0xA005, 0x8FC6, 0x6370, 0x96CC, 0x5E30
+};
+static const uint8_t __xor16_798_order[256] PROGMEM = {
+    0, 161,  63, 143, 112, 142,  17,  74, 222,  87,  73, 226,  18,  83,  64, 192,
+  139,  84, 208, 121, 231, 150, 173, 213, 147, 195, 187,  29,  90, 232, 144, 149,
+  250, 137, 105, 167,  42,  70,  89, 104,   8,  25, 203, 117, 201,  43, 102,  38,
+    4,  48,  58, 212, 123, 109, 153,  80, 111, 249, 159, 233, 202,  65, 130, 198,
+   56, 176,  61, 181,  81, 209,  54,  62,  30, 247, 172,  46, 188,  27,  97, 207,
+   15, 116,  71,  93,   2, 217, 255, 160, 154,  88, 191,  28, 237, 178, 227, 110,
+  180, 253, 158, 246, 248, 132,  92,  59,  12,  94,  20,  53, 210,  34,  39,  69,
+  234,   7,  50, 120,  57, 113, 221, 236, 186, 162,  11,  23,  31, 175, 169, 100,
+  136,  79, 230, 141, 205, 229, 126, 252, 206, 156,  82,  77, 131, 103, 163, 254,
+  197, 127,  24,  16,  98,  26,  22, 220,  40, 134,  21, 251,  36,   1, 168,  78,
+   76,   3, 174, 145, 129, 148, 106,  72,  66, 146,  85,  95,  19,  86, 133,  13,
+   14,  99, 190, 165, 228, 243, 244,  45,  32,  75,  68, 171, 118, 184, 241, 200,
+  196, 114, 151, 189,  91, 125,  35, 194, 185, 240, 242, 214,  37, 224,  52, 135,
+  152,  47,  44, 101, 216,  55, 183, 182,   6, 157, 115, 211, 170, 108, 225, 199,
+   49, 219,  96, 239, 164, 193, 138, 235,  10, 177,  67, 140,  41, 218, 204,  60,
+  245, 238,   9, 119, 166, 122, 155,  51,  33, 223, 107, 179,   5, 124, 215, 128
+};
+
+uint16_t xor16_798_position() {
+  uint16_t saved = __xor16_798_state;
+  uint16_t pos = __xor16_position(saved, xor16_798, __xor16_798_checkpoints, __xor16_798_order);
+  __xor16_798_state = saved;
+  return pos;
+}
+
+void xor16_798_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_798, xor16_798, __xor16_798_checkpoints);
+}
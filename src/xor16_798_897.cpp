@@ -0,0 +1,57 @@
+// XOR 16 // two full period generators, 798 and 897, with 897 clocked by 798 //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+static uint16_t __xor16_798_897_a;
+static uint16_t __xor16_798_897_b;
+
+bool seed_xor16_798_897(uint32_t seed) {
+  if (__builtin_constant_p(seed)) {
+    if((uint16_t)seed == 0 || (uint16_t)(seed >> 16) == 0) {
+      badArg("both halves of the seed must be non-zero, but one of them is always zero");
+    }
+  }
+  if((uint16_t)seed && (uint16_t)(seed >> 16)) {
+    __xor16_798_897_a = seed;
+    __xor16_798_897_b = seed >> 16;
+    return 1;
+  }
+  return 0;
+}
+
+uint16_t xor16_798_897() {
+  uint16_t ret;
+  __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "sbrs   %B0, 7"        "\n\t" // 897 only steps when bit 15 of 798 is set
+      "rjmp   1f"            "\n\t"
+      "eor    %B1, %A1"      "\n\t"
+      "mov    r18, %B1"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A1, r18"      "\n\t"
+      "movw   r18, %A1"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A1, r18"      "\n\t"
+      "eor    %B1, r19"      "\n\t"
+    "1:"                             "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "eor    %A2, %A1"      "\n\t"
+      "eor    %B2, %B1"      "\n\t"
+    :"+d"(__xor16_798_897_a), "+d"(__xor16_798_897_b), "=&r"(ret)::"r18","r19");
+  return ret;
+}
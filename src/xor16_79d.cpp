@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 79d //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_79d_state;
+uint16_t __xor16_79d_state;
 
 bool seed_xor16_79d(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -37,3 +38,202 @@ uint16_t xor16_79d() {
     :"+d"((uint16_t)__xor16_79d_state)::"r18","r19");
   return __xor16_79d_state;
 }
+
+void xor16_79d_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_79d_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_79d_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x2081, 0x4102, 0xA205, 0x440A, 0x8814, 0x1028, 0x2050, 0x40A0,
+    0x8140, 0x2201, 0x4402, 0x8804, 0x1008, 0x2010, 0x4020, 0x8040,
+    // M^2
+    0x4031, 0x8062, 0x00D5, 0x012A, 0x2255, 0x442A, 0x8854, 0x10A8,
+    0x2150, 0x2290, 0x4520, 0xAA41, 0x5402, 0xA804, 0x5008, 0xA010,
+    // M^4
+    0x7646, 0xEC0C, 0xFA4D, 0xE432, 0x6071, 0xD04A, 0xA085, 0x01AA,
+    0x2355, 0xB869, 0x7052, 0x48A0, 0xC148, 0xA280, 0x0520, 0x2A41,
+    // M^8
+    0x1817, 0xAB6C, 0x74DC, 0xA184, 0xC158, 0x4692, 0x0560, 0xFA8B,
+    0x7543, 0xE392, 0x4A10, 0x9C60, 0x4883, 0x3102, 0x834D, 0x848A,
+    // M^16
+    0xD21C, 0x2993, 0x5B37, 0x4E9C, 0x1738, 0xBA70, 0x7CA1, 0xE9C0,
+    0x7384, 0x30AB, 0x3DE7, 0x598B, 0x56DD, 0xA7AE, 0xDA74, 0x3EF9,
+    // M^32
+    0x8068, 0x88D6, 0x9BFD, 0x65E0, 0xCBC1, 0x7743, 0xCEC7, 0xFC4D,
+    0xDADF, 0x17D0, 0x6932, 0xFA75, 0xC40B, 0x8817, 0x51AE, 0x011D,
+    // M^64
+    0xDD79, 0x1108, 0x0211, 0x2F9D, 0xD52B, 0x7FF6, 0x75ED, 0x3F5A,
+    0x76F5, 0x997D, 0xCD47, 0x98DA, 0x54DF, 0xA3EA, 0xB2BF, 0x6F6B,
+    // M^128
+    0x87B7, 0x0DB7, 0x912F, 0x037B, 0xAEA3, 0x0CEC, 0x3B8C, 0xD373,
+    0x2EB2, 0xFA5E, 0x4531, 0x0267, 0x5546, 0x28DD, 0x7559, 0x42B7,
+    // M^256
+    0xB979, 0x03F7, 0x2DFB, 0xC454, 0x82FD, 0x3111, 0xEA37, 0xA587,
+    0xE95E, 0xB880, 0x3B22, 0xD611, 0xEC88, 0x7905, 0x72A2, 0xE514,
+    // M^512
+    0x6B20, 0x3AF7, 0xFFEE, 0xE9A5, 0xF11E, 0x4757, 0xA4BB, 0x7C9F,
+    0x536E, 0x030F, 0x20A4, 0xC318, 0x6253, 0x4CE2, 0xC8CE, 0x93C9,
+    // M^1024
+    0x5002, 0x2EF2, 0x75A4, 0x2895, 0xFB7A, 0x4397, 0x8D2B, 0xCFDE,
+    0x35AC, 0x17FD, 0x88C4, 0x13DD, 0x8351, 0x8EF6, 0x6C87, 0xFB5A,
+    // M^2048
+    0xC124, 0xD6F8, 0x25A5, 0x8C29, 0x9857, 0x7126, 0x401D, 0xE4D9,
+    0x61B7, 0xDEEF, 0xDFD6, 0x15BC, 0xFF58, 0xD6F0, 0xBDE2, 0xDBC0,
+    // M^4096
+    0x5316, 0x59DF, 0x19EF, 0x2D81, 0xDB17, 0x7786, 0x4D1D, 0x1E9A,
+    0x3574, 0xE64D, 0x2386, 0xE51D, 0x6EDB, 0xD5F6, 0x5AAF, 0x975A,
+    // M^8192
+    0x7C6A, 0x522A, 0xA414, 0x6B95, 0x5D3B, 0x4F97, 0x152F, 0xFFDE,
+    0x55BC, 0xF7AD, 0x5865, 0xB29E, 0x0057, 0x0AFA, 0x609F, 0xEB6A,
+    // M^16384
+    0xE3CE, 0xE14D, 0x40DA, 0x0071, 0x88F6, 0x00C4, 0xA3D8, 0xE3D3,
+    0x4FE2, 0x788E, 0x5090, 0x2924, 0xC240, 0x84D1, 0x2941, 0xF287,
+    // M^32768
+    0x8996, 0x1048, 0x0080, 0xC824, 0xB20D, 0x00D1, 0x89B6, 0xA205,
+    0xC61B, 0x04C1, 0x8024, 0xA209, 0x0090, 0x8924, 0xA201, 0x4453
+  };
+  __xor16_79d_state = __xor16_jump(__xor16_79d_state, table, n);
+  return __xor16_79d_state;
+}
+
+uint16_t xor16_79d_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_79d_state)::"r18","r19");
+  return __xor16_79d_state;
+}
+
+static const uint16_t __xor16_79d_checkpoints[256] PROGMEM = {
+  0x0001, 0xB979, 0x6B20, 0xBD79, 0x5002, 0x9DDD, 0x906A, 0x1519,
+  0xC124, 0x6202, 0xB0D0, 0xBDD4, 0x9442, 0xDB7E, 0x4F72, 0x9463,
+  0x5316, 0x6305, 0xCEFB, 0x4083, 0x6DAB, 0xE586, 0xB744, 0xDDA9,
+  0x96E8, 0x30CB, 0xA4E7, 0x4EE7, 0xCEC5, 0x1937, 0xF75E, 0xEA55,
+  0x7C6A, 0x1699, 0x357D, 0x4EFC, 0x32E2, 0x505B, 0x883A, 0x474A,
+  0x35CA, 0xCFE2, 0x560D, 0x4D5E, 0xF45D, 0x0105, 0x7DDC, 0xC7A0,
+  0x69DC, 0x100A, 0x2B2B, 0xB101, 0x20BE, 0x8536, 0xAA88, 0x9353,
+  0x8A06, 0xA589, 0x96C7, 0x52FB, 0xA42C, 0x7F8D, 0xAE93, 0x5456,
+  0xE3CE, 0x1A85, 0xB31C, 0x4A15, 0x0A4C, 0x6D09, 0x72E7, 0xB67B,
+  0xD43A, 0x3453, 0x7CEB, 0x0A67, 0x22C2, 0x8DC2, 0xAD3E, 0xC1C8,
+  0xF50C, 0x39E8, 0x1037, 0xC811, 0x7A23, 0x0221, 0x30E8, 0x2F78,
+  0x5867, 0x0468, 0x2450, 0x2AED, 0x39E3, 0x6EED, 0x7063, 0x8687,
+  0x5444, 0x62C4, 0xD16C, 0xA0E9, 0x9F9D, 0xC2DD, 0xB2AD, 0x0C59,
+  0xF8D4, 0x349C, 0x607A, 0x95DF, 0x458C, 0xECF6, 0xD1D0, 0x5F2D,
+  0x4300, 0x237C, 0x98AF, 0x183A, 0x4ED6, 0xC450, 0xC45E, 0x2E06,
+  0x02BA, 0x6948, 0x1A8B, 0x5944, 0x66A9, 0x61BE, 0x1ECA, 0x3128,
+  0x8996, 0xD32D, 0x4B27, 0x5309, 0xB2D9, 0x7879, 0x15C8, 0xB510,
+  0x2018, 0x3FAC, 0x5459, 0xB0EF, 0x5D19, 0x6597, 0x69D4, 0xD45E,
+  0xC28E, 0x60E9, 0x082B, 0x99DA, 0x3C3D, 0x9B84, 0x062F, 0xE192,
+  0x2360, 0xF3FD, 0xFF6F, 0x36D1, 0x621B, 0x4F00, 0xCE4F, 0x7B13,
+  0x5893, 0xD5CF, 0xB5D3, 0xD526, 0xB65F, 0xC8D0, 0x8CEA, 0xB125,
+  0x3C54, 0x3D8F, 0x6746, 0xA560, 0x954B, 0x4F0D, 0x9E99, 0x0678,
+  0x1E2D, 0xD8FC, 0xB8DC, 0x826A, 0x4111, 0xA078, 0x019E, 0x247C,
+  0xF253, 0x68FF, 0x72CB, 0x6EC5, 0x8526, 0x2875, 0x624D, 0x09C6,
+  0x5EF3, 0x8D4B, 0x7594, 0x3FD2, 0xE7DA, 0x8EA1, 0x9D48, 0x2392,
+  0x0C56, 0xABF5, 0x7300, 0xB6F1, 0xB61E, 0x9B9E, 0x4371, 0xC3DE,
+  0xE17D, 0x0EE0, 0x2B12, 0x7FC0, 0x1472, 0x8D86, 0x6AF2, 0x9A9D,
+  0x10A1, 0xC167, 0x32BB, 0x45BC, 0x5F1A, 0x6799, 0x3B0C, 0xFBED,
+  0xAB83, 0x04D7, 0x611A, 0xA7A7, 0xF50E, 0x3A1F, 0x2AC0, 0x5824,
+  0x54D1, 0xD13C, 0xC823, 0xCA38, 0x8E9F, 0xC4FC, 0xB967, 0x0385,
+  0x60DB, 0xB830, 0x1564, 0xC829, 0x0D9B, 0x5DCD, 0x8521, 0xBF00,
+  0xCC74, 0x0EA5, 0x55A7, 0x4FB5, 0x4CA6, 0x250B, 0xD5A3, 0x875A
+};
+static const uint8_t __xor16_79d_order[256] PROGMEM = {
+    0,  45, 182,  85, 120, 239,  89, 225, 150, 175, 146, 191,  68,  75, 200, 103,
+  244, 249, 209,  49,  82, 216, 212,   7, 242, 134,  33, 115,  29,  65, 122, 176,
+  126, 136,  52,  76, 152, 113, 199,  90, 183, 253, 189, 230,  91, 210,  50, 119,
+   87,  25,  86, 127, 218,  36,  73, 105,  34,  40, 155,  92,  81, 229, 222, 148,
+  168, 169, 137, 195,  19, 180, 112, 206, 108, 219,  39,  67, 130, 252,  43, 116,
+   27,  35, 157, 173,  14, 251,   4,  37,  59, 131,  16,  96,  63, 138, 232, 250,
+   42, 231,  88, 160, 123, 140, 245, 192, 220, 111, 106, 240, 145, 226, 125,   9,
+  156, 190,  97,  17, 141, 124, 170, 221, 185, 121, 142,  48, 214,   2,  69,  20,
+  187,  93,  94, 186,  70, 202, 194, 133,  84, 159,  32,  74,  46,  61, 211, 179,
+  246, 188,  53,  95, 255,  38, 128,  56, 166, 193, 213,  77, 236, 197,   6,  55,
+   12,  15, 172, 107,  58,  24, 114, 147, 215, 149, 205, 198,   5, 174, 100, 181,
+   99,  60,  26, 171,  57, 227,  54, 224, 201,  78,  62,  10, 139,  51, 167, 102,
+  132,  66, 135, 162, 204, 164,  71, 203,  22, 241, 178, 238,   1,   3,  11, 247,
+    8, 217,  79, 144, 101, 207, 117, 118, 237,  47,  83, 234, 243, 165, 235, 248,
+  158,  28,  18,  41, 233,  98, 110, 129,  72, 143, 163, 254, 161, 177,  13,  23,
+  208, 151,  64,  21, 196,  31, 109, 184, 153,  44,  80, 228,  30, 104, 223, 154
+};
+
+uint16_t xor16_79d_position() {
+  uint16_t saved = __xor16_79d_state;
+  uint16_t pos = __xor16_position(saved, xor16_79d, __xor16_79d_checkpoints, __xor16_79d_order);
+  __xor16_79d_state = saved;
+  return pos;
+}
+
+void xor16_79d_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_79d, xor16_79d, __xor16_79d_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 7f1 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_7f1_state;
+uint16_t __xor16_7f1_state;
 
 bool seed_xor16_7f1(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -38,3 +39,222 @@ uint16_t xor16_7f1() {
     :"+d"((uint16_t)__xor16_7f1_state)::"r18","r19");
   return __xor16_7f1_state;
 }
+
+void xor16_7f1_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_7f1_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_7f1_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0183, 0x0306, 0x060C, 0x0C18, 0x1830, 0x3060, 0x60C0, 0xC180,
+    0x8303, 0x0600, 0x0C00, 0x1800, 0x3000, 0x6000, 0xC000, 0x8003,
+    // M^2
+    0x4006, 0x8009, 0x0014, 0x0028, 0x0050, 0x00A0, 0x0140, 0x0280,
+    0x0785, 0x0A00, 0x1400, 0x2800, 0x5000, 0xA000, 0x4003, 0x8286,
+    // M^4
+    0xC01E, 0xC2A8, 0x0044, 0x0088, 0x0110, 0x0220, 0x06C5, 0x0880,
+    0x5B17, 0x2200, 0x4400, 0x8800, 0x1003, 0x2286, 0x800C, 0x0A1B,
+    // M^8
+    0x4963, 0xA23F, 0x0681, 0x0808, 0x5A07, 0x2020, 0xA81F, 0x8080,
+    0x62FA, 0x0086, 0xC40C, 0x821B, 0x12B5, 0xCAEA, 0x0AD7, 0xA92E,
+    // M^16
+    0x8955, 0xFCB0, 0x0D69, 0x8A13, 0x7722, 0xEACA, 0x5E0D, 0x29AE,
+    0x3834, 0x243E, 0x697C, 0x10FB, 0xA776, 0x83EC, 0x1DD8, 0x0FB3,
+    // M^32
+    0x8A6F, 0xFB30, 0xF632, 0x39B1, 0x5A4E, 0xA442, 0xE938, 0x138D,
+    0xA4E0, 0x0CB2, 0xF264, 0xB2CB, 0xCB15, 0x09AA, 0x6C57, 0xA42E,
+    // M^64
+    0xE9F1, 0xEE53, 0xF12C, 0xB37A, 0xC4B0, 0x4DE8, 0x1045, 0x3526,
+    0x0117, 0x561E, 0xBD3C, 0xD878, 0xF4F3, 0x6365, 0x1149, 0xCF11,
+    // M^128
+    0x2198, 0x5D30, 0x4767, 0xCBBA, 0xDF1A, 0xAEEB, 0xFC6B, 0x792A,
+    0x3329, 0x662D, 0xF7DA, 0xD8B4, 0x5F6B, 0x6055, 0xBF2A, 0xC154,
+    // M^256
+    0x3EF6, 0x8DF7, 0x74BB, 0x6D9F, 0x12EF, 0x74FA, 0x8BBC, 0x53E8,
+    0x2EF3, 0x4D26, 0x2F4F, 0xB61D, 0x7FB9, 0x9AF1, 0xBC61, 0x2941,
+    // M^512
+    0x7631, 0xE71B, 0x9D05, 0x7A13, 0x3414, 0x284F, 0xD050, 0x613C,
+    0x43C5, 0x8676, 0x41EF, 0x9B5D, 0xC53A, 0x2D74, 0x94EB, 0xB755,
+    // M^1024
+    0xD156, 0x55BB, 0x002C, 0xC4B0, 0x00B0, 0x1045, 0x02C0, 0x0117,
+    0x0B00, 0xC6D9, 0x3831, 0x59E2, 0xA0C7, 0xE50D, 0x419A, 0xD437,
+    // M^2048
+    0x698D, 0x83D3, 0xD4D9, 0xBC7E, 0x11E2, 0x737D, 0xC50E, 0x8F71,
+    0x943B, 0x7DC4, 0xDD8B, 0xF596, 0xB62C, 0x565B, 0xDA36, 0x996F,
+    // M^4096
+    0x639B, 0xC153, 0xA690, 0x1DE0, 0x98C6, 0x7505, 0xE19D, 0x9691,
+    0xC677, 0x18C1, 0x9002, 0x2307, 0xC28D, 0x4E99, 0x48B2, 0x7A64,
+    // M^8192
+    0x69E2, 0x2F32, 0xB269, 0xB5F6, 0x8B21, 0x57D8, 0x6C84, 0x5DE6,
+    0xB213, 0xF51D, 0x79BA, 0x9477, 0x646D, 0x935A, 0xD1B4, 0xCD68,
+    // M^16384
+    0x2D02, 0xCA52, 0x280A, 0x8136, 0x202B, 0x84D8, 0x40AC, 0x11E6,
+    0x02B3, 0xC51E, 0x1B3C, 0x947B, 0x6E75, 0x936A, 0xF9D4, 0xCDA8,
+    // M^32768
+    0xD4CC, 0xCFCC, 0x4C75, 0x89B0, 0x71D4, 0x26C3, 0xC5D6, 0x5B0C,
+    0x975B, 0x6EB6, 0x306C, 0x3AD8, 0xC1B0, 0xEB60, 0x06C0, 0xAD80
+  };
+  __xor16_7f1_state = __xor16_jump(__xor16_7f1_state, table, n);
+  return __xor16_7f1_state;
+}
+
+uint16_t xor16_7f1_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_7f1_state)::"r18","r19");
+  return __xor16_7f1_state;
+}
+
+static const uint16_t __xor16_7f1_checkpoints[256] PROGMEM = {
+  0x0001, 0x3EF6, 0x7631, 0x63A3, 0xD156, 0xA475, 0x3B1B, 0xFCF1,
+  0x698D, 0xCA44, 0x911C, 0x73C0, 0xE2A8, 0x087A, 0xBBDC, 0xCA5E,
+  0x639B, 0xDADC, 0xC23D, 0x99C1, 0x28B4, 0x6DAA, 0x564B, 0xF493,
+  0xAD21, 0x4E1D, 0x5D28, 0x6D1C, 0x9AFA, 0xF3EA, 0x5F7B, 0x0A68,
+  0x69E2, 0x9F27, 0x1F3F, 0x490E, 0xB05C, 0x4C7E, 0x5C49, 0x825F,
+  0x5711, 0xA35B, 0x97A8, 0x50EF, 0xC553, 0xBECE, 0x54FA, 0xB2BE,
+  0x2001, 0xA407, 0x5B45, 0xD7E1, 0x345B, 0x8DCA, 0xA6DC, 0x0246,
+  0x3FD6, 0x2C38, 0x0829, 0x918E, 0xBF30, 0x509B, 0x5C41, 0xEFC0,
+  0x2D02, 0xA0A7, 0x5318, 0xDF7D, 0xDA65, 0xA4A9, 0xE884, 0x9E9F,
+  0x69AE, 0x0DBF, 0x2879, 0x922C, 0x7600, 0x3B40, 0xBB3C, 0x66F0,
+  0xFAB8, 0xD331, 0xD1AF, 0x495D, 0x9A0E, 0x3910, 0x6F49, 0x04C2,
+  0x7AEC, 0x1798, 0x1FBB, 0x6E5D, 0x4C65, 0x9038, 0x5D72, 0x1427,
+  0xE3B6, 0xA0B5, 0xCC00, 0x0C72, 0xF90C, 0xF1A2, 0xF47E, 0x265D,
+  0x4619, 0x9F8E, 0x6B44, 0x0C5F, 0xAA24, 0x48CA, 0x3240, 0x23D2,
+  0xBE68, 0x8AA4, 0x81D3, 0x7E08, 0xE0C2, 0x5A72, 0x58BD, 0x67EA,
+  0x26CC, 0x39E8, 0xBC97, 0xD3E6, 0xDCAE, 0xC00A, 0x7548, 0xBEB6,
+  0xD4CC, 0x04A6, 0xF111, 0x7282, 0xCA10, 0x7CF4, 0x0A81, 0x9625,
+  0x0A26, 0x768D, 0x4F7A, 0x4B27, 0xDAE9, 0xEE65, 0x6EAE, 0x4125,
+  0xAC25, 0x1455, 0x83E8, 0x8BA5, 0x91D6, 0x4BFC, 0xCECC, 0x8024,
+  0x2900, 0x021F, 0xF5EC, 0xC45E, 0xB7EF, 0x8618, 0x3458, 0x3ECB,
+  0x37F6, 0xEEDF, 0xBB3B, 0xA14A, 0xF697, 0x94BC, 0x556E, 0xA9F1,
+  0xABE9, 0x99BF, 0x51CE, 0xA1AC, 0xA375, 0x7781, 0x78AD, 0xEFF4,
+  0x3FAC, 0x21F9, 0x592A, 0xCFA4, 0x3C0E, 0xE8C9, 0x32F1, 0x28D9,
+  0xB53E, 0x3F73, 0x4167, 0xAA6E, 0x231E, 0x7F18, 0xDCDE, 0x2DA3,
+  0xB943, 0x6C5A, 0xC6F9, 0x1A61, 0x4532, 0x563F, 0x6D81, 0xFC2F,
+  0x37E5, 0x4F31, 0x1E05, 0xE180, 0x72CA, 0x2C33, 0xD6B7, 0x7AB7,
+  0x5055, 0x10C6, 0x5EA1, 0x0E48, 0x3257, 0xF687, 0x8653, 0x617A,
+  0x05A2, 0xAB59, 0xAC42, 0x2CA9, 0x77D8, 0xB297, 0x0792, 0x806A,
+  0x366F, 0xD242, 0xA1F4, 0x57B9, 0xE9D6, 0xA4C8, 0x2934, 0x10B1,
+  0x74B2, 0xCE6C, 0xA736, 0x6073, 0x7838, 0xE4BE, 0x81B0, 0x324F,
+  0x89F7, 0xC854, 0xCED5, 0xC1A2, 0x1136, 0xCE13, 0xE0BA, 0xDA44,
+  0xEEA5, 0xB6FA, 0xF049, 0xA8BD, 0x1782, 0xED3C, 0xC741, 0x6CF0
+};
+static const uint8_t __xor16_7f1_order[256] PROGMEM = {
+    0, 153,  55, 129,  87, 216, 222,  58,  13, 136,  31, 134, 107,  99,  73, 211,
+  231, 209, 244,  95, 145, 252,  89, 195, 202,  34,  90,  48, 177, 188, 111, 103,
+  120,  74,  20, 183, 152, 230, 205,  57, 219,  64, 191, 110, 239, 212, 182, 158,
+   52, 224, 200, 160,  85, 121,   6,  77, 180, 159,   1, 185, 176,  56, 143, 186,
+  196, 104, 109,  35,  83, 139, 149,  92,  37,  25, 201, 138, 208,  61,  43, 170,
+   66,  46, 166, 197,  22,  40, 227, 118, 178, 117,  50,  62,  38,  26,  94, 210,
+   30, 235, 215,  16,   3,  79, 119,   8,  72,  32, 106, 193, 255,  27, 198,  21,
+   91, 142,  86, 131, 204,  11, 232, 126,  76,   2, 137, 173, 220, 236, 174, 207,
+   88, 133, 115, 189, 151, 223, 238, 114,  39, 146, 157, 214, 240, 113, 147,  53,
+   93,  10,  59, 148,  75, 165, 135,  42, 169,  19,  84,  28,  71,  33, 105,  65,
+   97, 163, 171, 226,  41, 172,  49,   5,  69, 229,  54, 234, 251, 167, 108, 187,
+  217, 168, 144, 218,  24,  36, 221,  47, 184, 249, 156, 192, 162,  78,  14, 122,
+  112, 127,  45,  60, 125, 243,  18, 155,  44, 194, 254, 241, 132,   9,  15,  98,
+  245, 233, 150, 242, 179,   4,  82, 225,  81, 123, 128, 206,  51, 247,  68,  17,
+  140, 124, 190,  67, 246, 116, 203,  12,  96, 237,  70, 181, 228, 253, 141, 248,
+  161,  63, 175, 250, 130, 101,  29, 102,  23, 154, 213, 164, 100,  80, 199,   7
+};
+
+uint16_t xor16_7f1_position() {
+  uint16_t saved = __xor16_7f1_state;
+  uint16_t pos = __xor16_position(saved, xor16_7f1, __xor16_7f1_checkpoints, __xor16_7f1_order);
+  __xor16_7f1_state = saved;
+  return pos;
+}
+
+void xor16_7f1_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_7f1, xor16_7f1, __xor16_7f1_checkpoints);
+}
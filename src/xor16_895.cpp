@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: 895 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_895_state;
+uint16_t __xor16_895_state;
+static uint16_t __xor16_895_weyl_count;
+static uint8_t __xor16_895_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_895_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_895(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_895(uint16_t seed) {
   }
   if(seed) {
     __xor16_895_state = seed;
+    __xor16_895_spare_full = 0;
     return 1;
   }
   return 0;
@@ -18,24 +23,400 @@ bool seed_xor16_895(uint16_t seed) {
 
 uint16_t xor16_895() {
     __asm__ __volatile__(
-      "mov    r19, %A0"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_895_state)::"r18","r19");
+  return __xor16_895_state;
+}
+
+uint16_t xor16_895_star() {
+    __asm__ __volatile__(
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_895_state)::"r18","r19");
+  return rng16::star(__xor16_895_state);
+}
+
+/* The same step as xor16_895(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_895_weyl(uint16_t seed) {
+  __xor16_895_state = seed ? seed : 1;
+  __xor16_895_weyl_count = seed;
+  __xor16_895_spare_full = 0;
+}
+
+uint16_t xor16_895_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "eor    %B0, %A0"      "\n\t"
       "mov    r18, %B0"      "\n\t"
       "lsr    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_895_state), "+d"(__xor16_895_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_895(). */
+uint8_t xor16_895_byte() {
+  if (__xor16_895_spare_full) {
+    __xor16_895_spare_full = 0;
+    return __xor16_895_spare;
+  }
+    __asm__ __volatile__(
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_895_state)::"r18","r19");
+  __xor16_895_spare = __xor16_895_state >> 8;
+  __xor16_895_spare_full = 1;
+  return __xor16_895_state;
+}
+
+/* n bytes, the same ones n calls to xor16_895_byte() would return; whole steps go through xor16_895_fill(). */
+void xor16_895_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_895_spare_full) {
+    __xor16_895_spare_full = 0;
+    *dst++ = __xor16_895_spare;
+    n--;
+  }
+  xor16_895_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_895_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 26 eors. */
+void xor16_895_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r9"       "\n\t" // y ^= y << 8
+      "eor    r16, r8"       "\n\t"
+      "eor    r15, r7"       "\n\t"
+      "eor    r14, r6"       "\n\t"
+      "eor    r13, r5"       "\n\t"
+      "eor    r12, r4"       "\n\t"
+      "eor    r11, r3"       "\n\t"
+      "eor    r10, r2"       "\n\t"
+      "eor    r2, r11"       "\n\t" // y ^= y >> 9
+      "eor    r3, r12"       "\n\t"
+      "eor    r4, r13"       "\n\t"
+      "eor    r5, r14"       "\n\t"
+      "eor    r6, r15"       "\n\t"
+      "eor    r7, r16"       "\n\t"
+      "eor    r8, r17"       "\n\t"
+      "eor    r17, r12"      "\n\t" // y ^= y << 5
+      "eor    r16, r11"      "\n\t"
+      "eor    r15, r10"      "\n\t"
+      "eor    r14, r9"       "\n\t"
+      "eor    r13, r8"       "\n\t"
+      "eor    r12, r7"       "\n\t"
+      "eor    r11, r6"       "\n\t"
+      "eor    r10, r5"       "\n\t"
+      "eor    r9, r4"        "\n\t"
+      "eor    r8, r3"        "\n\t"
+      "eor    r7, r2"        "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_895_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_895_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_895_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x2121, 0x4263, 0x84C6, 0x098C, 0x1318, 0x2630, 0x4C60, 0x98C0,
+    0x2100, 0x4221, 0x8442, 0x0884, 0x1108, 0x2210, 0x4420, 0x8840,
+    // M^2
+    0x0401, 0x0F13, 0x1E07, 0x3C0E, 0x68BD, 0xD15B, 0xA2B6, 0x456C,
+    0x0310, 0x0110, 0x0201, 0x1482, 0x3984, 0x7329, 0xE652, 0xCCA4,
+    // M^4
+    0x0600, 0x772C, 0x3B02, 0x7134, 0x5B7B, 0xED75, 0x5303, 0xB6A7,
+    0x6ABD, 0x6BAD, 0x0511, 0x71FA, 0x0654, 0x47AB, 0x9FD6, 0xB645,
+    // M^8
+    0x6EBC, 0x7D6B, 0x4639, 0x3998, 0x0C7D, 0xA861, 0xE9BE, 0x88FA,
+    0x8EB5, 0xBF73, 0x32D7, 0xE126, 0x5DC6, 0xC01D, 0x371B, 0xF707,
+    // M^16
+    0xC8C3, 0x9C14, 0x4987, 0x4F57, 0x8F4E, 0xF95F, 0x41BE, 0x978A,
+    0x9FE6, 0xD69E, 0x1A7F, 0x1D87, 0x6D8F, 0xDD7C, 0xB8F8, 0x0B38,
+    // M^32
+    0x2CA4, 0xA786, 0xB043, 0x25D8, 0x9EC2, 0x1DA5, 0x5C41, 0x7179,
+    0xD2CF, 0x90AE, 0xC33E, 0x7F4B, 0x3817, 0x772E, 0x493E, 0x6DB9,
+    // M^64
+    0x17C4, 0xFD74, 0xF5E3, 0xF0FD, 0xF3CB, 0xA696, 0xBDB9, 0x0292,
+    0xBFBF, 0x0B6F, 0xD79C, 0x0AA8, 0x95D1, 0xA8E0, 0x55C0, 0xABC8,
+    // M^128
+    0xBC55, 0xBCB5, 0x5817, 0x3B95, 0xD28F, 0x2615, 0x4484, 0x0742,
+    0x477C, 0x4AF9, 0xFCD2, 0x553E, 0x0D1E, 0x103D, 0x1719, 0xF286,
+    // M^256
+    0x3400, 0x51D3, 0xC541, 0x7417, 0xC658, 0x90DB, 0xB49E, 0x0966,
+    0x35D2, 0x3842, 0x7CAC, 0x8A04, 0xE328, 0x2653, 0xA906, 0x51A5,
+    // M^512
+    0xB9D7, 0x618F, 0x3143, 0x761B, 0xBA9C, 0xD8E9, 0xC7C9, 0x0F01,
+    0xA676, 0xAA32, 0xB23E, 0x26A2, 0x37AC, 0x75A8, 0x5CB2, 0x1700,
+    // M^1024
+    0x4E9F, 0x1F6D, 0xFBE3, 0x1265, 0x2B51, 0x8551, 0xF2CC, 0x210F,
+    0x8FD4, 0xEDC2, 0xBB94, 0xDBC3, 0x6CCE, 0xAB0D, 0xF379, 0x89D6,
+    // M^2048
+    0xCCC6, 0xBE0B, 0x03D9, 0x43ED, 0x85DA, 0x2A94, 0x6AEB, 0x9CAD,
+    0x88E6, 0xF28F, 0x067D, 0x2D85, 0x1D0B, 0x3C17, 0xDF4C, 0xC1DD,
+    // M^4096
+    0x7EFD, 0x0896, 0x86DE, 0xF505, 0xC13C, 0xF9B3, 0xD1A3, 0xCDE5,
+    0x8D58, 0x6356, 0xBDA5, 0xCCBB, 0x8F35, 0xFE2A, 0x78D4, 0x6919,
+    // M^8192
+    0x326C, 0x4E2A, 0x11DD, 0xA80C, 0xD7C1, 0xA230, 0x519D, 0xF05D,
+    0x70C5, 0xF627, 0x2835, 0x16D7, 0x36A5, 0x76BA, 0x9ED4, 0x8DD9,
+    // M^16384
+    0xFC44, 0x1207, 0xBBDC, 0x5465, 0x18D3, 0x78B5, 0x7495, 0x5EF3,
+    0x5CBA, 0x42AB, 0x362D, 0xF32D, 0xEFD1, 0x6353, 0x1465, 0x2F9F,
+    // M^32768
+    0xBD31, 0xF8E5, 0x932D, 0x8621, 0xC00A, 0x12C7, 0xAF72, 0xD85C,
+    0x4643, 0xCAAE, 0x934C, 0xC221, 0x4D49, 0xEB22, 0x9244, 0xFF98
+  };
+  __xor16_895_state = __xor16_jump(__xor16_895_state, table, n);
+  return __xor16_895_state;
+}
+
+uint16_t xor16_895_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
     :"+d"((uint16_t)__xor16_895_state)::"r18","r19");
   return __xor16_895_state;
 }
+
+static const uint16_t __xor16_895_checkpoints[256] PROGMEM = {
+  0x0001, 0x3400, 0xB9D7, 0xF03A, 0x4E9F, 0x7C57, 0x4881, 0x1E64,
+  0xCCC6, 0x2761, 0x472A, 0x6D25, 0x2DB5, 0x4B8D, 0xA2A2, 0x87DA,
+  0x7EFD, 0xCCBA, 0x742A, 0xA5CE, 0x63F5, 0x98FF, 0x0777, 0x33B3,
+  0xF2DD, 0xFB6C, 0x2F5F, 0x7B28, 0x0F25, 0x9AA2, 0xC8A5, 0x1A5B,
+  0x326C, 0x682A, 0xB04E, 0xC0C5, 0xB41A, 0x0BEE, 0x4A32, 0x1C10,
+  0xD3D8, 0x19AC, 0x7415, 0x27C8, 0x9E80, 0x7501, 0x1103, 0xB329,
+  0x4982, 0x4E65, 0xB2E8, 0xF5A8, 0x990C, 0xBC0D, 0xE720, 0x3F17,
+  0x5889, 0x895B, 0x8D71, 0x44C2, 0x3981, 0x47CB, 0x7406, 0x8443,
+  0xFC44, 0xBAAF, 0x6BA0, 0x917C, 0xD414, 0x643E, 0x45FF, 0xDF86,
+  0x7D47, 0xBB0B, 0x028E, 0xD1A1, 0x83E4, 0xB457, 0x3A26, 0x7374,
+  0x46B1, 0x860D, 0x901D, 0xF183, 0x64BF, 0x7899, 0x6950, 0x4245,
+  0xD49B, 0xB9DD, 0xD5FE, 0x590B, 0xE43C, 0x4589, 0xA909, 0x8837,
+  0x2DB0, 0xBACC, 0x2A36, 0x5604, 0xCB81, 0x4251, 0xD782, 0x3202,
+  0xACEA, 0x89B9, 0xF181, 0x356C, 0x1916, 0x0E34, 0x5D28, 0x6D98,
+  0xF706, 0xD876, 0xE700, 0xAFCC, 0x8060, 0x75E0, 0x0820, 0x1ADF,
+  0xFE4B, 0x5668, 0x5E92, 0x1A29, 0x81A2, 0xAC19, 0x0711, 0x8364,
+  0xBD31, 0x3527, 0xBC4C, 0x67BE, 0x4109, 0xDCC3, 0x3508, 0xF812,
+  0x2057, 0xF407, 0xE1E6, 0x5293, 0xD881, 0xACE9, 0xEC6A, 0x29D9,
+  0xA232, 0x48E4, 0xCB60, 0x5B72, 0x7E74, 0x85CB, 0xB4E7, 0x65C3,
+  0x1E00, 0x2DC2, 0x0902, 0xEE05, 0xE15B, 0x8820, 0x4B7A, 0xE94B,
+  0xC47C, 0xD744, 0x1B68, 0x34EE, 0x7471, 0xC6CC, 0xB0E3, 0xDC2E,
+  0x9D7D, 0x16BC, 0x4975, 0x058C, 0xF14E, 0x5C11, 0x4EDE, 0xFCC9,
+  0x369F, 0x9A2E, 0x7095, 0x5202, 0x23BF, 0xA0A3, 0x8B98, 0x6D18,
+  0xFE60, 0xD777, 0x2838, 0x8EC3, 0x4764, 0x393E, 0xCCAB, 0x8672,
+  0xA685, 0xCB3F, 0xFD31, 0x9C21, 0xE0FE, 0xD50E, 0xB270, 0x4E81,
+  0x5A8A, 0xD4CA, 0xFF1B, 0x117C, 0x85B1, 0x733E, 0xD7EB, 0x5650,
+  0x7C06, 0x0E47, 0xDAE6, 0x107C, 0xB063, 0xD548, 0x927C, 0xD984,
+  0x687A, 0xC288, 0xBD90, 0x989A, 0xD273, 0xA407, 0xABC8, 0x398D,
+  0xF69D, 0x335E, 0x5AA8, 0x15C2, 0x467D, 0x8AA3, 0x1F8D, 0x9420,
+  0x5EFA, 0x4A7B, 0xE899, 0xDBDD, 0x62E9, 0xDA23, 0x5CC5, 0xF03F,
+  0xBFDE, 0xF4C3, 0x995F, 0xAB18, 0x422D, 0x84C9, 0xD0E6, 0xA23A,
+  0x3CF3, 0xBD7B, 0xA47D, 0x6C11, 0x8BA5, 0xBECD, 0x629A, 0x5DED
+};
+static const uint8_t __xor16_895_order[256] PROGMEM = {
+    0,  74, 171, 126,  22, 118, 154,  37, 109, 209,  28, 211,  46, 203, 227, 169,
+  108,  41, 123,  31, 119, 162,  39, 152,   7, 230, 136, 180,   9,  43, 186, 143,
+   98,  96,  12, 153,  26, 103,  32, 225,  23,   1, 163, 134, 129, 107, 176, 189,
+   60, 223,  78, 248,  55, 132, 244,  87, 101,  59,  93,  70, 228,  80,  10, 188,
+   61,   6, 145, 170,  48,  38, 233, 158,  13,  49, 199,   4, 174, 179, 139,  99,
+  207, 121,  56,  91, 200, 226, 147, 173, 238, 110, 255, 122, 232, 254, 236,  20,
+   69,  84, 151, 131,  33, 216,  86,  66, 251, 183,  11, 111, 178, 205,  79,  62,
+   42,  18, 164,  45, 117,  85,  27, 208,   5,  72, 148,  16, 116, 124, 127,  76,
+   63, 245, 204, 149,  81, 191,  15, 157,  95,  57, 105, 229, 182, 252,  58, 187,
+   82,  67, 214, 231, 219,  21,  52, 242, 177,  29, 195, 168,  44, 181, 144, 247,
+   14, 221, 250,  19, 192,  94, 243, 222, 125, 141, 104, 115,  34, 212, 166, 198,
+   50,  47,  36,  77, 150,   2,  89,  65,  97,  73,  53, 130, 128, 249, 218, 253,
+  240,  35, 217, 160, 165,  30, 193, 146, 100, 190,  17,   8, 246,  75, 220,  40,
+   68,  88, 201, 197, 213,  90, 161, 185, 102, 206, 113, 140, 215, 237, 210, 235,
+  167, 133,  71, 196, 156, 138,  92, 114,  54, 234, 159, 142, 155,   3, 239, 172,
+  106,  83,  24, 137, 241,  51, 224, 112, 135,  25,  64, 175, 194, 120, 184, 202
+};
+
+uint16_t xor16_895_position() {
+  uint16_t saved = __xor16_895_state;
+  uint16_t pos = __xor16_position(saved, xor16_895, __xor16_895_checkpoints, __xor16_895_order);
+  __xor16_895_state = saved;
+  return pos;
+}
+
+void xor16_895_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_895, xor16_895, __xor16_895_checkpoints);
+}
@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: 897 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_897_state;
+uint16_t __xor16_897_state;
+static uint16_t __xor16_897_weyl_count;
+static uint8_t __xor16_897_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_897_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_897(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_897(uint16_t seed) {
   }
   if(seed) {
     __xor16_897_state = seed;
+    __xor16_897_spare_full = 0;
     return 1;
   }
   return 0;
@@ -18,19 +23,379 @@ bool seed_xor16_897(uint16_t seed) {
 
 uint16_t xor16_897() {
     __asm__ __volatile__(
-      "mov    r19, %A0"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_897_state)::"r18","r19");
+  return __xor16_897_state;
+}
+
+uint16_t xor16_897_star() {
+    __asm__ __volatile__(
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_897_state)::"r18","r19");
+  return rng16::star(__xor16_897_state);
+}
+
+/* The same step as xor16_897(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_897_weyl(uint16_t seed) {
+  __xor16_897_state = seed ? seed : 1;
+  __xor16_897_weyl_count = seed;
+  __xor16_897_spare_full = 0;
+}
+
+uint16_t xor16_897_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_897_state), "+d"(__xor16_897_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_897(). */
+uint8_t xor16_897_byte() {
+  if (__xor16_897_spare_full) {
+    __xor16_897_spare_full = 0;
+    return __xor16_897_spare;
+  }
+    __asm__ __volatile__(
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_897_state)::"r18","r19");
+  __xor16_897_spare = __xor16_897_state >> 8;
+  __xor16_897_spare_full = 1;
+  return __xor16_897_state;
+}
+
+/* n bytes, the same ones n calls to xor16_897_byte() would return; whole steps go through xor16_897_fill(). */
+void xor16_897_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_897_spare_full) {
+    __xor16_897_spare_full = 0;
+    *dst++ = __xor16_897_spare;
+    n--;
+  }
+  xor16_897_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_897_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 24 eors. */
+void xor16_897_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r9"       "\n\t" // y ^= y << 8
+      "eor    r16, r8"       "\n\t"
+      "eor    r15, r7"       "\n\t"
+      "eor    r14, r6"       "\n\t"
+      "eor    r13, r5"       "\n\t"
+      "eor    r12, r4"       "\n\t"
+      "eor    r11, r3"       "\n\t"
+      "eor    r10, r2"       "\n\t"
+      "eor    r2, r11"       "\n\t" // y ^= y >> 9
+      "eor    r3, r12"       "\n\t"
+      "eor    r4, r13"       "\n\t"
+      "eor    r5, r14"       "\n\t"
+      "eor    r6, r15"       "\n\t"
+      "eor    r7, r16"       "\n\t"
+      "eor    r8, r17"       "\n\t"
+      "eor    r17, r10"      "\n\t" // y ^= y << 7
+      "eor    r16, r9"       "\n\t"
+      "eor    r15, r8"       "\n\t"
+      "eor    r14, r7"       "\n\t"
+      "eor    r13, r6"       "\n\t"
+      "eor    r12, r5"       "\n\t"
+      "eor    r11, r4"       "\n\t"
+      "eor    r10, r3"       "\n\t"
+      "eor    r9, r2"        "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_897_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "eor    %B0, %A0"      "\n\t"
       "mov    r18, %B0"      "\n\t"
       "lsr    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "movw   r18, %A0"      "\n\t"
       "lsr    r19"           "\n\t"
       "mov    r19, r18"      "\n\t"
-      "eor    r18, r18"      "\n\t"
+      "clr    r18"           "\n\t"
       "ror    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_897_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_897_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x8181, 0x0383, 0x0706, 0x0E0C, 0x1C18, 0x3830, 0x7060, 0xE0C0,
+    0x8100, 0x0281, 0x0502, 0x0A04, 0x1408, 0x2810, 0x5020, 0xA040,
+    // M^2
+    0x4001, 0xE143, 0x8206, 0x048D, 0x091A, 0x1234, 0x2468, 0x48D0,
+    0x2140, 0x63C0, 0x8781, 0x0F83, 0x1F06, 0x3E0C, 0x7C18, 0xF830,
+    // M^4
+    0x3C19, 0x1E4E, 0xF8B5, 0x09DB, 0xC217, 0xE5EE, 0x8B5C, 0x1639,
+    0x3B24, 0x6C2C, 0x35E0, 0x2310, 0xB6C1, 0x4C43, 0xD887, 0xB18F,
+    // M^8
+    0x1BA7, 0xA861, 0x45F6, 0x6CCA, 0x1DD1, 0xBC24, 0x7DB2, 0xFD36,
+    0x93C1, 0x96B4, 0x8CCD, 0xD95C, 0xB3BD, 0x677C, 0x3002, 0xB529,
+    // M^16
+    0xD8B6, 0xD138, 0xE3E8, 0x46C0, 0xF31F, 0xCDAB, 0xD631, 0xDBD8,
+    0x98C2, 0x05D8, 0x52A7, 0x3554, 0x0AC5, 0x2BBD, 0x7CA0, 0xB5AD,
+    // M^32
+    0x2120, 0x237E, 0xF928, 0x2636, 0x2AD6, 0x6F01, 0x72B5, 0xD3B0,
+    0x56ED, 0x7253, 0x8FA8, 0x2DDB, 0x063B, 0x1B01, 0x2C58, 0x355D,
+    // M^64
+    0x22ED, 0xF4BD, 0x363E, 0x797B, 0x150C, 0x90B4, 0x0D5E, 0xADE7,
+    0xE7A2, 0x190C, 0x2917, 0x4024, 0x9C44, 0x2E7E, 0xC727, 0x6222,
+    // M^128
+    0x6AD7, 0x7BDF, 0xBC61, 0xF556, 0x1DB4, 0xE007, 0x2D3B, 0x12AE,
+    0x952C, 0x7487, 0x7C9A, 0x61AD, 0xAC35, 0x6D5F, 0x0266, 0x945C,
+    // M^256
+    0xF55B, 0x3914, 0xEFEA, 0x49D7, 0x7752, 0x560C, 0xFCA9, 0x18F3,
+    0x78EF, 0x0051, 0x5FA8, 0x2B5C, 0xCF31, 0x8F92, 0x7E05, 0x3D4B,
+    // M^512
+    0x2AC9, 0x8BA8, 0x0203, 0x9D1B, 0xAB5F, 0x48F0, 0x856A, 0xED26,
+    0xCDDE, 0x7EA0, 0xBA56, 0xF1B6, 0x9B01, 0x67B4, 0x50B2, 0x3589,
+    // M^1024
+    0x373C, 0x4F8C, 0xDFC1, 0xBF93, 0x00B9, 0x2AE7, 0x9928, 0x45EA,
+    0x34A6, 0x3C91, 0xE1B4, 0xD372, 0xC689, 0x32A4, 0x4E92, 0xD1C9,
+    // M^2048
+    0x57A2, 0x51DB, 0x88DD, 0x22F6, 0xE71B, 0x8C13, 0x65E0, 0x9DBA,
+    0xEAD9, 0xB484, 0x292C, 0xAD1F, 0x8F3B, 0x7870, 0x4A1A, 0x3919,
+    // M^4096
+    0xF222, 0x1436, 0x76CE, 0x86A0, 0xBF96, 0x5C48, 0x85D6, 0x5D57,
+    0x78FD, 0xF219, 0x198E, 0x64CA, 0xACF0, 0x1EA6, 0xC7B7, 0x22C2,
+    // M^8192
+    0xED44, 0x3458, 0xA2AF, 0xC84A, 0xE70D, 0x1575, 0x465E, 0xC464,
+    0x2838, 0x6E2E, 0x09C8, 0x8A88, 0x7A7F, 0x404A, 0x584C, 0x2008,
+    // M^16384
+    0x7787, 0x5AE4, 0x6C84, 0x4880, 0xF071, 0xA042, 0xC044, 0x8008,
+    0xF0F0, 0xBEA0, 0xE8C0, 0xC880, 0x8100, 0xE200, 0x8400, 0x8800,
+    // M^32768
+    0x807F, 0xFFAA, 0xAACC, 0xCC88, 0x88F0, 0xF0A0, 0xA0C0, 0xC080,
+    0x7F7F, 0x55AA, 0x66CC, 0x4488, 0x78F0, 0x50A0, 0x60C0, 0x4080
+  };
+  __xor16_897_state = __xor16_jump(__xor16_897_state, table, n);
+  return __xor16_897_state;
+}
+
+uint16_t xor16_897_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
     :"+d"((uint16_t)__xor16_897_state)::"r18","r19");
   return __xor16_897_state;
 }
+
+static const uint16_t __xor16_897_checkpoints[256] PROGMEM = {
+  0x0001, 0xF55B, 0x2AC9, 0xFC49, 0x373C, 0xE0D6, 0x892A, 0x4837,
+  0x57A2, 0xE1C9, 0xECE5, 0x10CF, 0x4119, 0xCD34, 0x81E1, 0x02A9,
+  0xF222, 0x6CA4, 0x2476, 0xDB33, 0x328C, 0xFE3C, 0xF02B, 0xD079,
+  0xED04, 0x2F2D, 0x86B2, 0x620B, 0x745E, 0x75DC, 0x2CD4, 0x8784,
+  0xED44, 0xD384, 0x03D8, 0xA261, 0xED76, 0xCBCE, 0x6BDF, 0x5B0F,
+  0x88A4, 0xB702, 0x63EA, 0x4BBC, 0xB277, 0x83EB, 0x723B, 0x9A31,
+  0x0D72, 0xE8F8, 0x6B53, 0xE5C1, 0xFA9A, 0x3782, 0x4652, 0x9313,
+  0x31D9, 0x17C8, 0x45AA, 0x677E, 0x945F, 0x4C5B, 0x0492, 0x091D,
+  0x7787, 0x22E6, 0xEB6B, 0xB003, 0xB1A7, 0x685D, 0x0256, 0x5D54,
+  0xD93E, 0x61BB, 0x354D, 0xC82B, 0xBB86, 0xE007, 0xEF79, 0xA1ED,
+  0x2B06, 0x0A8E, 0xACD7, 0x7680, 0x79AC, 0x85D7, 0xAAA1, 0x2270,
+  0x5234, 0x7FD1, 0x54BF, 0xBD43, 0x4115, 0x6B09, 0x1EF9, 0xC21C,
+  0x9270, 0x2FDC, 0xB6ED, 0xC321, 0x98A7, 0xB47C, 0x598A, 0x8AB7,
+  0x0C4E, 0x1774, 0xDA3A, 0xF6EF, 0x8430, 0x43BD, 0x6C70, 0x5894,
+  0x1A23, 0x7E7F, 0xFD86, 0xC1FB, 0x7B3D, 0x1F7C, 0xB8B1, 0x9A42,
+  0x1CCA, 0x2F5C, 0xAE1E, 0x2E07, 0xD892, 0xF196, 0xC25D, 0x9B82,
+  0x807F, 0x8ACE, 0x6D35, 0xC663, 0x7A5D, 0xCD36, 0xB8F5, 0x8901,
+  0x9BA3, 0x2328, 0xE8F7, 0x0121, 0xDBB8, 0xAFE7, 0x2F60, 0x297D,
+  0x52B0, 0x88C8, 0xBB9A, 0x3168, 0xDB3E, 0x61EA, 0x4BED, 0xCCD7,
+  0x8717, 0x4EAA, 0x349C, 0xD697, 0x9F82, 0xDFD7, 0x3098, 0x66D5,
+  0x27D7, 0x1829, 0x0EED, 0x9595, 0xA02D, 0xB7B3, 0xAF1C, 0x6FFC,
+  0x9EE4, 0xDB63, 0xB977, 0xD009, 0x30F3, 0x49E8, 0xD637, 0xD17D,
+  0x7A01, 0xE0F0, 0x09D8, 0x896C, 0x6260, 0x5B63, 0x843C, 0xE580,
+  0xF368, 0x9821, 0x7A71, 0x3D07, 0x6F1D, 0xD9E9, 0xD116, 0x553C,
+  0x1110, 0xC08C, 0xFD80, 0x1705, 0xF296, 0xBAE3, 0x28FC, 0xC7F7,
+  0x82F9, 0x4492, 0x7718, 0x2735, 0x936B, 0xA5F9, 0xEC16, 0x1984,
+  0x6B9B, 0x484C, 0x0FCD, 0xBB76, 0x2503, 0x649A, 0xB15D, 0xDD9A,
+  0x9F06, 0x28CE, 0xDFBD, 0xEAFE, 0xBDFC, 0x12CA, 0x5BF9, 0x9B5E,
+  0xB54A, 0xD6C5, 0x2D6D, 0x7A4A, 0x99C1, 0xB0C8, 0xD065, 0x3C6B,
+  0x1B6A, 0x46B5, 0x02E0, 0xB207, 0x5E1C, 0x14FE, 0xCAB4, 0xBE04,
+  0xE6A7, 0xFE7F, 0xC0CD, 0xF472, 0xB8A6, 0xCEB5, 0x14F7, 0x7638,
+  0x09D6, 0x1645, 0x76D0, 0xF257, 0xABE2, 0x6A79, 0xBBE1, 0x6907
+};
+static const uint8_t __xor16_897_order[256] PROGMEM = {
+    0, 139,  70,  15, 234,  34,  62,  63, 248, 178,  81, 104,  48, 162, 210,  11,
+  192, 221, 246, 237, 249, 195, 105,  57, 161, 207, 112, 232, 120,  94, 117,  87,
+   65, 137,  18, 212, 203, 160, 217, 198, 143,   2,  80,  30, 226, 123,  25, 121,
+  142,  97, 158, 172, 147,  56,  20, 154,  74,   4,  53, 231, 187,  92,  12, 109,
+  201,  58,  54, 233,   7, 209, 173,  43, 150,  61, 153,  88, 144,  90, 191,   8,
+  111, 102,  39, 181, 222,  71, 236,  73, 149,  27, 180,  42, 213, 159,  59,  69,
+  255, 253,  93,  50, 208,  38, 110,  17, 130, 188, 167,  46,  28,  29, 247,  83,
+  250, 202,  64,  84, 176, 227, 132, 186, 116, 113,  89, 128,  14, 200,  45, 108,
+  182,  85,  26, 152,  31,  40, 145, 135,   6, 179, 103, 129,  96,  55, 204,  60,
+  163, 185, 100, 228,  47, 119, 223, 127, 136, 168, 216, 156, 164,  79,  35, 205,
+   86, 252,  82, 122, 166, 141,  67, 229, 214,  68, 235,  44, 101, 224,  98,  41,
+  165, 244, 118, 134, 170, 197, 211,  76, 146, 254,  91, 220, 239, 193, 242, 115,
+   95, 126,  99, 131, 199,  75, 238,  37, 151,  13, 133, 245, 171, 230,  23, 190,
+  175,  33, 174, 155, 225, 124,  72, 189, 106,  19, 148, 169, 140, 215, 218, 157,
+   77,   5, 177,   9, 183,  51, 240, 138,  49, 219,  66, 206,  10,  24,  32,  36,
+   78,  22, 125,  16, 251, 196, 184, 243,   1, 107,  52,   3, 194, 114,  21, 241
+};
+
+uint16_t xor16_897_position() {
+  uint16_t saved = __xor16_897_state;
+  uint16_t pos = __xor16_position(saved, xor16_897, __xor16_897_checkpoints, __xor16_897_order);
+  __xor16_897_state = saved;
+  return pos;
+}
+
+void xor16_897_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_897, xor16_897, __xor16_897_checkpoints);
+}
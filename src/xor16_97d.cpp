@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: 97d //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_97d_state;
+uint16_t __xor16_97d_state;
 
 bool seed_xor16_97d(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -37,3 +38,202 @@ uint16_t xor16_97d() {
     :"+d"((uint16_t)__xor16_97d_state)::"r18","r19");
   return __xor16_97d_state;
 }
+
+void xor16_97d_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_97d_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_97d_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xA205, 0x440A, 0x8814, 0x1028, 0x2050, 0x40A0, 0x8140, 0x2081,
+    0x4102, 0x8204, 0x0408, 0x0810, 0x1020, 0x2040, 0x4080, 0x8100,
+    // M^2
+    0x0955, 0x10AA, 0x2154, 0x40A8, 0x8150, 0x20A1, 0x4142, 0xA2C4,
+    0x4588, 0x8B10, 0x1420, 0x2840, 0x5080, 0xA100, 0x6001, 0xC002,
+    // M^4
+    0x85DB, 0x82E7, 0x05CE, 0xA2CC, 0x4598, 0x2A30, 0x7461, 0x28C0,
+    0xD3C5, 0xA78A, 0x6401, 0xC802, 0x9245, 0x248A, 0xC854, 0xB0A9,
+    // M^8
+    0xBBA4, 0x6340, 0xCE80, 0xC80A, 0xB004, 0x24AA, 0xC110, 0xB029,
+    0x4243, 0x8C86, 0x0D04, 0x3218, 0x7112, 0x4860, 0x84C8, 0x2381,
+    // M^16
+    0xBC2D, 0xC37D, 0xA4FA, 0x3E1B, 0xD473, 0x7AAD, 0x550E, 0x4DF7,
+    0x11BA, 0x0174, 0xB3DF, 0xCDFA, 0x2CBD, 0x536A, 0x97B6, 0x8D28,
+    // M^32
+    0xD0BB, 0xD74C, 0x26DC, 0x95BE, 0x017C, 0x3579, 0x40F2, 0x95A4,
+    0x2348, 0x4E90, 0xCB0A, 0x3E40, 0xE8AA, 0x7900, 0x862A, 0xA601,
+    // M^64
+    0xFB69, 0x9DC3, 0x9BD2, 0x6366, 0xE4DD, 0x481A, 0xB035, 0x20E8,
+    0xC194, 0xA928, 0x3141, 0x6A82, 0x8544, 0x0A88, 0x5410, 0x8A20,
+    // M^128
+    0x33E2, 0x6344, 0xE499, 0xC81A, 0x9224, 0x24EA, 0xC990, 0xB129,
+    0x4043, 0x00C2, 0x0504, 0x2019, 0x5112, 0x8024, 0x04C8, 0x0190,
+    // M^256
+    0xAEA0, 0xE964, 0x588D, 0x1C3B, 0x9033, 0x722D, 0x460F, 0x4FF7,
+    0x9DFE, 0x1BFD, 0xA1DE, 0xE9F8, 0xE4F9, 0xC1E3, 0xB5A7, 0x634E,
+    // M^512
+    0xCCAC, 0x0FA3, 0x1D47, 0x153E, 0x226D, 0x137B, 0x0CF6, 0x8F2D,
+    0x145B, 0x8AF2, 0x0B4A, 0x94D1, 0xEFA9, 0x7706, 0x58E7, 0x199A,
+    // M^1024
+    0x4AC9, 0x5E6B, 0xB6D7, 0xC674, 0x26AC, 0x9AD1, 0x3FB2, 0xCF06,
+    0x1C49, 0xBAD7, 0x1C13, 0x9063, 0x728D, 0x474F, 0x6D77, 0xD8FE,
+    // M^2048
+    0x3BCA, 0x5EE8, 0x3F95, 0x2655, 0xC4FF, 0x1C16, 0x323C, 0x77DB,
+    0x4DF2, 0xB3E5, 0xCCF3, 0x1BB2, 0x170E, 0x8C49, 0x9BBB, 0x3566,
+    // M^4096
+    0x43B8, 0x97B5, 0x056A, 0x01C3, 0x83C2, 0x65CD, 0xE98B, 0xF077,
+    0xC2EE, 0x0D98, 0x81B0, 0x0371, 0x62C2, 0xCD84, 0x2B88, 0x5511,
+    // M^8192
+    0xF345, 0x29BF, 0x596E, 0x0F1F, 0x142E, 0xFBBF, 0x573B, 0x0F3C,
+    0x9C2C, 0x3259, 0x8187, 0x834A, 0x65DD, 0xCBAB, 0xF037, 0xCA6E,
+    // M^16384
+    0xC74A, 0xB8EB, 0x59C6, 0x341D, 0x602B, 0xD536, 0x806C, 0x1558,
+    0x00B0, 0x2360, 0xDAEA, 0x1580, 0xCF2A, 0x3600, 0xF82A, 0x5800,
+    // M^32768
+    0x558A, 0xBF14, 0x5629, 0xE97A, 0x50A0, 0xE16A, 0x6081, 0xC12A,
+    0xA045, 0x408A, 0x9514, 0x0028, 0x1550, 0x00A0, 0x1540, 0x2280
+  };
+  __xor16_97d_state = __xor16_jump(__xor16_97d_state, table, n);
+  return __xor16_97d_state;
+}
+
+uint16_t xor16_97d_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_97d_state)::"r18","r19");
+  return __xor16_97d_state;
+}
+
+static const uint16_t __xor16_97d_checkpoints[256] PROGMEM = {
+  0x0001, 0xAEA0, 0xCCAC, 0xE7A3, 0x4AC9, 0xFCC1, 0x1C8D, 0x093E,
+  0x3BCA, 0xB646, 0x0B91, 0x1E9F, 0x6B94, 0x9CF6, 0x959E, 0xC981,
+  0x43B8, 0x8276, 0x6D4B, 0xBC6C, 0x7EE6, 0x095A, 0x5765, 0xB48C,
+  0xECCB, 0x0D2B, 0xFC0A, 0x4E8A, 0x5CD4, 0xD83E, 0x9424, 0x0CC9,
+  0xF345, 0xC5D2, 0x9A66, 0xF079, 0xE579, 0x3DA0, 0xCD18, 0x8F39,
+  0xFDEE, 0xF02C, 0xC568, 0xC2D0, 0x54DF, 0x6A39, 0xD6C4, 0xD946,
+  0xB1F0, 0x304C, 0x27A3, 0x9C20, 0xBDBC, 0x7AD3, 0xBCB7, 0xBCD2,
+  0x7EDD, 0xB0BB, 0xB042, 0xE93F, 0x8260, 0x4C91, 0x8CE5, 0xA690,
+  0xC74A, 0x4264, 0xC2F5, 0xD0DF, 0xA8A9, 0xC414, 0xBF89, 0x751D,
+  0xD6B8, 0x39E1, 0x8469, 0x4429, 0xD4CF, 0x9944, 0xED33, 0x6708,
+  0x4FA2, 0xAF3C, 0xCA20, 0x56C1, 0x4C25, 0x7981, 0x05EC, 0x0343,
+  0x87C8, 0x5150, 0x1A9C, 0x8D8E, 0x54B3, 0x1AAD, 0xC130, 0xA909,
+  0x6430, 0x3784, 0x15BD, 0x9F26, 0x8A56, 0xF69E, 0x3BC6, 0xF2F0,
+  0x03E8, 0xE1ED, 0x1B37, 0x7655, 0x0A8F, 0xBE80, 0x5A78, 0x1B71,
+  0x81B3, 0x149D, 0x70F5, 0x8D76, 0xA36E, 0xBD5E, 0xE862, 0x23B4,
+  0xB284, 0x4AD3, 0x99AD, 0x247D, 0x2E3A, 0x8579, 0x49E4, 0xE2F9,
+  0x558A, 0xD7D6, 0x3DEF, 0x8865, 0x48B9, 0x432D, 0xAB9F, 0x11E0,
+  0x02D2, 0x6B52, 0x24E7, 0x04A1, 0x32A4, 0x5BB0, 0x934C, 0x030D,
+  0x6C15, 0x5A7C, 0x43FC, 0x9CF4, 0x7CFA, 0xC622, 0xF783, 0xDC1D,
+  0x0013, 0xD7F7, 0xE162, 0x57B2, 0x320E, 0x9335, 0x1587, 0x8867,
+  0xA1DD, 0x4C8E, 0x1FA4, 0x4F8B, 0x6F8A, 0x00C9, 0xBB63, 0x5A49,
+  0x57CF, 0x7C09, 0x6A00, 0x8641, 0x31C2, 0x5878, 0x008C, 0x0B41,
+  0x8754, 0xCA22, 0xBFA5, 0x4386, 0xCDBA, 0x5B87, 0x6E1B, 0xEC53,
+  0xCED4, 0x4474, 0xE8E5, 0x730A, 0xE3E1, 0x447C, 0xF4DE, 0x6634,
+  0x74F4, 0x8208, 0x6488, 0x8656, 0xBEB8, 0xA45D, 0x3F59, 0x8F98,
+  0x6E94, 0xA0D6, 0x8A8F, 0xDDCE, 0x43E2, 0xA115, 0x594D, 0x8941,
+  0xFFE7, 0x594A, 0x9608, 0x21AF, 0x62B5, 0x347D, 0xCAC3, 0x6AD0,
+  0x1F8A, 0x9074, 0x7B2B, 0xD694, 0x0F7A, 0x9F6B, 0x264F, 0x3EBD,
+  0x313E, 0xF728, 0xBA38, 0x4A74, 0xBB3E, 0x6663, 0xBD81, 0x72DB,
+  0x4974, 0x3D3D, 0xF8CA, 0xE6AC, 0xD445, 0x23EC, 0x7883, 0x7176,
+  0x18BB, 0xFB17, 0x1372, 0x2F8F, 0x4343, 0x326F, 0x09B7, 0xC6A6,
+  0xE0F9, 0x4E77, 0x5D24, 0xAE26, 0x32B2, 0x7A6A, 0xA3C5, 0xDB7B
+};
+static const uint8_t __xor16_97d_order[256] PROGMEM = {
+    0, 152, 174, 165, 136, 143,  87, 104, 139,  86,   7,  21, 246, 108, 175,  10,
+   31,  25, 220, 135, 242, 113, 158,  98, 240,  90,  93, 106, 111,   6,  11, 216,
+  162, 211, 119, 237, 123, 138, 222,  50, 124, 243,  49, 224, 172, 156, 245, 140,
+  252, 213,  97,  73, 102,   8, 233,  37, 130, 223, 198,  65, 133, 244, 179,  16,
+  204, 146,  75, 185, 189, 132, 232, 126, 227,   4, 121,  84, 161,  61, 249,  27,
+  163,  80,  89,  92,  44, 128,  83,  22, 155, 168, 173, 209, 206, 167, 110, 145,
+  181, 141,  28, 250, 212,  96, 194, 191, 229,  79, 170,  45, 215, 137,  12, 144,
+   18, 182, 200, 164, 114, 239, 231, 187, 192,  71, 107, 238,  85, 253,  53, 218,
+  169, 148,  56,  20, 112, 193,  60,  17,  74, 125, 171, 195, 176,  88, 131, 159,
+  207, 100, 202,  62, 115,  91,  39, 199, 217, 157, 142,  30,  14, 210,  77, 122,
+   34,  51, 147,  13,  99, 221, 201, 205, 160, 116, 254, 197,  63,  68,  95, 134,
+  251,   1,  81,  58,  57,  48, 120,  23,   9, 226, 228, 166,  19,  54,  55, 117,
+  230,  52, 109, 196,  70, 178,  94,  43,  66,  69,  42,  33, 149, 247,  64,  15,
+   82, 177, 214,   2,  38, 180, 184,  67, 236,  76, 219,  72,  46, 129, 153,  29,
+   47, 255, 151, 203, 248, 154, 105, 127, 188,  36, 235,   3, 118, 186,  59, 183,
+   24,  78,  41,  35, 103,  32, 190, 101, 225, 150, 234, 241,  26,   5,  40, 208
+};
+
+uint16_t xor16_97d_position() {
+  uint16_t saved = __xor16_97d_state;
+  uint16_t pos = __xor16_position(saved, xor16_97d, __xor16_97d_checkpoints, __xor16_97d_order);
+  __xor16_97d_state = saved;
+  return pos;
+}
+
+void xor16_97d_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_97d, xor16_97d, __xor16_97d_checkpoints);
+}
@@ -1,8 +1,12 @@
 
 // XOR 16 // full period generator: 9d3 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_9d3_state;
+uint16_t __xor16_9d3_state;
+static uint16_t __xor16_9d3_weyl_count;
+static uint8_t __xor16_9d3_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_9d3_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_9d3(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -12,6 +16,7 @@ bool seed_xor16_9d3(uint16_t seed) {
   }
   if(seed) {
     __xor16_9d3_state = seed;
+    __xor16_9d3_spare_full = 0;
     return 1;
   }
   return 0;
@@ -39,3 +44,402 @@ uint16_t xor16_9d3() {
     :"+d"((uint16_t)__xor16_9d3_state)::"r18","r19");
   return __xor16_9d3_state;
 }
+
+uint16_t xor16_9d3_star() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_9d3_state)::"r18","r19");
+  return rng16::star(__xor16_9d3_state);
+}
+
+/* The same step as xor16_9d3(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_9d3_weyl(uint16_t seed) {
+  __xor16_9d3_state = seed ? seed : 1;
+  __xor16_9d3_weyl_count = seed;
+  __xor16_9d3_spare_full = 0;
+}
+
+uint16_t xor16_9d3_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_9d3_state), "+d"(__xor16_9d3_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_9d3(). */
+uint8_t xor16_9d3_byte() {
+  if (__xor16_9d3_spare_full) {
+    __xor16_9d3_spare_full = 0;
+    return __xor16_9d3_spare;
+  }
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_9d3_state)::"r18","r19");
+  __xor16_9d3_spare = __xor16_9d3_state >> 8;
+  __xor16_9d3_spare_full = 1;
+  return __xor16_9d3_state;
+}
+
+/* n bytes, the same ones n calls to xor16_9d3_byte() would return; whole steps go through xor16_9d3_fill(). */
+void xor16_9d3_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_9d3_spare_full) {
+    __xor16_9d3_spare_full = 0;
+    *dst++ = __xor16_9d3_spare;
+    n--;
+  }
+  xor16_9d3_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_9d3_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 23 eors. */
+void xor16_9d3_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r8"       "\n\t" // y ^= y << 9
+      "eor    r16, r7"       "\n\t"
+      "eor    r15, r6"       "\n\t"
+      "eor    r14, r5"       "\n\t"
+      "eor    r13, r4"       "\n\t"
+      "eor    r12, r3"       "\n\t"
+      "eor    r11, r2"       "\n\t"
+      "eor    r2, r15"       "\n\t" // y ^= y >> 13
+      "eor    r3, r16"       "\n\t"
+      "eor    r4, r17"       "\n\t"
+      "eor    r17, r14"      "\n\t" // y ^= y << 3
+      "eor    r16, r13"      "\n\t"
+      "eor    r15, r12"      "\n\t"
+      "eor    r14, r11"      "\n\t"
+      "eor    r13, r10"      "\n\t"
+      "eor    r12, r9"       "\n\t"
+      "eor    r11, r8"       "\n\t"
+      "eor    r10, r7"       "\n\t"
+      "eor    r9, r6"        "\n\t"
+      "eor    r8, r5"        "\n\t"
+      "eor    r7, r4"        "\n\t"
+      "eor    r6, r3"        "\n\t"
+      "eor    r5, r2"        "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_9d3_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_9d3_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_9d3_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x1209, 0x2412, 0x4824, 0x9048, 0x2099, 0x4132, 0x8264, 0x0480,
+    0x0900, 0x1200, 0x2400, 0x4800, 0x9000, 0x2009, 0x4012, 0x8024,
+    // M^2
+    0x0041, 0x0082, 0x0104, 0x0208, 0x8651, 0x0CAB, 0x1956, 0x2080,
+    0x4100, 0x8200, 0x0409, 0x0812, 0x1024, 0xA248, 0x4499, 0x8932,
+    // M^4
+    0x1917, 0x2002, 0x4004, 0x8008, 0x907D, 0x22FB, 0xC7B7, 0x82C8,
+    0x0599, 0x0B32, 0x0640, 0x8EC1, 0x1D8B, 0xB224, 0xE408, 0x4A58,
+    // M^8
+    0x7FBF, 0x9226, 0xA40C, 0xCA50, 0xFBF9, 0xF7F2, 0xEFE4, 0x841D,
+    0x8873, 0x12EE, 0xCAC5, 0x9583, 0xAB46, 0x8C3A, 0x9A3C, 0xB639,
+    // M^16
+    0x7348, 0xCE49, 0x9E9A, 0xBF75, 0xD67A, 0xAEF5, 0x5DE3, 0x96E6,
+    0x2DCC, 0xD9D9, 0x1B22, 0x364D, 0xECD3, 0xBD02, 0xF845, 0xF08A,
+    // M^32
+    0xBF17, 0x6DA7, 0xD94F, 0xB09F, 0x72B7, 0xE766, 0xCCC4, 0xEB81,
+    0x574B, 0x2EDF, 0x4E37, 0x9C6E, 0x38DC, 0x6FB1, 0xDF62, 0xBEC4,
+    // M^64
+    0x3B2C, 0x32D9, 0xE5FB, 0xCBFF, 0xD37F, 0xA6FE, 0x4DF5, 0xBF7B,
+    0x7EF6, 0x7DA5, 0xBDCA, 0x7B94, 0xF721, 0xDA59, 0xB4B2, 0xEB25,
+    // M^128
+    0xDD45, 0x81FF, 0x03F7, 0x87AE, 0xB460, 0x6AC1, 0x55C2, 0xF92E,
+    0x721C, 0xE630, 0x755D, 0x68F2, 0x51A4, 0xC0DE, 0x83B4, 0x8520,
+    // M^256
+    0xB3F3, 0x5D92, 0xB92C, 0xF218, 0x5E04, 0xBC01, 0xF842, 0xE267,
+    0xC4C7, 0x8B86, 0xAD31, 0xD82A, 0x3014, 0x1BBE, 0x3574, 0xE8A0,
+    // M^512
+    0x9A0A, 0x554D, 0x28D2, 0xD1E4, 0x42D1, 0x05E2, 0x8B84, 0x5EE2,
+    0x3D8D, 0x7912, 0x1334, 0x2661, 0xCC82, 0xB1BB, 0xE137, 0x4026,
+    // M^1024
+    0x577E, 0xEBB4, 0x5520, 0xA848, 0x9598, 0xAB70, 0x54E8, 0xE43B,
+    0x483F, 0x907E, 0xE7FC, 0xCFF1, 0x9FEB, 0x07E0, 0x8D81, 0x994A,
+    // M^2048
+    0x510B, 0x8B68, 0x16D9, 0xADFB, 0x7089, 0xE31A, 0x467D, 0xDEBD,
+    0x3D3A, 0x7A7D, 0x5FC5, 0x3DC2, 0xF9CC, 0x241E, 0x4A3D, 0x967B,
+    // M^4096
+    0xF953, 0xE462, 0xC8CD, 0x9193, 0xB5A2, 0xE905, 0x5042, 0x9AF7,
+    0x37EF, 0xEF97, 0x49A3, 0x9147, 0x228E, 0x3B18, 0x7438, 0xE879,
+    // M^8192
+    0xDBAE, 0xB3DF, 0x67BE, 0xCF7C, 0x1833, 0x306F, 0xE296, 0xF7C9,
+    0xEF92, 0x5D6C, 0xBC53, 0x78A6, 0xF344, 0x7498, 0xE939, 0x523B,
+    // M^16384
+    0x5EA5, 0xAAC6, 0x5784, 0xAF01, 0xCBCF, 0x9596, 0xA96D, 0x33FE,
+    0xE5B4, 0x4B21, 0x83C6, 0x0584, 0x0B08, 0xF230, 0x6420, 0xC840,
+    // M^32768
+    0x0D02, 0x1304, 0x2601, 0x4C02, 0x9104, 0xA049, 0x409B, 0xC124,
+    0x0201, 0x0402, 0x0104, 0x0208, 0x0410, 0x4020, 0x8040, 0x0089
+  };
+  __xor16_9d3_state = __xor16_jump(__xor16_9d3_state, table, n);
+  return __xor16_9d3_state;
+}
+
+uint16_t xor16_9d3_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "andi   r18, 0x07"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_9d3_state)::"r18","r19");
+  return __xor16_9d3_state;
+}
+
+static const uint16_t __xor16_9d3_checkpoints[256] PROGMEM = {
+  0x0001, 0xB3F3, 0x9A0A, 0x2492, 0x577E, 0xEBF1, 0x1AD2, 0x7A0B,
+  0x510B, 0xDDDE, 0x0E9B, 0x5E87, 0x4ED7, 0xD885, 0xDD52, 0xA7C8,
+  0xF953, 0xA2B4, 0xC1D6, 0xB98C, 0x76B4, 0x8127, 0xC72B, 0x9FDC,
+  0xEDFB, 0x93EF, 0x9484, 0x2ECE, 0xE9A0, 0x84E1, 0x5046, 0x199C,
+  0xDBAE, 0x326B, 0xF816, 0x94EE, 0xC507, 0xE36F, 0x683D, 0xEC22,
+  0x52E2, 0x7550, 0xD16E, 0x7BE2, 0x7203, 0x7B39, 0x2A5B, 0xF22D,
+  0x393E, 0xC3E4, 0x8D9D, 0x1DD8, 0x37F1, 0x8209, 0x22CD, 0x72DA,
+  0x7EF3, 0xF602, 0x8D5B, 0xE343, 0x9F08, 0x10F6, 0x2C8A, 0x2348,
+  0x5EA5, 0xAF44, 0x882A, 0x2301, 0xE70C, 0x6F2E, 0xBE37, 0x88DF,
+  0xD1FE, 0xC781, 0x6E30, 0x3252, 0x5BF8, 0x9833, 0x0CFA, 0x22B1,
+  0x23A9, 0x4B72, 0xE5CA, 0x1A33, 0x6FDC, 0x1B85, 0x4FC7, 0x4246,
+  0xA20E, 0x6E3E, 0x24F4, 0xF783, 0x1808, 0x1A26, 0x3B07, 0xEB8C,
+  0xF852, 0xD580, 0x6651, 0x1DC8, 0x69F5, 0xC0D8, 0x6BED, 0xE742,
+  0x81CA, 0x99C8, 0x2C64, 0x93CA, 0x225A, 0x99F4, 0x8555, 0x2DCF,
+  0x1512, 0x5A74, 0xF5A7, 0x96A3, 0x4E04, 0x72C5, 0x85A2, 0x82A2,
+  0x60D2, 0x3779, 0x9276, 0xADCB, 0x449E, 0x3280, 0x424B, 0x5AC9,
+  0x0D02, 0xEC4E, 0x5D95, 0x0200, 0x8B86, 0x7912, 0x01A5, 0x907E,
+  0xD455, 0xEC68, 0x052A, 0x7A7D, 0xAFF2, 0x6CF6, 0x474F, 0x8A13,
+  0x0B69, 0x92C3, 0xA776, 0xEF97, 0x171E, 0x9AC6, 0x7583, 0x7B2E,
+  0x2312, 0x5769, 0xE2B8, 0xBF96, 0xA18D, 0x2D79, 0xF1CE, 0x3E3A,
+  0x98B8, 0xF2E4, 0x62F0, 0x5D6C, 0xBBCB, 0x523D, 0x9424, 0x70A8,
+  0xB2A0, 0x16EA, 0x1F0D, 0xF289, 0xDE74, 0xB036, 0xC5B1, 0x07B3,
+  0x0C73, 0x813D, 0x36A5, 0x59A4, 0xFEC7, 0x458B, 0xA29C, 0x8FCF,
+  0x6D8A, 0xD2FB, 0x821F, 0x9877, 0x4D94, 0x81E7, 0xDD0E, 0x4ABA,
+  0xC930, 0x233C, 0xFDCE, 0x4B21, 0xADED, 0x1C21, 0x4AFD, 0x663F,
+  0x4F2D, 0x4BE8, 0xF623, 0x82A9, 0x7CAB, 0x29DA, 0xECF8, 0xB949,
+  0x664E, 0xE699, 0x1D55, 0x2D51, 0xBFD7, 0xEA3C, 0x3CF7, 0xF1DC,
+  0x3DAC, 0x8F24, 0xD7D7, 0x1CDC, 0x4A1A, 0x9756, 0x783C, 0x6FC5,
+  0x046A, 0x46F8, 0x19FB, 0xC8A0, 0x5B98, 0xDC70, 0x829C, 0x9471,
+  0xDC31, 0xC92D, 0x85FF, 0xDC23, 0xCABB, 0x9263, 0xF910, 0xB497,
+  0x8515, 0xD58D, 0x9E96, 0x7EF4, 0xA14F, 0x6ACE, 0x71E5, 0x76E2,
+  0xC3DF, 0x73E1, 0x4448, 0x921F, 0xA863, 0x8116, 0x96DD, 0x42E5
+};
+static const uint8_t __xor16_9d3_order[256] PROGMEM = {
+    0, 134, 131, 224, 138, 175, 144, 176,  78, 128,  10,  61, 112, 169, 148,  92,
+   31, 226,  93,  83,   6,  85, 197, 219, 210,  99,  51, 170, 108,  79,  54,  67,
+  152, 193,  63,  80,   3,  90, 205,  46, 106,  62, 211, 157, 111,  27,  75,  33,
+  125, 178, 121,  52,  48,  94, 214, 216, 159,  87, 126, 255, 250, 124, 181, 225,
+  142, 220, 191, 198, 195,  81, 201, 188, 116,  12, 200,  86,  30,   8, 165,  40,
+  153,   4, 179, 113, 127, 228,  76, 163, 130,  11,  64, 120, 162, 199, 208,  98,
+   38, 100, 245, 102, 141, 184,  74,  89,  69, 223,  84, 167, 246,  44, 117,  55,
+  249,  41, 150,  20, 247, 222, 133,   7, 139, 151,  45,  43, 204,  56, 243, 253,
+   21, 177, 104, 189,  53, 186, 230, 119, 203,  29, 240, 110, 118, 234,  66,  71,
+  143, 132,  58,  50, 217, 183, 135, 251, 237, 122, 145, 107,  25, 166, 231,  26,
+   35, 115, 254, 221,  77, 187, 160, 105, 109,   2, 149, 242,  60,  23, 244, 156,
+   88, 182,  17, 146,  15, 252, 123, 196,  65, 140, 173, 168,   1, 239, 207,  19,
+  164,  70, 155, 212, 101,  18, 248,  49,  36, 174,  22,  73, 227, 233, 192, 236,
+   42,  72, 185, 136,  97, 241, 218,  13,  32, 235, 232, 229, 190,  14,   9, 172,
+  154,  59,  37,  82, 209,  68, 103,  28, 213,  95,   5,  39, 129, 137, 206,  24,
+  147, 158, 215,  47, 171, 161, 114,  57, 202,  91,  34,  96, 238,  16, 194, 180
+};
+
+uint16_t xor16_9d3_position() {
+  uint16_t saved = __xor16_9d3_state;
+  uint16_t pos = __xor16_position(saved, xor16_9d3, __xor16_9d3_checkpoints, __xor16_9d3_order);
+  __xor16_9d3_state = saved;
+  return pos;
+}
+
+void xor16_9d3_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_9d3, xor16_9d3, __xor16_9d3_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: b17 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_b17_state;
+uint16_t __xor16_b17_state;
 
 bool seed_xor16_b17(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -39,3 +40,225 @@ uint16_t xor16_b17() {
     :"+d"((uint16_t)__xor16_b17_state)::"r18","r19");
   return __xor16_b17_state;
 }
+
+void xor16_b17_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_b17_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_b17_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0C81, 0x1983, 0x3306, 0x660C, 0xCC18, 0x1830, 0x3060, 0x60C0,
+    0xC180, 0x8300, 0x0600, 0x0C00, 0x1800, 0x3000, 0x6000, 0xC000,
+    // M^2
+    0x6641, 0xA042, 0x4005, 0x800A, 0x0014, 0xC028, 0x0050, 0x00A0,
+    0x0140, 0x8280, 0x8500, 0x0A00, 0x1400, 0x2800, 0x5000, 0xA000,
+    // M^4
+    0x1991, 0x2812, 0x7644, 0x8048, 0x4011, 0xB022, 0x0044, 0xC088,
+    0x0110, 0x2220, 0x2440, 0x8880, 0x9100, 0x2200, 0x4400, 0x8800,
+    // M^8
+    0x8198, 0xC283, 0x8760, 0x080C, 0x1D80, 0xA330, 0x7600, 0x8CC0,
+    0x4101, 0xB002, 0x0604, 0xC008, 0x1810, 0x0020, 0x6040, 0x0080,
+    // M^16
+    0xD8CD, 0x1F19, 0x22B7, 0x4F64, 0x13DD, 0x4F13, 0xCE76, 0x3C4C,
+    0xA0D9, 0xDA33, 0x3166, 0x68CC, 0xC598, 0xA330, 0x1660, 0x8CC0,
+    // M^32
+    0x70D0, 0x62AC, 0xFCE2, 0x96F2, 0xEB8B, 0xE129, 0xB62F, 0x9CA7,
+    0x59BE, 0x76DD, 0x7ABA, 0x4275, 0x6BEA, 0x09D4, 0xAFA8, 0x2750,
+    // M^64
+    0x0C95, 0xC73F, 0x7B04, 0x025B, 0xF413, 0xDF99, 0xD04C, 0xE765,
+    0x4130, 0x1A32, 0x9B65, 0xE9CA, 0xF495, 0x262A, 0xD254, 0x01A9,
+    // M^128
+    0x1648, 0x8AE5, 0xC927, 0xF79C, 0xA59E, 0x137D, 0x8E7B, 0x4DF4,
+    0xB8EE, 0xEBD8, 0x3FB0, 0xAF60, 0xFEC0, 0xBD80, 0x6201, 0x7702,
+    // M^256
+    0x534F, 0x3C27, 0x447A, 0xEC14, 0x11E8, 0xBD9D, 0x5FA3, 0xF674,
+    0xFF8E, 0xC558, 0x7BB1, 0x9462, 0xEEC4, 0x5188, 0x2211, 0xC722,
+    // M^512
+    0x6EA6, 0xC610, 0x7A45, 0x0EFA, 0xE914, 0x748E, 0x3D51, 0x533A,
+    0xED47, 0xC353, 0x3AA7, 0x8C4E, 0x739D, 0x293B, 0xD677, 0x25EE,
+    // M^1024
+    0x1117, 0xE379, 0xEA7E, 0x4EA1, 0x28FA, 0x57E3, 0xBBEB, 0xDE8E,
+    0x6EAE, 0xA17E, 0xE0FC, 0x1CF9, 0x02F2, 0x73E4, 0x0BC8, 0x5691,
+    // M^2048
+    0x5CB6, 0x7A29, 0x106E, 0xCEC9, 0xD8B9, 0xE6FE, 0x7AE7, 0x9BF8,
+    0xEB9C, 0xC88F, 0x901E, 0xBB3D, 0x587B, 0x6DF6, 0xF8ED, 0xAFDB,
+    // M^4096
+    0x444D, 0xCA53, 0x60EC, 0xC7FA, 0x83B0, 0x1987, 0x8FC2, 0x7E1F,
+    0x3F08, 0x8FCB, 0x8B97, 0xBE2E, 0xB75D, 0xE0BB, 0x5C76, 0x1BED,
+    // M^8192
+    0xBB78, 0xF412, 0xF381, 0x1A8C, 0x4F06, 0xA696, 0xA519, 0x1B5A,
+    0x1566, 0x26AE, 0x065D, 0x82BB, 0x9876, 0x0AEC, 0x61D8, 0xB2B1,
+    // M^16384
+    0xC75D, 0xFCBA, 0xD219, 0xCE34, 0xD165, 0xCB61, 0x4594, 0x2D84,
+    0x8F51, 0x8ACC, 0x9899, 0x3333, 0xE366, 0x55CD, 0x959B, 0x4F37,
+    // M^32768
+    0x0829, 0xC2A3, 0x6B0A, 0x33D7, 0x2D2A, 0xA5AA, 0xACAB, 0x8EAB,
+    0xB2AC, 0x82F5, 0x6AEA, 0x92D5, 0x2AAA, 0xD255, 0xB2AB, 0xC856
+  };
+  __xor16_b17_state = __xor16_jump(__xor16_b17_state, table, n);
+  return __xor16_b17_state;
+}
+
+uint16_t xor16_b17_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_b17_state)::"r18","r19");
+  return __xor16_b17_state;
+}
+
+static const uint16_t __xor16_b17_checkpoints[256] PROGMEM = {
+  0x0001, 0x534F, 0x6EA6, 0x6AA6, 0x1117, 0x2BB0, 0xA53D, 0x45C1,
+  0x5CB6, 0x015A, 0x61F6, 0xF1E8, 0x5DAF, 0x5067, 0x05F9, 0x3EC6,
+  0x444D, 0xFD22, 0xCB98, 0x400F, 0xE517, 0x0A7E, 0x36A5, 0x5D79,
+  0x9005, 0x3ED3, 0x4290, 0x00D5, 0xAF0A, 0x939C, 0x5CC2, 0xB6F6,
+  0xBB78, 0xC918, 0x7323, 0x757E, 0x7EFD, 0x4955, 0x1083, 0x77D8,
+  0x8811, 0x11E7, 0x2E12, 0x56CC, 0x7385, 0x46CA, 0xE51C, 0x8902,
+  0x90E9, 0x82F7, 0x2CCA, 0xC7BF, 0x3953, 0xF583, 0x475C, 0x8553,
+  0x623E, 0x8EFD, 0x132A, 0xB9BC, 0xE1ED, 0xA45E, 0x3719, 0x5098,
+  0xC75D, 0x113E, 0x2976, 0xB1EF, 0x54AC, 0x54E3, 0xCC46, 0x2D1E,
+  0xC474, 0x292E, 0x13B0, 0x8E13, 0x9329, 0x11F6, 0x6CB5, 0xD17E,
+  0x93E6, 0x7F27, 0xDED7, 0xB251, 0xA032, 0x06F8, 0x575F, 0x04FF,
+  0xB915, 0x155F, 0xE3B6, 0xAC31, 0x8643, 0x4900, 0x49FD, 0xB77E,
+  0x5E96, 0x799F, 0xD62B, 0x8BFF, 0xAB32, 0xA84C, 0xF505, 0xC975,
+  0x6A3C, 0x26B8, 0x5974, 0x1095, 0x1E6D, 0xDD50, 0x55E1, 0x0FEF,
+  0x0649, 0x5E11, 0xA4F9, 0x57E2, 0xA5DF, 0x6DAC, 0x8043, 0xF7E9,
+  0xB009, 0xC735, 0x1F14, 0x6E53, 0x7831, 0xF605, 0xF3A3, 0x4428,
+  0x0829, 0x96A4, 0x989C, 0xF276, 0x14AC, 0x76F2, 0x1A31, 0x40C4,
+  0xCFBC, 0xC259, 0xD17B, 0x84D3, 0x6BC4, 0x3080, 0x4938, 0x099C,
+  0x241E, 0xAF98, 0x4827, 0x20FC, 0xFC44, 0xAE75, 0x58C2, 0xCD47,
+  0x81DF, 0x4795, 0x93DF, 0x6C09, 0x2311, 0x29F9, 0x809D, 0xDB9F,
+  0x85D9, 0x4479, 0x152D, 0x2C47, 0xCAEA, 0x7070, 0x6E8B, 0x2C1A,
+  0x7F80, 0xBE2C, 0x4716, 0x0AC3, 0x9785, 0x89C0, 0x0519, 0x2A8C,
+  0x5EA8, 0x41A3, 0xF91E, 0xB432, 0x938D, 0x1E65, 0x3144, 0x5B1B,
+  0xF0F5, 0x48E8, 0x4E2D, 0x4E26, 0xCD5A, 0x6B16, 0xB498, 0x0857,
+  0xF13B, 0x8AF8, 0x7FAE, 0x97F8, 0x8137, 0xBFCB, 0x87C0, 0x2F92,
+  0x5F36, 0xCDF8, 0x1CD8, 0x553C, 0x4CF1, 0x9B2F, 0xFDC9, 0x5CAE,
+  0xFCA6, 0x8618, 0x8437, 0x3BF4, 0x5020, 0x7148, 0xD164, 0x523D,
+  0x5ED9, 0xE13A, 0x3773, 0x6295, 0x4668, 0x92D2, 0x68A6, 0xD44F,
+  0xE8E3, 0x5BFB, 0xE4BF, 0x520D, 0xF2AC, 0x7CA0, 0x3967, 0x1D8C,
+  0xA083, 0x0FB6, 0xF759, 0xEA08, 0x0995, 0x9B45, 0xCFC4, 0xDD9B,
+  0x7F4A, 0xC7C8, 0xE197, 0x87BB, 0x5F38, 0x59B1, 0xAE77, 0x64E5,
+  0x0B57, 0xCBED, 0xA4EC, 0x513F, 0x5828, 0x093E, 0x53D0, 0x4E3C
+};
+static const uint8_t __xor16_b17_order[256] PROGMEM = {
+    0,  27,   9,  87, 174,  14, 112,  85, 128, 191, 253, 236, 143,  21, 171, 248,
+  233, 111,  38, 107,   4,  65,  41,  77,  58,  74, 132, 162,  89, 134, 202, 231,
+  181, 108, 122, 147, 156, 144, 105,  73,  66, 157, 175,   5, 167, 163,  50,  71,
+   42, 199, 141, 182,  22,  62, 218,  52, 230, 211,  15,  25,  19, 135, 177,  26,
+  127,  16, 161,   7, 220,  45, 170,  54, 153, 146, 185,  93, 142,  37,  94, 204,
+  187, 186, 255, 212,  13,  63, 251, 227, 215,   1, 254,  68,  69, 203, 110,  43,
+   86, 115, 252, 150, 106, 245, 183, 225, 207,   8,  30,  23,  12, 113,  96, 176,
+  216, 200, 244,  10,  56, 219, 247, 222, 104,   3, 189, 140, 155,  78, 117, 123,
+  166,   2, 165, 213,  34,  44,  35, 133,  39, 124,  97, 229,  36,  81, 240, 168,
+  194, 118, 158, 196, 152,  49, 210, 139,  55, 160, 209,  92, 243, 198,  40,  47,
+  173, 193,  99,  75,  57,  24,  48, 221,  76, 180,  29, 154,  80, 129, 172, 195,
+  130, 205, 237,  84, 232,  61, 250, 114,   6, 116, 101, 100,  91, 149, 246,  28,
+  145, 120,  67,  83, 179, 190,  31,  95,  88,  59,  32, 169, 197, 137,  72, 121,
+   64,  51, 241,  33, 103, 164,  18, 249,  70, 151, 188, 201, 136, 238, 214, 138,
+   79, 223,  98, 159, 109, 239,  82, 217, 242,  60,  90, 226,  20,  46, 224, 235,
+  184, 192,  11, 131, 228, 126, 102,  53, 125, 234, 119, 178, 148, 208,  17, 206
+};
+
+uint16_t xor16_b17_position() {
+  uint16_t saved = __xor16_b17_state;
+  uint16_t pos = __xor16_position(saved, xor16_b17, __xor16_b17_checkpoints, __xor16_b17_order);
+  __xor16_b17_state = saved;
+  return pos;
+}
+
+void xor16_b17_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_b17, xor16_b17, __xor16_b17_checkpoints);
+}
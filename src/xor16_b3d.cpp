@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: b3d //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_b3d_state;
+uint16_t __xor16_b3d_state;
 
 bool seed_xor16_b3d(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -40,3 +41,220 @@ uint16_t xor16_b3d() {
     :"+d"((uint16_t)__xor16_b3d_state)::"r18","r19");
   return __xor16_b3d_state;
 }
+
+void xor16_b3d_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_b3d_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_b3d_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x2901, 0x5202, 0xA404, 0x6809, 0xD012, 0x8024, 0x0048, 0x0090,
+    0x0120, 0x0240, 0x0480, 0x0900, 0x1200, 0x2400, 0x4800, 0x9000,
+    // M^2
+    0x0521, 0x0A42, 0x1484, 0x2408, 0x4810, 0xB420, 0x6841, 0xD082,
+    0x8104, 0x0208, 0x0410, 0x0820, 0x1040, 0x2080, 0x4100, 0x8200,
+    // M^4
+    0x3415, 0x682B, 0xD056, 0x0098, 0x0130, 0x02F0, 0x04C0, 0x0980,
+    0x1780, 0x2600, 0x4C00, 0xBC00, 0x7801, 0xF002, 0xC004, 0x8008,
+    // M^8
+    0x2170, 0xD250, 0x8580, 0x0828, 0x1440, 0x2880, 0x4140, 0xA200,
+    0x0C01, 0x9A02, 0x3004, 0xF80B, 0xC012, 0xA024, 0x905A, 0x8090,
+    // M^16
+    0xD1A5, 0x1FDA, 0x1E95, 0xD8A3, 0xB156, 0xFA2F, 0xDD1B, 0xBAB6,
+    0xE97F, 0xF0DB, 0xE5B6, 0x73FF, 0xD6DA, 0x8DB4, 0xCFFA, 0x36D0,
+    // M^32
+    0x4926, 0x48B5, 0x7498, 0xD2E9, 0xE9C3, 0xD306, 0xF74C, 0x1E1A,
+    0x7035, 0x6263, 0x88D7, 0xA9AD, 0x2B1F, 0xA6BC, 0x9D6A, 0x98F8,
+    // M^64
+    0xABD9, 0x2DA6, 0xBD2E, 0xED71, 0x9273, 0x00F6, 0x438D, 0x1B99,
+    0x17B2, 0x7C6C, 0x44CB, 0xC597, 0x5366, 0x565E, 0x5CBE, 0x1B30,
+    // M^128
+    0x6FE8, 0x4B57, 0xF5E9, 0xFDEF, 0x634D, 0x5A19, 0xD77F, 0x326D,
+    0xD8C9, 0xCBFE, 0x2B6F, 0xA64C, 0xB7F5, 0x9B78, 0x7A61, 0x6FAA,
+    // M^256
+    0x3DE9, 0xAA7E, 0xE7EC, 0xFF1E, 0x42BF, 0x516C, 0x58F4, 0x0DFB,
+    0x7367, 0x3FA7, 0x8FDC, 0xCB3A, 0x3D38, 0x7EE0, 0xD9D0, 0xA1C1,
+    // M^512
+    0xB2CD, 0xD217, 0xD97C, 0xC3DC, 0x773A, 0x86E5, 0x8EE2, 0x19D4,
+    0xAF2B, 0x6712, 0xA6A5, 0xB958, 0x9894, 0xE52A, 0xEAC4, 0xC4A0,
+    // M^1024
+    0xE157, 0x1F7E, 0xC51E, 0x1CF1, 0x19F2, 0x7F75, 0x7F8B, 0xB797,
+    0xD3AD, 0xC45F, 0x14BD, 0x9569, 0x52FE, 0x55EE, 0x5B4E, 0x17F0,
+    // M^2048
+    0x97B3, 0x1B45, 0x54CD, 0x9CE6, 0xA5DF, 0xF73D, 0x9F37, 0x86FD,
+    0xF9E8, 0x19BC, 0xAFEB, 0x7F46, 0xA5E5, 0xBF58, 0x3231, 0xFF2A,
+    // M^4096
+    0x4D99, 0x66BE, 0x7E6D, 0x2B1D, 0xEEB9, 0x9563, 0xE0EF, 0x5DCD,
+    0x2319, 0x3F7F, 0x8E6C, 0xC8CA, 0x3BF8, 0x7360, 0xC650, 0x97C1,
+    // M^8192
+    0x761F, 0x11FA, 0x9A74, 0x519C, 0x1BBB, 0x5FE7, 0x74E7, 0x3DDC,
+    0xE73B, 0xF73A, 0xCEE4, 0x69DA, 0x71D1, 0xE722, 0xEED4, 0xCE88,
+    // M^16384
+    0xF64F, 0xDBEB, 0x8B76, 0x95B1, 0x47F3, 0xC377, 0x5D8E, 0x4F9E,
+    0x6BBE, 0x6C70, 0xFCF0, 0x95F1, 0xBB83, 0x5786, 0x5F8E, 0x1C18,
+    // M^32768
+    0x51FE, 0x0358, 0x07B0, 0x0D80, 0x1F80, 0x3B80, 0x6C00, 0xFC00,
+    0x9401, 0xB803, 0x5006, 0x500E, 0x0018, 0x0030, 0x0070, 0x00C0
+  };
+  __xor16_b3d_state = __xor16_jump(__xor16_b3d_state, table, n);
+  return __xor16_b3d_state;
+}
+
+uint16_t xor16_b3d_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %A0"       "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "clr    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_b3d_state)::"r18","r19");
+  return __xor16_b3d_state;
+}
+
+static const uint16_t __xor16_b3d_checkpoints[256] PROGMEM = {
+  0x0001, 0x3DE9, 0xB2CD, 0xADAA, 0xE157, 0x1FA6, 0x241B, 0xDB0A,
+  0x97B3, 0xD65A, 0xBA79, 0x9F54, 0x6978, 0xAB54, 0xA57C, 0x704F,
+  0x4D99, 0x63E2, 0x45ED, 0x0413, 0x5AF4, 0xB145, 0x138F, 0xF366,
+  0x3303, 0x988F, 0xD55D, 0x86C2, 0xEECB, 0x4036, 0x8791, 0x1070,
+  0x761F, 0xE7A9, 0x5B8D, 0x4BF2, 0xB288, 0x2F5B, 0x0404, 0x6830,
+  0x7FD9, 0x4769, 0xD1A3, 0xFD4E, 0xE630, 0xA559, 0xFB26, 0xA0CD,
+  0xAF35, 0x1ED1, 0x6C20, 0xB2BA, 0x96F6, 0x27CC, 0xF001, 0x0620,
+  0xE117, 0x4752, 0xAAF9, 0xAF97, 0xE838, 0x2106, 0x4015, 0x416A,
+  0xF64F, 0x5C23, 0x66F5, 0x8B92, 0xC301, 0x0938, 0x5490, 0x2470,
+  0xBA1B, 0x3CB2, 0xB368, 0x585F, 0xBAFC, 0x48AA, 0x1B1D, 0xDD66,
+  0x36A2, 0x054A, 0xF12F, 0x96A7, 0x006E, 0xBB14, 0xC0B0, 0x6639,
+  0xC66F, 0x4E97, 0x9DAE, 0x4563, 0xBB64, 0x8B97, 0x1904, 0x6289,
+  0x579B, 0x0039, 0xD124, 0x80CE, 0x4642, 0x9B21, 0x7786, 0x197D,
+  0xEB59, 0x59B7, 0x32E6, 0x358E, 0x0014, 0xA553, 0xAE46, 0xB106,
+  0xDCEC, 0x1D5E, 0xA27E, 0x192D, 0xF112, 0xA06F, 0x59DC, 0x53F7,
+  0x9E8F, 0x6526, 0x4775, 0x8BEE, 0x90D4, 0x6CA5, 0x6544, 0xE493,
+  0x51FE, 0x63DF, 0x7325, 0x5DA1, 0xB217, 0xEF7A, 0x1090, 0x727C,
+  0xF67A, 0x95F5, 0xFC9B, 0x58E2, 0x81CF, 0x08CC, 0x86C7, 0x34CE,
+  0x2B87, 0x849A, 0x3439, 0x1D20, 0x5BD5, 0xAEA7, 0x888C, 0x7FF2,
+  0x7E8C, 0xF440, 0xECE1, 0x7B9D, 0x77AD, 0x2098, 0xCEBA, 0x4818,
+  0xAF4B, 0xE77A, 0xDBAA, 0xCB24, 0x496B, 0x009C, 0x57B6, 0x744E,
+  0xFFAC, 0x778A, 0x018F, 0xF1F9, 0xCC85, 0xEB09, 0x43FC, 0xCB3E,
+  0x5EB4, 0x666D, 0x3BC8, 0x6E33, 0x5835, 0xE604, 0x5166, 0xD385,
+  0xDE17, 0x0CAC, 0x0083, 0x9A6C, 0x790E, 0x90D9, 0x49BE, 0xCD29,
+  0xDC0B, 0x6946, 0x0A0B, 0x9C14, 0x7D4C, 0xED8F, 0xB3EE, 0x1836,
+  0xA843, 0xDB78, 0x76EA, 0x7B70, 0x56D5, 0x9926, 0x385A, 0xC7C9,
+  0x2CF5, 0xA6DF, 0xF78F, 0x7A4B, 0x5EE8, 0x64D4, 0xD8B0, 0x903B,
+  0xE7A3, 0x0EED, 0x5A39, 0xC151, 0x2CD4, 0xCA5A, 0xC3A7, 0x183D,
+  0xC0CA, 0x787E, 0xA899, 0x99A8, 0x872D, 0x16AA, 0x84B4, 0xD7D9,
+  0x5372, 0x4971, 0x1743, 0x3147, 0x1830, 0xE5D1, 0xD013, 0x9001,
+  0xA110, 0xEEF9, 0xF99B, 0xA459, 0x8841, 0x0FE6, 0x41D7, 0xCD7C,
+  0x1C45, 0xFB2F, 0x623A, 0xDE24, 0x88E8, 0x9186, 0xAFF7, 0xE1A0
+};
+static const uint8_t __xor16_b3d_order[256] PROGMEM = {
+    0, 108,  97,  84, 186, 165, 170,  38,  19,  81,  55, 141,  69, 194, 185, 217,
+  245,  31, 134,  22, 229, 234, 236, 199, 223,  94, 115, 103,  78, 248, 147, 113,
+   49,   5, 157,  61,   6,  71,  53, 144, 220, 208,  37, 235, 106,  24, 146, 143,
+  107,  80, 206, 178,  73,   1,  62,  29,  63, 246, 174,  91,  18, 100,  57,  41,
+  122, 159,  77, 164, 233, 190,  35,  16,  89, 182, 128, 232, 119,  70, 204,  96,
+  166, 180,  75, 139, 105, 118, 218,  20,  34, 148,  65, 131, 176, 212, 250,  95,
+  129,  17, 213, 121, 126,  87, 177,  66,  39, 193,  12,  50, 125, 179,  15, 135,
+  130, 167,  32, 202, 102, 169, 156, 225, 188, 211, 203, 155, 196, 152,  40, 151,
+   99, 140, 145, 230,  27, 142, 228,  30, 244, 150, 252,  67,  93, 123, 239, 215,
+  124, 189, 253, 137,  83,  52,   8,  25, 205, 227, 187, 101, 195,  90, 120,  11,
+  117,  47, 240, 114, 243, 109,  45,  14, 209, 200, 226,  58,  13,   3, 110, 149,
+   48, 160,  59, 254, 111,  21, 132,  36,  51,   2,  74, 198,  72,  10,  76,  85,
+   92,  86, 224, 219,  68, 222,  88, 207, 221, 163, 175, 172, 191, 247, 158, 238,
+   98,  42, 183,  26,   9, 231, 214,   7, 201, 162, 192, 112,  79, 184, 251,  56,
+    4, 255, 127, 237, 181,  44, 161, 216,  33,  60, 173, 104, 154, 197,  28, 241,
+  133,  54, 116,  82, 171,  23, 153,  64, 136, 210, 242,  46, 249, 138,  43, 168
+};
+
+uint16_t xor16_b3d_position() {
+  uint16_t saved = __xor16_b3d_state;
+  uint16_t pos = __xor16_position(saved, xor16_b3d, __xor16_b3d_checkpoints, __xor16_b3d_order);
+  __xor16_b3d_state = saved;
+  return pos;
+}
+
+void xor16_b3d_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_b3d, xor16_b3d, __xor16_b3d_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: b53 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_b53_state;
+uint16_t __xor16_b53_state;
 
 bool seed_xor16_b53(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -24,16 +25,81 @@ uint16_t xor16_b53() {
       "add    r19, r19"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_b53_state)::"r18","r19");
+  return __xor16_b53_state;
+}
+
+void xor16_b53_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
@@ -45,6 +111,178 @@ uint16_t xor16_b53() {
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_b53_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_b53_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x4A49, 0x9492, 0x2924, 0x5248, 0xA490, 0x0129, 0x0252, 0x04A4,
+    0x0948, 0x1290, 0x2520, 0x4A40, 0x9480, 0x2900, 0x5200, 0xA400,
+    // M^2
+    0x1083, 0x2106, 0x4205, 0x840A, 0x0814, 0x1060, 0x20C0, 0x0989,
+    0x1312, 0x2624, 0x0441, 0x0882, 0x1104, 0x6A08, 0xD410, 0xA820,
+    // M^4
+    0x2908, 0x1A19, 0xA0B2, 0x096D, 0x4293, 0x21A4, 0x4341, 0x8690,
+    0x0D20, 0x1A08, 0x3402, 0x200D, 0x4013, 0x14B4, 0x6161, 0xDACA,
+    // M^8
+    0x30F4, 0x18E0, 0x31C0, 0xCF1F, 0x8C7B, 0x1E12, 0x1C00, 0x30C3,
+    0x388B, 0x737B, 0x7ABC, 0x9463, 0x10E3, 0x3104, 0x3318, 0x1718,
+    // M^16
+    0xAE8D, 0xB651, 0x35AF, 0xDB9F, 0x90A5, 0x19DC, 0xFE3C, 0x2530,
+    0x624C, 0x306D, 0xA992, 0x5741, 0x0A26, 0x28AC, 0x2973, 0x62CB,
+    // M^32
+    0xE154, 0x19AA, 0x2354, 0x0787, 0xCF23, 0x9AB2, 0xC0C5, 0x6A0B,
+    0x21BE, 0x85D7, 0x7CAE, 0x8857, 0xFD0E, 0xAD31, 0x7238, 0x29FD,
+    // M^64
+    0xFBF8, 0xBA73, 0x25EA, 0x6966, 0x6919, 0xFF43, 0x330B, 0x2DF0,
+    0x8E6C, 0xCAAA, 0x1B3E, 0x75E6, 0xE3C4, 0xE54E, 0xF5C6, 0x3E00,
+    // M^128
+    0x1DAB, 0x631C, 0x42B1, 0xB8D3, 0x1085, 0x95D2, 0x6AA1, 0x8D5B,
+    0x1AB6, 0x752C, 0xB241, 0x183F, 0x515F, 0x7E2E, 0xD97C, 0xA2F8,
+    // M^256
+    0x3F7A, 0x222F, 0xB9F7, 0x1C7E, 0x831E, 0xCF33, 0xCF63, 0xAE70,
+    0x15ED, 0x314A, 0x8FAF, 0x48E2, 0x6C64, 0x25F3, 0x3DC6, 0x7384,
+    // M^512
+    0x1762, 0x6356, 0xEE80, 0xAFC1, 0x539B, 0xFCD0, 0xB0AD, 0x233E,
+    0xC2F5, 0xAD48, 0x49F1, 0xF92B, 0x66DF, 0x8FDA, 0x61FC, 0x4771,
+    // M^1024
+    0x6FB8, 0xEF7B, 0x97FB, 0x933D, 0xC3CE, 0xBF5A, 0x27B9, 0x6D3B,
+    0x4EFF, 0xA5E8, 0x7198, 0xD373, 0xFFE2, 0x9489, 0x514A, 0x4F34,
+    // M^2048
+    0x0EAD, 0x8BD8, 0x0FB1, 0x4C2B, 0x5456, 0xF592, 0xE32C, 0x46BD,
+    0xE45A, 0x823F, 0x4916, 0xD165, 0x264A, 0x50F0, 0xBBA8, 0xF3D9,
+    // M^4096
+    0xE454, 0xF935, 0x17C2, 0x1F17, 0xE7E7, 0x0AB4, 0xC8EC, 0xDACF,
+    0x211E, 0x16CD, 0x5EA8, 0x9DC3, 0xBF06, 0x99B7, 0xCD67, 0xEBEF,
+    // M^8192
+    0xD95E, 0xA221, 0x3D6B, 0xA6FA, 0xC470, 0xAB50, 0xAB09, 0x1517,
+    0xAEAE, 0x09C1, 0x68AB, 0xB9DE, 0xD711, 0xD50B, 0x0C06, 0x180C,
+    // M^16384
+    0x82A2, 0xB6C8, 0xA01D, 0x7988, 0xB888, 0xBCCF, 0xAC12, 0x9370,
+    0x9244, 0x7030, 0x0311, 0x4EB8, 0x11F1, 0xD89B, 0x4E3F, 0xF55E,
+    // M^32768
+    0x1C19, 0x09FF, 0xCE7A, 0xB151, 0x9874, 0xA300, 0x6E2C, 0xAE8E,
+    0x9890, 0x8312, 0xD85E, 0x9D19, 0x3A32, 0x8232, 0x9A1E, 0x9899
+  };
+  __xor16_b53_state = __xor16_jump(__xor16_b53_state, table, n);
+  return __xor16_b53_state;
+}
+
+uint16_t xor16_b53_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_b53_state)::"r18","r19");
   return __xor16_b53_state;
 }
+
+static const uint16_t __xor16_b53_checkpoints[256] PROGMEM = {
+  0x0001, 0x3F7A, 0x1762, 0xE513, 0x6FB8, 0x05FC, 0x12F5, 0xF69D,
+  0x0EAD, 0x0DB7, 0x945F, 0x64EE, 0xBE1C, 0xEA83, 0xA13C, 0xAA3E,
+  0xE454, 0x1194, 0xED10, 0x3A0F, 0x88E3, 0x8813, 0xA52D, 0x99F5,
+  0xE95C, 0xDF4A, 0x30FE, 0xE30F, 0xF7CA, 0xF39F, 0xB6C0, 0xE5E5,
+  0xD95E, 0xB4F2, 0xBAAD, 0xB80B, 0x73DA, 0x8CAA, 0xEBDB, 0xE4D2,
+  0x243C, 0x43F8, 0x2821, 0x9D58, 0x9D43, 0x1F76, 0x9718, 0x2B88,
+  0xFBB8, 0x95B3, 0x7AAA, 0x52EB, 0xCFE3, 0x1EDD, 0xE29D, 0xED66,
+  0x2299, 0x1AD3, 0xEA94, 0x8680, 0x6311, 0x80F6, 0xC562, 0xF67F,
+  0x82A2, 0x01A2, 0x5681, 0x7E4D, 0xD7C6, 0x73E5, 0x785B, 0x71E5,
+  0x4911, 0xDCAD, 0x1EDB, 0x7945, 0x60B0, 0xFA68, 0x6253, 0x7857,
+  0xD46C, 0x0850, 0x049F, 0x1A1D, 0x0C21, 0x3704, 0x5B68, 0x21C9,
+  0x7209, 0x661F, 0x9D12, 0x6C71, 0x634C, 0x5678, 0x7077, 0x53BD,
+  0x0DAB, 0xB2C8, 0x7634, 0x3F6E, 0x2D8B, 0x5808, 0x053E, 0x51C9,
+  0x0658, 0xEEE6, 0xA84E, 0x5650, 0xA33A, 0x00AC, 0xC4CA, 0x9EAF,
+  0x3078, 0xD6A7, 0x5922, 0xE1B1, 0xA37B, 0xF0B5, 0x6305, 0xBA1F,
+  0x7879, 0x9CF9, 0xD697, 0x150F, 0x4EFA, 0xD8AE, 0x8C21, 0x4480,
+  0x1C19, 0x0B33, 0x3D3D, 0x4DE9, 0x6242, 0xC433, 0x9095, 0xB403,
+  0xA8E9, 0x93B1, 0xE660, 0xD504, 0x0193, 0x25D6, 0xC664, 0x4900,
+  0x60C9, 0x5A22, 0xC516, 0xCCC6, 0x73C4, 0x8812, 0x9A57, 0x8E97,
+  0x0C4F, 0xB0F2, 0x3502, 0xF1FA, 0x0157, 0xFD32, 0xBB77, 0x71BA,
+  0xBDB0, 0x0AEE, 0x502E, 0x1937, 0xD9E4, 0x68FE, 0xFA4F, 0x09C2,
+  0x1E33, 0xCB1B, 0xA032, 0x3875, 0x04B6, 0xF62A, 0x4852, 0x1B76,
+  0x18B7, 0x6279, 0x8935, 0xE42B, 0x2A06, 0xC783, 0x566F, 0x57CB,
+  0x9A92, 0x6909, 0x663E, 0x6D5B, 0x87C3, 0xA4CA, 0x869A, 0xDE5E,
+  0x1FFA, 0x9CE1, 0x49F7, 0xE955, 0xFC4E, 0x885D, 0xEDE8, 0x0B4F,
+  0x1BFA, 0x134E, 0x0006, 0x9BD8, 0x8DD6, 0xD8F1, 0x7880, 0x92C3,
+  0x52EC, 0x6B41, 0x8469, 0xDF7F, 0xFA5E, 0xB5A6, 0x5ACA, 0x7748,
+  0x0C44, 0xB1D9, 0xEEF7, 0x142A, 0x12A9, 0x1F69, 0xACDA, 0x4D66,
+  0x74EE, 0xD278, 0x8C5C, 0x5D3D, 0x55DC, 0x8C64, 0x0D6E, 0x5556,
+  0x1C45, 0xE2C7, 0x9F4A, 0x0D38, 0x82F3, 0x72A5, 0xA2D5, 0x03BD,
+  0x5C09, 0xB5EB, 0x0F5A, 0x91C6, 0xF0C6, 0xFD1E, 0xD1CD, 0xCC2B,
+  0x4717, 0xB172, 0x8E9F, 0x1031, 0x1F33, 0xDEF6, 0x62C7, 0xECCE
+};
+static const uint8_t __xor16_b53_order[256] PROGMEM = {
+    0, 202, 109, 156, 140,  65, 239,  82, 172, 102,   5, 104,  81, 167, 161, 129,
+  199,  84, 216, 152, 235, 230,  96,   9,   8, 242, 251,  17, 220,   6, 201, 219,
+  123,   2, 176, 163,  83,  57, 175, 200, 128, 232, 168,  74,  53, 252, 221,  45,
+  192,  87,  56,  40, 141,  42, 180,  47, 100, 112,  26, 154,  85, 171,  19, 130,
+   99,   1,  41, 127, 248, 174, 143,  72, 194, 223, 131, 124, 162, 103,  51, 208,
+   95, 231, 228, 107, 182,  93,  66, 183, 101, 114, 145, 214,  86, 240, 227,  76,
+  144, 132,  78, 177, 254, 118,  60,  92,  11,  89, 186, 165, 185, 209,  91, 187,
+    4,  94, 159,  71,  88, 237, 148,  36,  69, 224,  98, 215,  79,  70, 120, 206,
+   75,  50,  67,  61,  64, 236, 210,  59, 190, 188, 149,  21, 197,  20, 178, 126,
+  226, 229,  37, 204, 151, 250, 134, 243, 207, 137,  10,  49,  46,  23, 150, 184,
+  203, 193, 121,  90,  44,  43, 111, 234, 170,  14, 238, 108, 116, 189,  22, 106,
+  136,  15, 222, 153, 249, 217,  97, 135,  33, 213, 241,  30,  35, 119,  34, 158,
+  160,  12, 133, 110, 146,  62, 142, 181, 169, 247, 147,  52, 246, 225,  80, 139,
+  122, 113,  68, 125, 205,  32, 164,  73, 191, 253,  25, 211, 115,  54, 233,  27,
+  179,  16,  39,   3,  31, 138, 195,  24,  13,  58,  38, 255,  18,  55, 198, 105,
+  218, 117, 244, 155,  29, 173,  63,   7,  28, 166, 212,  77,  48, 196, 245, 157
+};
+
+uint16_t xor16_b53_position() {
+  uint16_t saved = __xor16_b53_state;
+  uint16_t pos = __xor16_position(saved, xor16_b53, __xor16_b53_checkpoints, __xor16_b53_order);
+  __xor16_b53_state = saved;
+  return pos;
+}
+
+void xor16_b53_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_b53, xor16_b53, __xor16_b53_checkpoints);
+}
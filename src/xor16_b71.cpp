@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: b71 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_b71_state;
+uint16_t __xor16_b71_state;
+static uint16_t __xor16_b71_weyl_count;
+static uint8_t __xor16_b71_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_b71_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_b71(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_b71(uint16_t seed) {
   }
   if(seed) {
     __xor16_b71_state = seed;
+    __xor16_b71_spare_full = 0;
     return 1;
   }
   return 0;
@@ -39,3 +44,422 @@ uint16_t xor16_b71() {
     :"+d"((uint16_t)__xor16_b71_state)::"r18","r19");
   return __xor16_b71_state;
 }
+
+uint16_t xor16_b71_star() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_b71_state)::"r18","r19");
+  return rng16::star(__xor16_b71_state);
+}
+
+/* The same step as xor16_b71(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_b71_weyl(uint16_t seed) {
+  __xor16_b71_state = seed ? seed : 1;
+  __xor16_b71_weyl_count = seed;
+  __xor16_b71_spare_full = 0;
+}
+
+uint16_t xor16_b71_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_b71_state), "+d"(__xor16_b71_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_b71(). */
+uint8_t xor16_b71_byte() {
+  if (__xor16_b71_spare_full) {
+    __xor16_b71_spare_full = 0;
+    return __xor16_b71_spare;
+  }
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_b71_state)::"r18","r19");
+  __xor16_b71_spare = __xor16_b71_state >> 8;
+  __xor16_b71_spare_full = 1;
+  return __xor16_b71_state;
+}
+
+/* n bytes, the same ones n calls to xor16_b71_byte() would return; whole steps go through xor16_b71_fill(). */
+void xor16_b71_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_b71_spare_full) {
+    __xor16_b71_spare_full = 0;
+    *dst++ = __xor16_b71_spare;
+    n--;
+  }
+  xor16_b71_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_b71_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 29 eors. */
+void xor16_b71_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r6"       "\n\t" // y ^= y << 11
+      "eor    r16, r5"       "\n\t"
+      "eor    r15, r4"       "\n\t"
+      "eor    r14, r3"       "\n\t"
+      "eor    r13, r2"       "\n\t"
+      "eor    r2, r9"        "\n\t" // y ^= y >> 7
+      "eor    r3, r10"       "\n\t"
+      "eor    r4, r11"       "\n\t"
+      "eor    r5, r12"       "\n\t"
+      "eor    r6, r13"       "\n\t"
+      "eor    r7, r14"       "\n\t"
+      "eor    r8, r15"       "\n\t"
+      "eor    r9, r16"       "\n\t"
+      "eor    r10, r17"      "\n\t"
+      "eor    r17, r16"      "\n\t" // y ^= y << 1
+      "eor    r16, r15"      "\n\t"
+      "eor    r15, r14"      "\n\t"
+      "eor    r14, r13"      "\n\t"
+      "eor    r13, r12"      "\n\t"
+      "eor    r12, r11"      "\n\t"
+      "eor    r11, r10"      "\n\t"
+      "eor    r10, r9"       "\n\t"
+      "eor    r9, r8"        "\n\t"
+      "eor    r8, r7"        "\n\t"
+      "eor    r7, r6"        "\n\t"
+      "eor    r6, r5"        "\n\t"
+      "eor    r5, r4"        "\n\t"
+      "eor    r4, r3"        "\n\t"
+      "eor    r3, r2"        "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_b71_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_b71_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_b71_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x1833, 0x3066, 0x60CC, 0xC198, 0x8330, 0x0060, 0x00C0, 0x0183,
+    0x0306, 0x060C, 0x0C18, 0x1830, 0x3060, 0x60C0, 0xC180, 0x8300,
+    // M^2
+    0x8355, 0x00AA, 0x0157, 0x02AD, 0x055A, 0x00A0, 0x0143, 0x2AD0,
+    0x55A0, 0xAB40, 0x5680, 0xAB00, 0x5000, 0xA003, 0x4005, 0x860A,
+    // M^4
+    0xFEF1, 0x2877, 0xD311, 0x019F, 0x053E, 0x2A70, 0xD71C, 0x8E8A,
+    0x3955, 0x72AA, 0xC715, 0x73E9, 0x1005, 0xA5F6, 0xC207, 0x79CD,
+    // M^8
+    0x4046, 0x2BDA, 0x1BFF, 0xB6E9, 0x2BF7, 0x5CE7, 0xF095, 0x18F9,
+    0x008D, 0x884C, 0x1FFE, 0xB083, 0x3DE5, 0xAFC5, 0xCCF7, 0x48A1,
+    // M^16
+    0x0C47, 0xC92F, 0x5C51, 0x0F17, 0x7898, 0x9A87, 0x7EC1, 0xE4B5,
+    0xF5A9, 0xA5A1, 0x03E9, 0xA9E4, 0xD2E2, 0x730D, 0xC434, 0x782C,
+    // M^32
+    0x4DF5, 0xECFC, 0xB6C5, 0x1BA4, 0x5F05, 0xDB07, 0xFC44, 0x9A40,
+    0x96D5, 0x8F14, 0x53AB, 0x0BCE, 0x0287, 0x6AD2, 0x01BF, 0x05FE,
+    // M^64
+    0xD639, 0x7991, 0x2C20, 0xE70A, 0xB9AC, 0x0305, 0x7EF0, 0x7FE7,
+    0x19F7, 0xAD9A, 0xE113, 0x3596, 0x0298, 0x3A4A, 0x84FF, 0x66E5,
+    // M^128
+    0x2791, 0x803E, 0xEDCA, 0x13B5, 0xC59E, 0x4E74, 0x7E8C, 0x5D5F,
+    0x16CF, 0xC90D, 0xD7A3, 0x53CC, 0x8CDB, 0x40B5, 0x58CA, 0x0A37,
+    // M^256
+    0xF784, 0xFF9C, 0x30B0, 0x4FF7, 0x7511, 0x0D04, 0x7AE6, 0xA473,
+    0xE876, 0xCE10, 0x62C3, 0xD67F, 0xDC0F, 0x4424, 0x3785, 0x5B4E,
+    // M^512
+    0x2486, 0xC81F, 0x444D, 0x3B77, 0xA78E, 0x6C7A, 0xAB7C, 0x7742,
+    0x334F, 0x6376, 0x6B3C, 0x69BB, 0x7327, 0x68F2, 0xBFC9, 0xE1AE,
+    // M^1024
+    0xF8DE, 0x03F1, 0x2435, 0xEA0B, 0x723E, 0x465C, 0xAF6C, 0xFC7A,
+    0x7333, 0x6BD8, 0x5A77, 0xE697, 0x308B, 0x6155, 0x6B0A, 0xA9C7,
+    // M^2048
+    0x9963, 0x8741, 0xD3AB, 0x3FF3, 0xA8A1, 0x49C9, 0x4B97, 0x5D07,
+    0xED72, 0x3F00, 0x92DA, 0xC369, 0xBC80, 0x78D5, 0x1DD9, 0xD13A,
+    // M^4096
+    0x5FDD, 0x4366, 0x970E, 0xAE4E, 0xE72B, 0x83C2, 0x34ED, 0xD011,
+    0x2549, 0x4794, 0x5439, 0xBA5F, 0x19DB, 0xEE1C, 0x18E0, 0xC4CB,
+    // M^8192
+    0xE8CA, 0x197A, 0x91D2, 0xCDEE, 0x35E4, 0x018C, 0xA25D, 0x7D06,
+    0x5A12, 0x8E30, 0xC078, 0x38FA, 0x37EF, 0x45AE, 0xC4BA, 0xDE1B,
+    // M^16384
+    0x6C3A, 0x17A6, 0x4023, 0x23A0, 0xA72E, 0x7B28, 0x36CA, 0x9CC3,
+    0x6901, 0x9CC1, 0x417A, 0x751C, 0x1540, 0x671C, 0x4723, 0x5246,
+    // M^32768
+    0xFC59, 0x1194, 0x4797, 0x7537, 0x8EED, 0xED2B, 0x31E8, 0xA2F5,
+    0x5018, 0xB553, 0xF0E8, 0xD9A9, 0x0BF1, 0x5028, 0xF32D, 0xAFED
+  };
+  __xor16_b71_state = __xor16_jump(__xor16_b71_state, table, n);
+  return __xor16_b71_state;
+}
+
+uint16_t xor16_b71_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_b71_state)::"r18","r19");
+  return __xor16_b71_state;
+}
+
+static const uint16_t __xor16_b71_checkpoints[256] PROGMEM = {
+  0x0001, 0xF784, 0x2486, 0x4DB8, 0xF8DE, 0x09C0, 0xE09C, 0x86CA,
+  0x9963, 0xC6B2, 0xE3E2, 0x2284, 0x1EF7, 0x388B, 0xADC8, 0xD2C2,
+  0x5FDD, 0x5A17, 0xBE5C, 0xC979, 0xE842, 0x7BEA, 0x3C4D, 0xDEB2,
+  0xE992, 0x3818, 0x74B2, 0xEE97, 0xBB89, 0x2F7C, 0xAB4A, 0x25FE,
+  0xE8CA, 0x906E, 0x7078, 0xE2AA, 0xFFE3, 0xBDB3, 0x4BD1, 0x9B9C,
+  0xD97D, 0x04FD, 0x4C80, 0x274A, 0xCA0C, 0x0BE3, 0x2B90, 0x655F,
+  0x81BC, 0x1019, 0x116D, 0xCB58, 0xDCD2, 0x5060, 0x9C68, 0x0BE8,
+  0x6C7F, 0xB2B1, 0x2697, 0x013D, 0x18A0, 0xA307, 0x01A4, 0x71B1,
+  0x6C3A, 0x0F63, 0xED20, 0x7921, 0x6B27, 0xB614, 0x2A17, 0x11F2,
+  0x6D65, 0x9FBD, 0x413E, 0x273D, 0xF057, 0xC3BF, 0xE194, 0x214B,
+  0x915B, 0x272F, 0x7ADA, 0xAC2E, 0x2609, 0x5084, 0x7F49, 0xFFE1,
+  0x422F, 0x83CE, 0x2366, 0xDA8C, 0x739F, 0x2FF5, 0xB74A, 0x4D4D,
+  0x996A, 0x7EC1, 0xFC13, 0x3D55, 0x0C22, 0x4624, 0xA6E2, 0x9FB4,
+  0xF94D, 0x38CC, 0xEF86, 0xD16A, 0x9F3B, 0x2A61, 0xDC2D, 0x81BF,
+  0x1801, 0xFDF4, 0x3E1A, 0x27FD, 0x2EC2, 0x1F81, 0x1D22, 0x725D,
+  0xE68A, 0x9024, 0xBAF5, 0xBABE, 0x87B7, 0xFB25, 0xCEC9, 0x7081,
+  0xFC59, 0xF7D8, 0x5436, 0x3E70, 0xE074, 0x1AAC, 0x1250, 0x1DE8,
+  0x1CA3, 0xC9DC, 0x8601, 0x0019, 0xCD62, 0xB87F, 0x60B6, 0x60EB,
+  0xE7DF, 0xB091, 0xE583, 0x0E31, 0xF53D, 0x8E83, 0x8D89, 0x1B84,
+  0xB8D5, 0x79AA, 0x88BB, 0x16B8, 0xE34D, 0xFCAC, 0x966C, 0x2337,
+  0x22FF, 0x5BEB, 0x8FED, 0x92C6, 0x58E8, 0xA193, 0x2E66, 0x8646,
+  0x4257, 0xCECA, 0x7899, 0x10C0, 0x029A, 0xAF19, 0x40D2, 0x639D,
+  0x0C66, 0x0C72, 0x49D3, 0xAA10, 0x7214, 0x241F, 0x24A9, 0x37E3,
+  0x0707, 0x7C0D, 0x93D1, 0xFD27, 0x9D86, 0xB0D4, 0x5851, 0xC586,
+  0x8D21, 0xFD04, 0x989A, 0x3037, 0xD896, 0x78F5, 0x1865, 0xBAA6,
+  0xBD51, 0x67DC, 0xE3C7, 0xE8B4, 0x1246, 0xA7D5, 0x377F, 0xA922,
+  0xD3FB, 0x77CD, 0xBD5D, 0x189B, 0x9CFD, 0x1DBE, 0xDC78, 0x497C,
+  0x7438, 0xFA8F, 0x3FA3, 0xAB9E, 0xBECA, 0xD737, 0xB4DC, 0x7565,
+  0x95CD, 0x5BA2, 0x4D78, 0x264B, 0xD5FE, 0x1C2A, 0xD5DC, 0xEEB2,
+  0x71B9, 0x23CD, 0x3414, 0xBF49, 0x932A, 0x1C48, 0x5DA2, 0xE1AB,
+  0x2E01, 0xC90C, 0x2D85, 0x7BA9, 0x4EB3, 0x9957, 0x8E17, 0x6C5B,
+  0x8F05, 0x0EA0, 0xD3DB, 0x7AC9, 0xD127, 0x6D1E, 0xDAA1, 0xF658
+};
+static const uint8_t __xor16_b71_order[256] PROGMEM = {
+    0, 139,  59,  62, 172,  41, 184,   5,  45,  55, 100, 176, 177, 147, 249,  65,
+   49, 171,  50,  71, 204, 134, 155, 112, 198, 211,  60, 133, 151, 229, 237, 136,
+  118, 213, 135,  12, 117,  79,  11, 160, 159,  90, 233, 181,   2, 182,  31,  84,
+  227,  58,  81,  75,  43, 115,  70, 109,  46, 242, 240, 166, 116,  29,  93, 195,
+  234, 206, 183,  25,  13, 105,  22,  99, 114, 131, 218, 174,  74,  88, 168, 101,
+  215, 178,  38,  42,  95, 226,   3, 244,  53,  85, 130, 190, 164,  17, 225, 161,
+  238,  16, 142, 143, 175,  47, 201,  68,  64, 247,  56, 253,  72,  34, 127,  63,
+  232, 180, 119,  92, 216,  26, 223, 209, 170, 197,  67, 153, 251,  82, 243,  21,
+  185,  97,  86,  48, 111,  89, 138, 167,   7, 124, 154, 192, 150, 246, 149, 248,
+  162, 121,  33,  80, 163, 236, 186, 224, 158, 194, 245,   8,  96,  39,  54, 212,
+  188, 108, 103,  73, 165,  61, 102, 205, 207, 179,  30, 219,  83,  14, 173, 145,
+  189,  57, 222,  69,  94, 141, 152, 199, 123, 122,  28, 200, 210,  37,  18, 220,
+  235,  77, 191,   9, 241,  19, 137,  44,  51, 140, 126, 169, 252, 107,  15, 250,
+  208, 230, 228, 221, 196,  40,  91, 254, 110, 214,  52,  23, 132,   6,  78, 239,
+   35, 156, 202,  10, 146, 120, 144,  20, 203,  32,  24,  66,  27, 231, 106,  76,
+  148, 255,   1, 129,   4, 104, 217, 125,  98, 128, 157, 193, 187, 113,  87,  36
+};
+
+uint16_t xor16_b71_position() {
+  uint16_t saved = __xor16_b71_state;
+  uint16_t pos = __xor16_position(saved, xor16_b71, __xor16_b71_checkpoints, __xor16_b71_order);
+  __xor16_b71_state = saved;
+  return pos;
+}
+
+void xor16_b71_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_b71, xor16_b71, __xor16_b71_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: bb3 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_bb3_state;
+uint16_t __xor16_bb3_state;
 
 bool seed_xor16_bb3(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -40,3 +41,220 @@ uint16_t xor16_bb3() {
     :"+d"((uint16_t)__xor16_bb3_state)::"r18","r19");
   return __xor16_bb3_state;
 }
+
+void xor16_bb3_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_bb3_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_bb3_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x4800, 0x9000, 0x2000, 0x4000, 0x8000, 0x0120, 0x0240, 0x0480,
+    0x0900, 0x1200, 0x2400, 0x4809, 0x9012, 0x2024, 0x4048, 0x8090,
+    // M^2
+    0x0841, 0x1082, 0x2024, 0x4048, 0x8090, 0x0820, 0x1040, 0x2080,
+    0x4109, 0x8212, 0x0424, 0x0041, 0x0082, 0x0104, 0x0208, 0x0410,
+    // M^4
+    0x1840, 0x3080, 0x2900, 0x5200, 0xA400, 0x0861, 0x10C2, 0x2184,
+    0x0B08, 0x1610, 0x2C20, 0x1801, 0x3002, 0x612D, 0xC25A, 0x84B4,
+    // M^8
+    0x38C1, 0x70AB, 0x7224, 0xE448, 0xC9B9, 0x18E2, 0x31C4, 0x62A1,
+    0x5719, 0xAE32, 0x5D6D, 0x3043, 0x61AF, 0xC35E, 0x86BC, 0x0C71,
+    // M^16
+    0xF916, 0xF22C, 0xE0B9, 0xC172, 0x82E4, 0x6AC0, 0xD4A9, 0xA952,
+    0x5665, 0xADC3, 0x5AAF, 0xDB5F, 0xB6BE, 0x6D5C, 0xDAB8, 0xB570,
+    // M^32
+    0xA961, 0x52E2, 0x7B86, 0xF70C, 0xEF31, 0xBC83, 0x782F, 0xF177,
+    0x3CAC, 0x7978, 0xF3F9, 0x8533, 0x0B6F, 0x17F7, 0x2FEE, 0x5ED5,
+    // M^64
+    0x9D70, 0x3AC0, 0x2B82, 0x5704, 0xAF01, 0x3E73, 0x7DCF, 0xFA97,
+    0xAB2C, 0x5678, 0xACF0, 0x39B1, 0x7342, 0xE7AD, 0xCF5A, 0x9FBD,
+    // M^128
+    0x3E2F, 0x7C7E, 0xE31F, 0xC63E, 0x8D75, 0x1CDB, 0x39B6, 0x7265,
+    0xFE00, 0xFD29, 0xFB7B, 0xF0E7, 0xE1EE, 0xC3FC, 0x87F8, 0x0EF9,
+    // M^256
+    0xAF0C, 0x5F31, 0xA3D1, 0x47A2, 0x8E4D, 0xA8BB, 0x505F, 0xA09E,
+    0x5DA6, 0xBA45, 0x74AA, 0x5D55, 0xBAAA, 0x7574, 0xEAE8, 0xD4D9,
+    // M^512
+    0x8BC2, 0x17A4, 0x97CE, 0x2EB5, 0x5C43, 0xCD0F, 0x9A1E, 0x343C,
+    0xD0DE, 0xA095, 0x412A, 0xF6D4, 0xECA1, 0xD942, 0xB38D, 0x6613,
+    // M^1024
+    0x590A, 0xB33D, 0xBB2E, 0x7755, 0xEEAA, 0x97A3, 0x2E6F, 0x5CFE,
+    0x6581, 0xCB22, 0x974D, 0x646D, 0xC9D3, 0x928F, 0x253E, 0x4B55,
+    // M^2048
+    0x2969, 0x52D2, 0x3222, 0x656D, 0xCBD3, 0x9A02, 0x350D, 0x6B13,
+    0x4089, 0x803B, 0x0076, 0x0C41, 0x198B, 0x3316, 0x660C, 0xCD11,
+    // M^4096
+    0x9CD5, 0x38A3, 0x6276, 0xC4CC, 0x8998, 0x0A32, 0x1444, 0x2981,
+    0x411B, 0x8216, 0x042C, 0x1053, 0x2086, 0x410C, 0x8218, 0x0519,
+    // M^8192
+    0x7B1E, 0xF61C, 0x8C39, 0x1852, 0x3084, 0x294C, 0x5298, 0xA510,
+    0x2A21, 0x5442, 0xA8A4, 0x192C, 0x3258, 0x65B9, 0xCA5B, 0x94B6,
+    // M^16384
+    0xA806, 0x5105, 0x5FBA, 0xBF74, 0x7EC8, 0x9047, 0x2187, 0x430E,
+    0x7A85, 0xF423, 0xE846, 0xBC72, 0x79ED, 0xF2F3, 0xE4CF, 0xC8B7,
+    // M^32768
+    0x8889, 0x101B, 0x0440, 0x0989, 0x123B, 0x3664, 0x6DC1, 0xDBA2,
+    0x9332, 0x2664, 0x4DC1, 0x8990, 0x1320, 0x2640, 0x4D89, 0x9B32
+  };
+  __xor16_bb3_state = __xor16_jump(__xor16_bb3_state, table, n);
+  return __xor16_bb3_state;
+}
+
+uint16_t xor16_bb3_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_bb3_state)::"r18","r19");
+  return __xor16_bb3_state;
+}
+
+static const uint16_t __xor16_bb3_checkpoints[256] PROGMEM = {
+  0x0001, 0xAF0C, 0x8BC2, 0xC19F, 0x590A, 0x4822, 0x4037, 0x9FF2,
+  0x2969, 0x65CD, 0x0D2E, 0x67A0, 0x04F0, 0xA29D, 0x7E44, 0x4502,
+  0x9CD5, 0x35DD, 0xD321, 0x64CF, 0x0FB9, 0xA0DA, 0xC7B2, 0x7421,
+  0x562B, 0x8189, 0xC14F, 0x2786, 0xBA43, 0x5C75, 0x03C9, 0xFF8C,
+  0x7B1E, 0xAA8F, 0xF26D, 0xF831, 0x2540, 0x0C27, 0xD2A8, 0x7159,
+  0x4E2C, 0x359A, 0xD092, 0xF579, 0x46E4, 0xDFAC, 0xA6D1, 0xBEC2,
+  0x274D, 0xFD1D, 0x4084, 0xE9A7, 0x107F, 0xD84D, 0xC2EE, 0x674C,
+  0xB8F9, 0x78CB, 0x3F3D, 0x6C4B, 0x51A3, 0xF5FC, 0xEAA7, 0xF79C,
+  0xA806, 0x0018, 0xC9EF, 0x72F6, 0xB5A4, 0x99FF, 0xACF9, 0xB6CB,
+  0x92B6, 0xAEBE, 0x0F3D, 0xA395, 0x6440, 0xBB69, 0xB1FB, 0x2709,
+  0x0E93, 0x4D54, 0xE372, 0x853E, 0x6061, 0xC874, 0xB61C, 0xBFD6,
+  0x5777, 0xE64E, 0x6EB7, 0xD9A2, 0xD37C, 0xF1A2, 0xFB5D, 0xDE34,
+  0x9206, 0x28D6, 0xAA4D, 0x5D9D, 0x41B7, 0x62CA, 0xCD8B, 0x5D69,
+  0x3451, 0xCA6A, 0x3956, 0xEDDF, 0x55DE, 0xBC80, 0x9266, 0xD032,
+  0xFD5C, 0xBFD7, 0xF87B, 0x6D8C, 0xAF28, 0x80A8, 0x9B5E, 0xB195,
+  0x64AF, 0xF75D, 0xF7CB, 0x25F8, 0xCDED, 0x596D, 0xE32A, 0x1C8E,
+  0x8889, 0xC1BC, 0x018C, 0x194B, 0x5D99, 0xE266, 0xF504, 0x7B32,
+  0xE647, 0x8619, 0x7CD5, 0x7E98, 0xDFFD, 0xD7CF, 0xF35D, 0x8361,
+  0x64D2, 0xCA8B, 0xCE20, 0x0530, 0x0FFA, 0x00B8, 0xC1CA, 0x8BC5,
+  0x9273, 0x52A2, 0xBD13, 0x112E, 0xF4F5, 0x5FAF, 0x8235, 0x44B7,
+  0x4BC6, 0x5C7F, 0x1B5A, 0xC69D, 0x9572, 0x6EE7, 0x07B0, 0x1521,
+  0x9411, 0x3B98, 0x1C19, 0xF5B6, 0xA26B, 0x5493, 0xFA06, 0xEA1F,
+  0x3656, 0x23C3, 0x926B, 0x9B4D, 0xCFE5, 0xA48A, 0x6D0A, 0xF356,
+  0x34FE, 0xD601, 0xE578, 0x5342, 0xB8CF, 0xA2DD, 0x2E1B, 0xDF1C,
+  0x20B9, 0x1BB2, 0xD945, 0xD8EA, 0x9927, 0x95D7, 0x6A1F, 0xE28F,
+  0x45D0, 0xBD68, 0xD018, 0x4D74, 0x4BC9, 0x4831, 0x3E47, 0x5FD7,
+  0xB33E, 0x6150, 0x1C28, 0x7C4C, 0xB8E5, 0x12F5, 0xDA05, 0x6F56,
+  0x7372, 0xEB4D, 0xEAD3, 0x22E4, 0x349A, 0x8D34, 0x25A7, 0x07B1,
+  0xBA2D, 0x1FD3, 0xFA07, 0x4513, 0xBD94, 0xE25C, 0xCB61, 0xD36F,
+  0x8FD2, 0x3B78, 0x4463, 0x969B, 0x39D0, 0xB1A1, 0xE188, 0xF1DF,
+  0xC68B, 0xE7DF, 0xB2CE, 0xEAC1, 0xF398, 0x7F7D, 0xD6FC, 0x7830,
+  0x5E95, 0xE1F6, 0x3C34, 0x6306, 0x849F, 0x9AEE, 0x6A5B, 0x1101
+};
+static const uint8_t __xor16_bb3_order[256] PROGMEM = {
+    0,  65, 149, 130,  30,  12, 147, 166, 223,  37,  10,  80,  74,  20, 148,  52,
+  255, 155, 213, 167, 131, 162, 193, 170, 210, 127, 225, 192, 219, 177,  36, 222,
+  123,  79,  48,  27,  97,   8, 190, 104, 220, 184,  41,  17, 176, 106, 236, 233,
+  169, 250, 206,  58,   6,  50, 100, 234, 159,  15, 227, 200,  44,   5, 205, 160,
+  204,  81, 203,  40,  60, 153, 187, 173, 108,  24,  88,   4, 125,  29, 161, 103,
+  132,  99, 248, 157, 207,  84, 209, 101, 251,  76, 120,  19, 144,   9,  55,  11,
+  198, 254,  59, 182, 115,  90, 165, 215,  39,  67, 216,  23, 247,  57,  32, 135,
+  211, 138,  14, 139, 245, 117,  25, 158, 143, 252,  83, 137, 128,   2, 151, 221,
+  232,  96, 110, 178, 152,  72, 168, 164, 197, 235, 196,  69, 253, 179, 118,  16,
+    7,  21, 172,  13, 189,  75, 181,  46,  64,  98,  33,  70,  73,   1, 116, 119,
+  237,  78, 242, 208,  68,  86,  71, 188, 212,  56, 224,  28,  77, 109, 154, 201,
+  228,  47,  87, 113,  26,   3, 129, 150,  54, 240, 163,  22,  85,  66, 105, 145,
+  230, 102, 124, 146, 180, 202, 111,  42,  38,  18, 231,  92, 185, 246, 141,  53,
+  195, 194,  91, 214,  95, 191,  45, 140, 238, 249, 229, 133, 199, 126,  82, 186,
+  136,  89, 241,  51, 175,  62, 243, 218, 217, 107,  93, 239,  34, 183, 142, 244,
+  156, 134,  43, 171,  61, 121,  63, 122,  35, 114, 174, 226,  94,  49, 112,  31
+};
+
+uint16_t xor16_bb3_position() {
+  uint16_t saved = __xor16_bb3_state;
+  uint16_t pos = __xor16_position(saved, xor16_bb3, __xor16_bb3_checkpoints, __xor16_bb3_order);
+  __xor16_bb3_state = saved;
+  return pos;
+}
+
+void xor16_bb3_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_bb3, xor16_bb3, __xor16_bb3_checkpoints);
+}
@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: bb4 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_bb4_state;
+uint16_t __xor16_bb4_state;
+static uint16_t __xor16_bb4_weyl_count;
+static uint8_t __xor16_bb4_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_bb4_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_bb4(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_bb4(uint16_t seed) {
   }
   if(seed) {
     __xor16_bb4_state = seed;
+    __xor16_bb4_spare_full = 0;
     return 1;
   }
   return 0;
@@ -29,16 +34,410 @@ uint16_t xor16_bb4() {
       "lsr    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_bb4_state)::"r18","r19");
   return __xor16_bb4_state;
 }
+
+uint16_t xor16_bb4_star() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_bb4_state)::"r18","r19");
+  return rng16::star(__xor16_bb4_state);
+}
+
+/* The same step as xor16_bb4(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_bb4_weyl(uint16_t seed) {
+  __xor16_bb4_state = seed ? seed : 1;
+  __xor16_bb4_weyl_count = seed;
+  __xor16_bb4_spare_full = 0;
+}
+
+uint16_t xor16_bb4_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_bb4_state), "+d"(__xor16_bb4_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_bb4(). */
+uint8_t xor16_bb4_byte() {
+  if (__xor16_bb4_spare_full) {
+    __xor16_bb4_spare_full = 0;
+    return __xor16_bb4_spare;
+  }
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_bb4_state)::"r18","r19");
+  __xor16_bb4_spare = __xor16_bb4_state >> 8;
+  __xor16_bb4_spare_full = 1;
+  return __xor16_bb4_state;
+}
+
+/* n bytes, the same ones n calls to xor16_bb4_byte() would return; whole steps go through xor16_bb4_fill(). */
+void xor16_bb4_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_bb4_spare_full) {
+    __xor16_bb4_spare_full = 0;
+    *dst++ = __xor16_bb4_spare;
+    n--;
+  }
+  xor16_bb4_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_bb4_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 22 eors. */
+void xor16_bb4_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r6"       "\n\t" // y ^= y << 11
+      "eor    r16, r5"       "\n\t"
+      "eor    r15, r4"       "\n\t"
+      "eor    r14, r3"       "\n\t"
+      "eor    r13, r2"       "\n\t"
+      "eor    r2, r13"       "\n\t" // y ^= y >> 11
+      "eor    r3, r14"       "\n\t"
+      "eor    r4, r15"       "\n\t"
+      "eor    r5, r16"       "\n\t"
+      "eor    r6, r17"       "\n\t"
+      "eor    r17, r13"      "\n\t" // y ^= y << 4
+      "eor    r16, r12"      "\n\t"
+      "eor    r15, r11"      "\n\t"
+      "eor    r14, r10"      "\n\t"
+      "eor    r13, r9"       "\n\t"
+      "eor    r12, r8"       "\n\t"
+      "eor    r11, r7"       "\n\t"
+      "eor    r10, r6"       "\n\t"
+      "eor    r9, r5"        "\n\t"
+      "eor    r8, r4"        "\n\t"
+      "eor    r7, r3"        "\n\t"
+      "eor    r6, r2"        "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_bb4_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_bb4_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_bb4_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x8800, 0x1000, 0x2000, 0x4000, 0x8000, 0x0220, 0x0440, 0x0880,
+    0x1100, 0x2200, 0x4400, 0x8811, 0x1022, 0x2044, 0x4088, 0x8110,
+    // M^2
+    0x0901, 0x1022, 0x2044, 0x4088, 0x8110, 0x2020, 0x4040, 0x8091,
+    0x0122, 0x0244, 0x0488, 0x0101, 0x0202, 0x0404, 0x0808, 0x1010,
+    // M^4
+    0x0922, 0x3200, 0x6400, 0xC811, 0x9022, 0x2424, 0x4848, 0x1890,
+    0x3120, 0x6240, 0xC491, 0x0823, 0x1266, 0x24CC, 0x4189, 0x8312,
+    // M^8
+    0x2F27, 0x54EA, 0xA1D4, 0x53B8, 0x8750, 0xA079, 0xC9F3, 0x92F7,
+    0x23AE, 0x4F4D, 0x879A, 0x1725, 0x4A4A, 0x1C94, 0xA90A, 0x7250,
+    // M^16
+    0x9AA8, 0x98F5, 0x30EA, 0x69C5, 0xD78A, 0xFC81, 0xE831, 0xD163,
+    0xE47F, 0x41EE, 0x8BDC, 0x8FB9, 0x3FC3, 0x6E86, 0x5D1D, 0xFE3A,
+    // M^32
+    0x4B89, 0xF65B, 0x65A6, 0xCB4D, 0x92FA, 0xBDCC, 0xF3BB, 0x6E76,
+    0xDE35, 0xBD6B, 0x63E5, 0x56CB, 0xCBBE, 0x0F6C, 0x96C9, 0x6DD2,
+    // M^64
+    0x4DEE, 0xF699, 0x6432, 0xD857, 0x94EA, 0x713D, 0x6B48, 0x5E90,
+    0xB9F9, 0x7AF3, 0xF4D5, 0x68AB, 0xD77E, 0xB6EC, 0x65EB, 0x8BD2,
+    // M^128
+    0x4E75, 0x5E4E, 0x349C, 0x710B, 0xC252, 0xA9DC, 0xCBB9, 0x9E62,
+    0x7EA4, 0x7D59, 0xF390, 0xF721, 0xCAFB, 0x9CE6, 0xB9EE, 0x77D8,
+    // M^256
+    0x1AD8, 0xDA9D, 0xBC2A, 0xF067, 0xE4CA, 0xB0A5, 0xF078, 0xF8E0,
+    0x9539, 0xA373, 0xC7E6, 0x8FEF, 0x1B2B, 0x2F47, 0x4F9E, 0xF91C,
+    // M^512
+    0x2B82, 0xCB8A, 0x1F26, 0xBE5C, 0x7C41, 0x23C7, 0xD69E, 0xB53C,
+    0x0E38, 0x8443, 0x99A4, 0xB36A, 0x2209, 0xDD13, 0xBB27, 0x30BF,
+    // M^1024
+    0x9AB4, 0x7263, 0x75D7, 0x6A8D, 0x93EF, 0xCBE4, 0x17FB, 0xA6C5,
+    0x4F57, 0x9F8D, 0x2639, 0xC551, 0xCC8E, 0x112E, 0x2A5D, 0x54D2,
+    // M^2048
+    0x4999, 0x5CB8, 0x2142, 0x4284, 0xC5D1, 0x6409, 0x5102, 0xA215,
+    0x00FB, 0x88C5, 0x00A8, 0x0941, 0x561B, 0x2504, 0x4A08, 0x9058,
+    // M^4096
+    0x2F6B, 0x54B3, 0x2845, 0x419A, 0xA55C, 0x64B9, 0x4050, 0x9093,
+    0x056A, 0x02D5, 0x8498, 0x1121, 0x060A, 0x0415, 0x8908, 0x1014,
+    // M^8192
+    0x88B8, 0x2134, 0x524A, 0xAC84, 0x1920, 0x3602, 0x6C04, 0x5809,
+    0xB032, 0x7064, 0xE0D9, 0x48B2, 0x9364, 0x26EA, 0x45C5, 0x8B13,
+    // M^16384
+    0x180E, 0xEBB0, 0x4771, 0x0FD1, 0x5DE6, 0x0407, 0x990E, 0xBA2F,
+    0x308B, 0xF807, 0xE12D, 0x5B68, 0xD06D, 0x39E8, 0xFBD1, 0xB35B,
+    // M^32768
+    0x2815, 0x0148, 0x0A91, 0x1400, 0x2A95, 0x55E2, 0xABC5, 0x46A8,
+    0xAFC5, 0x4EA8, 0x1540, 0x2A80, 0x5540, 0xAA91, 0x5422, 0xAAD5
+  };
+  __xor16_bb4_state = __xor16_jump(__xor16_bb4_state, table, n);
+  return __xor16_bb4_state;
+}
+
+uint16_t xor16_bb4_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_bb4_state)::"r18","r19");
+  return __xor16_bb4_state;
+}
+
+static const uint16_t __xor16_bb4_checkpoints[256] PROGMEM = {
+  0x0001, 0x1AD8, 0x2B82, 0xB49F, 0x9AB4, 0xDE0E, 0xD003, 0x6DEC,
+  0x4999, 0xA3DD, 0x5AD6, 0xF2CC, 0x6548, 0x3219, 0x996A, 0x92C6,
+  0x2F6B, 0x21FB, 0xD6AB, 0xB15B, 0x7CD9, 0x3516, 0xE4CE, 0xC06B,
+  0xC67D, 0x2095, 0x959F, 0x20CA, 0x0D25, 0xCB67, 0x3395, 0xB8FE,
+  0x88B8, 0x2A1B, 0xD733, 0xC82F, 0x05C0, 0x5A47, 0xF43E, 0x87B7,
+  0xD850, 0x36F4, 0xB024, 0xC1FF, 0xF344, 0xF8F6, 0x3741, 0x2F60,
+  0x11D9, 0x88FF, 0xA60C, 0xFE83, 0x5131, 0x8F3B, 0xE312, 0x91D8,
+  0x6B3B, 0xBD31, 0x5EF7, 0x9F57, 0xF4A9, 0xE7F2, 0xEE03, 0xB2FA,
+  0x180E, 0x0214, 0xFB93, 0xE724, 0x64E6, 0x79B5, 0x6B59, 0x2771,
+  0x6024, 0x6C56, 0x5AD5, 0x3289, 0x8540, 0x5BBB, 0x71BD, 0x14D1,
+  0x2A47, 0x8FCC, 0xC38A, 0x52D2, 0xC109, 0xC904, 0x107E, 0x29EC,
+  0xC1E1, 0x815E, 0xEE47, 0xFEA8, 0xD1B6, 0xF2A8, 0x99BF, 0xD866,
+  0x042C, 0x3B0E, 0x1B19, 0xACFB, 0xF287, 0xA512, 0xBAD3, 0xCDFB,
+  0x0767, 0xCD1E, 0x19A8, 0xB9DF, 0xB7FC, 0x2C66, 0x4124, 0xD628,
+  0x89FE, 0x29ED, 0xDB39, 0xAADC, 0x5AD8, 0x641C, 0x0FB8, 0x22AB,
+  0xF453, 0x91FF, 0xA7F1, 0x61D8, 0xE9D5, 0xC9B3, 0xC09E, 0x3C78,
+  0x2815, 0xE290, 0x269C, 0x1BB5, 0xA8F3, 0xC506, 0x82EA, 0xC8A8,
+  0x814F, 0x1055, 0xA96B, 0xBC72, 0xFBF3, 0xA7F9, 0x91BF, 0x5789,
+  0xB746, 0xAA13, 0xDE48, 0x46CC, 0x6FDE, 0x6418, 0xB392, 0x3D8D,
+  0x4729, 0xE428, 0x1EE1, 0x52B4, 0xE763, 0xE8F1, 0x5005, 0xF247,
+  0xAD8A, 0xD971, 0x09B0, 0xB659, 0x57E8, 0xED43, 0x74C8, 0x44EB,
+  0x0067, 0x3CB2, 0x0A77, 0xF4E4, 0x411F, 0xB265, 0x882C, 0x8A1B,
+  0x0168, 0x2583, 0x453D, 0x1FBB, 0xF9C5, 0x3652, 0x9ED6, 0x83A8,
+  0x7774, 0x9263, 0xC1DC, 0x83A4, 0x3B39, 0x3319, 0x0C53, 0x9CFE,
+  0x6019, 0x6EAC, 0x8FAB, 0xFF38, 0x58A5, 0x35ED, 0x881B, 0xA21B,
+  0xA1C0, 0x4BFA, 0x8036, 0xCBC4, 0xBB95, 0xCE0D, 0x0B6D, 0xAFED,
+  0x46B0, 0x8784, 0x4C7A, 0x897A, 0x6D27, 0x7123, 0x9E2B, 0x89CA,
+  0xC1A8, 0x9B99, 0xAD07, 0x7704, 0x3674, 0x48C4, 0x74C3, 0x74C9,
+  0x5E33, 0x2BE5, 0x882D, 0x90C3, 0x2AEA, 0x911C, 0xDF89, 0xC1B5,
+  0x29C6, 0x5BBE, 0xD74F, 0x2075, 0x2DA2, 0x60AF, 0xA494, 0xB1BD,
+  0xA253, 0xA1DF, 0x2338, 0xBD05, 0xB6B2, 0xDFF7, 0xF372, 0xCA2E,
+  0xBC6B, 0xF586, 0x4E66, 0x828E, 0x345F, 0x6B30, 0x8D13, 0x00A3
+};
+static const uint8_t __xor16_bb4_order[256] PROGMEM = {
+    0, 168, 255, 176,  65,  96,  36, 104, 162, 170, 206, 190,  28, 118, 137,  86,
+   48,  79,  64, 106,   1,  98, 131, 154, 179, 235,  25,  27,  17, 119, 242, 177,
+  130,  71, 128, 232,  87, 113,  33,  80, 228,   2, 225, 109, 236,  47,  16,  13,
+   75, 189,  30, 252,  21, 197, 181, 220,  41,  46,  97, 188, 127, 169, 151, 172,
+  110, 167, 178, 208, 147, 152, 221,   8, 201, 210, 250, 158,  52, 155,  83, 143,
+  164, 196,  37,  74,  10, 116,  77, 233, 224,  58, 192,  72, 237, 123, 149, 117,
+   68,  12, 253,  56,  70,  73, 212,   7, 193, 148, 213,  78, 222, 166, 223, 219,
+  184,  69,  20, 202, 136,  89, 251, 134, 187, 183,  76, 209,  39, 198, 174, 226,
+   32,  49, 211, 215, 112, 175, 254,  53, 194,  81, 227, 229, 142,  55, 121, 185,
+   15,  26,  14,  94,   4, 217, 191, 214, 182,  59, 200, 241, 199, 240,   9, 238,
+  101,  50, 122, 141, 132, 138, 145, 115,  99, 218, 160, 207,  42,  19, 239, 173,
+   63, 150,   3, 163, 244, 144, 108,  31, 107, 102, 204, 248, 139, 243,  57,  23,
+  126,  84, 216, 231, 186,  88,  43,  82, 133,  24,  35, 135,  85, 125, 247,  29,
+  203, 105, 103, 205,   6,  92, 111,  18,  34, 234,  40,  95, 161, 114,   5, 146,
+  230, 245, 129,  54, 153,  22,  67, 156,  61, 157, 124, 165,  62,  90, 159, 100,
+   93,  11,  44, 246,  38, 120,  60, 171, 249,  45, 180,  66, 140,  51,  91, 195
+};
+
+uint16_t xor16_bb4_position() {
+  uint16_t saved = __xor16_bb4_state;
+  uint16_t pos = __xor16_position(saved, xor16_bb4, __xor16_bb4_checkpoints, __xor16_bb4_order);
+  __xor16_bb4_state = saved;
+  return pos;
+}
+
+void xor16_bb4_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_bb4, xor16_bb4, __xor16_bb4_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: bb5 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_bb5_state;
+uint16_t __xor16_bb5_state;
 
 bool seed_xor16_bb5(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -29,18 +30,228 @@ uint16_t xor16_bb5() {
       "lsr    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_bb5_state)::"r18","r19");
+  return __xor16_bb5_state;
+}
+
+void xor16_bb5_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_bb5_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_bb5_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x0800, 0x1000, 0x2000, 0x4000, 0x8000, 0x0420, 0x0840, 0x1080,
+    0x2100, 0x4200, 0x8400, 0x0821, 0x1042, 0x2084, 0x4108, 0x8210,
+    // M^2
+    0x0821, 0x1042, 0x2084, 0x4108, 0x8210, 0x8020, 0x0061, 0x00C2,
+    0x0184, 0x0308, 0x0610, 0x0401, 0x0802, 0x1004, 0x2008, 0x4010,
+    // M^4
+    0x8C00, 0x1821, 0x3042, 0x6084, 0xC108, 0xC030, 0x8860, 0x10E1,
+    0x21C2, 0x4384, 0x8708, 0x0E31, 0x1443, 0x2886, 0x510C, 0xA218,
+    // M^8
+    0x2B21, 0x5642, 0xAC84, 0x5929, 0xB252, 0xF22C, 0xE479, 0xC0F2,
+    0x89E4, 0x13E9, 0x27D2, 0x4785, 0x8F0A, 0x1E35, 0x344B, 0x6896,
+    // M^16
+    0x1AB0, 0x3D41, 0x7A82, 0xF504, 0xEA29, 0xD98A, 0xB335, 0x6E6A,
+    0xDCD4, 0xB1A8, 0x6371, 0xCEC3, 0x9DA7, 0x3B6F, 0x76DE, 0xE59D,
+    // M^32
+    0xBF05, 0x7E2B, 0xFC56, 0xF0AC, 0xE179, 0xBADC, 0x7DB8, 0xF351,
+    0xEEA2, 0xDD65, 0xBAEB, 0x75F7, 0xE3CF, 0xC7BF, 0x877E, 0x06FC,
+    // M^64
+    0x9D04, 0x3A29, 0x7452, 0xE085, 0xC12B, 0xE974, 0xDAE8, 0xB5F1,
+    0x63E2, 0xC7C4, 0x8FA9, 0x1F73, 0x36C7, 0x6D8E, 0xDB1C, 0xBE38,
+    // M^128
+    0x0F95, 0x170B, 0x2E16, 0x540D, 0xA81A, 0xF2DE, 0xEDBC, 0xD378,
+    0xAEF0, 0x55E0, 0xABC0, 0x57A1, 0xAF42, 0x5EA5, 0xBD4A, 0x7AB5,
+    // M^256
+    0x5D90, 0xB301, 0x6623, 0xCC46, 0x98AD, 0x9836, 0x386C, 0x70D8,
+    0xE991, 0xDB22, 0xB665, 0x6CEB, 0xD9D6, 0xBBAC, 0x7779, 0xE6D3,
+    // M^512
+    0x75C5, 0xEB8A, 0xD735, 0xA66A, 0x4CF5, 0x8657, 0x04AE, 0x095C,
+    0x1A99, 0x3D13, 0x7207, 0xE40E, 0xC83D, 0x987A, 0x38F4, 0x79C9,
+    // M^1024
+    0xAF2F, 0x5E7F, 0xB4DF, 0x61BE, 0xCB5D, 0x37FC, 0x67D9, 0xC793,
+    0x8726, 0x0E6D, 0x1CDA, 0x3195, 0x6B0B, 0xD616, 0xA42C, 0x4879,
+    // M^2048
+    0x29A6, 0x534C, 0xA698, 0x4530, 0x8241, 0xA106, 0x422D, 0x845A,
+    0x00B4, 0x0949, 0x1292, 0x2D05, 0x5A0A, 0xB414, 0x6028, 0xC050,
+    // M^4096
+    0x492D, 0x925A, 0x2CB4, 0x5149, 0xA292, 0x8124, 0x0269, 0x04D2,
+    0x0185, 0x030A, 0x0614, 0x0409, 0x0812, 0x1805, 0x300A, 0x6014,
+    // M^8192
+    0x8072, 0x08E4, 0x11C8, 0x2390, 0x4F01, 0xCC01, 0x9823, 0x3067,
+    0x60CE, 0xC19C, 0x8B38, 0x1E70, 0x34C1, 0x6982, 0xD304, 0xA629,
+    // M^16384
+    0xB5EE, 0x6BFD, 0xDFDB, 0xB7B6, 0x676C, 0x6017, 0xC80F, 0x903F,
+    0x287E, 0x58DD, 0xB99B, 0x7B36, 0xFE4D, 0xFCBB, 0xF176, 0xEAEC,
+    // M^32768
+    0x4248, 0x8490, 0x0120, 0x0240, 0x0480, 0x6B69, 0xD6D2, 0xA5A4,
+    0x4B69, 0x96D2, 0x25A4, 0x4B48, 0x9690, 0x2520, 0x4A40, 0x9480
+  };
+  __xor16_bb5_state = __xor16_jump(__xor16_bb5_state, table, n);
+  return __xor16_bb5_state;
+}
+
+uint16_t xor16_bb5_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_bb5_state)::"r18","r19");
   return __xor16_bb5_state;
 }
+
+static const uint16_t __xor16_bb5_checkpoints[256] PROGMEM = {
+  0x0001, 0x5D90, 0x75C5, 0x39F0, 0xAF2F, 0x6980, 0x3977, 0x5745,
+  0x29A6, 0x031A, 0xD559, 0x269F, 0x7A6A, 0x7DD7, 0x7EB7, 0xEC5E,
+  0x492D, 0x9DC0, 0x44AE, 0x3096, 0x5F2D, 0x2951, 0xC387, 0x5B73,
+  0x2691, 0x630E, 0xE702, 0x1DD1, 0x6740, 0x706F, 0xF1AD, 0x055A,
+  0x8072, 0x6D25, 0x5C4F, 0x08B9, 0x8D7E, 0xF45F, 0xA180, 0xC436,
+  0xF276, 0xC527, 0xDEDA, 0xE68E, 0x2EFD, 0x05DA, 0xF0AA, 0x6479,
+  0xD391, 0xCF2A, 0x9EE6, 0x3B09, 0xADF4, 0x406C, 0x7D46, 0xCB52,
+  0xDC32, 0x2168, 0x3E21, 0xA670, 0x08CF, 0x60AB, 0x06EC, 0x17A0,
+  0xB5EE, 0x12BB, 0x5060, 0x0EF5, 0x7230, 0xCEBA, 0x9F02, 0x6439,
+  0xEBFD, 0xCB84, 0xD909, 0x5CD0, 0xA438, 0x27C7, 0xFF7C, 0x897F,
+  0x1FAA, 0xA642, 0xBB55, 0x4183, 0x00A1, 0xB57E, 0xFACE, 0x15C9,
+  0x5F40, 0x7EFE, 0x45E4, 0x9E2C, 0x0CFA, 0xEDE6, 0x1CB9, 0xE2CD,
+  0x4E65, 0xED3C, 0xB3E7, 0xEE2A, 0xCCDB, 0xB9EA, 0xAE16, 0x115C,
+  0x3AE3, 0xEBA0, 0x9CB0, 0x95C8, 0xE403, 0x72F2, 0x350F, 0x797A,
+  0xD7C9, 0x15C8, 0x02D0, 0x0B3B, 0x7C14, 0x3103, 0x657A, 0xD491,
+  0x4BFC, 0xCB6B, 0x4D7F, 0x3865, 0x9578, 0x9440, 0xB10C, 0xC75D,
+  0x4248, 0x5871, 0xA723, 0xAF0E, 0xAC26, 0xCAE5, 0xCD52, 0xB175,
+  0x6E7C, 0x5FEB, 0xB4C7, 0xF2CA, 0x1F01, 0x6C7B, 0x0C7B, 0xC0AE,
+  0x6020, 0x54E3, 0x26D9, 0x9724, 0x45C6, 0xB51B, 0x6127, 0x35C0,
+  0x753A, 0x352B, 0x876F, 0x86AB, 0x41AD, 0x81F3, 0xA9FC, 0x3A4F,
+  0xA92B, 0x62E4, 0xA156, 0xC10D, 0x8FCE, 0x5F3E, 0x5F6D, 0x113D,
+  0xC729, 0x1C9C, 0x4148, 0x6AC2, 0x80A9, 0x9FEB, 0x256D, 0xB3F7,
+  0x7687, 0x802E, 0x6781, 0x654B, 0x899A, 0xF49B, 0x8F17, 0x1EF1,
+  0xCDC5, 0xD1B2, 0x62AF, 0xBBED, 0xFD86, 0x6535, 0xA809, 0xA042,
+  0xD612, 0x0E97, 0x616B, 0xA7C9, 0x00CB, 0x6A63, 0x35D7, 0x6525,
+  0x30A4, 0xECB7, 0x0879, 0xC5CA, 0xF9AD, 0x69B1, 0x647C, 0xE822,
+  0x6DDA, 0x5094, 0x20F9, 0x6255, 0x8C85, 0x7736, 0x446C, 0xCB23,
+  0xB955, 0x9AA1, 0x3DB2, 0x9227, 0xF4A3, 0x43CA, 0x7239, 0x5F6C,
+  0x4CAD, 0xB2EC, 0x256C, 0xEE67, 0x0342, 0xB9DE, 0xC8AE, 0x0CCB,
+  0xB0ED, 0xA3DE, 0xA6B1, 0x1DEB, 0x189C, 0xF72D, 0x18C5, 0xC63A,
+  0x8331, 0x896B, 0xE124, 0x3D82, 0x92BC, 0x3E01, 0x3E46, 0x8E98,
+  0xC34C, 0x3110, 0x1346, 0x062B, 0xD7A6, 0xF166, 0x6F39, 0xB5A5
+};
+static const uint8_t __xor16_bb5_order[256] PROGMEM = {
+    0,  84, 196, 114,   9, 228,  31,  45, 251,  62, 202,  35,  60, 115, 142, 231,
+   92, 193,  67, 167, 103,  65, 250, 113,  87,  63, 236, 238, 169,  94,  27, 235,
+  183, 140,  80, 210,  57, 226, 174,  24,  11, 146,  77,  21,   8,  44,  19, 200,
+  117, 249, 110, 153, 151, 198, 123,   6,   3, 159, 104,  51, 243, 218, 245,  58,
+  246,  53, 170,  83, 156, 128, 221, 214,  18, 148,  90,  16, 120, 224, 122,  96,
+   66, 209, 145,   7, 129,  23,  34,  75,   1,  20, 165,  88, 223, 166, 137, 144,
+   61, 150, 194, 211, 186, 161,  25,  71,  47, 206, 199, 189, 179, 118,  28, 178,
+    5, 205, 197, 171, 141,  33, 208, 136, 254,  29,  68, 222, 109, 152,   2, 176,
+  213, 111,  12, 116,  54,  13,  14,  89, 177,  32, 172, 157, 240, 155, 154, 241,
+   79, 180, 212,  36, 247, 182, 164, 219, 244, 125, 124, 107, 147, 217, 106,  17,
+   91,  50,  70, 173, 191, 162,  38, 233,  76,  81,  59, 234, 130, 195, 190, 160,
+  158, 132,  52, 102, 131,   4, 232, 126, 135, 225,  98, 175, 138, 149,  85, 255,
+   64, 216, 229, 101,  82, 187, 143, 163, 248,  22,  39,  41, 203, 239, 168, 127,
+  230, 133, 215,  55, 121,  73, 100, 134, 184,  69,  49, 185,  48, 119,  10, 192,
+  252, 112,  74,  56,  42, 242,  95, 108,  43,  26, 207, 105,  72,  15, 201,  97,
+   93,  99, 227,  46, 253,  30,  40, 139,  37, 181, 220, 237, 204,  86, 188,  78
+};
+
+uint16_t xor16_bb5_position() {
+  uint16_t saved = __xor16_bb5_state;
+  uint16_t pos = __xor16_position(saved, xor16_bb5, __xor16_bb5_checkpoints, __xor16_bb5_order);
+  __xor16_bb5_state = saved;
+  return pos;
+}
+
+void xor16_bb5_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_bb5, xor16_bb5, __xor16_bb5_checkpoints);
+}
@@ -0,0 +1,16 @@
+// Unbiased bounded random numbers on the default generator //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+uint16_t __xor16_below_exact(uint16_t n) {
+  uint32_t m = rng16::mul16(xor16(), n);
+  if ((uint16_t) m < n) {
+    // Only low words below 65536 % n need to be rejected; that's a 16-bit division, but it only
+    // happens when we land in the first n of them.
+    uint16_t threshold = (uint16_t)(0 - n) % n;
+    while ((uint16_t) m < threshold) {
+      m = rng16::mul16(xor16(), n);
+    }
+  }
+  return m >> 16;
+}
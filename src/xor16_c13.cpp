@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: c13 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_c13_state;
+uint16_t __xor16_c13_state;
 
 bool seed_xor16_c13(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -39,3 +40,234 @@ uint16_t xor16_c13() {
     :"+d"((uint16_t)__xor16_c13_state)::"r18","r19");
   return __xor16_c13_state;
 }
+
+void xor16_c13_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_c13_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_c13_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xD809, 0xB01B, 0x6036, 0xC06C, 0x00D8, 0x01B0, 0x0360, 0x06C0,
+    0x0D80, 0x1B00, 0x3600, 0x6C00, 0xD800, 0xB000, 0x6000, 0xC000,
+    // M^2
+    0x0C65, 0x00A6, 0x0145, 0x028A, 0xC514, 0x0A28, 0x1450, 0x28A0,
+    0x5140, 0xA280, 0x4500, 0x8A00, 0x1400, 0xA800, 0xD000, 0xA000,
+    // M^4
+    0xDC58, 0x236B, 0x4830, 0x880C, 0xA011, 0x2022, 0x8044, 0x0088,
+    0x8110, 0x8220, 0xC440, 0x8880, 0x5100, 0x8200, 0x6400, 0x0800,
+    // M^8
+    0xD999, 0x5669, 0x6CB3, 0x40BC, 0xF649, 0x8149, 0xC074, 0x8884,
+    0x2901, 0xAA02, 0x2804, 0x8008, 0xB410, 0x8A20, 0x2240, 0x8880,
+    // M^16
+    0x5031, 0xCC4E, 0x7018, 0xF1CB, 0x4FA7, 0xF8D0, 0x7107, 0xECBF,
+    0xFAB0, 0x7EC3, 0x669B, 0xC83C, 0x68FD, 0x23C3, 0xE056, 0x800C,
+    // M^32
+    0x6FED, 0xF267, 0x1504, 0x21D8, 0x328A, 0x3147, 0xBDBF, 0xAB5A,
+    0xC653, 0x7ACB, 0x1561, 0x9EC2, 0xF084, 0xA677, 0xC16F, 0x01DF,
+    // M^64
+    0x2CB0, 0xE8FE, 0x36B2, 0x6593, 0x54DD, 0xA591, 0x1B1D, 0xD978,
+    0xBDA5, 0xD922, 0xC0A3, 0xE4B1, 0x281D, 0xFEFE, 0x234D, 0x4B6A,
+    // M^128
+    0xF2D8, 0xFA9E, 0x0FA8, 0xE95E, 0x22DA, 0x6987, 0x8367, 0x96EC,
+    0x62D5, 0x5441, 0xD080, 0x52FE, 0x3103, 0xCB02, 0xFEF5, 0x909A,
+    // M^256
+    0x1E20, 0x3A8F, 0xA2DF, 0x2893, 0xBBD2, 0x94DE, 0x4B00, 0xBFA2,
+    0xAB97, 0x6EC9, 0xC980, 0xD909, 0x9092, 0xF09B, 0xE1F7, 0x066F,
+    // M^512
+    0x7A0C, 0xC688, 0x79AE, 0x094D, 0x0FCE, 0xA0CE, 0xFDA0, 0xA242,
+    0x68A3, 0xAD3D, 0x2AA4, 0x3327, 0xA802, 0x8FDD, 0xE14A, 0xD674,
+    // M^1024
+    0x286C, 0x1BA8, 0x29F6, 0xACCB, 0x3594, 0xB020, 0x634D, 0xCFBC,
+    0xE3B8, 0x8D66, 0x6AE5, 0x87A5, 0xAC06, 0x50AA, 0xE225, 0x33AB,
+    // M^2048
+    0x815F, 0x962A, 0x2FAC, 0xBDBF, 0xA62F, 0x7F27, 0x124D, 0x9D25,
+    0x0939, 0xDC60, 0xA507, 0x4996, 0xBC1F, 0x86DC, 0xBDF8, 0x72E1,
+    // M^4096
+    0x4ADC, 0xE32B, 0xCF05, 0x6CC1, 0x771B, 0xF90D, 0x617E, 0xFA82,
+    0xA547, 0xF2FD, 0x60DA, 0x7FDB, 0x87FA, 0xB0D2, 0x4655, 0x2A4B,
+    // M^8192
+    0x8450, 0xB74D, 0xA17C, 0x38A6, 0xF430, 0x68B2, 0xFC47, 0xCFB9,
+    0x5888, 0x5539, 0x958A, 0x1017, 0x872B, 0x12AF, 0x47CE, 0x99BC,
+    // M^16384
+    0x0441, 0x75CE, 0x2A84, 0x34A9, 0x42FE, 0xA100, 0xA04D, 0xB993,
+    0x27ED, 0x2D93, 0x93C7, 0xE17A, 0x628E, 0xDFDE, 0xC29C, 0x9CE9,
+    // M^32768
+    0x37CB, 0xB9DB, 0x8020, 0x06EC, 0x7ECC, 0x64DA, 0xF916, 0x6DCC,
+    0xE4D5, 0x006C, 0xB6CC, 0xA492, 0xE2A1, 0x74FB, 0x96A6, 0x04EC
+  };
+  __xor16_c13_state = __xor16_jump(__xor16_c13_state, table, n);
+  return __xor16_c13_state;
+}
+
+uint16_t xor16_c13_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_c13_state)::"r18","r19");
+  return __xor16_c13_state;
+}
+
+static const uint16_t __xor16_c13_checkpoints[256] PROGMEM = {
+  0x0001, 0x1E20, 0x7A0C, 0xBC72, 0x286C, 0x7C00, 0x9177, 0xDF16,
+  0x815F, 0xF3C9, 0x80DE, 0xF9DC, 0x3033, 0x6BAA, 0x345B, 0x5567,
+  0x4ADC, 0x930B, 0x5F9F, 0x0E21, 0xF4BE, 0x6E7C, 0x816C, 0xF86A,
+  0x935A, 0xB16D, 0x8643, 0xCE89, 0x10C9, 0x5283, 0x84A1, 0xFAB3,
+  0x8450, 0x3F3D, 0x0EBE, 0x5E2D, 0x0F97, 0x57D7, 0xB4BB, 0x3374,
+  0x6384, 0xC94F, 0x70E5, 0x5D7D, 0x3A1B, 0x6027, 0x03C2, 0x0B73,
+  0x5CF4, 0x189D, 0xD987, 0x3C46, 0xA3D0, 0x7CDA, 0xCC1B, 0x40FF,
+  0x94BA, 0xDDCF, 0x9655, 0x7D99, 0x0823, 0x6978, 0x2F6D, 0x6EFE,
+  0x0441, 0x9CA0, 0xAD08, 0x6579, 0x21C4, 0x0D71, 0xC132, 0x598C,
+  0x3615, 0xC06D, 0xAC2A, 0x60BF, 0x2F21, 0xAFB2, 0x8902, 0x4E7E,
+  0x4B78, 0xB13F, 0x4C1E, 0xFA6F, 0x416C, 0x1FF2, 0xA464, 0x4275,
+  0x57CD, 0x1D75, 0xF37F, 0x8820, 0x4BB8, 0x459D, 0x13FC, 0x042E,
+  0xED9D, 0x3C01, 0x6EA0, 0x4450, 0xD8A5, 0x3980, 0xAD35, 0xDE19,
+  0x842B, 0x570D, 0xE9D7, 0xAC9D, 0x7661, 0xE749, 0x666E, 0xD938,
+  0x020B, 0x62F5, 0x18F4, 0x30EA, 0x1269, 0x1736, 0x2B10, 0x571E,
+  0x76AA, 0x1FD7, 0x8C45, 0xE119, 0x31F5, 0xACCF, 0xBC3C, 0xD3AF,
+  0x37CB, 0x9449, 0x22CE, 0xDA33, 0xCB69, 0x12A2, 0xEFA8, 0xC13B,
+  0x6F3F, 0x4554, 0xD1ED, 0x288D, 0x025C, 0x1457, 0x2FB0, 0xB5E2,
+  0x5E82, 0x8A08, 0x993C, 0x4123, 0xFA11, 0x95A3, 0xFB39, 0x8279,
+  0x3A19, 0x5AA8, 0xC54A, 0xDC93, 0x475C, 0x97B7, 0x8CFD, 0x5924,
+  0x35FA, 0xCBAC, 0x5AFF, 0xB3E8, 0xEBD7, 0xC254, 0xDB5C, 0x11C3,
+  0xEB08, 0x23C7, 0x4717, 0xD08B, 0xC494, 0x88B7, 0xC9B8, 0x2D3B,
+  0x68B5, 0xE434, 0x5350, 0x44E9, 0x7EB8, 0x4783, 0x7624, 0x10B6,
+  0x986C, 0x1A66, 0x60DC, 0xD450, 0x4E58, 0x47F6, 0xAED7, 0x41B4,
+  0x7811, 0xFD05, 0x8070, 0x6263, 0x84D4, 0x2240, 0xD552, 0xDF40,
+  0xE9DD, 0xBE81, 0xB9A4, 0x9D5B, 0xD10D, 0x48F1, 0xFD70, 0x5883,
+  0x3361, 0x64A9, 0xC523, 0x35FE, 0x6973, 0x2351, 0xDB37, 0xC221,
+  0x03AF, 0x40C1, 0x0B75, 0xC4A4, 0xA7BB, 0x66B8, 0x0E18, 0xED01,
+  0xB23D, 0xB3CF, 0xF979, 0xA7B0, 0x6A84, 0xBBD1, 0x2B61, 0x2D32,
+  0x5E06, 0x9775, 0x42D0, 0xC04E, 0x1C5B, 0x7CF5, 0xF626, 0x2C56,
+  0x8890, 0xDB16, 0x48DF, 0xD96D, 0x4E26, 0x9339, 0x4A1C, 0x67A9,
+  0x007D, 0xF060, 0x584F, 0x4D8F, 0x4BA8, 0xFE4F, 0x1C32, 0x9598
+};
+static const uint8_t __xor16_c13_order[256] PROGMEM = {
+    0, 248, 112, 140, 216,  46,  95,  64,  60,  47, 218,  69, 222,  19,  34,  36,
+  183,  28, 167, 116, 133,  94, 141, 117,  49, 114, 185, 254, 236,  89,   1, 121,
+   85,  68, 197, 130, 213, 169,   4, 139, 118, 230, 239, 231, 175,  76,  62, 142,
+   12, 115, 124, 208,  39,  14, 160, 211,  72, 128, 101, 152,  44,  97,  51,  33,
+  217,  55, 147,  84, 191,  87, 234,  99, 179, 137,  93, 170, 156, 181, 189, 242,
+  205, 246,  16,  80, 252,  92,  82, 251, 244, 188,  79,  29, 178,  15, 105, 119,
+   88,  37, 250, 207, 159,  71, 153, 162,  48,  43, 232,  35, 144,  18,  45,  75,
+  186, 195, 113,  40, 209,  67, 110, 221, 247, 176, 212,  61, 228,  13,  21,  98,
+   63, 136,  42, 182, 108, 120, 192,   2,   5,  53, 237,  59, 180, 194,  10,   8,
+   22, 151, 104,  32,  30, 196,  26,  91, 240, 173,  78, 145, 122, 158,   6,  17,
+  245,  24, 129,  56, 255, 149,  58, 233, 157, 184, 146,  65, 203,  52,  86, 227,
+  220,  74, 107, 125,  66, 102, 190,  77,  81,  25, 224, 225, 163,  38, 143, 202,
+  229, 126,   3, 201, 235,  73,  70, 135, 215, 165, 172, 219, 210, 154,  41, 174,
+  132, 161,  54,  27, 171, 204, 138, 127, 187, 198, 100, 111, 243,  50, 131, 241,
+  214, 166, 155,  57, 103,   7, 199, 123, 177, 109, 106, 200, 168, 164, 223,  96,
+  134, 249,  90,   9,  20, 238,  23, 226,  11, 148,  83,  31, 150, 193, 206, 253
+};
+
+uint16_t xor16_c13_position() {
+  uint16_t saved = __xor16_c13_state;
+  uint16_t pos = __xor16_position(saved, xor16_c13, __xor16_c13_checkpoints, __xor16_c13_order);
+  __xor16_c13_state = saved;
+  return pos;
+}
+
+void xor16_c13_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_c13, xor16_c13, __xor16_c13_checkpoints);
+}
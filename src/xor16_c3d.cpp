@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: c3d //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_c3d_state;
+uint16_t __xor16_c3d_state;
 
 bool seed_xor16_c3d(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -39,3 +40,217 @@ uint16_t xor16_c3d() {
     :"+d"((uint16_t)__xor16_c3d_state)::"r18","r19");
   return __xor16_c3d_state;
 }
+
+void xor16_c3d_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_c3d_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_c3d_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x3201, 0x6402, 0xC804, 0xB009, 0x4012, 0x8024, 0x0048, 0x0090,
+    0x0120, 0x0240, 0x0480, 0x0900, 0x1200, 0x2400, 0x4800, 0x9000,
+    // M^2
+    0x0641, 0x0C82, 0x1904, 0x2408, 0x6C10, 0xD820, 0xB041, 0x4082,
+    0x8104, 0x0208, 0x0410, 0x0820, 0x1040, 0x2080, 0x4100, 0x8200,
+    // M^4
+    0xB018, 0x4030, 0x8060, 0x0098, 0x01A0, 0x0340, 0x04C0, 0x0D00,
+    0x1A00, 0x2600, 0x6800, 0xD000, 0xA001, 0x6002, 0xC004, 0x8008,
+    // M^8
+    0x4133, 0xC2E4, 0x8788, 0x0C38, 0x1440, 0x38C0, 0x61C0, 0xA200,
+    0x5601, 0x2E02, 0x7006, 0xE00D, 0x5012, 0xE036, 0xC06C, 0x8090,
+    // M^16
+    0x393A, 0x1276, 0x26AD, 0xB0B3, 0x41D4, 0x93E9, 0xB59B, 0x4EA4,
+    0x8F49, 0x9CDB, 0x3524, 0x6A49, 0x46DA, 0xC926, 0x924C, 0x36D0,
+    // M^32
+    0x1A04, 0x897C, 0x12B0, 0x0EF9, 0x8143, 0x82C7, 0x97CE, 0xAA1A,
+    0x463D, 0x0E73, 0x80D5, 0x91EA, 0x239D, 0xE6AE, 0xCF54, 0x9CE8,
+    // M^64
+    0xAEB4, 0xC33C, 0x8470, 0x35E1, 0xDE63, 0x2E87, 0xDF0F, 0xE319,
+    0x443B, 0x187E, 0x28CB, 0xC1DE, 0x83F4, 0x865C, 0x0EF0, 0x1FA0,
+    // M^128
+    0xFF1A, 0x0C60, 0x1880, 0xD57D, 0xFFCF, 0x7DD6, 0xFBED, 0x8E7F,
+    0x8EB6, 0x1F6C, 0x23FD, 0xC5B3, 0x0B67, 0x9FE8, 0x3D99, 0xFB3A,
+    // M^256
+    0x036A, 0x6075, 0x40AB, 0x2B9C, 0x6EAD, 0x5F53, 0x3CE6, 0x456B,
+    0x1A9E, 0x3735, 0xCB5E, 0x94F4, 0x39A8, 0x5AF0, 0xA7A0, 0x5D41,
+    // M^512
+    0x05F7, 0xB389, 0xF51B, 0xA35E, 0xE7AA, 0xDD5D, 0x3AF2, 0x5D56,
+    0xBAED, 0xF792, 0x1AB7, 0xA76F, 0xDC96, 0x75BA, 0xFB7C, 0xE4B0,
+    // M^1024
+    0xBE6C, 0xFB1C, 0xE430, 0xE4E1, 0xAD62, 0x4A85, 0x170B, 0xBB15,
+    0xF42A, 0xE85D, 0xA8AF, 0xC156, 0x82EC, 0x857C, 0x0AB0, 0x1760,
+    // M^2048
+    0xCC0B, 0x6AD2, 0xD7E4, 0x68F4, 0xA95D, 0xC2F2, 0x97A5, 0x3AEF,
+    0xE797, 0x5D2E, 0xE77B, 0x4CBF, 0x1977, 0xBBD8, 0x75F9, 0x6BBA,
+    // M^4096
+    0x7BAA, 0xB175, 0xE2AA, 0x939F, 0x36A9, 0xEF5A, 0xCCFD, 0xC54F,
+    0x1AD6, 0x37ED, 0xCA7E, 0x96B4, 0x3F68, 0x53F0, 0xB5A0, 0x6B41,
+    // M^8192
+    0x6A48, 0x9101, 0xB203, 0x311E, 0x532B, 0x245E, 0x58F5, 0x795E,
+    0xF2F5, 0x67AA, 0xAAF6, 0x57AC, 0xAD51, 0x77B2, 0xFD64, 0xEA88,
+    // M^16384
+    0xD33B, 0xDF64, 0xAC88, 0x6921, 0x2B63, 0xC486, 0x890C, 0x9B1C,
+    0x2430, 0x4860, 0xD8E0, 0xB181, 0xF303, 0x8704, 0x0C08, 0x1818,
+    // M^32768
+    0x01D8, 0x0320, 0x0440, 0x0900, 0x1B00, 0x2400, 0x4800, 0xD800,
+    0xB001, 0xF003, 0x8004, 0x0008, 0x0018, 0x0020, 0x0040, 0x00C0
+  };
+  __xor16_c3d_state = __xor16_jump(__xor16_c3d_state, table, n);
+  return __xor16_c3d_state;
+}
+
+uint16_t xor16_c3d_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %A0"       "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "clr    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_c3d_state)::"r18","r19");
+  return __xor16_c3d_state;
+}
+
+static const uint16_t __xor16_c3d_checkpoints[256] PROGMEM = {
+  0x0001, 0x036A, 0x05F7, 0xBA07, 0xBE6C, 0x5E04, 0xB63C, 0x98BB,
+  0xCC0B, 0xEDC8, 0xB734, 0xA9B9, 0xD5B8, 0x4D80, 0xA7FF, 0xA11F,
+  0x7BAA, 0x2C76, 0x289C, 0x8EF5, 0x3E6C, 0x0345, 0x528C, 0x8761,
+  0xDB6B, 0x5120, 0xDBC5, 0x405A, 0xBE02, 0x36F3, 0xB45F, 0xAF24,
+  0x6A48, 0x49EB, 0x4797, 0x4927, 0x552D, 0x78C6, 0x095F, 0xD409,
+  0x20E1, 0x7F44, 0xCAB4, 0x6D1E, 0xDD8B, 0x8B95, 0x8C19, 0x44B0,
+  0x186B, 0x866A, 0x8976, 0xFEED, 0xBFA5, 0x15E1, 0xCDDC, 0xC3C2,
+  0xCEB2, 0x869E, 0x81AE, 0x56A5, 0x3B9A, 0xBA28, 0xE917, 0x6362,
+  0xD33B, 0x979F, 0xA1F2, 0x3529, 0xC53D, 0x7282, 0xD6D3, 0x4B1D,
+  0x180F, 0xA574, 0x9BC2, 0xC44E, 0x061B, 0xDA45, 0x1FAF, 0x59B9,
+  0x4C01, 0xFB60, 0x4353, 0xBB5F, 0xDD25, 0x9AEF, 0xE9DE, 0x3219,
+  0x1236, 0x1FBD, 0x5761, 0x1822, 0x927A, 0x152D, 0xDF66, 0xF223,
+  0x92C0, 0x2A51, 0xA810, 0xFDE8, 0xD1CF, 0xA872, 0xFE28, 0x85E9,
+  0x82A9, 0x58BA, 0x3580, 0xF7F3, 0x5420, 0x0A05, 0xE000, 0xA011,
+  0x6A76, 0x7357, 0x98AC, 0x8112, 0x4907, 0x0A7E, 0xA59B, 0xB534,
+  0x9E8C, 0x222A, 0x797F, 0x4FA2, 0xAFEC, 0x3859, 0x8D11, 0x75B2,
+  0x01D8, 0x2622, 0x99BD, 0xF64B, 0x11B7, 0x7417, 0x42BF, 0xEC28,
+  0x8B74, 0xA9AD, 0xFBBE, 0x5F31, 0xDE9D, 0xE84D, 0x605E, 0xA459,
+  0xB652, 0xF04C, 0xCE68, 0xDA57, 0x1177, 0x0D9A, 0x251B, 0xAD1E,
+  0x276A, 0x9459, 0xD50A, 0x5960, 0x73D7, 0xDDC7, 0xDC44, 0xE0AE,
+  0xB16B, 0x0FB1, 0x05FE, 0x92F1, 0x18C5, 0x9710, 0xECB1, 0x8844,
+  0xB5F8, 0x8C36, 0x13CB, 0x250D, 0xE36D, 0x8652, 0x9314, 0x6744,
+  0x67E8, 0x16E7, 0xC0A9, 0xC82F, 0x396E, 0x85C5, 0xB6CD, 0xD3A2,
+  0x94AF, 0xBDA7, 0x42A1, 0x89C7, 0x8912, 0xDDF3, 0xAD11, 0x2F42,
+  0x7462, 0x0C66, 0x1CC1, 0x1CE5, 0x031D, 0x2B5B, 0xF967, 0x57D2,
+  0x0FA8, 0x43A5, 0xD3F2, 0xC6E4, 0x60FF, 0xBD0B, 0x33AE, 0x5F89,
+  0x8194, 0x2CB2, 0x11BA, 0x1C4A, 0x110D, 0x4B6B, 0x35C9, 0xE3E3,
+  0xC87B, 0x2B8E, 0xAD86, 0x2730, 0x8DFB, 0x1885, 0xABF6, 0xD643,
+  0x60DB, 0xA2F3, 0x1BE8, 0x8DB5, 0x2F21, 0x74C8, 0x5DB7, 0x8C1D,
+  0x041B, 0xED70, 0xE83D, 0x6D46, 0xA45C, 0xF593, 0x00A0, 0x1A38,
+  0x800B, 0x15C2, 0xF190, 0xA8E1, 0xB6F1, 0x896B, 0xF81D, 0x0BBD,
+  0xA597, 0xDE03, 0xC8C9, 0x3F6E, 0x79AE, 0x5BE8, 0x2A15, 0xD45D
+};
+static const uint8_t __xor16_c3d_order[256] PROGMEM = {
+    0, 238, 128, 196,  21,   1, 232,   2, 162,  76,  38, 109, 117, 247, 193, 149,
+  200, 161, 212, 148, 132, 210,  88, 170,  93, 241,  53, 177,  72,  91,  48, 221,
+  164, 239, 226, 211, 194, 195,  78,  89,  40, 121, 171, 150, 129, 219, 152,  18,
+  254,  97, 197, 217,  17, 209, 228, 191,  87, 206,  67, 106, 214,  29, 125, 180,
+   60,  20, 251,  27, 186, 134,  82, 201,  47,  34, 116,  35,  33,  71, 213,  80,
+   13, 123,  25,  22, 108,  36,  59,  90, 199, 105, 155,  79, 253, 230,   5, 139,
+  207, 142, 224, 204,  63, 175, 176,  32, 112,  43, 235,  69, 113, 156, 133, 192,
+  229, 127,  37, 122, 252,  16,  41, 240, 115, 208,  58, 104, 181, 103, 173,  49,
+   57,  23, 167, 188, 245,  50, 187, 136,  45,  46, 231, 169, 126, 227, 220,  19,
+   92,  96, 163, 174, 153, 184, 165,  65, 114,   7, 130,  85,  74, 120, 111,  15,
+   66, 225, 143, 236,  73, 248, 118,  14,  98, 101, 243, 137,  11, 222, 190, 151,
+  218,  31, 124, 160,  30, 119, 168,   6, 144, 182, 244,  10,   3,  61,  83, 205,
+  185,  28,   4,  52, 178,  55,  75,  68, 203, 179, 216, 250,  42,   8,  54, 146,
+   56, 100,  64, 183, 202,  39, 255, 154,  12, 223,  70,  77, 147,  24,  26, 158,
+   84,  44, 157, 189, 249, 140,  94, 110, 159, 172, 215, 234, 141,  62,  86, 135,
+  166, 233,   9, 145, 242,  95, 237, 131, 107, 246, 198,  81, 138,  99, 102,  51
+};
+
+uint16_t xor16_c3d_position() {
+  uint16_t saved = __xor16_c3d_state;
+  uint16_t pos = __xor16_position(saved, xor16_c3d, __xor16_c3d_checkpoints, __xor16_c3d_order);
+  __xor16_c3d_state = saved;
+  return pos;
+}
+
+void xor16_c3d_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_c3d, xor16_c3d, __xor16_c3d_checkpoints);
+}
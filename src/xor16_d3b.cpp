@@ -1,7 +1,11 @@
 // XOR 16 // full period generator: d3b //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_d3b_state;
+uint16_t __xor16_d3b_state;
+static uint16_t __xor16_d3b_weyl_count;
+static uint8_t __xor16_d3b_spare;      // the high byte of the last _byte() step
+static uint8_t __xor16_d3b_spare_full; // and whether it is still to be handed out
 
 bool seed_xor16_d3b(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -11,6 +15,7 @@ bool seed_xor16_d3b(uint16_t seed) {
   }
   if(seed) {
     __xor16_d3b_state = seed;
+    __xor16_d3b_spare_full = 0;
     return 1;
   }
   return 0;
@@ -40,3 +45,412 @@ uint16_t xor16_d3b() {
     :"+d"((uint16_t)__xor16_d3b_state)::"r18","r19");
   return __xor16_d3b_state;
 }
+
+uint16_t xor16_d3b_star() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_d3b_state)::"r18","r19");
+  return rng16::star(__xor16_d3b_state);
+}
+
+/* The same step as xor16_d3b(), sharing its state, plus a Weyl counter: w += 0x7F4B each call,
+ * and the output is state + w. The pair repeats after 65535 * 65536 calls, and any seed works. */
+void seed_xor16_d3b_weyl(uint16_t seed) {
+  __xor16_d3b_state = seed ? seed : 1;
+  __xor16_d3b_weyl_count = seed;
+  __xor16_d3b_spare_full = 0;
+}
+
+uint16_t xor16_d3b_weyl() {
+  uint16_t ret;
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "subi   %A1, 0xB5"     "\n\t" // w += 0x7F4B
+      "sbci   %B1, 0x80"     "\n\t"
+      "movw   %A2, %A0"      "\n\t"
+      "add    %A2, %A1"      "\n\t"
+      "adc    %B2, %B1"      "\n\t"
+    :"+d"((uint16_t)__xor16_d3b_state), "+d"(__xor16_d3b_weyl_count), "=&r"(ret)::"r18","r19");
+  return ret;
+}
+
+/* Bytes: each step gives two, the low byte now and the high byte on the next call, so only every
+ * other call steps the generator. The same state as xor16_d3b(). */
+uint8_t xor16_d3b_byte() {
+  if (__xor16_d3b_spare_full) {
+    __xor16_d3b_spare_full = 0;
+    return __xor16_d3b_spare;
+  }
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_d3b_state)::"r18","r19");
+  __xor16_d3b_spare = __xor16_d3b_state >> 8;
+  __xor16_d3b_spare_full = 1;
+  return __xor16_d3b_state;
+}
+
+/* n bytes, the same ones n calls to xor16_d3b_byte() would return; whole steps go through xor16_d3b_fill(). */
+void xor16_d3b_fill_bytes(uint8_t *dst, uint16_t n) {
+  if (n && __xor16_d3b_spare_full) {
+    __xor16_d3b_spare_full = 0;
+    *dst++ = __xor16_d3b_spare;
+    n--;
+  }
+  xor16_d3b_fill((uint16_t *)dst, n >> 1);
+  if (n & 1) {
+    dst[n - 1] = xor16_d3b_byte();
+  }
+}
+
+/* Eight streams of this generator at once, in bitsliced form (see xor16_sliced_load()). Runs n
+ * steps, writing the 16 planes to dst after each one, so dst gets 16 * n bytes. A step is 21 eors. */
+void xor16_d3b_sliced(uint8_t *planes, uint8_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "ldd    r2, Z+0"       "\n\t"
+      "ldd    r3, Z+1"       "\n\t"
+      "ldd    r4, Z+2"       "\n\t"
+      "ldd    r5, Z+3"       "\n\t"
+      "ldd    r6, Z+4"       "\n\t"
+      "ldd    r7, Z+5"       "\n\t"
+      "ldd    r8, Z+6"       "\n\t"
+      "ldd    r9, Z+7"       "\n\t"
+      "ldd    r10, Z+8"      "\n\t"
+      "ldd    r11, Z+9"      "\n\t"
+      "ldd    r12, Z+10"     "\n\t"
+      "ldd    r13, Z+11"     "\n\t"
+      "ldd    r14, Z+12"     "\n\t"
+      "ldd    r15, Z+13"     "\n\t"
+      "ldd    r16, Z+14"     "\n\t"
+      "ldd    r17, Z+15"     "\n\t"
+    "1:"                             "\n\t"
+      "eor    r17, r4"       "\n\t" // y ^= y << 13
+      "eor    r16, r3"       "\n\t"
+      "eor    r15, r2"       "\n\t"
+      "eor    r2, r5"        "\n\t" // y ^= y >> 3
+      "eor    r3, r6"        "\n\t"
+      "eor    r4, r7"        "\n\t"
+      "eor    r5, r8"        "\n\t"
+      "eor    r6, r9"        "\n\t"
+      "eor    r7, r10"       "\n\t"
+      "eor    r8, r11"       "\n\t"
+      "eor    r9, r12"       "\n\t"
+      "eor    r10, r13"      "\n\t"
+      "eor    r11, r14"      "\n\t"
+      "eor    r12, r15"      "\n\t"
+      "eor    r13, r16"      "\n\t"
+      "eor    r14, r17"      "\n\t"
+      "eor    r17, r6"       "\n\t" // y ^= y << 11
+      "eor    r16, r5"       "\n\t"
+      "eor    r15, r4"       "\n\t"
+      "eor    r14, r3"       "\n\t"
+      "eor    r13, r2"       "\n\t"
+      "st     X+, r2"        "\n\t"
+      "st     X+, r3"        "\n\t"
+      "st     X+, r4"        "\n\t"
+      "st     X+, r5"        "\n\t"
+      "st     X+, r6"        "\n\t"
+      "st     X+, r7"        "\n\t"
+      "st     X+, r8"        "\n\t"
+      "st     X+, r9"        "\n\t"
+      "st     X+, r10"       "\n\t"
+      "st     X+, r11"       "\n\t"
+      "st     X+, r12"       "\n\t"
+      "st     X+, r13"       "\n\t"
+      "st     X+, r14"       "\n\t"
+      "st     X+, r15"       "\n\t"
+      "st     X+, r16"       "\n\t"
+      "st     X+, r17"       "\n\t"
+      "sbiw   %1, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+      "std    Z+0, r2"       "\n\t"
+      "std    Z+1, r3"       "\n\t"
+      "std    Z+2, r4"       "\n\t"
+      "std    Z+3, r5"       "\n\t"
+      "std    Z+4, r6"       "\n\t"
+      "std    Z+5, r7"       "\n\t"
+      "std    Z+6, r8"       "\n\t"
+      "std    Z+7, r9"       "\n\t"
+      "std    Z+8, r10"      "\n\t"
+      "std    Z+9, r11"      "\n\t"
+      "std    Z+10, r12"     "\n\t"
+      "std    Z+11, r13"     "\n\t"
+      "std    Z+12, r14"     "\n\t"
+      "std    Z+13, r15"     "\n\t"
+      "std    Z+14, r16"     "\n\t"
+      "std    Z+15, r17"     "\n\t"
+    :"+x"(dst), "+w"(n):"z"(planes):"r2","r3","r4","r5","r6","r7","r8","r9","r10","r11","r12","r13","r14","r15","r16","r17","memory");
+}
+
+void xor16_d3b_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_d3b_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_d3b_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x2C01, 0x5802, 0xB004, 0x4809, 0x9012, 0x2024, 0x4048, 0x8090,
+    0x0120, 0x0240, 0x0480, 0x0900, 0x1200, 0x2400, 0x4800, 0x9000,
+    // M^2
+    0x0581, 0x0B02, 0x1604, 0x2508, 0x4A10, 0xB420, 0x4041, 0x8082,
+    0x2104, 0x4208, 0x8410, 0x0820, 0x1040, 0x2080, 0x4100, 0x8200,
+    // M^4
+    0x2017, 0x602E, 0xC05C, 0xA09C, 0x4138, 0x82F0, 0x04C0, 0x0980,
+    0x1780, 0x2600, 0x4C00, 0xBC00, 0x5001, 0xA002, 0x6004, 0xC008,
+    // M^8
+    0x615F, 0x4218, 0x8534, 0x4872, 0x14D0, 0x2880, 0x4140, 0xA200,
+    0x2401, 0xCA02, 0x9004, 0xC00B, 0x1012, 0x0024, 0x005A, 0x0090,
+    // M^16
+    0x9FEE, 0x96FA, 0x0DF1, 0xFF59, 0x7786, 0x622F, 0x651B, 0xCAB6,
+    0xF17F, 0x48DB, 0x95B6, 0x6BFF, 0x46DA, 0xADB4, 0x5FFA, 0xB6D0,
+    // M^32
+    0x1E37, 0xFEC0, 0x2ADC, 0x3783, 0xC93B, 0x2306, 0x174C, 0x8E1A,
+    0x7835, 0x1A63, 0xD0D7, 0x61AD, 0x331F, 0xC6BC, 0x8D6A, 0x58F8,
+    // M^64
+    0xB810, 0x127E, 0xF040, 0x29CF, 0xF143, 0x70F6, 0x8B8D, 0xF399,
+    0xC7B2, 0x9C6C, 0x7CCB, 0x9D97, 0xA366, 0x665E, 0x6CBE, 0x9B30,
+    // M^128
+    0x32DC, 0xFEC3, 0xB93B, 0x378E, 0xD4E7, 0xB219, 0xCF7F, 0xFA6D,
+    0xB0C9, 0xFBFE, 0xB36F, 0x464C, 0xBFF5, 0x5B78, 0x5261, 0x7FAA,
+    // M^256
+    0x7033, 0x3E96, 0xF0CD, 0x96CE, 0xD37E, 0xB16C, 0x78F4, 0xB5FB,
+    0xAB67, 0xE7A7, 0xEFDC, 0x5B3A, 0xFD38, 0x7EE0, 0x59D0, 0x89C1,
+    // M^512
+    0xF6BF, 0x7847, 0x88F6, 0xE918, 0x239A, 0x0EE5, 0xDEE2, 0x39D4,
+    0x972B, 0xB712, 0x2EA5, 0x7958, 0xB894, 0xF52A, 0x4AC4, 0xC4A0,
+    // M^1024
+    0xA1D0, 0xA6CE, 0x8700, 0x5FBF, 0x5E02, 0x7775, 0x478B, 0xEF97,
+    0x1BAD, 0xDC5F, 0x5CBD, 0xFD69, 0x62FE, 0xE5EE, 0xEB4E, 0x97F0,
+    // M^2048
+    0x9FAD, 0x2491, 0x0CBF, 0xF6D7, 0x52F5, 0xBF3D, 0xC737, 0xCEFD,
+    0xB9E8, 0x79BC, 0x97EB, 0x8F46, 0x2DE5, 0x7F58, 0x9A31, 0xEF2A,
+    // M^4096
+    0x0E33, 0xEB16, 0x7ACC, 0x254D, 0xB978, 0xED63, 0x78EF, 0x95CD,
+    0xCB19, 0x277F, 0x6E6C, 0xD8CA, 0xFBF8, 0x7360, 0x4650, 0xBFC1,
+    // M^8192
+    0x20E7, 0x96FF, 0x83DE, 0xFF48, 0x2D33, 0x87E7, 0xACE7, 0x5DDC,
+    0x5F3B, 0x673A, 0x6EE4, 0xF9DA, 0xD9D1, 0xB722, 0xCED4, 0x8E88,
+    // M^16384
+    0xF438, 0xCFE6, 0x80E8, 0xD23F, 0x63EB, 0x9B77, 0xED8E, 0x7F9E,
+    0x5BBE, 0xEC70, 0x7CF0, 0x3DF1, 0xC383, 0xA786, 0xEF8E, 0xDC18,
+    // M^32768
+    0x01C0, 0x8330, 0x0740, 0x8DF0, 0x1F40, 0x3B80, 0x6C00, 0xFC00,
+    0xBC01, 0xC003, 0xA006, 0xE00E, 0xC018, 0x8030, 0x8070, 0x00C0
+  };
+  __xor16_d3b_state = __xor16_jump(__xor16_d3b_state, table, n);
+  return __xor16_d3b_state;
+}
+
+uint16_t xor16_d3b_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %A0"       "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "clr    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_d3b_state)::"r18","r19");
+  return __xor16_d3b_state;
+}
+
+static const uint16_t __xor16_d3b_checkpoints[256] PROGMEM = {
+  0x0001, 0x7033, 0xF6BF, 0xA4FD, 0xA1D0, 0x4237, 0x620D, 0xD6A7,
+  0x9FAD, 0x9E78, 0xAB90, 0x865E, 0x72A5, 0xB9C6, 0xF910, 0x70EA,
+  0x0E33, 0x7FF6, 0x4368, 0x4A46, 0x53E2, 0xAADD, 0x43FD, 0xAC3D,
+  0x37E5, 0xDC59, 0xD4B8, 0x83D2, 0xE5E6, 0x5872, 0xDBA2, 0x00D2,
+  0x20E7, 0xBCEB, 0x1AF7, 0x50D0, 0xBA99, 0x36FC, 0x42BD, 0x7FAE,
+  0x7E2C, 0x5E26, 0x889E, 0xECEB, 0xBE1F, 0xA280, 0xA57D, 0xBF4C,
+  0xECC8, 0x41D6, 0x229D, 0xE9F2, 0xCF27, 0x2733, 0xF14B, 0x5831,
+  0xEDF3, 0x50C8, 0xFF29, 0xFC7E, 0xA55C, 0x7E13, 0x1492, 0x4AF7,
+  0xF438, 0x48C9, 0x2918, 0xCB0D, 0xD1DB, 0x4054, 0x0297, 0x3F4A,
+  0xAB52, 0x75C7, 0xEDD4, 0x5FCC, 0xF7C2, 0x034C, 0x5237, 0x9F35,
+  0x6E33, 0x58C6, 0xFC86, 0x9C8F, 0x5D42, 0xFD0B, 0x9423, 0x64EC,
+  0xD28C, 0x1976, 0xD9D8, 0x55CB, 0xF537, 0xCB08, 0x5125, 0x3E1D,
+  0x15D7, 0x199A, 0xC3B8, 0xDDF6, 0x53EE, 0xCCDE, 0x2213, 0x049C,
+  0xEF5A, 0x5505, 0x60AD, 0x3597, 0x1F8E, 0xE870, 0xEF2D, 0xF18B,
+  0x953E, 0x0AC5, 0xF16C, 0x5735, 0xE518, 0xAFFA, 0x0842, 0x1D58,
+  0xDFFD, 0x6C22, 0x1C2C, 0x9EB1, 0x8062, 0x7ECF, 0x6CE0, 0xEFB5,
+  0x01C0, 0x6668, 0x701D, 0x1F46, 0xB3B1, 0xE103, 0x4B33, 0x629D,
+  0xB022, 0x85E3, 0xFFBC, 0x1A05, 0xC15B, 0x0897, 0x83D7, 0x6518,
+  0x263B, 0xCCE2, 0x2602, 0x480D, 0x14DA, 0xA4CD, 0xC3C2, 0x6F48,
+  0x312C, 0xFFD0, 0xB59E, 0x70B2, 0x3377, 0x6B96, 0x9814, 0x0C70,
+  0xAE00, 0xA460, 0xD165, 0xCF28, 0x0F95, 0x1E5D, 0x13C3, 0x3252,
+  0xF163, 0x7F93, 0x0A0E, 0xE408, 0xD7E3, 0xBCF3, 0x5F47, 0x9A52,
+  0x5D78, 0x3741, 0x2803, 0x6B7F, 0x028A, 0xFA04, 0x1F99, 0x8566,
+  0xCAB9, 0x5D98, 0x4B22, 0xC1D0, 0x6507, 0xDDE3, 0x006E, 0x910D,
+  0xC9AE, 0x7C4E, 0x4E8F, 0x97CC, 0x7CE9, 0xF470, 0xA6F3, 0x1EE2,
+  0xEC8C, 0xC9EF, 0x7489, 0x66D2, 0x0FAC, 0x9AB2, 0x211B, 0xDE92,
+  0x267B, 0xB416, 0xF8E0, 0x7490, 0x5351, 0x3391, 0xD9AE, 0x8176,
+  0xF61B, 0x50A7, 0x1E17, 0xC36F, 0x7DEF, 0x914C, 0xC169, 0x5413,
+  0xD6EF, 0x7197, 0xA982, 0x8C11, 0x9E6A, 0x4678, 0xDD83, 0xC9F6,
+  0x410A, 0x5AEF, 0x4CB0, 0x3ADF, 0x0992, 0xA84E, 0x8C7A, 0x8F99,
+  0xF19F, 0xB68D, 0xA1A9, 0xBE2C, 0x8E37, 0x06FA, 0x0F3E, 0xC2A1,
+  0x4312, 0xF8F8, 0x3120, 0x99D3, 0xD470, 0xD813, 0xEBC8, 0xE2CA
+};
+static const uint8_t __xor16_d3b_order[256] PROGMEM = {
+    0, 190,  31, 128, 180,  70,  77, 103, 245, 118, 141, 236, 170, 113, 159,  16,
+  246, 164, 204, 166,  62, 148,  96,  89,  97, 139,  34, 122, 119, 218, 165, 199,
+  131, 108, 182,  32, 206, 102,  50, 146, 144, 208,  53, 178,  66, 250, 152, 167,
+  156, 213, 107,  37, 177,  24, 235,  95,  71,  69, 232,  49,   5,  38, 248,  18,
+   22, 229, 147,  65,  19,  63, 186, 134, 234, 194, 217,  57,  35,  94,  78, 212,
+   20, 100, 223, 105,  91, 115,  55,  29,  81, 233,  84, 176, 185,  41, 174,  75,
+  106,   6, 135,  87, 188, 143, 129, 203, 179, 157, 121, 126,  80, 151, 130,   1,
+  155,  15, 225,  12, 202, 211,  73, 193, 196, 220,  61,  40, 125, 169,  39,  17,
+  124, 215,  27, 142, 183, 137,  11,  42, 227, 238, 244, 239, 191, 221,  86, 112,
+  195, 158, 251, 175, 205,  83, 228,   9, 123,  79,   8, 242,   4,  45, 161, 149,
+    3,  60,  46, 198, 237, 226,  21,  72,  10,  23, 160, 117, 136, 132, 209, 154,
+  241,  13,  36,  33, 173,  44, 243,  47, 140, 222, 187, 247, 219,  98, 150, 192,
+  201, 231, 184,  93,  67, 101, 145,  52, 163, 162,  68,  88, 252,  26,   7, 224,
+  172, 253, 214,  90,  30,  25, 230, 189,  99, 207, 120, 133, 255, 171, 116,  28,
+  109,  51, 254, 200,  48,  43,  74,  56, 110, 104, 127,  54, 168, 114, 111, 240,
+   64, 197,  92, 216,   2,  76, 210, 249,  14, 181,  59,  82,  85,  58, 138, 153
+};
+
+uint16_t xor16_d3b_position() {
+  uint16_t saved = __xor16_d3b_state;
+  uint16_t pos = __xor16_position(saved, xor16_d3b, __xor16_d3b_checkpoints, __xor16_d3b_order);
+  __xor16_d3b_state = saved;
+  return pos;
+}
+
+void xor16_d3b_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_d3b, xor16_d3b, __xor16_d3b_checkpoints);
+}
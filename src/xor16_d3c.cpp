@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: d3c //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_d3c_state;
+uint16_t __xor16_d3c_state;
 
 bool seed_xor16_d3c(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -39,3 +40,217 @@ uint16_t xor16_d3c() {
     :"+d"((uint16_t)__xor16_d3c_state)::"r18","r19");
   return __xor16_d3c_state;
 }
+
+void xor16_d3c_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_d3c_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_d3c_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x3401, 0x6802, 0xD004, 0x9009, 0x2012, 0x4024, 0x8048, 0x0090,
+    0x0120, 0x0240, 0x0480, 0x0900, 0x1200, 0x2400, 0x4800, 0x9000,
+    // M^2
+    0x0681, 0x0D02, 0x1A04, 0x2608, 0x6C10, 0xD820, 0x8041, 0x2082,
+    0x4104, 0x8208, 0x0410, 0x0820, 0x1040, 0x2080, 0x4100, 0x8200,
+    // M^4
+    0xA01B, 0x4036, 0x806C, 0x8090, 0x01A0, 0x0340, 0x04C0, 0x0D00,
+    0x1A00, 0x2600, 0x6800, 0xD000, 0x9001, 0x0002, 0x0004, 0x0008,
+    // M^8
+    0x6117, 0xC2BE, 0x0774, 0x0CA8, 0x1440, 0x38C0, 0x61C0, 0xA200,
+    0x6601, 0x4E02, 0xD006, 0x900D, 0x3012, 0x4036, 0x806C, 0x8090,
+    // M^16
+    0x16C6, 0x091C, 0xB231, 0xD663, 0x81D4, 0x23E9, 0x659B, 0x8EA4,
+    0x3F49, 0x4CDB, 0xF524, 0xDA49, 0xA6DA, 0x6926, 0xD24C, 0x36D0,
+    // M^32
+    0x4F37, 0x0086, 0x010C, 0xA211, 0xD143, 0x12C7, 0xB7CE, 0x4A1A,
+    0x363D, 0x5E73, 0x70D5, 0x71EA, 0x539D, 0xC6AE, 0x0F54, 0x1CE8,
+    // M^64
+    0xEB1C, 0x4B90, 0x9520, 0x1A41, 0x8E63, 0xBE87, 0xCF0F, 0x5319,
+    0x943B, 0x387E, 0xF8CB, 0xE1DE, 0x43F4, 0xC65C, 0x0EF0, 0x1FA0,
+    // M^128
+    0x9B95, 0x9E11, 0x8E23, 0xBE47, 0xEFCF, 0xDDD6, 0x8BED, 0x9E7F,
+    0x2EB6, 0x5F6C, 0x53FD, 0x95B3, 0x9B67, 0x1FE8, 0x8D99, 0x1B3A,
+    // M^256
+    0x0032, 0x6D25, 0x5A4A, 0x06DD, 0x1EAD, 0x0F53, 0x9CE6, 0x956B,
+    0x3A9E, 0xC735, 0xEB5E, 0x54F4, 0xB9A8, 0x5AF0, 0xA7A0, 0x6D41,
+    // M^512
+    0x7CDB, 0x2D4F, 0x7AD7, 0x67EE, 0x07AA, 0xAD5D, 0x5AF2, 0xFD56,
+    0xCAED, 0x9792, 0x8AB7, 0xB76F, 0x7C96, 0x95BA, 0xBB7C, 0xE4B0,
+    // M^1024
+    0xF9FC, 0x74D0, 0xF9E0, 0xC381, 0xCD62, 0xBA85, 0xC70B, 0x4B15,
+    0x142A, 0x985D, 0xB8AF, 0x6156, 0xC2EC, 0xC57C, 0x0AB0, 0x1760,
+    // M^2048
+    0xAEA4, 0xF4F3, 0x59A7, 0x234E, 0xD95D, 0xA2F2, 0x67A5, 0x2AEF,
+    0x7797, 0x7D2E, 0x377B, 0x5CBF, 0x8977, 0x3BD8, 0xC5F9, 0x8BBA,
+    // M^4096
+    0x7732, 0xA725, 0xEC4B, 0xD8DE, 0x86A9, 0x0F5A, 0xBCFD, 0xD54F,
+    0xBAD6, 0x47ED, 0xEA7E, 0x56B4, 0xBF68, 0x53F0, 0xB5A0, 0x5B41,
+    // M^8192
+    0x60AB, 0x8BD7, 0xB5EF, 0x7B96, 0x832B, 0x045E, 0xA8F5, 0x595E,
+    0x02F5, 0x87AA, 0x0AF6, 0x17AC, 0x9D51, 0x17B2, 0x3D64, 0x6A88,
+    // M^16384
+    0xE73C, 0xD468, 0x3898, 0xC139, 0x7B63, 0x6486, 0xC90C, 0xDB1C,
+    0x2430, 0x4860, 0xD8E0, 0x8181, 0xA303, 0x4704, 0x8C08, 0x9818,
+    // M^32768
+    0x01E0, 0x0340, 0x04C0, 0x09C0, 0x1B00, 0x2400, 0x4800, 0xD800,
+    0x8001, 0xA003, 0x4004, 0x8008, 0x8018, 0x0020, 0x0040, 0x00C0
+  };
+  __xor16_d3c_state = __xor16_jump(__xor16_d3c_state, table, n);
+  return __xor16_d3c_state;
+}
+
+uint16_t xor16_d3c_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %A0"       "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "clr    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r0"            "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_d3c_state)::"r18","r19");
+  return __xor16_d3c_state;
+}
+
+static const uint16_t __xor16_d3c_checkpoints[256] PROGMEM = {
+  0x0001, 0x0032, 0x7CDB, 0x87B8, 0xF9FC, 0x0337, 0xDB08, 0xDCCB,
+  0xAEA4, 0x8F5C, 0xF19C, 0xC476, 0x9BC8, 0x72E6, 0xB27C, 0x98A3,
+  0x7732, 0x2ED6, 0x0220, 0xC866, 0x3ACF, 0x4894, 0x22D8, 0x8C38,
+  0xC5C8, 0x1471, 0xDFDC, 0x7AFF, 0xFECA, 0x3353, 0xF1AF, 0xB89F,
+  0x60AB, 0x0CA2, 0x48B7, 0x409C, 0x70F1, 0x5CB9, 0x23D8, 0xB6A6,
+  0x0F25, 0x172A, 0xCBF6, 0x4CA2, 0xEF17, 0xFBE0, 0x8638, 0x5609,
+  0x348C, 0xC1FA, 0x83F4, 0xD2D3, 0xCE4B, 0x4552, 0x990E, 0x8B31,
+  0xD5D2, 0xD88C, 0xEE41, 0x745A, 0x4615, 0xCF1E, 0xA7FF, 0x08B7,
+  0xE73C, 0xCB8D, 0xAA70, 0x2968, 0xA1F2, 0x7879, 0x9BFB, 0x0E0F,
+  0x491F, 0xE6E7, 0x8DF9, 0xF6E9, 0x05E3, 0xBA09, 0x1B37, 0x3654,
+  0x1732, 0xD386, 0x2CE6, 0xD4EB, 0xF503, 0x956E, 0xA72E, 0x1FA5,
+  0x3BE9, 0x4A36, 0x12F0, 0x66EE, 0xE657, 0x096C, 0xA148, 0x9714,
+  0x86FB, 0x3293, 0xC2BC, 0xD5D6, 0x82C6, 0x9496, 0x831E, 0xBFF5,
+  0x8E13, 0x6664, 0x18C4, 0xBE9B, 0x168A, 0x6B50, 0xD644, 0x998E,
+  0x1E5A, 0x2884, 0xC125, 0xA554, 0x3E70, 0x16DF, 0xB363, 0x8D10,
+  0xF6D8, 0x142F, 0x6C25, 0x17D1, 0xB84F, 0x778B, 0xACAC, 0x4EB4,
+  0x01E0, 0x3C40, 0xC014, 0x8E06, 0x22B1, 0x1962, 0x2952, 0xDBF4,
+  0x982F, 0xBECE, 0xCEB9, 0x3004, 0xB912, 0x93FB, 0x5AFB, 0xFE70,
+  0xDC3E, 0xECAF, 0x8403, 0xEB08, 0x3F93, 0x4788, 0x22E3, 0xF60C,
+  0x5945, 0xB6FC, 0xE696, 0x00D3, 0x7A37, 0xF19A, 0xF319, 0xCC50,
+  0xF700, 0x3F4C, 0x6128, 0xCE40, 0x2E98, 0xAF74, 0xA2E2, 0x9B7F,
+  0xC12E, 0xCE9E, 0x080A, 0x3F0C, 0xFDCE, 0x94B2, 0xD607, 0x687F,
+  0x153C, 0x2501, 0x8B02, 0xA93B, 0x23EF, 0x9005, 0x8E91, 0x9E2A,
+  0xC8DD, 0xD590, 0x294F, 0x99FC, 0xFE67, 0xF5CE, 0xC046, 0x6168,
+  0x52A6, 0x746A, 0x57EB, 0x65E9, 0x2CA1, 0x7F50, 0x84B2, 0x6FAF,
+  0x14E9, 0x52C7, 0xE7ED, 0xDC9F, 0x76A5, 0xA8D3, 0x1972, 0x37FF,
+  0xDC5E, 0x7F1A, 0x73AC, 0x7FFC, 0x421D, 0x229D, 0x4AA6, 0x9936,
+  0x9C12, 0x18CB, 0x8F1B, 0x5A27, 0xB5C7, 0x6109, 0xC121, 0xFF1E,
+  0x44A7, 0xE19B, 0x4A83, 0xCC1D, 0x3743, 0x045C, 0x3582, 0xCAD6,
+  0x796F, 0x88A7, 0x94D0, 0x2897, 0xB29F, 0xF36A, 0x2C5F, 0x5691,
+  0xB997, 0x5CE8, 0xA1A1, 0x9725, 0x9737, 0xE4BF, 0xCE5A, 0x5BCD,
+  0xE27F, 0xEBBC, 0xE14C, 0x6AFE, 0x4750, 0x331E, 0x31EC, 0x838F
+};
+static const uint8_t __xor16_d3c_order[256] PROGMEM = {
+    0,   1, 155, 128,  18,   5, 229,  76, 170,  63,  93,  33,  71,  40,  90, 121,
+   25, 200, 176, 108, 117,  41,  80, 123, 106, 217, 133, 206,  78, 112,  87, 213,
+  132,  22, 150,  38, 180, 177, 113, 235, 186, 134,  67, 238, 196,  82, 164,  17,
+  139, 254,  97, 253,  29,  48, 230,  79, 228, 207,  20,  88, 129, 116, 171, 161,
+  148,  35, 212, 224,  53,  60, 252, 149,  21,  34,  72,  89, 226, 214,  43, 127,
+  192, 201,  47, 239, 194, 152, 219, 142, 247,  37, 241,  32, 221, 162, 191, 195,
+  105,  91, 175, 251, 109, 122, 199,  36,  13, 210,  59, 193, 204,  16, 125,  69,
+  232, 156,  27,   2, 209, 197, 211, 100, 102, 255,  50, 146, 198,  46,  96,   3,
+  233, 178,  55,  23, 119,  74, 131, 104, 182, 218,   9, 181, 141, 101, 173, 234,
+   85,  95, 243, 244, 136,  15,  54, 215, 111, 187, 167,  12,  70, 216, 183,  94,
+  242,  68, 166, 115,  86,  62, 205, 179,  66, 126,   8, 165,  14, 236, 118, 220,
+   39, 153, 124,  31, 140, 240,  77, 107, 137, 103, 130, 190, 222, 114, 168,  49,
+   98,  11,  24,  19, 184, 231,  65,  42, 227, 159, 163,  52, 246, 169, 138,  61,
+   51,  81,  83, 185,  56,  99, 174, 110,  57,   6, 135, 144, 208, 203,   7,  26,
+  250, 225, 248, 245,  92, 154,  73,  64, 202, 147, 249, 145,  58,  44, 157,  10,
+   30, 158, 237,  84, 189, 151, 120,  75, 160,   4,  45, 172, 188, 143,  28, 223
+};
+
+uint16_t xor16_d3c_position() {
+  uint16_t saved = __xor16_d3c_state;
+  uint16_t pos = __xor16_position(saved, xor16_d3c, __xor16_d3c_checkpoints, __xor16_d3c_order);
+  __xor16_d3c_state = saved;
+  return pos;
+}
+
+void xor16_d3c_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_d3c, xor16_d3c, __xor16_d3c_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: d52 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_d52_state;
+uint16_t __xor16_d52_state;
 
 bool seed_xor16_d52(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -24,14 +25,75 @@ uint16_t xor16_d52() {
       "andi   r19, 0xE0"     "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_d52_state)::"r18","r19");
+  return __xor16_d52_state;
+}
+
+void xor16_d52_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
@@ -43,6 +105,171 @@ uint16_t xor16_d52() {
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_d52_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_d52_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xA505, 0x4A0A, 0x9414, 0x0028, 0x0050, 0x00A5, 0x014A, 0x0294,
+    0x0528, 0x0A50, 0x14A0, 0x2940, 0x5280, 0xA500, 0x4A00, 0x9400,
+    // M^2
+    0x1199, 0x2332, 0x4664, 0x008D, 0x011A, 0x3320, 0x4E40, 0x9C80,
+    0x1105, 0x220A, 0x4411, 0x8822, 0x1044, 0x2088, 0x6910, 0xD220,
+    // M^4
+    0x8DCF, 0x028F, 0x340F, 0xCBF0, 0x33A0, 0x30E3, 0xC969, 0x92D7,
+    0x56BC, 0x213D, 0x3D82, 0x4A10, 0x1860, 0xBC85, 0xD1A5, 0xBA5E,
+    // M^8
+    0xB071, 0xC355, 0xE9D8, 0x0E97, 0x7150, 0x40F8, 0xC8E2, 0x5052,
+    0xBB11, 0x9B4A, 0x1593, 0x8928, 0xABFA, 0x423E, 0x3ED3, 0x722F,
+    // M^16
+    0xD2D0, 0x8CBC, 0xDB8C, 0xBC0F, 0xD5B4, 0x995C, 0xDEC9, 0xEFCE,
+    0xF3B9, 0x7586, 0x575E, 0x0E79, 0xFDB8, 0xB02B, 0x74F1, 0x98CE,
+    // M^32
+    0x80B2, 0x054C, 0x118C, 0xB595, 0xCDCA, 0xF448, 0x62FE, 0x5934,
+    0xEA6A, 0x257B, 0xB86A, 0xD05F, 0x141B, 0xAE62, 0xC103, 0xB137,
+    // M^64
+    0xD4CD, 0x94E7, 0x035C, 0x5C8E, 0x7978, 0xA54C, 0xE907, 0xC723,
+    0x0D1D, 0x9775, 0xFD7E, 0xEAFC, 0x51D0, 0xC1E1, 0x1FA0, 0x4CD4,
+    // M^128
+    0x5AE1, 0x2864, 0x55C5, 0x55E4, 0x01CD, 0xCB83, 0x3602, 0xD104,
+    0xE8F8, 0x98B0, 0x27DC, 0x42DE, 0x1431, 0x01CC, 0xBE55, 0x5C22,
+    // M^256
+    0x066E, 0xEB56, 0x8D62, 0x1C00, 0x553E, 0x7360, 0x82F5, 0x4B7B,
+    0xD9C9, 0x1187, 0xB0B2, 0xE86B, 0xA342, 0x0FDF, 0x8C86, 0x2C81,
+    // M^512
+    0x2A94, 0x3E02, 0xB752, 0xFB9B, 0x1AD5, 0x19C0, 0x59DA, 0xF930,
+    0xE107, 0x51AA, 0x066F, 0x471E, 0x82B3, 0x707D, 0x5917, 0x1A13,
+    // M^1024
+    0x327E, 0xDC17, 0x2312, 0x4A91, 0xB3FE, 0x8440, 0x021B, 0x14C6,
+    0x71BA, 0x1FCA, 0x4F80, 0x87CB, 0xA50A, 0x974B, 0xC4AC, 0x9A44,
+    // M^2048
+    0xADBA, 0x4D2C, 0x96D2, 0xC9EB, 0x5282, 0xD7DF, 0x08CC, 0x0352,
+    0x32A9, 0x836A, 0x7651, 0x0991, 0xA5B3, 0xB85D, 0xE86D, 0x8646,
+    // M^4096
+    0x71BA, 0x2DE2, 0xC2FE, 0xA02F, 0x80CA, 0xEAB9, 0x5D36, 0xA6A1,
+    0x2E58, 0x6C51, 0xF74C, 0xC752, 0x1C7A, 0x3AF4, 0xF277, 0xA04F,
+    // M^8192
+    0xBBBE, 0x187E, 0xE0BE, 0x4E8B, 0xD615, 0xDE88, 0x7524, 0x3C04,
+    0x1B68, 0x54DB, 0xFE14, 0x1763, 0x96EC, 0xDE97, 0xB104, 0xF904,
+    // M^16384
+    0x6B7D, 0x4A7D, 0x1445, 0xDDE7, 0xF936, 0x11CF, 0x2235, 0x41B2,
+    0x2B1B, 0xAB82, 0x8B7C, 0x2F27, 0xFCBA, 0xCA2F, 0x4AA9, 0xECCE,
+    // M^32768
+    0x472B, 0xA61F, 0x2ACB, 0x9290, 0x220F, 0x5C84, 0xF66C, 0x8284,
+    0x6040, 0x8290, 0x401E, 0xCA67, 0x0A78, 0xDBAF, 0x28EB, 0x284B
+  };
+  __xor16_d52_state = __xor16_jump(__xor16_d52_state, table, n);
+  return __xor16_d52_state;
+}
+
+uint16_t xor16_d52_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_d52_state)::"r18","r19");
   return __xor16_d52_state;
 }
+
+static const uint16_t __xor16_d52_checkpoints[256] PROGMEM = {
+  0x0001, 0x066E, 0x2A94, 0x6514, 0x327E, 0x6385, 0x8B60, 0xFD31,
+  0xADBA, 0x383D, 0xF5A4, 0xD098, 0x0100, 0xD9C9, 0xE107, 0x164B,
+  0x71BA, 0x63A1, 0x7562, 0x53A3, 0x32A9, 0x9F6F, 0x929B, 0x7139,
+  0xC5E2, 0x98C4, 0x2344, 0xC806, 0x2E58, 0x8D4A, 0xD832, 0x2626,
+  0xBBBE, 0xB728, 0x9780, 0xBC44, 0xD752, 0x4724, 0x0A78, 0x4147,
+  0xB7E0, 0x420E, 0xE735, 0x7A76, 0x1B68, 0x6EF2, 0xCE81, 0xA44C,
+  0x807B, 0x7912, 0xAFD1, 0x2917, 0x0B19, 0x6F75, 0x3C69, 0x1FBF,
+  0x22AA, 0xD115, 0x04BE, 0xA7A3, 0x8E81, 0x28CA, 0xD96C, 0x5210,
+  0x6B7D, 0x90DB, 0xE24B, 0xCD92, 0xD404, 0x3E95, 0x708A, 0x9C36,
+  0x9770, 0x5394, 0x74AD, 0x3FBE, 0x2B1B, 0x8BFC, 0x7216, 0x0296,
+  0x69F6, 0x3B1F, 0xA5DC, 0x47F7, 0x7BF0, 0xEFEE, 0xFF95, 0x0944,
+  0x3E35, 0x4891, 0x7CC6, 0xD778, 0xC312, 0xD621, 0xD77E, 0xA526,
+  0x5F71, 0x1D96, 0x5A23, 0x4870, 0xC046, 0x44C6, 0x938E, 0x76C2,
+  0xA3F6, 0x62F4, 0xF06C, 0x6C6D, 0xBD19, 0x4E5C, 0x8371, 0x460A,
+  0xDAE5, 0xCB4B, 0xF3EF, 0x0260, 0xE012, 0x11B0, 0x17AE, 0x9991,
+  0xA64A, 0xF7C8, 0xA1E8, 0x5C79, 0xC9D8, 0x1115, 0xA4B9, 0xE4A7,
+  0x472B, 0x7622, 0x1918, 0xDBDE, 0xC5E4, 0xFEF0, 0xAA14, 0x02EE,
+  0xD15D, 0x9A4B, 0x05E2, 0x38C3, 0x6040, 0x01AC, 0x70B0, 0x4D3E,
+  0x51FC, 0x88BF, 0xD595, 0xFF77, 0x58FC, 0xB91D, 0x738C, 0x324C,
+  0xAE8D, 0xB677, 0xE5D8, 0x4613, 0x95B5, 0x0091, 0x182B, 0xC971,
+  0x3360, 0x9546, 0x0279, 0xAF42, 0xDA6A, 0xFC6A, 0x5280, 0x7538,
+  0x733E, 0xB43F, 0x6AAA, 0xB5F8, 0x1AB7, 0x57D1, 0xCDE6, 0xFDCD,
+  0xD308, 0xD70B, 0x8A81, 0x9878, 0xDF03, 0x7EEA, 0x24FD, 0xC7B1,
+  0xB3B0, 0x2577, 0xA255, 0x6E1E, 0xE50D, 0x51AF, 0xB24C, 0x820C,
+  0xAC64, 0x0770, 0xDC57, 0xEC0D, 0x600D, 0x1455, 0x4F37, 0x5A15,
+  0x081A, 0x4A03, 0x9852, 0x5B35, 0xA2B3, 0xB2C4, 0xD577, 0xAECF,
+  0xDFD4, 0x8200, 0x3D06, 0x4BB9, 0xDBE8, 0x858E, 0x74B5, 0x7680,
+  0xCA55, 0x052C, 0x8B79, 0xB261, 0x6660, 0xD3F9, 0x3EB5, 0x03EA,
+  0x85F6, 0xCC1E, 0xD7D4, 0x6A6B, 0x7A18, 0x90C9, 0x5C23, 0xE945,
+  0x9783, 0x517C, 0xC3C4, 0x2CA5, 0xE411, 0x4C3A, 0x0557, 0xDEEA,
+  0x07A3, 0xADDF, 0x42A4, 0x2878, 0x5F1F, 0x9637, 0x68F2, 0x6FB4,
+  0xF389, 0x95C1, 0x2958, 0xF5B6, 0x6EF0, 0x25D7, 0x9A4E, 0x8EEE
+};
+static const uint8_t __xor16_d52_order[256] PROGMEM = {
+    0, 157,  12, 141, 115, 162,  79, 135, 223,  58, 217, 238, 138,   1, 193, 240,
+  200,  87,  38,  52, 125, 117, 197,  15, 118, 158, 130, 172,  44,  97,  55,  56,
+   26, 182, 185, 253,  31, 243,  61,  51, 250,   2,  76, 235,  28, 151,   4,  20,
+  160,   9, 139,  81,  54, 210,  88,  69, 222,  75,  39,  41, 242, 101, 111, 155,
+   37, 128,  83,  99,  89, 201, 211, 237, 143, 109, 198, 233, 189, 144,  63, 166,
+   73,  19, 173, 148, 199,  98, 203, 230, 123, 244,  96, 196, 140, 105,   5,  17,
+    3, 220, 246,  80, 227, 170,  64, 107, 187, 252,  45,  53, 247,  70, 142,  23,
+   16,  78, 168, 150,  74, 214, 167,  18, 129, 215, 103,  49, 228,  43,  84,  90,
+  181,  48, 209, 191, 110, 213, 224, 145, 178,   6, 218,  77,  29,  60, 255, 229,
+   65,  22, 102, 161, 156, 249, 245,  72,  34, 232, 202, 179,  25, 119, 137, 254,
+   71,  21, 122, 186, 204, 104,  47, 126,  95,  82, 120,  59, 134, 192,   8, 241,
+  152, 207, 163,  50, 190, 219, 205, 184, 169, 171, 153,  33,  40, 149,  32,  35,
+  108, 100,  92, 234,  24, 132, 183,  27, 159, 124, 216, 113, 225,  67, 174,  46,
+   11,  57, 136, 176, 221,  68, 206, 146,  93, 177,  36,  91,  94, 226,  30,  62,
+   13, 164, 112, 131, 212, 194, 239, 180, 208, 116,  14,  66, 236, 127, 188, 154,
+   42, 231, 195,  85, 106, 248, 114,  10, 251, 121, 165,   7, 175, 133, 147,  86
+};
+
+uint16_t xor16_d52_position() {
+  uint16_t saved = __xor16_d52_state;
+  uint16_t pos = __xor16_position(saved, xor16_d52, __xor16_d52_checkpoints, __xor16_d52_order);
+  __xor16_d52_state = saved;
+  return pos;
+}
+
+void xor16_d52_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_d52, xor16_d52, __xor16_d52_checkpoints);
+}
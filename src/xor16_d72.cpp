@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: d72 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_d72_state;
+uint16_t __xor16_d72_state;
 
 bool seed_xor16_d72(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -41,3 +42,224 @@ uint16_t xor16_d72() {
     :"+d"((uint16_t)__xor16_d72_state)::"r18","r19");
   return __xor16_d72_state;
 }
+
+void xor16_d72_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_d72_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_d72_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xA145, 0x428A, 0x8514, 0x0028, 0x0050, 0x00A0, 0x0140, 0x0285,
+    0x050A, 0x0A14, 0x1428, 0x2850, 0x50A0, 0xA140, 0x4280, 0x8500,
+    // M^2
+    0x045B, 0x08B3, 0x1166, 0x0088, 0x0110, 0x0225, 0x044A, 0x2CC0,
+    0x5380, 0xA700, 0x4400, 0x8800, 0x1005, 0x200A, 0x4A11, 0x9422,
+    // M^4
+    0x4D3A, 0xAB1D, 0x5C3F, 0x2C48, 0x5290, 0xB018, 0x4871, 0xC480,
+    0x8254, 0x04A8, 0x0E11, 0x1C22, 0x0538, 0x2831, 0x605A, 0xCAB1,
+    // M^8
+    0x95E0, 0x1783, 0x0389, 0x5E3B, 0xF7DA, 0x9960, 0x9BBB, 0x607A,
+    0x88C7, 0x56C1, 0x0931, 0x0C0E, 0x4285, 0x9BA1, 0xD5DF, 0xD953,
+    // M^16
+    0x7881, 0x77AB, 0x75A7, 0x7646, 0x473C, 0x1DC4, 0x9B46, 0xF2C7,
+    0xAF76, 0xA68B, 0x7F93, 0x4F0E, 0x750D, 0x2524, 0x1C35, 0x24C2,
+    // M^32
+    0x8954, 0xAC1D, 0x0977, 0x0C4E, 0x3342, 0xF6C0, 0x8E76, 0xDD59,
+    0xFB34, 0x5355, 0xCFAD, 0x511F, 0xE799, 0x9DA2, 0x124E, 0x449D,
+    // M^64
+    0x5AF5, 0xF8A2, 0xCDE1, 0xB9E0, 0xF031, 0xE33F, 0x67E4, 0xECE2,
+    0x1963, 0x60A1, 0xC7F4, 0x1DD1, 0xC7BC, 0x4106, 0x939E, 0xBF95,
+    // M^128
+    0x264E, 0x401F, 0xDD81, 0x55A4, 0xE34A, 0xD197, 0xC976, 0x27B3,
+    0xE582, 0x87B0, 0xC7D4, 0x2538, 0x19D0, 0xBFBE, 0x919B, 0x110F,
+    // M^256
+    0xFE96, 0x9CA5, 0x9FD7, 0x81B8, 0x81D5, 0x03EF, 0x261B, 0x6967,
+    0x7AD0, 0xA187, 0xF57C, 0xFA91, 0xD4E5, 0xEAEB, 0x1A51, 0x1226,
+    // M^512
+    0x73D3, 0xC2E7, 0x2134, 0x0213, 0xC71E, 0xEB98, 0xDC4E, 0xA8EB,
+    0xB1E0, 0x169E, 0x039B, 0x7B4B, 0x043C, 0x1692, 0xD6AB, 0x75FF,
+    // M^1024
+    0x61F4, 0xBAF7, 0xAAC0, 0x60B4, 0x216F, 0x0415, 0xE236, 0x343C,
+    0x498C, 0x9F0C, 0x7BAC, 0x7759, 0x0C3A, 0xBC2B, 0x4239, 0xBC4E,
+    // M^2048
+    0xEE2E, 0x66B9, 0x3E3A, 0x4594, 0x02F3, 0x91F7, 0xE81D, 0x24B3,
+    0x82A4, 0xA075, 0xA9AC, 0x9D1D, 0xF3CC, 0xBF08, 0xF90F, 0x921F,
+    // M^4096
+    0xCC3C, 0x53D3, 0x6829, 0xCA7D, 0x7748, 0x0A70, 0xDE76, 0x2984,
+    0xB914, 0x861A, 0xFC44, 0x40B5, 0xB205, 0x8D2F, 0xCB54, 0x306C,
+    // M^8192
+    0x98A5, 0x590A, 0x0AFF, 0xF0B1, 0x233F, 0x65E1, 0xEB62, 0x3523,
+    0xE986, 0xA4D4, 0xCEBC, 0x3BFD, 0x2D49, 0x0242, 0x4594, 0x4978,
+    // M^16384
+    0x9D54, 0x131D, 0x3C57, 0xC8BF, 0x322F, 0x43E9, 0xAF88, 0xAC7F,
+    0xBA03, 0x7207, 0xD4CA, 0xA3D0, 0x9DF3, 0x16BC, 0x7E4D, 0xCAE2,
+    // M^32768
+    0x3BF8, 0x0E64, 0xD3EC, 0xB067, 0xC000, 0xA3BC, 0x0780, 0x0FAB,
+    0x1E33, 0x351B, 0x25C3, 0x2582, 0x6670, 0x126F, 0x362B, 0x367B
+  };
+  __xor16_d72_state = __xor16_jump(__xor16_d72_state, table, n);
+  return __xor16_d72_state;
+}
+
+uint16_t xor16_d72_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_d72_state)::"r18","r19");
+  return __xor16_d72_state;
+}
+
+static const uint16_t __xor16_d72_checkpoints[256] PROGMEM = {
+  0x0001, 0xFE96, 0x73D3, 0x5392, 0x61F4, 0xD8FB, 0x08CE, 0x3727,
+  0xEE2E, 0xCDD3, 0xD1D0, 0x68EB, 0xA533, 0x9768, 0x4CA4, 0xE0E3,
+  0xCC3C, 0x9BCF, 0xD425, 0x4B40, 0x1D8C, 0xD6D0, 0x46C0, 0x01D6,
+  0xB70B, 0xE188, 0x7093, 0xAEDE, 0x1AC4, 0x5F58, 0x3C78, 0x147A,
+  0x98A5, 0x379B, 0x1B1C, 0x6A99, 0x3C30, 0xB3D9, 0x46F8, 0x0254,
+  0x999E, 0x2CFA, 0x355D, 0xF695, 0xEB71, 0x99ED, 0xEAE8, 0x74A1,
+  0x453D, 0xF73E, 0x18A2, 0xD859, 0xFEE3, 0xB6B3, 0xF1BD, 0x470D,
+  0xD483, 0x22BA, 0xBD2C, 0x4495, 0x66DE, 0xE822, 0x8747, 0xE7F2,
+  0x9D54, 0x8BE7, 0x8297, 0xA6F7, 0x9C94, 0xBE4B, 0x47D2, 0x6676,
+  0x0312, 0xC627, 0xA287, 0xCDC9, 0x4D18, 0x6F01, 0xDA96, 0x6C44,
+  0x469B, 0x4593, 0x1F7C, 0xBA11, 0x087D, 0xBE49, 0xDB77, 0xA491,
+  0x1B95, 0x7CD0, 0xE51B, 0x0F6E, 0x7384, 0x09B8, 0xEAA4, 0x4CD5,
+  0xBA54, 0x4F27, 0x30E0, 0x729D, 0x8D93, 0xED9A, 0x620E, 0xD3F7,
+  0x3767, 0xC835, 0x119D, 0xA67E, 0x8ADD, 0x6760, 0xFB65, 0x530A,
+  0x08FE, 0xB51D, 0xC2A8, 0x42C0, 0xF4AA, 0xB490, 0x31E6, 0x0B3F,
+  0xDFA0, 0x62A0, 0x3BB5, 0x95D4, 0x1811, 0x5137, 0xCBBA, 0xDFF1,
+  0x3BF8, 0x5336, 0x94AB, 0xBABC, 0x820C, 0xADCE, 0x4046, 0x3F38,
+  0xE936, 0xE395, 0xB038, 0x2FAA, 0x49C4, 0x4ABB, 0x4991, 0x8C34,
+  0x0026, 0x009D, 0x084B, 0x3F01, 0x1422, 0xBED3, 0x2ED8, 0x0B90,
+  0xC974, 0xB3C0, 0xB803, 0xB48A, 0xAD2E, 0x0CD5, 0xA005, 0x998C,
+  0x318A, 0x30A4, 0xCB51, 0x70E9, 0x17E2, 0x2AF8, 0xFD03, 0x2177,
+  0xC9FE, 0xC7BA, 0xD01C, 0x4328, 0x4351, 0x985E, 0x1956, 0xF018,
+  0x3614, 0x74F7, 0xE181, 0x0FBD, 0xDF1E, 0x0B37, 0x5E18, 0x60B3,
+  0x79D4, 0xF560, 0x9C21, 0x3457, 0x9158, 0x9A65, 0xD960, 0x7927,
+  0x5A15, 0x7536, 0x2ABB, 0xB92B, 0x4C0D, 0xF545, 0xFE8F, 0x8D28,
+  0xE54C, 0x5544, 0xF8D4, 0x9D96, 0x583E, 0x34D5, 0x649A, 0xF069,
+  0x6CA3, 0xF7EC, 0x4AAE, 0xA905, 0x19CD, 0xFB21, 0xEAC6, 0xF584,
+  0x4F65, 0x8A5E, 0x6C34, 0xE2BA, 0xB55B, 0xE7C1, 0x7D5D, 0x1655,
+  0x4691, 0x588E, 0xDF88, 0xE0F7, 0xD23E, 0x7DE5, 0x7CB0, 0xC0EF,
+  0x38B8, 0xAE7A, 0xEF9B, 0x3D1F, 0xB6BA, 0x8E93, 0x36CD, 0xC570,
+  0x23FA, 0xE1E7, 0x293B, 0x0B1B, 0x4398, 0xA80C, 0x1C33, 0x3B01,
+  0xE15E, 0xBD48, 0xFEB6, 0x703C, 0xB80A, 0xCBA4, 0xDCEE, 0x1D26
+};
+static const uint8_t __xor16_d72_order[256] PROGMEM = {
+    0, 144, 145,  23,  39,  72, 146,  84,   6, 112,  93, 243, 181, 119, 151, 157,
+   91, 179, 106, 148,  31, 223, 164, 124,  50, 174, 212,  28,  34,  88, 246, 255,
+   20,  82, 167,  57, 240, 242, 194, 165,  41, 150, 139, 161,  98, 160, 118, 187,
+  205,  42, 176, 238,   7, 104,  33, 232, 247, 122, 128,  36,  30, 235, 147, 135,
+  134, 115, 171, 172, 244,  59,  48,  81, 224,  80,  22,  38,  55,  70, 142, 140,
+  210, 141,  19, 196,  14,  95,  76,  97, 216, 125, 111, 129,   3, 201, 204, 225,
+  192, 182,  29, 183,   4, 102, 121, 206,  71,  60, 109,  11,  35, 218,  79, 208,
+   77, 251,  26, 163,  99,  92,   2,  47, 177, 193, 191, 184, 230,  89, 222, 229,
+  132,  66,  62, 217, 108,  65, 143, 199, 100, 237, 188, 130, 123,  13, 173,  32,
+  159,  40,  45, 189,  17, 186,  68,  64, 203, 158,  74,  87,  12, 107,  67, 245,
+  211, 156, 133, 233,  27, 138, 153,  37, 155, 117, 113, 220,  53, 236,  24, 154,
+  252, 195,  83,  96, 131,  58, 249,  85,  69, 149, 231, 114, 239,  73, 169, 105,
+  152, 168, 162, 253, 126,  16,  75,   9, 170,  10, 228, 103,  18,  56,  21,  51,
+    5, 190,  78,  86, 254, 180, 226, 120, 127,  15, 227, 248, 178,  25, 241, 219,
+  137,  90, 200, 221,  63,  61, 136,  94, 214,  46,  44, 101,   8, 234, 175, 207,
+   54, 116, 197, 185, 215,  43,  49, 209, 202, 213, 110, 166, 198,   1, 250,  52
+};
+
+uint16_t xor16_d72_position() {
+  uint16_t saved = __xor16_d72_state;
+  uint16_t pos = __xor16_position(saved, xor16_d72, __xor16_d72_checkpoints, __xor16_d72_order);
+  __xor16_d72_state = saved;
+  return pos;
+}
+
+void xor16_d72_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_d72, xor16_d72, __xor16_d72_checkpoints);
+}
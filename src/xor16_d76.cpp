@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: d76 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_d76_state;
+uint16_t __xor16_d76_state;
 
 bool seed_xor16_d76(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -24,28 +25,251 @@ uint16_t xor16_d76() {
       "andi   r19, 0xE0"     "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
+      "lsl    r18"           "\n\t"
       "mov    r18, r19"      "\n\t"
-      "adc    r18, r18"      "\n\t"
-      "sbc    r19, r19"      "\n\t"
-      "neg    r19"           "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_d76_state)::"r18","r19");
+  return __xor16_d76_state;
+}
+
+void xor16_d76_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_d76_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_d76_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x3001, 0x6002, 0xC004, 0x0208, 0x0410, 0x0820, 0x1040, 0x20C1,
+    0x4182, 0x8304, 0x0608, 0x0C10, 0x1820, 0x3040, 0x6080, 0xC100,
+    // M^2
+    0x1861, 0x30C2, 0x6184, 0x810C, 0x0218, 0x0430, 0x0860, 0x30C0,
+    0x61C1, 0xC382, 0x8704, 0x0E08, 0x1C10, 0x3820, 0x7001, 0xE002,
+    // M^4
+    0x0629, 0x2C52, 0x78A4, 0x614B, 0x4096, 0x812C, 0x0258, 0x1C90,
+    0x0921, 0x3242, 0xA4C1, 0xCB82, 0x9704, 0x2E08, 0x4C50, 0x98E1,
+    // M^8
+    0x70CD, 0x2FD7, 0xDBC6, 0x2211, 0x44A0, 0x0903, 0x11C7, 0xA441,
+    0x45A6, 0xA544, 0x0AC9, 0x1492, 0xE8E3, 0x1242, 0x61DD, 0x5DAA,
+    // M^16
+    0xA7E0, 0x9901, 0x6173, 0x836B, 0xC656, 0x0E2E, 0x9C1F, 0x242B,
+    0x77E1, 0xCA86, 0x568C, 0x2D1C, 0xD938, 0x73B7, 0x4E05, 0x7247,
+    // M^32
+    0x5C01, 0x5662, 0x20D5, 0xE09B, 0x0273, 0xC421, 0xCA40, 0x969F,
+    0x1E9B, 0x0781, 0xCD04, 0x5B88, 0xF494, 0xEA2C, 0x3980, 0xED81,
+    // M^64
+    0x0799, 0x5F92, 0xC854, 0x4039, 0x01F0, 0x8125, 0x4248, 0x8D51,
+    0x1B8D, 0x1E80, 0x7CC3, 0xF982, 0xB384, 0x664B, 0xCD34, 0x7CA4,
+    // M^128
+    0xB2CF, 0x2DCF, 0xC3FE, 0x0A41, 0x5441, 0x29C1, 0xD1C5, 0xA649,
+    0x4DAE, 0xA514, 0x0AA8, 0x5493, 0xE963, 0x9346, 0x67DD, 0x599A,
+    // M^256
+    0xA798, 0xA1E0, 0x3881, 0x928D, 0xE71C, 0x4F38, 0x9C37, 0x0C2B,
+    0x1FB0, 0x1A65, 0x744E, 0xE91E, 0xD338, 0x67B7, 0x4E34, 0x4205,
+    // M^512
+    0x2D93, 0xE526, 0xF622, 0x8AE7, 0x570D, 0xEC18, 0x9AB0, 0x469D,
+    0xEFB2, 0x6C55, 0x192E, 0x71D8, 0xE075, 0xC2EE, 0x59A4, 0xCB48,
+    // M^1024
+    0x9C8F, 0x5982, 0xCC32, 0xD867, 0x724E, 0xE51E, 0xCB38, 0x6C19,
+    0xA3BD, 0xE5B0, 0x0BE4, 0x954A, 0xAA16, 0x576F, 0x7B1C, 0x7084,
+    // M^2048
+    0xF97D, 0xD266, 0x5BE4, 0x13DD, 0xE53A, 0xCB37, 0x97E8, 0x847B,
+    0x1275, 0x0FE7, 0x5D4A, 0x3816, 0xB0EF, 0x639D, 0x3339, 0x264E,
+    // M^4096
+    0xE4C7, 0x7F22, 0x2512, 0xEA90, 0xD663, 0x6E01, 0x1D00, 0xFA27,
+    0xA474, 0xD095, 0xA2AC, 0x87DC, 0x4EBA, 0x9D33, 0x0A4D, 0x3C87,
+    // M^8192
+    0x5085, 0x9976, 0x32AA, 0xD0F4, 0xE2AD, 0x865C, 0xCFBE, 0x62FC,
+    0x8368, 0x95E1, 0x2A85, 0x140C, 0x285F, 0xD0BE, 0x610C, 0xB229,
+    // M^16384
+    0x4980, 0x0D81, 0xC022, 0x0063, 0xC001, 0xC200, 0x8600, 0x0FBE,
+    0x3DB6, 0x4800, 0x5180, 0xE084, 0xC20C, 0x865F, 0xD084, 0xD904,
+    // M^32768
+    0x0208, 0xCA8C, 0xC601, 0x0001, 0x4000, 0x4180, 0xC084, 0x04CD,
+    0x08FD, 0x3000, 0x2080, 0x4043, 0x81C1, 0x02C5, 0x0410, 0xD69C
+  };
+  __xor16_d76_state = __xor16_jump(__xor16_d76_state, table, n);
+  return __xor16_d76_state;
+}
+
+uint16_t xor16_d76_prev() {
+    __asm__ __volatile__(
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_d76_state)::"r18","r19");
   return __xor16_d76_state;
 }
+
+static const uint16_t __xor16_d76_checkpoints[256] PROGMEM = {
+  0x0001, 0xA798, 0x2D93, 0x0818, 0x9C8F, 0xAC32, 0xB126, 0x3F63,
+  0xF97D, 0x7797, 0x5EEE, 0xCEF1, 0x14A4, 0xDCE4, 0xA5FC, 0xDC78,
+  0xE4C7, 0xB12D, 0xAB96, 0xBB2F, 0xF90D, 0x4384, 0x7F4B, 0x6AFC,
+  0x48CC, 0x9D3A, 0x8894, 0x78AD, 0x5D22, 0xF134, 0x37AB, 0x12F2,
+  0x5085, 0x0E3E, 0x24FD, 0x2655, 0xEDAE, 0xA199, 0xE420, 0x50F0,
+  0xA534, 0xDEE9, 0xB20D, 0xE17B, 0xD4D0, 0xDC47, 0xE097, 0xBE48,
+  0x7F05, 0xFD27, 0x4B9F, 0xE5BC, 0x0E7B, 0x27D3, 0x6754, 0x1BB2,
+  0x3A1C, 0x0AE4, 0x14DE, 0xDB9A, 0xEB98, 0xFEF7, 0x394A, 0xED7B,
+  0x4980, 0xB4B1, 0x8153, 0x20E6, 0x21F2, 0xE1DF, 0xAF42, 0x80E0,
+  0x9D21, 0xFB7D, 0x6DF2, 0x32BB, 0x9E10, 0xF114, 0x7893, 0xFEEA,
+  0xD3C2, 0xEB20, 0xC875, 0x4E25, 0x1920, 0x6AAE, 0x9207, 0xB5A1,
+  0x79FF, 0x9859, 0x361D, 0x302C, 0x51BB, 0xB246, 0xE9B9, 0x0C32,
+  0x9494, 0x36C5, 0xD5A1, 0x507C, 0x0313, 0xE4B1, 0x1C5F, 0x9937,
+  0xF14E, 0x30D5, 0x5C96, 0x720A, 0xD3B3, 0x78AB, 0xC443, 0xE230,
+  0xD9C7, 0x8742, 0x0E49, 0x2E17, 0x3967, 0xAFD7, 0xF4CE, 0x5700,
+  0xEC97, 0x2318, 0x17F3, 0x9CE3, 0xD531, 0xBB4B, 0x1283, 0xC30E,
+  0x0208, 0x88E8, 0xE6B2, 0x0042, 0x3DD7, 0x7F96, 0x1068, 0x92BA,
+  0x1C3A, 0xD521, 0x5C57, 0x458E, 0x220D, 0x7046, 0xFFED, 0xF28B,
+  0x3A05, 0xD8ED, 0xE4A7, 0x6222, 0xDD3E, 0xFE21, 0xD72B, 0x755F,
+  0x461A, 0xF46E, 0x1413, 0x4612, 0x66E3, 0x9EF4, 0x16B1, 0xBE84,
+  0x4515, 0x5DCF, 0x2384, 0x56C8, 0xF1B6, 0x9A60, 0xB149, 0x4018,
+  0x3BA5, 0x844E, 0xA190, 0xD135, 0xF784, 0xFD8F, 0x9A01, 0xC5DE,
+  0x1B23, 0x76B3, 0x36E7, 0x3B79, 0x5942, 0x5675, 0x582D, 0x36BE,
+  0x7547, 0x338B, 0x2984, 0xA5B3, 0xEC3B, 0xCA07, 0xC1B3, 0xB1F6,
+  0x4863, 0x725D, 0x9661, 0x8B81, 0x057D, 0x5279, 0x866F, 0x5355,
+  0x7CEB, 0x2C3A, 0x61AE, 0x7ECC, 0x479E, 0xDF74, 0x4B1E, 0x4E0F,
+  0x6575, 0xE977, 0x97C2, 0xD15A, 0x88FF, 0x3F57, 0x69D8, 0x3AA0,
+  0x04E7, 0x9593, 0x178C, 0x0484, 0x40E4, 0xA991, 0x9FB3, 0xABCF,
+  0xF511, 0x93C4, 0x3C75, 0x82D5, 0xB079, 0xF78C, 0x6F02, 0x10E6,
+  0x957D, 0xC344, 0xAD52, 0x7D99, 0xA679, 0x4A9F, 0xFA0C, 0xE1C9,
+  0xD13F, 0xC4E9, 0x924E, 0x1C83, 0x443B, 0x06AB, 0xB9CD, 0x9DAC,
+  0xFAC2, 0x7A39, 0x94F1, 0x7AD3, 0x78B8, 0x2527, 0x7D88, 0xE6FD
+};
+static const uint8_t __xor16_d76_order[256] PROGMEM = {
+    0, 131, 128, 100, 219, 216, 196, 245,   3,  57,  95,  33, 114,  52, 134, 231,
+  126,  31, 154,  12,  58, 158, 218, 122,  84, 176,  55, 136, 102, 243,  67,  68,
+  140, 121, 162,  34, 253,  35,  53, 186, 201,   2, 115,  91, 105,  75, 185,  90,
+  183,  97, 178,  30,  62, 116, 144,  56, 215, 179, 168, 226, 132, 213,   7, 167,
+  220,  21, 244, 160, 139, 155, 152, 204, 192,  24,  64, 237, 206,  50, 207,  83,
+   99,  32,  39,  92, 197, 199, 181, 163, 119, 182, 180, 138, 106,  28, 161,  10,
+  202, 147, 208, 156,  54, 214,  85,  23,  74, 230, 141, 107, 193, 184, 151, 177,
+    9,  78, 109,  27, 252,  88, 249, 251, 200, 254, 235, 203,  48,  22, 133,  71,
+   66, 227, 169, 198, 113,  26, 129, 212, 195,  86, 242, 135, 225,  96, 250, 232,
+  217, 194, 210,  89, 103, 174, 165,   4, 123,  72,  25, 247,  76, 157, 222, 170,
+   37,  40, 187,  14, 236,   1, 221,  18, 223,   5, 234,  70, 117, 228,   6,  17,
+  166, 191,  42,  93,  65,  87, 246,  19, 125,  47, 159, 190, 127, 233, 110, 241,
+  175,  82, 189,  11, 171, 240, 211, 108,  80,  44, 137, 124,  98, 150, 145, 112,
+   59,  45,  15,  13, 148,  41, 205,  46,  43, 239,  69, 111,  38, 146, 101,  16,
+   51, 130, 255, 209,  94,  81,  60, 188, 120,  63,  36,  77,  29, 104, 164, 143,
+  153, 118, 224, 172, 229,  20,   8, 238, 248,  73,  49, 173, 149,  79,  61, 142
+};
+
+uint16_t xor16_d76_position() {
+  uint16_t saved = __xor16_d76_state;
+  uint16_t pos = __xor16_position(saved, xor16_d76, __xor16_d76_checkpoints, __xor16_d76_order);
+  __xor16_d76_state = saved;
+  return pos;
+}
+
+void xor16_d76_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_d76, xor16_d76, __xor16_d76_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: d79 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_d79_state;
+uint16_t __xor16_d79_state;
 
 bool seed_xor16_d79(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -37,3 +38,202 @@ uint16_t xor16_d79() {
     :"+d"((uint16_t)__xor16_d79_state)::"r18","r19");
   return __xor16_d79_state;
 }
+
+void xor16_d79_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_d79_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_d79_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xA241, 0x4482, 0x8904, 0x1008, 0x2010, 0x4020, 0x8040, 0x0281,
+    0x0502, 0x0A04, 0x1408, 0x2810, 0x5020, 0xA040, 0x4080, 0x8100,
+    // M^2
+    0x0945, 0x128B, 0x2516, 0x4028, 0x8050, 0x00A0, 0x0140, 0xAAC4,
+    0x5588, 0xAB10, 0x5420, 0xA840, 0x5080, 0xA100, 0x4201, 0x8402,
+    // M^4
+    0xD0DB, 0x0AB2, 0x1765, 0x0289, 0x0512, 0xAA64, 0x54C8, 0xA8C0,
+    0xF9C5, 0xF38A, 0x4601, 0x8C02, 0xB845, 0x708A, 0xE054, 0xC2A9,
+    // M^8
+    0xBB42, 0x728C, 0xCD19, 0x8918, 0xB064, 0x2462, 0xE091, 0xC229,
+    0xA443, 0x4086, 0x8504, 0x0218, 0x1512, 0x8860, 0x14C8, 0x0181,
+    // M^16
+    0xE833, 0x4F14, 0xB428, 0x9EA6, 0x9519, 0xBB1B, 0x5426, 0x43F7,
+    0x25BA, 0x6974, 0xEDDF, 0x79FA, 0xF6BD, 0xC76A, 0x3BB6, 0xDD28,
+    // M^32
+    0xD12B, 0xC26C, 0x249D, 0xD514, 0x007C, 0x7553, 0x60F3, 0x5DA4,
+    0xB348, 0x6E90, 0x9F0A, 0xBE40, 0xFCAA, 0x7900, 0x922A, 0x8401,
+    // M^64
+    0xEAC9, 0x9C92, 0x9B70, 0xE222, 0xE455, 0x480A, 0xB015, 0xF0E8,
+    0x6994, 0xF928, 0x9341, 0x2E82, 0x8D44, 0x1A88, 0x7410, 0xCA20,
+    // M^128
+    0x3B04, 0x7288, 0xE510, 0x8908, 0x1200, 0x2422, 0xC800, 0xC329,
+    0xA643, 0xC4C2, 0x8D04, 0x3219, 0x3512, 0x4824, 0x94C8, 0x2190,
+    // M^256
+    0xC8BE, 0x671D, 0xC43B, 0x3CC2, 0xF1D0, 0x938A, 0x8741, 0x41F7,
+    0xA1FE, 0x41FD, 0xDDDE, 0x19F8, 0x36F9, 0x67E3, 0x1BA7, 0x3F4E,
+    // M^512
+    0x8158, 0x800E, 0x080C, 0x3497, 0xE36B, 0xF39C, 0x4D6C, 0x752D,
+    0xC25B, 0x2EF2, 0xDF4A, 0x16D1, 0x9DA9, 0xBB06, 0x76E7, 0x6D9A,
+    // M^1024
+    0x3551, 0xD10F, 0x2A4A, 0x66F9, 0xC7E3, 0x7BA6, 0xFF4C, 0x0306,
+    0xAE49, 0xF4D7, 0x5A13, 0x3663, 0xC88D, 0x394F, 0x6377, 0xE4FE,
+    // M^2048
+    0x0866, 0x49A0, 0xB341, 0xE75B, 0xE4B6, 0x7DAD, 0xF35A, 0xA1DB,
+    0xE9F2, 0xD9E5, 0x4AF3, 0x3FB2, 0xCB0E, 0x3E49, 0x8DBB, 0x3966,
+    // M^4096
+    0x4BA4, 0x878D, 0x070A, 0x4101, 0x0246, 0x6445, 0xC89A, 0xFE77,
+    0xDEEE, 0x3D98, 0xE1B0, 0xC171, 0xA6C2, 0x4584, 0x3B88, 0x5711,
+    // M^8192
+    0x84B7, 0xA60F, 0xC44A, 0xAEC2, 0x7585, 0x1B88, 0x9755, 0xF73C,
+    0x442C, 0xA059, 0x6F87, 0x574A, 0x7FDD, 0xFDAB, 0x7E37, 0xD66E,
+    // M^16384
+    0xC62A, 0xAC2B, 0x5846, 0x7537, 0x602B, 0x951C, 0x806C, 0xA558,
+    0x60B0, 0xE360, 0x4EEA, 0x1580, 0xDB2A, 0x3600, 0xEC2A, 0x5800,
+    // M^32768
+    0x55A0, 0xBF40, 0x5681, 0xE82A, 0x5000, 0xE02A, 0x6001, 0xD52A,
+    0x8A45, 0x148A, 0x3D14, 0x5028, 0xB550, 0x40A0, 0x9540, 0x2280
+  };
+  __xor16_d79_state = __xor16_jump(__xor16_d79_state, table, n);
+  return __xor16_d79_state;
+}
+
+uint16_t xor16_d79_prev() {
+    __asm__ __volatile__(
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_d79_state)::"r18","r19");
+  return __xor16_d79_state;
+}
+
+static const uint16_t __xor16_d79_checkpoints[256] PROGMEM = {
+  0x0001, 0xC8BE, 0x8158, 0xD4E3, 0x3551, 0x9315, 0x14E1, 0x76A5,
+  0x0866, 0xAE15, 0x2023, 0x5BCA, 0x49CC, 0x9DEE, 0xA6B7, 0x8CBB,
+  0x4BA4, 0xF41A, 0x0222, 0xB56A, 0x5D60, 0x5C4D, 0x5E7E, 0xD27A,
+  0xED29, 0x4124, 0xEDE8, 0x4F2C, 0x54F1, 0x9CD2, 0x9DEA, 0x628C,
+  0x84B7, 0xAAA5, 0xDE50, 0xE15A, 0xCFBA, 0x78BE, 0xEF0C, 0x9FD6,
+  0xB9D2, 0x8629, 0xC49B, 0xDA71, 0x67B0, 0x6234, 0x9BD8, 0xFBE8,
+  0xE5F6, 0x38E0, 0x1DDE, 0xFBA3, 0xF1D6, 0x404D, 0xACA1, 0x8648,
+  0x18EE, 0xE5D9, 0xFC30, 0xD38F, 0xE4BE, 0x229D, 0xA67E, 0xBE71,
+  0xC62A, 0x709F, 0xADC0, 0xFBC3, 0xE51D, 0xFEBD, 0xE3C2, 0x02A2,
+  0xF49D, 0x284D, 0xC91D, 0x5D78, 0x915F, 0x8982, 0xA1A2, 0x4C33,
+  0x1278, 0xAEDD, 0xDA57, 0x571C, 0x19AA, 0x075D, 0x7B0B, 0x2027,
+  0x9FF1, 0x41C0, 0x7CEF, 0x8CFD, 0x6FC3, 0x3174, 0xD1C4, 0xB163,
+  0x74C2, 0x36C8, 0x374D, 0xDBC1, 0xE5E3, 0xC5B5, 0x77E1, 0xEAE2,
+  0x292E, 0xD38B, 0x2085, 0x2A91, 0x477F, 0x943B, 0x2552, 0x0A4F,
+  0x881E, 0x4882, 0x24B5, 0x9515, 0x88C2, 0x871D, 0xC304, 0x00D1,
+  0xFFD8, 0x5A72, 0xF75D, 0x0EF8, 0x1DF5, 0xFB48, 0x378B, 0xBE51,
+  0x55A0, 0x8303, 0x70EE, 0x8065, 0x2700, 0x5A3E, 0x88E5, 0x7F0F,
+  0x39C2, 0x48B7, 0x4A6A, 0x0CB6, 0x44AD, 0x2443, 0x92DF, 0x2876,
+  0x3826, 0x784E, 0x4BE0, 0xB760, 0x4742, 0xC626, 0x8866, 0x915B,
+  0x4DB9, 0xA9AE, 0xAD32, 0x3832, 0x4DA5, 0xA087, 0x72C2, 0xAAEB,
+  0xC6F5, 0x10A3, 0x4B27, 0x1A4E, 0x7659, 0x5473, 0xBA38, 0x68C9,
+  0x5776, 0x56BE, 0x0D34, 0xC3B9, 0x133B, 0x27C1, 0x5436, 0x31FC,
+  0xACF1, 0xF0D9, 0xB6E9, 0x5337, 0xC49F, 0x1E4A, 0x6FBC, 0x8335,
+  0xB192, 0x1890, 0x9F26, 0x1D3E, 0xAE9F, 0x3A0B, 0x9A7E, 0x2B4D,
+  0x291E, 0xB1D1, 0x3072, 0xD31C, 0xFB3A, 0xB58D, 0x63C4, 0x9ECA,
+  0x1105, 0x9B82, 0xD6A6, 0xFF68, 0x79DF, 0x9287, 0x6225, 0xA2B6,
+  0x99DB, 0x15B6, 0xCA52, 0x6D60, 0x0D57, 0x78D1, 0xAC9D, 0x1CEB,
+  0x3482, 0xAA2E, 0x0CC6, 0xA1B6, 0x79D8, 0xF91F, 0x6B7F, 0x37FE,
+  0x57CF, 0x816F, 0xDD21, 0x2CFC, 0xFFD0, 0x66B0, 0xC3CA, 0x5983,
+  0x7B0C, 0x4BBF, 0x96AB, 0xD488, 0xB2FB, 0x1824, 0x78B0, 0x70E8,
+  0x2343, 0xAF02, 0x1B95, 0x73A0, 0x78C3, 0x3A50, 0x7F8E, 0xB08B,
+  0xBCC2, 0x0BD9, 0x3AE1, 0x949D, 0x5409, 0x04FC, 0x81CB, 0xCB67
+};
+static const uint8_t __xor16_d79_order[256] PROGMEM = {
+    0, 119,  18,  71, 253,  85,   8, 111, 249, 139, 218, 170, 212, 123, 161, 200,
+   80, 172,   6, 209, 237, 185,  56,  84, 163, 242, 215, 187,  50, 124, 181,  10,
+   87, 106,  61, 240, 141, 114, 110, 132, 173,  73, 143, 192, 104, 107, 191, 227,
+  194,  93, 175, 216,   4,  97,  98, 126, 223, 144, 155,  49, 136, 189, 245, 250,
+   53,  25,  89, 140, 148, 108, 113, 137,  12, 138, 162,  16, 233, 146,  79, 156,
+  152,  27, 179, 252, 174, 165,  28, 128, 169,  83, 168, 224, 231, 133, 121,  11,
+   21,  20,  75,  22, 206,  45,  31, 198, 229,  44, 167, 222, 211, 182,  92,  65,
+  239, 130, 158, 243,  96, 164,   7, 102, 145, 238,  37, 244, 213, 220, 204,  86,
+  232,  90, 135, 246, 131,   2, 225, 254, 129, 183,  32,  41,  55, 117, 112, 150,
+  116, 134,  77,  15,  91, 151,  76, 205, 142,   5, 109, 251, 115, 234, 208, 190,
+  201,  46,  29,  30,  13, 199, 186,  39,  88, 157,  78, 219, 207,  62,  14, 153,
+  217,  33, 159, 214,  54, 176, 154,  66,   9, 188,  81, 241, 247,  95, 184, 193,
+  236,  19, 197, 178, 147,  40, 166, 248, 127,  63, 118, 171, 230,  42, 180, 101,
+  149,  64, 160,   1,  74, 210, 255,  36,  94,  23, 195, 105,  59, 235,   3, 202,
+   82,  43,  99, 226,  34,  35,  70,  60,  68,  57, 100,  48, 103,  24,  26,  38,
+  177,  52,  17,  72, 122, 221, 196, 125,  51,  67,  47,  58,  69, 203, 228, 120
+};
+
+uint16_t xor16_d79_position() {
+  uint16_t saved = __xor16_d79_state;
+  uint16_t pos = __xor16_position(saved, xor16_d79, __xor16_d79_checkpoints, __xor16_d79_order);
+  __xor16_d79_state = saved;
+  return pos;
+}
+
+void xor16_d79_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_d79, xor16_d79, __xor16_d79_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: d97 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_d97_state;
+uint16_t __xor16_d97_state;
 
 bool seed_xor16_d97(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -37,3 +38,202 @@ uint16_t xor16_d97() {
     :"+d"((uint16_t)__xor16_d97_state)::"r18","r19");
   return __xor16_d97_state;
 }
+
+void xor16_d97_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "eor    r18, r18"      "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_d97_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_d97_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x2891, 0x5122, 0xA244, 0x0408, 0x0810, 0x1020, 0x2040, 0x4080,
+    0x8100, 0x0281, 0x0502, 0x0A04, 0x1408, 0x2810, 0x5020, 0xA040,
+    // M^2
+    0x4215, 0x842A, 0x08D5, 0x010A, 0x0214, 0x0428, 0x0850, 0x10A0,
+    0x2140, 0x6A90, 0xD520, 0xAAC1, 0x1502, 0x2A04, 0x5408, 0xA810,
+    // M^4
+    0x764C, 0xFC38, 0xFAE5, 0xA460, 0x6051, 0xD002, 0xA085, 0x018A,
+    0x0314, 0xACE9, 0x1952, 0x18A0, 0x6548, 0xE280, 0x9520, 0x2AC1,
+    // M^8
+    0x5953, 0x2DE8, 0x71C4, 0xA194, 0xC138, 0x2691, 0x4562, 0x5AC6,
+    0x3549, 0x6A92, 0x4210, 0xAC60, 0x6903, 0xF002, 0x85CD, 0x818A,
+    // M^16
+    0x8506, 0xB39A, 0x47E5, 0xAEFB, 0x7733, 0x1A2D, 0xBC8F, 0x69B4,
+    0x53FD, 0x052B, 0x2E67, 0xFC0B, 0x985D, 0xB0AE, 0x6074, 0x6279,
+    // M^32
+    0xEB9C, 0x1FBA, 0x1530, 0x25D2, 0x6BB4, 0x1748, 0x2ED0, 0x3C63,
+    0x7AC2, 0xFFD0, 0xB032, 0x60F5, 0xA18B, 0x6397, 0x46AE, 0x2F9D,
+    // M^64
+    0x8876, 0x8EA9, 0x1787, 0xCFDA, 0x9571, 0x9FA9, 0x3587, 0xDF65,
+    0x169E, 0x87FD, 0x8EC7, 0xB5DA, 0xDB5F, 0x16EA, 0x0D3F, 0xBAEB,
+    // M^128
+    0xA940, 0x016B, 0x0AC6, 0x234A, 0x4EC4, 0xCCAA, 0x9BD1, 0xF32A,
+    0xCE85, 0x155E, 0xFDB1, 0xD1E7, 0x3646, 0xE65D, 0xF9D9, 0xF937,
+    // M^256
+    0x9BD9, 0x129F, 0xA7EF, 0x8476, 0xA2EC, 0x3119, 0x4A32, 0xE5A5,
+    0x694A, 0xF880, 0xEA22, 0xFE91, 0xA888, 0x5B85, 0x63A2, 0xEF14,
+    // M^512
+    0x3A13, 0xBD9E, 0xFB28, 0x6981, 0xF106, 0x2704, 0xE4D9, 0xBCD1,
+    0x7327, 0x648F, 0xF2A4, 0x4F18, 0x2BD3, 0x7DE2, 0x6FCE, 0x5749,
+    // M^1024
+    0x0B2D, 0xAD03, 0x7883, 0xA8D1, 0x5B27, 0x63C6, 0x4D5D, 0x2FD9,
+    0x75F6, 0x497D, 0x6AC4, 0x5D5D, 0x0BD1, 0x35F6, 0xCF07, 0x165A,
+    // M^2048
+    0xD96F, 0xC7ED, 0x258A, 0x4C7F, 0x186B, 0x717E, 0x406D, 0xA4BB,
+    0x61F7, 0x496F, 0xF4D6, 0x4BBC, 0x5358, 0xAEF0, 0x0CE2, 0x3BC0,
+    // M^4096
+    0x0855, 0xCE5E, 0x14F8, 0xED87, 0x7B0A, 0x17DD, 0x8D6B, 0xFEB5,
+    0x752E, 0x60CD, 0x2086, 0xCB9D, 0x635B, 0xEEF6, 0xED2F, 0x7A5A,
+    // M^8192
+    0x2151, 0xDDE3, 0xB153, 0xCBF0, 0x9D25, 0xAFC0, 0x5555, 0x1FC1,
+    0x15D6, 0x812D, 0xCAE5, 0x3D9E, 0xCBD7, 0x37FA, 0xCF1F, 0x1E6A,
+    // M^16384
+    0xCB0D, 0xE1E9, 0xC353, 0x0061, 0x08D2, 0x0084, 0x8389, 0xC392,
+    0xAFE5, 0xFF8E, 0x1890, 0x3B24, 0xE240, 0xCC51, 0xA9C1, 0x5107,
+    // M^32768
+    0x9BB6, 0x1081, 0x0912, 0x4800, 0x9204, 0x00C1, 0x0992, 0x8204,
+    0xA648, 0x4441, 0x1224, 0x8689, 0x4890, 0x9B24, 0x8281, 0x0DD3
+  };
+  __xor16_d97_state = __xor16_jump(__xor16_d97_state, table, n);
+  return __xor16_d97_state;
+}
+
+uint16_t xor16_d97_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "add    r19, r19"      "\n\t"
+      "andi   r19, 0xE0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_d97_state)::"r18","r19");
+  return __xor16_d97_state;
+}
+
+static const uint16_t __xor16_d97_checkpoints[256] PROGMEM = {
+  0x0001, 0x9BD9, 0x3A13, 0xDEB6, 0x0B2D, 0xE602, 0xD70E, 0x6ED0,
+  0xD96F, 0x6211, 0xF992, 0xBDB6, 0xA2C0, 0xE386, 0x162C, 0xA8AA,
+  0x0855, 0x2A79, 0x9BFC, 0x373C, 0x3889, 0xF796, 0xF66A, 0x80DB,
+  0xEF5F, 0x104B, 0xEF8A, 0x2106, 0x87BF, 0x4873, 0xCDB2, 0x9580,
+  0x2151, 0x41C8, 0x2109, 0x2D60, 0x5D57, 0x70A4, 0xE3FC, 0x5902,
+  0x4E6E, 0xC5BC, 0x5A17, 0x417E, 0xE229, 0x0105, 0x557C, 0xB21C,
+  0x65EC, 0x0658, 0x7E0A, 0xEA75, 0x34D3, 0x9D12, 0x8A16, 0xFE99,
+  0xCB6E, 0xA9C0, 0x8CDD, 0x4E9C, 0xEB41, 0x6983, 0xC31F, 0x154F,
+  0xCB0D, 0x5BAD, 0xC88D, 0x2FC2, 0x63F4, 0x3260, 0x70A6, 0xF163,
+  0xE49C, 0x59C1, 0x68BF, 0x1A39, 0x22C3, 0x85D4, 0xC6E8, 0x84EC,
+  0xB821, 0x4848, 0x5377, 0xAD8E, 0x1DCB, 0x77D6, 0x534C, 0x334B,
+  0x25C5, 0x4B4C, 0x6552, 0x410E, 0x3BEE, 0x33DE, 0x5EBA, 0xC7A0,
+  0x23E2, 0x465E, 0xA8D8, 0xC30D, 0xA53C, 0x8795, 0xEF83, 0x3EA9,
+  0xD42D, 0x4745, 0x6E4E, 0xAF20, 0x00F1, 0xA7BB, 0xB419, 0x4B78,
+  0x5148, 0x6C24, 0xBA62, 0x73BC, 0x54AC, 0xD62D, 0xBFC5, 0x0AC1,
+  0x325F, 0x498C, 0x3245, 0x7D89, 0x175C, 0x1827, 0x49A9, 0x3F6A,
+  0x9BB6, 0xEBE7, 0x084F, 0x1E7C, 0xBEE5, 0x5292, 0x667C, 0xD0DB,
+  0x2475, 0x5456, 0x7CA6, 0xE5D0, 0x5920, 0x6DE8, 0x5F26, 0xCA3A,
+  0x8FBB, 0x110D, 0x7982, 0xF04E, 0x048F, 0xA558, 0x5B51, 0xD776,
+  0x3361, 0x8235, 0xB857, 0x24FF, 0x271A, 0x1468, 0xBDF7, 0x732B,
+  0x3D4C, 0xE75F, 0xEEDA, 0xA092, 0xE147, 0xDAE2, 0xAE3E, 0xFA51,
+  0x0AAD, 0x6AED, 0x18F8, 0xEE0D, 0x8340, 0x34EC, 0xA438, 0x4930,
+  0x678C, 0x85F3, 0xD958, 0xDF4D, 0x5335, 0xF523, 0x448C, 0x4FBC,
+  0xB312, 0x3DA0, 0x5A48, 0x037F, 0xE2D2, 0x3057, 0x357A, 0x3F4B,
+  0x3176, 0xF6F0, 0x517B, 0x7697, 0xEBED, 0x9EA6, 0xCA63, 0x78CA,
+  0x5740, 0xFAF0, 0x45C8, 0xCB2B, 0xDFC4, 0xA93F, 0x1A60, 0xD5B2,
+  0xC399, 0x459A, 0x316A, 0x7785, 0x32D4, 0xA119, 0x6098, 0xFB18,
+  0x367A, 0xAE81, 0x26DE, 0x755A, 0x6DF0, 0x79BC, 0x52BD, 0xFDBA,
+  0xE2FB, 0x1EE1, 0x41EC, 0xB7FF, 0xF14C, 0x7F5A, 0x6BE1, 0x522B,
+  0x0F83, 0xE99A, 0x9148, 0xE092, 0x82E5, 0xB52C, 0x8DF1, 0x3556,
+  0x2DCB, 0x84DB, 0x057D, 0xE2EF, 0x1BE2, 0x4BC2, 0xB1F1, 0xD2E8,
+  0xC646, 0x6156, 0x0CC3, 0x3262, 0x6239, 0x4CFD, 0xF333, 0xF4C2
+};
+static const uint8_t __xor16_d97_order[256] PROGMEM = {
+    0, 108,  45, 187, 148, 242,  49, 130,  16, 168, 119,   4, 250, 232,  25, 145,
+  157,  63,  14, 124, 125, 170,  75, 206, 244,  84, 131, 225,  27,  34,  32,  76,
+   96, 136, 155,  88, 218, 156,  17,  35, 240,  67, 189, 210, 192, 122, 120,  69,
+  251, 212,  87, 152,  93,  52, 173, 239, 190, 216,  19,  20,   2,  92, 160, 185,
+  103, 191, 127,  91,  43,  33, 226, 182, 209, 202,  97, 105,  81,  29, 175, 121,
+  126,  89, 111, 245, 253,  40,  59, 183, 112, 194, 231, 133, 222, 180,  86,  82,
+  137, 116,  46, 200,  39, 140,  73,  42, 186, 150,  65,  36,  94, 142, 214, 249,
+    9, 252,  68,  90,  48, 134, 176,  74,  61, 169, 230, 113, 141, 220, 106,   7,
+   37,  70, 159, 115, 219, 195, 211,  85, 199, 146, 221, 138, 123,  50, 229,  23,
+  153, 236, 172, 241,  79,  77, 177, 101,  28,  54,  58, 238, 144, 234,  31, 128,
+    1,  18,  53, 197, 163, 213,  12, 174, 100, 149, 109,  15,  98, 205,  57,  83,
+  166, 217, 107, 246,  47, 184, 110, 237, 227,  80, 154, 114,  11, 158, 132, 118,
+   99,  62, 208,  41, 248,  78,  95,  66, 143, 198,  64, 203,  56,  30, 135, 247,
+  104, 207, 117,   6, 151, 178,   8, 165,   3, 179, 204, 235, 164,  44, 188, 243,
+  224,  13,  38,  72, 139,   5, 161, 233,  51,  60, 129, 196, 171, 162,  24, 102,
+   26, 147, 228,  71, 254, 255, 181,  22, 193,  21,  10, 167, 201, 215, 223,  55
+};
+
+uint16_t xor16_d97_position() {
+  uint16_t saved = __xor16_d97_state;
+  uint16_t pos = __xor16_position(saved, xor16_d97, __xor16_d97_checkpoints, __xor16_d97_order);
+  __xor16_d97_state = saved;
+  return pos;
+}
+
+void xor16_d97_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_d97, xor16_d97, __xor16_d97_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: e11 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_e11_state;
+uint16_t __xor16_e11_state;
 
 bool seed_xor16_e11(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -37,3 +38,230 @@ uint16_t xor16_e11() {
     :"+d"((uint16_t)__xor16_e11_state)::"r18","r19");
   return __xor16_e11_state;
 }
+
+void xor16_e11_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_e11_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_e11_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xA003, 0x4005, 0x000A, 0x0014, 0x0028, 0x0050, 0x00A0, 0x0140,
+    0x0280, 0x0500, 0x0A00, 0x1400, 0x2800, 0x5000, 0xA000, 0x4000,
+    // M^2
+    0xF006, 0x0009, 0x4011, 0x0022, 0x0044, 0x0088, 0x0110, 0x0220,
+    0x0440, 0x0880, 0x1100, 0x2200, 0x4400, 0x8800, 0x1000, 0xA000,
+    // M^4
+    0x3C18, 0xF024, 0xE042, 0x0081, 0x4101, 0x0202, 0x0404, 0x0808,
+    0x1010, 0x2020, 0x4040, 0x8080, 0x0100, 0x8200, 0x4400, 0x2800,
+    // M^8
+    0x0240, 0x0D40, 0x1A20, 0x3410, 0x6808, 0xD004, 0xA002, 0x8001,
+    0x4001, 0x8002, 0x4004, 0x2008, 0x1010, 0x0820, 0x0440, 0x0280,
+    // M^16
+    0x2000, 0x800F, 0x601E, 0x303C, 0x1878, 0x0CF0, 0x07E0, 0x00C0,
+    0x0600, 0x0FC0, 0x1E60, 0x3C30, 0x7818, 0xF00C, 0xE006, 0x0003,
+    // M^32
+    0xF00C, 0xF02E, 0xD85F, 0xCCBE, 0x677C, 0x31F8, 0x1C70, 0x0720,
+    0x11A0, 0x2CB0, 0x5E98, 0xBECC, 0x7C66, 0x3833, 0xF018, 0xA00F,
+    // M^64
+    0x00A3, 0xC175, 0xFD72, 0x0528, 0xF5B6, 0xD49F, 0xD6C6, 0x5270,
+    0x5B1E, 0x89C3, 0xEC78, 0x270F, 0x51E0, 0xAC3F, 0xBF80, 0x8CFF,
+    // M^128
+    0x4739, 0x625F, 0x6853, 0x66D1, 0x3698, 0x10AD, 0xBF95, 0x904C,
+    0xD72B, 0xB58E, 0xA6F0, 0xAB16, 0xE557, 0xF312, 0x3AFA, 0xDB9B,
+    // M^256
+    0xF972, 0xDE8F, 0xCE95, 0x84EE, 0xC53E, 0x2C0D, 0x2B23, 0x8FDB,
+    0x9379, 0x4094, 0x321B, 0xDDAE, 0xA790, 0xC146, 0x05BF, 0x28E6,
+    // M^512
+    0x19C7, 0xC7B5, 0xFF7A, 0x06FC, 0xF1FC, 0x9DFA, 0xC4F5, 0xD66B,
+    0xE317, 0x81CF, 0x406F, 0xC127, 0x42B3, 0x8519, 0xAA0C, 0x8407,
+    // M^1024
+    0x5315, 0x506C, 0x638B, 0x46BE, 0x8DA8, 0x1B3A, 0xF641, 0x2C99,
+    0x193E, 0x527A, 0xD4F7, 0x71EE, 0x4FDC, 0xC9B8, 0xB870, 0xE560,
+    // M^2048
+    0x01DE, 0x3FE2, 0x53D2, 0xF1AF, 0x285A, 0xF536, 0xF8AD, 0xD83B,
+    0xC4C7, 0xD3D7, 0xEA83, 0x9391, 0x2468, 0xC975, 0x7239, 0xB41A,
+    // M^4096
+    0x5194, 0x695D, 0x766F, 0x5EB5, 0x445E, 0xB426, 0x3601, 0x6325,
+    0x61D8, 0x9079, 0xA917, 0x76DD, 0xDFC2, 0xE6B8, 0x61EE, 0x5593,
+    // M^8192
+    0x8EE0, 0x9B42, 0xF3CE, 0x4539, 0xFB21, 0x6EEA, 0x5180, 0xE52A,
+    0xA941, 0x4309, 0xAED6, 0x09CE, 0xF9AD, 0x2643, 0x460B, 0x6951,
+    // M^16384
+    0x5700, 0xB9B8, 0x83E3, 0x1F8E, 0xF338, 0x8062, 0xF3CD, 0xBE1F,
+    0x30FD, 0x679A, 0x8C04, 0x3990, 0xE3EC, 0x8FBE, 0xFB4F, 0xE486,
+    // M^32768
+    0xC3C0, 0x5372, 0x90E9, 0x9AD5, 0x4828, 0x2E91, 0xA243, 0xDB37,
+    0x99B7, 0x4483, 0xD2F1, 0x2818, 0x96CD, 0xEEE5, 0x9C74, 0x9837
+  };
+  __xor16_e11_state = __xor16_jump(__xor16_e11_state, table, n);
+  return __xor16_e11_state;
+}
+
+uint16_t xor16_e11_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_e11_state)::"r18","r19");
+  return __xor16_e11_state;
+}
+
+static const uint16_t __xor16_e11_checkpoints[256] PROGMEM = {
+  0x0001, 0xF972, 0x19C7, 0xA4D7, 0x5315, 0x831B, 0x9D26, 0xCFAD,
+  0x01DE, 0x664B, 0x3E46, 0xF2CE, 0x3B17, 0x44C3, 0xB4A1, 0x268F,
+  0x5194, 0xB526, 0xD345, 0x45E0, 0x2C28, 0x8610, 0x9F57, 0xB45B,
+  0x3125, 0xEE45, 0x5FFA, 0x89DD, 0xB4FE, 0xA514, 0x4369, 0xACE0,
+  0x8EE0, 0x0F32, 0x0BE4, 0x4823, 0xD3E1, 0x28A3, 0x98C3, 0xD1DD,
+  0xCB7F, 0x8C8C, 0x02F3, 0x2AA2, 0x2125, 0x49D5, 0x1D49, 0x8DE3,
+  0xFB22, 0xB74E, 0x1011, 0x9BDC, 0xAA88, 0x7FAF, 0x9161, 0xE253,
+  0x656B, 0xC1A6, 0x0DEC, 0xBE42, 0x14BD, 0x406A, 0x58F0, 0x324A,
+  0x5700, 0x43D9, 0xCA08, 0x348D, 0x681F, 0xB1EF, 0x383A, 0x082A,
+  0xABC2, 0x9D94, 0x77CA, 0x7C06, 0x9CC6, 0xD421, 0x6DAD, 0xA8EA,
+  0xE69A, 0x8E14, 0x8C6C, 0x8A06, 0xA5C6, 0xFC20, 0x8837, 0xF513,
+  0x082E, 0x6557, 0x62EE, 0x986C, 0x1F8D, 0xA71A, 0x9709, 0x131C,
+  0xFB38, 0x2811, 0x20A4, 0xAC05, 0x31F2, 0x66EB, 0x9D90, 0xB95F,
+  0x837C, 0x7360, 0xB7AA, 0x5671, 0xEBC2, 0x982B, 0xDDC6, 0x42E7,
+  0x24B6, 0x85AF, 0x47D4, 0x4B1A, 0x94A3, 0x3946, 0x1338, 0x19A0,
+  0x4A91, 0x2B12, 0xD4B4, 0x10AF, 0x69C0, 0x2ED6, 0x1FBB, 0x5E33,
+  0xC3C0, 0x5A4C, 0x5E4D, 0x9524, 0xCC8C, 0x074C, 0x80AE, 0x1FC4,
+  0xF1A5, 0x4CC7, 0xA79A, 0x18D2, 0xC577, 0xA743, 0x0488, 0x392E,
+  0x90F8, 0x4653, 0xBED0, 0x80D7, 0xA048, 0x466D, 0xC317, 0xD2E2,
+  0x9C27, 0xA5A6, 0xFB0E, 0xD138, 0x746D, 0xE555, 0x9487, 0xDBDE,
+  0x71B8, 0x1216, 0x3220, 0x0A4F, 0xDB9F, 0xA3E9, 0xCF24, 0xF399,
+  0xAF1B, 0xB3D5, 0xCBFC, 0x24AA, 0x0AEA, 0x4FAE, 0x0EC5, 0x3C3E,
+  0xF4A4, 0x14D7, 0x1D25, 0xC0B6, 0x5BAB, 0xACA9, 0xD85F, 0xD4FC,
+  0xBF62, 0xABC9, 0x3E87, 0xAF44, 0x304E, 0xD901, 0x3D6C, 0x574F,
+  0x057C, 0x2909, 0xF20D, 0xB812, 0x882F, 0xB4C3, 0xFF2E, 0xCF2E,
+  0xA9F8, 0x6E52, 0x5B4A, 0xDD2E, 0x4EFC, 0xAD2E, 0x2D95, 0xC088,
+  0x266C, 0xFE9C, 0xE430, 0x3737, 0x877B, 0xA813, 0xD6CD, 0xEFB7,
+  0x5FC7, 0xD3E7, 0x38B9, 0xA00C, 0xA3DB, 0xF898, 0x582A, 0x09ED,
+  0x752B, 0x4D15, 0x8BAA, 0xDF12, 0xAD20, 0xB961, 0xFEBB, 0x2155,
+  0x8BC5, 0xB5BA, 0xD3DB, 0x9BF1, 0x358C, 0x0214, 0x4B3F, 0x8F49,
+  0x4201, 0xBC59, 0x3204, 0xE8D7, 0xB91F, 0xA85F, 0xB795, 0xD2C4,
+  0xA030, 0x0093, 0x6D18, 0xF9E5, 0xBA4A, 0xA248, 0x06F9, 0x42D8
+};
+static const uint8_t __xor16_e11_order[256] PROGMEM = {
+    0, 249,   8, 237,  42, 142, 192, 254, 133,  71,  88, 223, 163, 172,  34,  58,
+  174,  33,  50, 123, 161,  95, 118,  60, 177, 139, 119,   2, 178,  46,  92, 126,
+  135,  98,  44, 231, 171, 112, 208,  15,  97,  37, 193,  43, 121,  20, 206, 125,
+  188,  24, 100, 242, 162,  63,  67, 236, 211,  70, 218, 143, 117,  12, 175, 190,
+   10, 186,  61, 240, 255, 111,  30,  65,  13,  19, 145, 149, 114,  35,  45, 120,
+  115, 238, 137, 225, 204, 173,  16,   4, 107,  64, 191, 222,  62, 129, 202, 180,
+  127, 130, 216,  26,  90,  89,  56,   9, 101,  68, 124, 250,  78, 201, 160, 105,
+  156, 224,  74,  75,  53, 134, 147,   5, 104, 113,  21, 212, 196,  86,  27,  83,
+  226, 232,  82,  41,  47,  81,  32, 239, 144,  54, 158, 116, 131,  94, 109,  91,
+   38,  51, 235, 152,  76,   6, 102,  73,  22, 219, 248, 148, 253, 220, 165,   3,
+   29, 153,  84,  93, 141, 138, 213, 245,  79, 200,  52,  72, 185,  99, 181,  31,
+  228, 205, 168, 187,  69, 169,  23,  14, 197,  28,  17, 233,  49, 246, 106, 195,
+  244, 103, 229, 252, 241,  59, 146, 184, 207, 179,  57, 150, 128, 140,  66,  40,
+  170, 132, 166, 199,   7, 155,  39, 247, 151,  18, 234,  36, 217,  77, 122, 183,
+  214, 182, 189, 164, 159, 203, 110, 227,  55, 210, 157,  80, 243, 108,  25, 215,
+  136, 194,  11, 167, 176,  87, 221,   1, 251, 154,  48,  96,  85, 209, 230, 198
+};
+
+uint16_t xor16_e11_position() {
+  uint16_t saved = __xor16_e11_state;
+  uint16_t pos = __xor16_position(saved, xor16_e11, __xor16_e11_checkpoints, __xor16_e11_order);
+  __xor16_e11_state = saved;
+  return pos;
+}
+
+void xor16_e11_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_e11, xor16_e11, __xor16_e11_checkpoints);
+}
@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: e75 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_e75_state;
+uint16_t __xor16_e75_state;
 
 bool seed_xor16_e75(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -18,33 +19,261 @@ bool seed_xor16_e75(uint16_t seed) {
 
 uint16_t xor16_e75() {
     __asm__ __volatile__(
-      "eor    r19, r19"      "\n\t"
+      "clr    r19"           "\n\t"
       "bst    %A0, 0"        "\n\t"
       "bld    r19, 6"        "\n\t"
       "bst    %A0, 1"        "\n\t"
       "bld    r19, 7"        "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
-      "add    r18, r18"      "\n\t"
+      "lsl    r18"           "\n\t"
       "mov    r18, r19"      "\n\t"
-      "adc    r18, r18"      "\n\t"
-      "sbc    r19, r19"      "\n\t"
-      "neg    r19"           "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_e75_state)::"r18","r19");
+  return __xor16_e75_state;
+}
+
+void xor16_e75_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_e75_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_e75_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x50A1, 0xA142, 0x0084, 0x0108, 0x0210, 0x0420, 0x0840, 0x10A1,
+    0x2142, 0x4284, 0x8508, 0x0A10, 0x1420, 0x2840, 0x5080, 0xA100,
+    // M^2
+    0x0080, 0x0100, 0x1025, 0x204A, 0x4094, 0x8128, 0x0250, 0x5000,
+    0xA000, 0x0221, 0x0442, 0x4A84, 0x9508, 0x2A10, 0x5401, 0xA802,
+    // M^4
+    0x5000, 0xA000, 0x0485, 0x090A, 0x54B0, 0xA960, 0x40E5, 0xC109,
+    0x8212, 0x8389, 0x0712, 0x5C81, 0xB902, 0x2221, 0xC5CB, 0xC996,
+    // M^8
+    0x7CC9, 0xEBB7, 0x929E, 0x7799, 0x4702, 0xDCA1, 0xB9C2, 0xD745,
+    0xBEAF, 0x500E, 0xF239, 0xB653, 0x2C26, 0x58C8, 0xF1BB, 0xE3F2,
+    // M^16
+    0xA4E8, 0x5B75, 0x012D, 0x02DA, 0x0694, 0x0D28, 0x1AD0, 0x7562,
+    0xFAE5, 0xD32D, 0xA65A, 0x5C95, 0xB92A, 0x72D0, 0x7409, 0xBAB3,
+    // M^32
+    0x0E79, 0x0CD7, 0x50D2, 0xE3A4, 0x07AC, 0x0FD8, 0x5FB4, 0xAFC1,
+    0x4DA7, 0xF46F, 0xF8FF, 0xE1DF, 0x83BE, 0x05F8, 0xBF9B, 0x7FB2,
+    // M^64
+    0x5752, 0xBC85, 0xC72B, 0x8CD2, 0x5258, 0xB495, 0x6BAA, 0x24AE,
+    0x1979, 0x5F24, 0xEE69, 0xCE77, 0xDE6E, 0xAEFD, 0x107B, 0x3257,
+    // M^128
+    0xE356, 0xD60D, 0x5988, 0xB390, 0x2411, 0x4A22, 0x96C0, 0x27D3,
+    0x5F87, 0xDBE8, 0xF754, 0xFC8D, 0xAB3B, 0x56F2, 0x340C, 0x3AB9,
+    // M^256
+    0xE17C, 0x807C, 0xA87E, 0x40DD, 0x66E1, 0x8F46, 0x0C2D, 0x8590,
+    0x5B81, 0x95CD, 0x6B1E, 0xD638, 0xFC51, 0xBAA6, 0xE085, 0xC38A,
+    // M^512
+    0xCF01, 0xCEA3, 0x2241, 0x0606, 0x4377, 0x94CF, 0x3BBF, 0x1064,
+    0x604C, 0x8F26, 0x4C69, 0x88F7, 0x536E, 0xE45C, 0x553B, 0xA872,
+    // M^1024
+    0x19BC, 0x33F8, 0x9FC4, 0x2FAD, 0x75B5, 0xB94B, 0x3296, 0xDE5F,
+    0xAE9F, 0xFBAB, 0xF7D2, 0xFF05, 0xACAB, 0x09F3, 0xFA6C, 0xE67D,
+    // M^2048
+    0x5FF9, 0xFFF6, 0x6438, 0x9AD1, 0x92A0, 0x25C0, 0x5925, 0x9EC8,
+    0x2D35, 0x7185, 0xB12B, 0x62D2, 0x85A4, 0x5BE9, 0x8653, 0x4E26,
+    // M^4096
+    0x391B, 0x7232, 0x4120, 0xD261, 0x010F, 0x001A, 0x5211, 0x34C2,
+    0x2984, 0xD022, 0xA240, 0x0684, 0x0D08, 0x1A90, 0xE502, 0x9A21,
+    // M^8192
+    0xA0DF, 0x519F, 0xCC9C, 0xC919, 0xF1EC, 0xA15C, 0x003C, 0xA139,
+    0x4072, 0x0003, 0x0282, 0x0780, 0x5F21, 0xEE63, 0x9C45, 0x788E,
+    // M^16384
+    0x32C1, 0x2706, 0xB499, 0x3B13, 0x1027, 0x22CA, 0x5535, 0xEFE9,
+    0x9D56, 0xF140, 0xF0A5, 0xE3CA, 0x8794, 0x5F89, 0x4ED2, 0xDFA4,
+    // M^32768
+    0xA140, 0x50A5, 0x0100, 0x5221, 0x0400, 0x0800, 0x1000, 0x2042,
+    0x0084, 0x8108, 0x0210, 0x0420, 0x0840, 0x5004, 0x2100, 0x1021
+  };
+  __xor16_e75_state = __xor16_jump(__xor16_e75_state, table, n);
+  return __xor16_e75_state;
+}
+
+uint16_t xor16_e75_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
       "add    r18, r18"      "\n\t"
       "adc    r19, r19"      "\n\t"
-      "add    r18, r18"      "\n\t"
-      "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "add    r19, r19"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 6"        "\n\t"
+      "bst    %A0, 1"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_e75_state)::"r18","r19");
   return __xor16_e75_state;
 }
+
+static const uint16_t __xor16_e75_checkpoints[256] PROGMEM = {
+  0x0001, 0xE17C, 0xCF01, 0xB119, 0x19BC, 0xF57C, 0x584E, 0xAE1E,
+  0x5FF9, 0xAE05, 0x18C5, 0xEAD6, 0x1D02, 0x9A8A, 0x391F, 0x240C,
+  0x391B, 0x8C72, 0x1B5A, 0x4E48, 0x849E, 0x233A, 0x5DEC, 0x142B,
+  0x39D4, 0x8C6C, 0x1564, 0xE7DB, 0xF27A, 0xD51E, 0xE1FF, 0x2B91,
+  0xA0DF, 0x1FD3, 0x0167, 0x1194, 0xECDF, 0x4270, 0x90C2, 0x361A,
+  0x1E64, 0xFFAF, 0x95E7, 0xC0C1, 0x4BCE, 0x1993, 0xF399, 0xE964,
+  0x3F05, 0x7C9F, 0x7186, 0x5061, 0x7EC3, 0x6624, 0x83C8, 0xC4A6,
+  0x6AC5, 0xD969, 0x702D, 0x20EB, 0x9D80, 0x5CEC, 0x4FAA, 0x5998,
+  0x32C1, 0xBBFB, 0xDCCE, 0x831A, 0xAB86, 0xCCCA, 0xD735, 0xDAA9,
+  0x37DC, 0xE45A, 0x58DA, 0xE511, 0x2EAB, 0xB946, 0x2CEB, 0x20A6,
+  0x9872, 0x8C15, 0x514F, 0xC2DB, 0x7843, 0x1D67, 0x50E3, 0x7B2F,
+  0xB8E3, 0x34BE, 0x2901, 0xD663, 0xC3E6, 0xC3BA, 0x41D5, 0x1D5A,
+  0xB09B, 0x47D1, 0x4BF7, 0x5195, 0xED26, 0xD84A, 0xC5EA, 0xD5CA,
+  0xA6DD, 0x617C, 0x0C8B, 0x196B, 0xD35E, 0x1301, 0xD361, 0x7305,
+  0x213C, 0xE023, 0x77EF, 0x8C78, 0xDBFB, 0x86ED, 0x327D, 0x3F6F,
+  0x3F55, 0x1653, 0x094E, 0xE94B, 0x39E0, 0xCDB5, 0xE09D, 0x7307,
+  0xA140, 0x2E80, 0x17DD, 0xBF80, 0x7387, 0x24D0, 0x3EE4, 0xC099,
+  0x61DF, 0x675D, 0x9C62, 0x81EA, 0x5E51, 0xBF8F, 0xFA24, 0x0135,
+  0xFB24, 0x5AB4, 0x9B68, 0xE419, 0x35F7, 0xDF0C, 0x4497, 0xA194,
+  0x69A2, 0x5D30, 0x13D4, 0x753F, 0xF6E9, 0x3C71, 0xFF27, 0x50AA,
+  0xD6A3, 0x4A5B, 0xE861, 0x2D86, 0xF193, 0xBC08, 0x7886, 0xDDD8,
+  0x9678, 0x645F, 0xD252, 0xA023, 0x976A, 0xD943, 0x3FCA, 0x7C81,
+  0x7FB8, 0xF9F2, 0x0827, 0x9000, 0x3FDB, 0xFB1C, 0xF3CE, 0x4AD6,
+  0x642E, 0xD6A4, 0x8325, 0xCB82, 0x3E97, 0x4413, 0x8C7A, 0x5B87,
+  0x484E, 0x524F, 0x0C97, 0x9729, 0xB46E, 0x05D7, 0x16BD, 0x676A,
+  0xBCBB, 0x75B1, 0x1BA6, 0xC6F1, 0x5CBA, 0x0D64, 0xCDB2, 0x29E3,
+  0x50E4, 0xB251, 0x9B00, 0x27AF, 0x9C81, 0xE611, 0xE0E7, 0x562C,
+  0x85E2, 0x7592, 0xF5E0, 0x539C, 0xD94A, 0x9E6B, 0xB586, 0x1870,
+  0xCFE3, 0x379E, 0x680B, 0xADC6, 0x3E34, 0x2FC5, 0x0973, 0x0933,
+  0x051E, 0x3EA1, 0x85B6, 0xB720, 0xAF69, 0x288C, 0x01AD, 0x5888,
+  0x0FA1, 0x98C0, 0x605E, 0x5830, 0x234B, 0x591A, 0x372D, 0x653C,
+  0x6BB8, 0x6EBD, 0x1720, 0xD645, 0x64A2, 0xBB97, 0xB706, 0x082D
+};
+static const uint8_t __xor16_e75_order[256] PROGMEM = {
+    0, 143,  34, 238, 232, 197, 178, 255, 231, 122, 230, 106, 194, 205, 240,  35,
+  109, 154,  23,  26, 121, 198, 250, 130, 223,  10, 107,  45,   4,  18, 202,  12,
+   95,  85,  40,  33,  79,  59, 112,  21, 244,  15, 133, 211, 237,  90, 207,  31,
+   78, 163, 129,  76, 229, 118,  64,  89, 148,  39, 246, 225,  72,  16,  14,  24,
+  124, 157, 228, 188, 233, 134,  48, 120, 119, 174, 180,  94,  37, 189, 150,  97,
+  192, 161, 183,  44,  98,  19,  62,  51, 159,  86, 208,  82,  99, 193, 219, 215,
+  243,   6, 239,  74, 245,  63, 145, 191, 204,  61, 153,  22, 140,   8, 242, 105,
+  136, 184, 169, 252, 247,  53, 137, 199, 226, 152,  56, 248, 249,  58,  50, 111,
+  127, 132, 155, 217, 201, 114,  84, 166,  87, 175,  49,  52, 176, 139,  67, 186,
+   54,  20, 234, 216, 117,  81,  25,  17, 115, 190, 179,  38,  42, 168, 195, 172,
+   80, 241,  13, 210, 146, 138, 212,  60, 221, 171,  32, 128, 151, 104,  68, 227,
+    9,   7, 236,  96,   3, 209, 196, 222, 254, 235,  88,  77, 253,  65, 165, 200,
+  131, 141, 135,  43,  83,  93,  92,  55, 102, 203, 187,  69, 206, 125,   2, 224,
+  170, 108, 110,  29, 103, 251,  91, 160, 185,  70, 101, 173, 220,  57,  71, 116,
+   66, 167, 149, 113, 126, 214,   1,  30, 147,  73,  75, 213,  27, 162, 123,  47,
+   11,  36, 100, 164,  28,  46, 182,   5, 218, 156, 177, 142, 181, 144, 158,  41
+};
+
+uint16_t xor16_e75_position() {
+  uint16_t saved = __xor16_e75_state;
+  uint16_t pos = __xor16_position(saved, xor16_e75, __xor16_e75_checkpoints, __xor16_e75_order);
+  __xor16_e75_state = saved;
+  return pos;
+}
+
+void xor16_e75_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_e75, xor16_e75, __xor16_e75_checkpoints);
+}
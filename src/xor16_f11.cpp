@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: f11 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_f11_state;
+uint16_t __xor16_f11_state;
 
 bool seed_xor16_f11(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -35,3 +36,224 @@ uint16_t xor16_f11() {
     :"+d"((uint16_t)__xor16_f11_state)::"r18","r19");
   return __xor16_f11_state;
 }
+
+void xor16_f11_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_f11_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_f11_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x4003, 0x0005, 0x000A, 0x0014, 0x0028, 0x0050, 0x00A0, 0x0140,
+    0x0280, 0x0500, 0x0A00, 0x1400, 0x2800, 0x5000, 0xA000, 0x4000,
+    // M^2
+    0xE006, 0x4009, 0x0011, 0x0022, 0x0044, 0x0088, 0x0110, 0x0220,
+    0x0440, 0x0880, 0x1100, 0x2200, 0x4400, 0x8800, 0x1000, 0xA000,
+    // M^4
+    0x7818, 0xF024, 0xE042, 0x4081, 0x0101, 0x0202, 0x0404, 0x0808,
+    0x1010, 0x2020, 0x4040, 0x8080, 0x0100, 0x8200, 0x4400, 0x2800,
+    // M^8
+    0x0600, 0x0D40, 0x1A20, 0x3410, 0x6808, 0xD004, 0xA002, 0xC001,
+    0x0001, 0x8002, 0x4004, 0x2008, 0x1010, 0x0820, 0x0440, 0x0280,
+    // M^16
+    0xC006, 0xC00F, 0x601E, 0x303C, 0x1878, 0x0CF0, 0x07E0, 0x00C0,
+    0x0600, 0x0FC0, 0x1E60, 0x3C30, 0x7818, 0xF00C, 0xE006, 0x4003,
+    // M^32
+    0x0014, 0xF02E, 0x985F, 0xCCBE, 0x677C, 0x31F8, 0x1C70, 0x0720,
+    0x11A0, 0x2CB0, 0x5E98, 0xBECC, 0x7C66, 0x7833, 0xF018, 0xE00F,
+    // M^64
+    0xFF23, 0x8175, 0xFD72, 0x0528, 0xF5B6, 0x949F, 0xD6C6, 0x5270,
+    0x5B1E, 0xC9C3, 0xEC78, 0x670F, 0x51E0, 0xEC3F, 0xBF80, 0xCCFF,
+    // M^128
+    0x3DC3, 0x225F, 0x2853, 0x26D1, 0x3698, 0x50AD, 0xFF95, 0x904C,
+    0x972B, 0xB58E, 0xA6F0, 0xAB16, 0xA557, 0xF312, 0x3AFA, 0x9B9B,
+    // M^256
+    0xBCCD, 0x9E8F, 0x8E95, 0x84EE, 0xC53E, 0x6C0D, 0x6B23, 0xCFDB,
+    0xD379, 0x4094, 0x721B, 0xDDAE, 0xA790, 0xC146, 0x45BF, 0x28E6,
+    // M^512
+    0xF3CB, 0x87B5, 0xFF7A, 0x06FC, 0xF1FC, 0x9DFA, 0x84F5, 0x966B,
+    0xA317, 0xC1CF, 0x006F, 0x8127, 0x02B3, 0xC519, 0xAA0C, 0xC407,
+    // M^1024
+    0xAB65, 0x506C, 0x238B, 0x46BE, 0x8DA8, 0x1B3A, 0xB641, 0x6C99,
+    0x193E, 0x527A, 0x94F7, 0x71EE, 0x4FDC, 0xC9B8, 0xB870, 0xE560,
+    // M^2048
+    0x33E7, 0x3FE2, 0x53D2, 0xB1AF, 0x285A, 0xF536, 0xB8AD, 0x983B,
+    0x84C7, 0x93D7, 0xAA83, 0xD391, 0x2468, 0x8975, 0x3239, 0xB41A,
+    // M^4096
+    0x307A, 0x295D, 0x366F, 0x1EB5, 0x445E, 0xB426, 0x7601, 0x2325,
+    0x61D8, 0xD079, 0xE917, 0x36DD, 0xDFC2, 0xE6B8, 0x61EE, 0x1593,
+    // M^8192
+    0x88EB, 0x9B42, 0xF3CE, 0x0539, 0xBB21, 0x6EEA, 0x5180, 0xE52A,
+    0xE941, 0x0309, 0xAED6, 0x09CE, 0xB9AD, 0x6643, 0x060B, 0x2951,
+    // M^16384
+    0xEC4F, 0xB9B8, 0xC3E3, 0x1F8E, 0xF338, 0x8062, 0xB3CD, 0xFE1F,
+    0x70FD, 0x679A, 0x8C04, 0x3990, 0xE3EC, 0x8FBE, 0xBB4F, 0xE486,
+    // M^32768
+    0x5FB4, 0x5372, 0xD0E9, 0xDAD5, 0x4828, 0x6E91, 0xE243, 0x9B37,
+    0xD9B7, 0x0483, 0x92F1, 0x2818, 0xD6CD, 0xAEE5, 0x9C74, 0xD837
+  };
+  __xor16_f11_state = __xor16_jump(__xor16_f11_state, table, n);
+  return __xor16_f11_state;
+}
+
+uint16_t xor16_f11_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_f11_state)::"r18","r19");
+  return __xor16_f11_state;
+}
+
+static const uint16_t __xor16_f11_checkpoints[256] PROGMEM = {
+  0x0001, 0xBCCD, 0xF3CB, 0x9A36, 0xAB65, 0x9295, 0xF75F, 0x6C5D,
+  0x33E7, 0x9119, 0xA112, 0x6168, 0xD440, 0xD3F1, 0xE822, 0x8333,
+  0x307A, 0xBEA7, 0xAE10, 0xC3BF, 0xB065, 0x7B46, 0x1613, 0x7263,
+  0x4691, 0xC118, 0xFFF0, 0x3A1C, 0x34A9, 0x8F38, 0x3963, 0x4D6D,
+  0x88EB, 0x9B11, 0xB8C6, 0x277C, 0xE8DB, 0xB6DB, 0xBBD5, 0x53ED,
+  0x0F81, 0x4F4E, 0x8630, 0xB35A, 0x69A1, 0x9535, 0xB57F, 0x057B,
+  0xC5DE, 0x3909, 0x5022, 0x10AD, 0xB2F0, 0x036F, 0xBCFA, 0xF62F,
+  0x7D34, 0x7803, 0xDC85, 0x98FF, 0x772A, 0xB4F3, 0x13A2, 0x0924,
+  0xEC4F, 0x40B0, 0x2357, 0x5061, 0x59CC, 0x427B, 0x6197, 0xF1B2,
+  0x2091, 0x776E, 0x5145, 0x682D, 0x83EC, 0x7985, 0xD03D, 0xD54C,
+  0x0AF3, 0xB2B3, 0x4A0E, 0x4C71, 0x94D7, 0x307C, 0xAEBD, 0xD6DF,
+  0xB1B9, 0xC382, 0xAFE0, 0x1D0D, 0x6DEA, 0x2AA1, 0x4367, 0x7DAB,
+  0x5ADF, 0x36EA, 0x86CD, 0x0827, 0x1D74, 0x97D9, 0x3765, 0xB256,
+  0xB0A3, 0xCFA4, 0x7C42, 0x7970, 0xEFAE, 0xA765, 0x3D20, 0x7617,
+  0x780F, 0xD6FE, 0x6179, 0xADB3, 0xD1C6, 0xAD52, 0xA5FE, 0xD1FD,
+  0xA2CD, 0xBB7A, 0xD802, 0x89E8, 0x6A2A, 0x6FAF, 0x334E, 0x0AEC,
+  0x5FB4, 0x360A, 0x4E38, 0x8743, 0x8071, 0x563B, 0xDF3F, 0x779B,
+  0x6ED6, 0x1A04, 0xB43F, 0xBD21, 0xE23C, 0x4FC3, 0xFF5D, 0x2F7C,
+  0x3575, 0x37FC, 0x8090, 0x2203, 0xA390, 0x70A8, 0x0451, 0x60CB,
+  0x86AD, 0x0F09, 0x047B, 0x16A7, 0x9A1E, 0x4386, 0x0993, 0x2670,
+  0x31D9, 0xEC4A, 0x72E8, 0x2FE6, 0x25F1, 0xD122, 0xEB32, 0xD5E0,
+  0xA35E, 0x40A4, 0x68FC, 0x5EE7, 0x692C, 0xEC58, 0x2959, 0x59AF,
+  0x6717, 0x0CE6, 0x775A, 0x76E3, 0xFB51, 0x571C, 0xCC9C, 0xC272,
+  0x7152, 0xC082, 0x3C0D, 0x7FD5, 0x4CAF, 0x61E5, 0xAD2D, 0x4FD7,
+  0xB4F6, 0x21FA, 0x0595, 0x99DF, 0xC85E, 0x8A1E, 0xE416, 0x0B20,
+  0x224E, 0x7E05, 0xFE10, 0x2190, 0x18DA, 0x0199, 0xE1BF, 0x31B7,
+  0x7F90, 0x15D4, 0xE9A1, 0xBDD3, 0x7178, 0xB6EE, 0x20BE, 0x335A,
+  0x4147, 0x5132, 0x06EA, 0xE01B, 0xCF8D, 0x286C, 0x11BD, 0xA4B7,
+  0x5184, 0x7018, 0x62B9, 0x9AA6, 0xA180, 0xF502, 0x3462, 0x8D6C,
+  0x597F, 0x06D1, 0xEF84, 0xD109, 0x2193, 0x3A98, 0x75E7, 0xE629,
+  0xCABE, 0x027F, 0xAABD, 0xA4C4, 0xB1D6, 0xEC95, 0x3B17, 0x417C,
+  0x5EAD, 0x186E, 0xE9E4, 0xE4A8, 0xF93C, 0xA610, 0x1E11, 0x3142
+};
+static const uint8_t __xor16_f11_order[256] PROGMEM = {
+    0, 205, 241,  53, 150, 154,  47, 194, 233, 218,  99,  63, 158, 127,  80, 199,
+  177, 153,  40,  51, 222,  62, 209,  22, 155, 249, 204, 137,  91, 100, 254,  72,
+  214, 203, 236, 193, 147, 200,  66, 164, 159,  35, 221, 174,  93, 143, 163,  16,
+   85, 255, 207, 160, 126, 215,   8, 230,  28, 144, 129,  97, 102, 145,  49,  30,
+   27, 237, 246, 186, 110, 169,  65, 216, 247,  69,  94, 157,  24,  82,  83, 188,
+   31, 130,  41, 141, 191,  50,  67, 217,  74, 224,  39, 133, 181, 232, 175,  68,
+   96, 248, 171, 128, 151,  11, 114,  70, 189, 226, 176,  75, 170, 172,  44, 124,
+    7,  92, 136, 125, 225, 149, 184, 212,  23, 162, 238, 111, 179,  60, 178,  73,
+  135,  57, 112, 107,  77,  21, 106,  56,  95, 201, 208, 187, 132, 146,  15,  76,
+   42, 152,  98, 131,  32, 123, 197, 231,  29,   9,   5,  84,  45, 101,  59, 195,
+  156,   3, 227,  33,  10, 228, 120, 168, 148, 223, 243, 118, 253, 109, 242,   4,
+  190, 117, 115,  18,  86,  90,  20, 104,  88, 244, 103,  81,  52,  43, 138,  61,
+  192,  46,  37, 213,  34, 121,  38,   1,  54, 139, 211,  17, 185,  25, 183,  89,
+   19,  48, 196, 240, 182, 220, 105,  78, 235, 165, 116, 119,  13,  12,  79, 167,
+   87, 113, 122,  58, 134, 219, 206, 140, 198, 251, 239,  14,  36, 210, 250, 166,
+  161,  64, 173, 245, 234, 108,  71,   2, 229,  55,   6, 252, 180, 202, 142,  26
+};
+
+uint16_t xor16_f11_position() {
+  uint16_t saved = __xor16_f11_state;
+  uint16_t pos = __xor16_position(saved, xor16_f11, __xor16_f11_checkpoints, __xor16_f11_order);
+  __xor16_f11_state = saved;
+  return pos;
+}
+
+void xor16_f11_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_f11, xor16_f11, __xor16_f11_checkpoints);
+}
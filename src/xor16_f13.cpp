@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: f13 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_f13_state;
+uint16_t __xor16_f13_state;
 
 bool seed_xor16_f13(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -39,3 +40,234 @@ uint16_t xor16_f13() {
     :"+d"((uint16_t)__xor16_f13_state)::"r18","r19");
   return __xor16_f13_state;
 }
+
+void xor16_f13_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_f13_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_f13_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0xC009, 0x001B, 0x0036, 0x006C, 0x00D8, 0x01B0, 0x0360, 0x06C0,
+    0x0D80, 0x1B00, 0x3600, 0x6C00, 0xD800, 0xB000, 0x6000, 0xC000,
+    // M^2
+    0x6065, 0xC0A6, 0x0145, 0x028A, 0x0514, 0x0A28, 0x1450, 0x28A0,
+    0x5140, 0xA280, 0x4500, 0x8A00, 0x1400, 0xA800, 0xD000, 0xA000,
+    // M^4
+    0x0758, 0x936B, 0x2430, 0x480C, 0x1011, 0x2022, 0x4044, 0x0088,
+    0x8110, 0x8220, 0xC440, 0x8880, 0x5100, 0x8200, 0x6400, 0x0800,
+    // M^8
+    0xDF29, 0xE669, 0x7673, 0x80BC, 0x4649, 0x3149, 0x0074, 0x4884,
+    0x9901, 0xAA02, 0xE804, 0x8008, 0xB410, 0x8A20, 0x2240, 0x8880,
+    // M^16
+    0x2B03, 0x0C4E, 0x1042, 0x41CB, 0x3FA7, 0xF8D0, 0x0107, 0x9CBF,
+    0xFAB0, 0xCEC3, 0xD69B, 0x083C, 0x18FD, 0x93C3, 0x2056, 0x400C,
+    // M^32
+    0x88C1, 0x8267, 0x15B4, 0x21D8, 0x328A, 0x4147, 0xCDBF, 0xAB5A,
+    0x7653, 0xCACB, 0xA561, 0x9EC2, 0x3084, 0xD677, 0xB16F, 0x71DF,
+    // M^64
+    0x0139, 0x28FE, 0x2E95, 0xD593, 0x24DD, 0x1591, 0x6B1D, 0xD978,
+    0xCDA5, 0xD922, 0x70A3, 0x54B1, 0x581D, 0x3EFE, 0x534D, 0x4B6A,
+    // M^128
+    0x2843, 0x3A9E, 0x11C7, 0x295E, 0x22DA, 0x1987, 0xF367, 0x56EC,
+    0x12D5, 0xE441, 0xD080, 0x92FE, 0x8103, 0xCB02, 0x8EF5, 0x909A,
+    // M^256
+    0xB846, 0x4A8F, 0x3547, 0x9893, 0xBBD2, 0x54DE, 0x4B00, 0xBFA2,
+    0xDB97, 0xDEC9, 0xC980, 0x6909, 0x9092, 0x409B, 0x91F7, 0x766F,
+    // M^512
+    0xFBA7, 0xC688, 0x4E90, 0x794D, 0xCFCE, 0x60CE, 0xFDA0, 0xA242,
+    0xD8A3, 0xDD3D, 0xEAA4, 0x4327, 0xA802, 0xFFDD, 0xE14A, 0x1674,
+    // M^1024
+    0x576B, 0x1BA8, 0xF878, 0x1CCB, 0xF594, 0xB020, 0x134D, 0x0FBC,
+    0xE3B8, 0x4D66, 0x1AE5, 0xF7A5, 0x6C06, 0x50AA, 0x9225, 0x83AB,
+    // M^2048
+    0xB97D, 0x962A, 0x90B5, 0xCDBF, 0xD62F, 0x0F27, 0x624D, 0xED25,
+    0xB939, 0xDC60, 0xD507, 0x8996, 0xCC1F, 0x46DC, 0xBDF8, 0xC2E1,
+    // M^4096
+    0x27BF, 0x532B, 0x131B, 0xDCC1, 0xC71B, 0x890D, 0xA17E, 0xFA82,
+    0xD547, 0x82FD, 0x60DA, 0xCFDB, 0x87FA, 0xB0D2, 0x3655, 0x9A4B,
+    // M^8192
+    0x8868, 0xC74D, 0xBF0E, 0xF8A6, 0xF430, 0x68B2, 0x8C47, 0x7FB9,
+    0x5888, 0xE539, 0x958A, 0x6017, 0x372B, 0x62AF, 0x87CE, 0x59BC,
+    // M^16384
+    0x25F8, 0xB5CE, 0xC4F1, 0x84A9, 0x82FE, 0xA100, 0xD04D, 0x0993,
+    0x57ED, 0x9D93, 0xE3C7, 0xE17A, 0xA28E, 0x1FDE, 0x029C, 0x2CE9,
+    // M^32768
+    0xD57D, 0x09DB, 0x126A, 0xC6EC, 0xBECC, 0x64DA, 0x3916, 0xADCC,
+    0x94D5, 0xC06C, 0x76CC, 0xA492, 0x52A1, 0xC4FB, 0x56A6, 0xC4EC
+  };
+  __xor16_f13_state = __xor16_jump(__xor16_f13_state, table, n);
+  return __xor16_f13_state;
+}
+
+uint16_t xor16_f13_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r0, %B0"       "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "clr    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r0"            "\n\t"
+      "ror    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r19, %A0"      "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_f13_state)::"r18","r19");
+  return __xor16_f13_state;
+}
+
+static const uint16_t __xor16_f13_checkpoints[256] PROGMEM = {
+  0x0001, 0xB846, 0xFBA7, 0x7734, 0x576B, 0xB83F, 0x7F7E, 0xA77E,
+  0xB97D, 0xA566, 0x44F5, 0xCED8, 0x4E3B, 0x6AE1, 0x7E96, 0x4406,
+  0x27BF, 0x83F6, 0x1757, 0x6B10, 0x06E9, 0x97E0, 0x8A5F, 0x6E60,
+  0xB0F2, 0xF747, 0x77C1, 0xC1C4, 0xFDEA, 0x3EEF, 0x5128, 0x16BF,
+  0x8868, 0x982B, 0xB170, 0xD9FD, 0xCBA8, 0xF820, 0x0A46, 0x8308,
+  0xEBA2, 0x6AA7, 0x4A5E, 0x31BE, 0xBC6B, 0x736B, 0x3124, 0x6A07,
+  0xA122, 0xF332, 0x974C, 0xCCF7, 0x9B31, 0xDDE0, 0xAC68, 0x1130,
+  0xA409, 0xDFA1, 0x81E7, 0xCA0A, 0x8244, 0xD6E1, 0x7879, 0xAC2E,
+  0x25F8, 0xD1B1, 0x4475, 0x717A, 0xEC79, 0x8353, 0x712A, 0x1CAB,
+  0xB13D, 0x876F, 0xFA72, 0x6ED2, 0xAAD3, 0x3C8D, 0xDAB0, 0x9064,
+  0xCC64, 0x6D88, 0x8D43, 0xB4B8, 0xA7DB, 0xDF00, 0xD2DD, 0xF321,
+  0xDE57, 0x3E16, 0x6A53, 0x64B7, 0x8FCC, 0x8ACE, 0xD256, 0x26D9,
+  0x3877, 0xDA82, 0x35E7, 0xA5EC, 0x294B, 0xD35F, 0xDD9B, 0x623E,
+  0x07F2, 0x9DFF, 0xD950, 0x3546, 0xF6D6, 0x1060, 0x8F4C, 0x356C,
+  0x7014, 0xCF6B, 0x37CB, 0x822F, 0xA365, 0xA175, 0xC46E, 0xD69D,
+  0x71A1, 0xC953, 0x571D, 0x63FB, 0xA5C6, 0xAF89, 0x0C54, 0x651C,
+  0xD57D, 0xD483, 0xF3E1, 0x2AF5, 0x61F4, 0x2412, 0x7846, 0x1C3F,
+  0x800A, 0xA473, 0xA9B1, 0x6C82, 0x84C8, 0xD3DE, 0xDA7F, 0x3BDB,
+  0x9974, 0xC528, 0x39C2, 0xDCBA, 0x5531, 0x4438, 0x2FE8, 0xDDA3,
+  0x15A1, 0xD1BF, 0xA32E, 0x802F, 0x7DAC, 0x7C48, 0x32E4, 0x9BFB,
+  0xFB5E, 0x4C4F, 0x2563, 0xBF9B, 0x6D9B, 0xC458, 0x4659, 0x56B9,
+  0x6657, 0xF179, 0x68DF, 0xA808, 0xC76E, 0xD3C3, 0x743F, 0x386F,
+  0xF9C3, 0x8364, 0x59A8, 0xC014, 0x690D, 0x7660, 0x4969, 0x1C62,
+  0x654A, 0x5A67, 0x6EF5, 0x3983, 0x2FFC, 0x5336, 0x94FF, 0x6BCE,
+  0xAEC2, 0xF699, 0x047D, 0x781E, 0x747E, 0xCB29, 0xFFC4, 0x53A3,
+  0x1D8E, 0xB375, 0x8A35, 0xA3A2, 0x9259, 0xE833, 0xD3CF, 0xD9EB,
+  0x0FB2, 0xBFF6, 0x67D7, 0x954C, 0x123E, 0x460C, 0x2B6A, 0xE10E,
+  0x9BCF, 0x2115, 0xADDF, 0x5D87, 0x0257, 0xE995, 0x9CEC, 0x4BDC,
+  0x1F04, 0x0002, 0x4A8F, 0xC688, 0xD7E0, 0x1BA8, 0x8F2A, 0x557A,
+  0x6562, 0x962A, 0x7776, 0x56E4, 0x8317, 0x0F6D, 0xAF9B, 0xFD09,
+  0x6C5A, 0x532B, 0x3ABF, 0x687A, 0xCE75, 0xB0D5, 0x6417, 0x64B0,
+  0x4842, 0xF971, 0x9945, 0x9262, 0x6D65, 0x38AD, 0x47EE, 0x1A0E
+};
+static const uint8_t __xor16_f13_order[256] PROGMEM = {
+    0, 225, 220, 194,  20, 104,  38, 126, 237, 208, 109,  55, 212, 152,  31,  18,
+  255, 229, 135, 183,  71, 200, 224, 217, 133, 162,  64,  95,  16, 100, 131, 214,
+  150, 188,  46,  43, 158, 107, 111,  98, 114, 175,  96, 253, 187, 146, 242, 143,
+   77,  89,  29,  15, 149,  66,  10, 213, 166, 254, 248, 182,  42, 226, 223, 161,
+   12,  30, 241, 189, 199, 148, 231, 167, 235, 122,   4, 178, 185, 219, 132, 103,
+  123, 246, 247,  91, 127, 184, 232, 168, 210, 243, 170, 180,  47,  90,  41,  13,
+   19, 191, 240, 139, 252,  81, 164,  23,  75, 186, 112,  70,  67, 120,  45, 174,
+  196, 181,   3, 234,  26, 195, 134,  62, 157, 156,  14,   6, 136, 155,  58, 115,
+   60,  39, 236,  69, 177,  17, 140,  73,  32, 202,  22,  93,  82, 230, 110,  92,
+   79, 204, 251, 190, 211, 233,  50,  21,  33, 250, 144,  52, 216, 159, 222, 105,
+   48, 117, 154, 116, 203,  56, 137,   9, 124,  99,   7,  84, 171, 138,  76,  63,
+   54, 218, 192, 125, 238, 245,  24,  72,  34, 201,  83,   5,   1,   8,  44, 163,
+  209, 179,  27, 165, 118, 145, 227, 172, 121,  59, 197,  36,  80,  51, 244,  11,
+  113,  65, 153,  94,  86, 101, 173, 206, 141, 129, 128, 119,  61, 228, 106, 207,
+   35, 142,  97,  78, 147, 102, 151,  53,  88,  85,  57, 215, 205, 221,  40,  68,
+  169,  87,  49, 130, 193, 108,  25,  37, 249, 176,  74, 160,   2, 239,  28, 198
+};
+
+uint16_t xor16_f13_position() {
+  uint16_t saved = __xor16_f13_state;
+  uint16_t pos = __xor16_position(saved, xor16_f13, __xor16_f13_checkpoints, __xor16_f13_order);
+  __xor16_f13_state = saved;
+  return pos;
+}
+
+void xor16_f13_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_f13, xor16_f13, __xor16_f13_checkpoints);
+}
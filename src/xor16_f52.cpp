@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: f52 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_f52_state;
+uint16_t __xor16_f52_state;
 
 bool seed_xor16_f52(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -18,21 +19,80 @@ bool seed_xor16_f52(uint16_t seed) {
 
 uint16_t xor16_f52() {
     __asm__ __volatile__(
-      "eor    r19, r19"      "\n\t"
+      "clr    r19"           "\n\t"
       "bst    %A0, 0"        "\n\t"
       "bld    r19, 7"        "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_f52_state)::"r18","r19");
+  return __xor16_f52_state;
+}
+
+void xor16_f52_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
       "lsr    r19"           "\n\t"
       "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
-      "lsr    r19"           "\n\t"
-      "ror    r18"           "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
       "movw   r18, %A0"      "\n\t"
@@ -42,6 +102,170 @@ uint16_t xor16_f52() {
       "adc    r19, r19"      "\n\t"
       "eor    %A0, r18"      "\n\t"
       "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_f52_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_f52_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x9405, 0x000A, 0x0014, 0x0028, 0x0050, 0x00A5, 0x014A, 0x0294,
+    0x0528, 0x0A50, 0x14A0, 0x2940, 0x5280, 0xA500, 0x4A00, 0x9400,
+    // M^2
+    0x4631, 0x0022, 0x0044, 0x008D, 0x011A, 0x9620, 0x0440, 0x0880,
+    0x1105, 0x220A, 0x4411, 0x8822, 0x1044, 0x2088, 0x6910, 0xD220,
+    // M^4
+    0xDE00, 0x9602, 0x0404, 0x4E78, 0x10B0, 0x325F, 0x4051, 0x80A2,
+    0x4734, 0x022D, 0x6A2A, 0xCC00, 0x1440, 0x2885, 0xD1A5, 0x1F5E,
+    // M^8
+    0x7EBC, 0xF51B, 0x6E2E, 0x5964, 0xB60D, 0x6C77, 0x5F44, 0x3BA1,
+    0xD87D, 0xA40E, 0xDD28, 0x68D1, 0x3E3B, 0xBE23, 0xF576, 0x7BEC,
+    // M^16
+    0xB208, 0x6F19, 0xF484, 0x26FC, 0xCB24, 0x9E1B, 0x33AD, 0xBDD0,
+    0x14B8, 0xDAB6, 0xE836, 0x8FD0, 0x9956, 0x0DD3, 0x15DC, 0x5E14,
+    // M^32
+    0x36DB, 0xEE37, 0x7E2F, 0x3669, 0x6089, 0x4ADB, 0x1930, 0xFC96,
+    0xBF73, 0xF48A, 0x0769, 0xB2A5, 0x3F3E, 0xEB16, 0xF2F9, 0x0E7A,
+    // M^64
+    0x4C61, 0xDA42, 0xBDE6, 0x7492, 0xE5CB, 0xDF7C, 0x18BA, 0x9160,
+    0xCFE9, 0x0B0A, 0x1FC9, 0xD061, 0xA63E, 0x1E58, 0x1367, 0xAA7A,
+    // M^128
+    0x5768, 0x06B0, 0x235F, 0x1A21, 0x1C0E, 0xFF11, 0x7358, 0x046B,
+    0xDC03, 0xBA52, 0x1C5C, 0x9484, 0x8960, 0xEB7F, 0x8EDE, 0xE394,
+    // M^256
+    0xEBDB, 0x417A, 0x8ADE, 0x0FCF, 0x3E76, 0xAABA, 0xFFE7, 0xDBEC,
+    0x3D2A, 0xC6BB, 0x5790, 0x519C, 0x275A, 0x8C01, 0x85ED, 0xDB5E,
+    // M^512
+    0xC7AC, 0x9D59, 0x926F, 0xF626, 0xCB63, 0xC1ED, 0xA6BB, 0xD844,
+    0x7472, 0x25D6, 0xEB2C, 0xFF16, 0xAF24, 0x3689, 0x519F, 0xD61E,
+    // M^1024
+    0x40E9, 0x4520, 0x0506, 0x1E0D, 0x1490, 0xEF04, 0x5074, 0xE367,
+    0x1272, 0x137D, 0xBA1E, 0x9FE7, 0xF68B, 0xBE99, 0xA752, 0xD42C,
+    // M^2048
+    0xA5A1, 0xE03A, 0xE84A, 0x9BED, 0xBB62, 0xEC17, 0xFF3F, 0x7357,
+    0x0B36, 0x0786, 0x5A1F, 0x5A89, 0x6AAC, 0x03A9, 0xD060, 0xCBE4,
+    // M^4096
+    0xA385, 0x348F, 0xC64C, 0x4108, 0x07CA, 0x0E08, 0x1FEE, 0x5C59,
+    0x093C, 0x2D88, 0x6A9D, 0xAAD8, 0x6221, 0xADBC, 0x6200, 0xC588,
+    // M^8192
+    0x7510, 0xE917, 0x7837, 0x2A34, 0x7819, 0xACC5, 0x78A4, 0x3ACD,
+    0x2D62, 0x7994, 0x37BE, 0xEA11, 0x4FB9, 0x7392, 0xE234, 0xD978,
+    // M^16384
+    0xBCDA, 0x1384, 0x04E2, 0x4CFC, 0x1333, 0x380B, 0xDA31, 0xCAD4,
+    0xBE29, 0x238F, 0x0A66, 0xD652, 0xDA58, 0x212A, 0x9DA1, 0x35CA,
+    // M^32768
+    0x4E22, 0x89C8, 0x310C, 0x3256, 0xC398, 0xCE82, 0x100C, 0x5A82,
+    0xF92E, 0x9118, 0x0081, 0x815C, 0x0210, 0xF870, 0xC38A, 0x00A0
+  };
+  __xor16_f52_state = __xor16_jump(__xor16_f52_state, table, n);
+  return __xor16_f52_state;
+}
+
+uint16_t xor16_f52_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r18, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "andi   r19, 0x0F"     "\n\t"
+      "eor    r18, r19"      "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
     :"+d"((uint16_t)__xor16_f52_state)::"r18","r19");
   return __xor16_f52_state;
 }
+
+static const uint16_t __xor16_f52_checkpoints[256] PROGMEM = {
+  0x0001, 0xEBDB, 0xC7AC, 0x06F5, 0x40E9, 0xEF48, 0xDF07, 0xA40B,
+  0xA5A1, 0xA768, 0xA1CC, 0xCB6F, 0x8E53, 0x70D9, 0xD0DF, 0x4C24,
+  0xA385, 0x1627, 0x3CB4, 0x68A9, 0xCD32, 0xB023, 0x701E, 0xD4AB,
+  0xFA41, 0x76F3, 0xA5FB, 0x284C, 0xA76B, 0x0B6D, 0x919A, 0x6A01,
+  0x7510, 0x7A7A, 0x9C0F, 0xD5B8, 0x53BC, 0x9317, 0x199C, 0x2B67,
+  0x532E, 0x37F7, 0x97E2, 0x9FCE, 0xE1F9, 0xBB4B, 0x8081, 0xEB69,
+  0xC9F6, 0x4966, 0x77A2, 0xB29B, 0xF64A, 0xD591, 0x1D12, 0x6370,
+  0x9956, 0x9A87, 0x90B0, 0xB324, 0xABF0, 0x4D95, 0x3A54, 0x7733,
+  0xBCDA, 0x22C1, 0x856A, 0xAA0C, 0x4569, 0x5E1E, 0x981D, 0xFD24,
+  0xEEAA, 0x2DE6, 0xF232, 0xE6E5, 0xAC2D, 0x9523, 0x96A5, 0x7D7C,
+  0xFBAA, 0x6006, 0xC248, 0x6820, 0xF2CA, 0x59ED, 0x2E7A, 0x6928,
+  0xC02F, 0xDBB9, 0x78D0, 0x6557, 0x82B8, 0x5D0A, 0xD724, 0xF58C,
+  0xC1AF, 0x3D7F, 0xD4E6, 0x6B6C, 0x73AD, 0xCABB, 0x23DA, 0x2358,
+  0xB9CE, 0xFCD3, 0x4338, 0xE57F, 0xFC93, 0xBCDF, 0x43C4, 0xD0A9,
+  0xECAB, 0x0086, 0x1048, 0xD772, 0xFFB9, 0xA341, 0xB8F2, 0xD024,
+  0x598D, 0x7B27, 0x0E7E, 0x6FF7, 0x64C9, 0x9E63, 0xC34F, 0x7575,
+  0x4E22, 0xAE9A, 0x3CC7, 0xA923, 0x3BF2, 0xF0EB, 0xDE37, 0x0DED,
+  0xDB5D, 0x7CBF, 0x482A, 0x307E, 0x041B, 0xCC88, 0x8C9C, 0xBDD9,
+  0xB54A, 0xABED, 0x1D29, 0x52D2, 0x3F0B, 0xF3A8, 0x70E0, 0xA007,
+  0x7720, 0x280D, 0xB357, 0x6A7A, 0xBB55, 0x7A9C, 0xD91A, 0x659C,
+  0x03DD, 0x8F26, 0x47DD, 0x5D5B, 0xFD6E, 0x5FF8, 0xE022, 0x3972,
+  0xEDBC, 0x23A5, 0x67C3, 0x2B47, 0xF994, 0xF61A, 0x1400, 0x70CA,
+  0x4408, 0xDDB2, 0x4C95, 0x077E, 0x0341, 0xEFAD, 0x30B3, 0x4EDA,
+  0x1192, 0xBE90, 0x5528, 0x6D78, 0x562E, 0x5D4D, 0x08BC, 0x9BAD,
+  0x4995, 0x6DC4, 0x9C1F, 0xEBCE, 0x98DF, 0x9855, 0x0D0C, 0xBE37,
+  0x0401, 0xBC4B, 0x2C80, 0x51E1, 0xFAF7, 0xF277, 0x7807, 0x5F55,
+  0xFFBE, 0x833E, 0x7068, 0x7424, 0x5942, 0x709C, 0x4E3D, 0xBF5C,
+  0xC918, 0x03BC, 0x31A0, 0xE727, 0xF476, 0x02F7, 0x5603, 0x993D,
+  0x6AB4, 0x5B35, 0xFD73, 0x0F44, 0x88A4, 0x714A, 0xA2CE, 0x7184,
+  0x42AE, 0xF66B, 0x94F0, 0x1B53, 0xE667, 0x36BB, 0xD03E, 0x294E,
+  0xDB3B, 0xE246, 0x204A, 0x3D53, 0xFB4D, 0xCEC8, 0xB5C0, 0x3EB4,
+  0xAE12, 0xE8E4, 0x8741, 0x6363, 0x0D81, 0x0B11, 0x7FA0, 0xA27D
+};
+static const uint8_t __xor16_f52_order[256] PROGMEM = {
+    0, 113, 221, 180, 217, 160, 200, 140,   3, 179, 190, 253,  29, 198, 252, 135,
+  122, 227, 114, 184, 174,  17,  38, 235,  54, 146, 242,  65, 103, 169, 102, 153,
+   27, 239, 171,  39, 202,  73,  86, 139, 182, 218, 237,  41, 167,  62, 132,  18,
+  130, 243,  97, 247, 148,   4, 232, 106, 110, 176,  68, 162, 138,  49, 192,  15,
+  178,  61, 128, 214, 183, 203, 147,  40,  36, 186, 222, 188, 212, 120,  85, 225,
+   93, 189, 163,  69, 207, 165,  81, 251,  55, 124,  91, 159, 170,  83,  19,  87,
+   31, 155, 224,  99, 187, 193, 123,  22, 210, 213, 175,  13, 150, 229, 231, 100,
+  211,  32, 127,  25, 152,  63,  50, 206,  90,  33, 157, 121, 137,  79, 254,  46,
+   92, 209,  66, 250, 228, 142,  12, 161,  58,  30,  37, 234,  77,  78,  42,  70,
+  197, 196, 223,  56,  57, 191,  34, 194, 125,  43, 151,  10, 255, 230, 117,  16,
+    7,   8,  26,   9,  28, 131,  67, 145,  60,  76, 248, 129,  21,  51,  59, 154,
+  144, 246, 118, 104,  45, 156, 201,  64, 109, 143, 199, 185, 215,  88,  96,  82,
+  126,   2, 216,  48, 101,  11, 141,  20, 245, 119, 238, 111,  14,  23,  98,  53,
+   35,  94, 115, 158, 240, 136,  89, 177, 134,   6, 166,  44, 241, 107, 236,  75,
+  219, 249,  47, 195,   1, 112, 168,  72,   5, 181, 133,  74, 205,  84, 149, 220,
+   95, 173,  52, 233, 172,  24, 204, 244,  80, 108, 105,  71, 164, 226, 116, 208
+};
+
+uint16_t xor16_f52_position() {
+  uint16_t saved = __xor16_f52_state;
+  uint16_t pos = __xor16_position(saved, xor16_f52, __xor16_f52_checkpoints, __xor16_f52_order);
+  __xor16_f52_state = saved;
+  return pos;
+}
+
+void xor16_f52_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_f52, xor16_f52, __xor16_f52_checkpoints);
+}
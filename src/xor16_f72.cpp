@@ -1,7 +1,8 @@
 // XOR 16 // full period generator: f72 //
 
+#define RNGBETTER_BUILDING_LIBRARY
 #include <rngBetter.h>
-static uint16_t __xor16_f72_state;
+uint16_t __xor16_f72_state;
 
 bool seed_xor16_f72(uint16_t seed) {
   if (__builtin_constant_p(seed)) {
@@ -40,3 +41,221 @@ uint16_t xor16_f72() {
     :"+d"((uint16_t)__xor16_f72_state)::"r18","r19");
   return __xor16_f72_state;
 }
+
+void xor16_f72_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "eor    r19, r19"      "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "adc    r18, r18"      "\n\t"
+      "sbc    r19, r19"      "\n\t"
+      "neg    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_f72_state), "+x"(dst), "+w"(n)::"r18","r19","memory");
+}
+
+uint16_t xor16_f72_jump(uint16_t n) {
+  static const uint16_t table[256] PROGMEM = {
+    // M^1
+    0x8505, 0x000A, 0x0014, 0x0028, 0x0050, 0x00A0, 0x0140, 0x0285,
+    0x050A, 0x0A14, 0x1428, 0x2850, 0x50A0, 0xA140, 0x4280, 0x8500,
+    // M^2
+    0x1133, 0x0022, 0x0044, 0x0088, 0x0110, 0x0225, 0x044A, 0x8D80,
+    0x1100, 0x2200, 0x4400, 0x8800, 0x1005, 0x200A, 0x4A11, 0x9422,
+    // M^4
+    0x1321, 0x0207, 0x040E, 0x8D08, 0x1010, 0x3152, 0x40E0, 0xC4A2,
+    0x0105, 0x020A, 0x0E11, 0x1C22, 0x0172, 0x20A0, 0xF032, 0xC220,
+    // M^8
+    0x200E, 0x1722, 0x8510, 0x5C1E, 0x1162, 0x7220, 0x4522, 0xCBF4,
+    0x162A, 0x8D05, 0x1308, 0x2014, 0x62A0, 0xD550, 0x3085, 0x014A,
+    // M^16
+    0x1B7C, 0x8F85, 0x150A, 0xBE77, 0x54AA, 0x7850, 0x50A5, 0xE270,
+    0xC5B1, 0x8162, 0xA591, 0x4122, 0xD104, 0x020D, 0xD91A, 0x1834,
+    // M^32
+    0x03D7, 0x5452, 0x80D6, 0x5340, 0x065D, 0x4F3E, 0x9C48, 0x3E1E,
+    0x74F8, 0x7AF5, 0xD7BF, 0xEB7E, 0xC091, 0x3163, 0xF1E1, 0xA9D6,
+    // M^64
+    0x7D55, 0x2888, 0xD959, 0xA335, 0xE71E, 0x0D8A, 0x9A8E, 0x365F,
+    0x6FD9, 0xF9AC, 0xB27A, 0xDEC8, 0x63A3, 0x01F9, 0x3382, 0x77BC,
+    // M^128
+    0x8B2F, 0x4A5B, 0x357C, 0xAEA8, 0xD432, 0xBE89, 0x57C0, 0x7BAD,
+    0x5D13, 0xD6CC, 0x17ED, 0xBD67, 0xCA06, 0xF7FC, 0xEAF8, 0xD370,
+    // M^256
+    0x01E1, 0x6D7D, 0xD1AB, 0x3346, 0xC483, 0xCCE6, 0x90A1, 0x3465,
+    0xC221, 0x8516, 0xD42B, 0x0452, 0x2D04, 0x4542, 0x4DA1, 0x452A,
+    // M^512
+    0xABE2, 0x6173, 0x40F7, 0x0306, 0x8459, 0x0C06, 0x914C, 0x3060,
+    0x409A, 0x2B75, 0x6298, 0xED74, 0x86B1, 0xA677, 0xA69B, 0xC976,
+    // M^1024
+    0x25C3, 0x93F4, 0x058E, 0x4A6B, 0x161F, 0xAE68, 0xDDE0, 0xBD8C,
+    0x70D7, 0xD2EA, 0x9CA6, 0x5F08, 0x9346, 0xB599, 0x5B42, 0xFA94,
+    // M^2048
+    0x8FB3, 0x167A, 0x8DEC, 0x5974, 0x32C7, 0x67AA, 0x4FED, 0x9D5B,
+    0xB857, 0xF7E1, 0x2FE2, 0xE3FC, 0x8075, 0xF401, 0x7B25, 0xA4F6,
+    // M^4096
+    0x76A1, 0x0DF8, 0xB13B, 0x3797, 0x4506, 0x5A8F, 0x16BA, 0xED5D,
+    0x5A71, 0xF15C, 0xD4CF, 0x3727, 0xBC29, 0x0BF6, 0xC6EE, 0x6358,
+    // M^8192
+    0x95D1, 0x6A60, 0xDDB1, 0xAA04, 0xF493, 0xAC14, 0x5101, 0xB468,
+    0xC32E, 0x9D08, 0xCB42, 0x58D0, 0x2CD6, 0xC4A7, 0xAA19, 0x021E,
+    // M^16384
+    0xA28F, 0x5673, 0xAD53, 0xDED0, 0x347E, 0x7C09, 0xD030, 0x763C,
+    0x47E0, 0xD470, 0x9590, 0xCFE5, 0xF11E, 0x5939, 0xC827, 0x744E,
+    // M^32768
+    0x0844, 0x1462, 0x2050, 0x5100, 0x8000, 0x462A, 0x0500, 0x1A14,
+    0x1422, 0x40A0, 0x1562, 0xA055, 0x4220, 0x8514, 0x562A, 0x0050
+  };
+  __xor16_f72_state = __xor16_jump(__xor16_f72_state, table, n);
+  return __xor16_f72_state;
+}
+
+uint16_t xor16_f72_prev() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "adc    r19, r19"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "swap   r18"           "\n\t"
+      "swap   r19"           "\n\t"
+      "andi   r19, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    r19, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "rol    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "clr    r18"           "\n\t"
+      "bst    %B0, 7"        "\n\t"
+      "bld    r18, 1"        "\n\t"
+      "bst    %B0, 6"        "\n\t"
+      "bld    r18, 0"        "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "clr    r19"           "\n\t"
+      "bst    %A0, 0"        "\n\t"
+      "bld    r19, 7"        "\n\t"
+      "eor    %B0, r19"      "\n\t"
+    :"+d"((uint16_t)__xor16_f72_state)::"r18","r19");
+  return __xor16_f72_state;
+}
+
+static const uint16_t __xor16_f72_checkpoints[256] PROGMEM = {
+  0x0001, 0x01E1, 0xABE2, 0x4652, 0x25C3, 0x9B10, 0xEFC8, 0x4D05,
+  0x8FB3, 0x82F8, 0x5FDB, 0xC876, 0x28CB, 0xBA0E, 0x23B8, 0x0D33,
+  0x76A1, 0x8DB8, 0x5834, 0xBD39, 0x05F6, 0x067D, 0x2AF5, 0xB8ED,
+  0xA210, 0x41FD, 0xC02D, 0x2761, 0x8BF8, 0x99A8, 0x6598, 0xDD49,
+  0x95D1, 0x1F82, 0xE352, 0x33A1, 0xD613, 0xDCAD, 0xEE79, 0xB2C5,
+  0xDCF4, 0x88FC, 0x0F34, 0x4E80, 0x2CAB, 0x3262, 0xDC6A, 0xF78A,
+  0x998F, 0x1449, 0x5B29, 0xDD81, 0x0253, 0xBDA8, 0xF4F1, 0x19A6,
+  0xAF22, 0x36BD, 0xE677, 0x3907, 0x1302, 0x074E, 0x8C2D, 0xBAB9,
+  0xA28F, 0x3F6A, 0xFD74, 0x3BFA, 0xD9B9, 0xED5B, 0x5469, 0xDA6E,
+  0x771C, 0x9095, 0x4882, 0x10EB, 0x1AFC, 0xE20C, 0x2A32, 0xA11E,
+  0x895A, 0x8940, 0x13F8, 0xF5D4, 0xC72B, 0x08AB, 0xA30B, 0x1885,
+  0xCD79, 0xB0B0, 0x116C, 0x518F, 0x1890, 0xD9B0, 0xDFFC, 0xFC8D,
+  0x67DD, 0x18B4, 0xC4FD, 0x930D, 0xCC15, 0xCC3B, 0x8F4D, 0xA1C9,
+  0x542A, 0x2653, 0x2CC1, 0x301E, 0x2355, 0x861D, 0x3398, 0xECD1,
+  0xFC16, 0xC8E1, 0x651A, 0x8451, 0xC4C2, 0x1519, 0xCD2A, 0x880E,
+  0xCEE8, 0x0680, 0x6558, 0x798D, 0x34FD, 0xF3C0, 0x833E, 0x85E8,
+  0x0844, 0x4558, 0x3CCF, 0x928A, 0x8766, 0x36A7, 0x7CCF, 0xDF2B,
+  0x21FD, 0xC8CE, 0x278D, 0x0137, 0x7773, 0x42A3, 0x5CA8, 0x7B19,
+  0x90A6, 0x2C7B, 0x5225, 0xF91F, 0xEC4C, 0xEFFC, 0x94CB, 0x471B,
+  0x45E4, 0xE222, 0x6944, 0x8F9A, 0x7CB9, 0xFB39, 0x196A, 0xE90B,
+  0xD460, 0xADE3, 0x168E, 0xC7CC, 0xDDBE, 0x8447, 0xBC97, 0xB0C4,
+  0x5803, 0x086B, 0x07CF, 0xB9A9, 0x213B, 0xD0DC, 0xA725, 0x8FD8,
+  0x8165, 0x0B06, 0xFFB3, 0xA71F, 0xD986, 0x6B4F, 0x5556, 0x9E5B,
+  0x36B9, 0x37DC, 0x79F0, 0x4F35, 0x02C0, 0x21D2, 0x8A59, 0xA2EB,
+  0xB286, 0x20C9, 0xD321, 0xAFBF, 0x2557, 0xBA5D, 0x1B06, 0xD2B7,
+  0x21AE, 0xF070, 0xF809, 0x5638, 0x0ABB, 0xE29E, 0xB7A9, 0x7454,
+  0x7445, 0xB127, 0x9E9C, 0x2F4A, 0x1C96, 0xB14D, 0x9CE0, 0xD075,
+  0x6D01, 0x1B5A, 0x6478, 0x774A, 0x7861, 0x7C13, 0x5D81, 0x4779,
+  0x74DE, 0x1E1B, 0xE332, 0x6FE6, 0x4B59, 0x6841, 0x9DF1, 0xD736,
+  0x0220, 0x49F0, 0x2773, 0x2206, 0x7C82, 0xAC86, 0x58A2, 0xF109,
+  0x904B, 0xA755, 0x171C, 0x9876, 0x486E, 0x9A24, 0xF427, 0xC537,
+  0xABD3, 0x4FD6, 0x067E, 0x4669, 0x727C, 0xDAD8, 0xF7CA, 0x092E
+};
+static const uint8_t __xor16_f72_order[256] PROGMEM = {
+    0, 139,   1, 232,  52, 188,  20,  21, 250, 121,  61, 170, 128, 169,  85, 255,
+  204, 177,  15,  42,  75,  90,  60,  82,  49, 117, 162, 242,  87,  92,  97, 158,
+   55,  76, 198, 217, 212, 225,  33, 193, 172, 200, 189, 136, 235, 108,  14, 196,
+    4, 105,  27, 234, 138,  12,  78,  22, 145,  44, 106, 211, 107,  45, 110,  35,
+  124, 133, 184,  57, 185,  59,  67, 130,  65,  25, 141, 129, 152,   3, 251, 151,
+  223, 244,  74, 233, 228,   7,  43, 187, 249,  91, 146, 104,  70, 182, 203, 168,
+   18, 238,  50, 142, 222,  10, 218, 114, 122,  30,  96, 229, 154, 181, 216, 227,
+  252, 208, 207, 224,  16,  72, 219, 140, 220, 123, 186, 143, 221, 236, 156, 134,
+  176,   9, 126, 165, 115, 127, 109, 132, 119,  41,  81,  80, 190,  28,  62,  17,
+  102, 155,   8, 175, 240,  73, 144, 131,  99, 150,  32, 243,  48,  29, 245,   5,
+  214, 230, 183, 210,  79, 103,  24,  64, 191,  86, 179, 174, 241, 248,   2, 237,
+  161,  56, 195,  89, 167, 209, 213, 192,  39, 206,  23, 171,  13, 197,  63, 166,
+   19,  53,  26, 116,  98, 247,  84, 163,  11, 137, 113, 100, 101, 118,  88, 120,
+  215, 173, 199, 194, 160,  36, 231, 180,  93,  68,  71, 253,  46,  37,  40,  31,
+   51, 164, 135,  94,  77, 153, 205, 226,  34,  58, 159, 148, 111,  69,  38,   6,
+  149, 201, 239, 125, 246,  54,  83,  47, 254, 202, 147, 157, 112,  95,  66, 178
+};
+
+uint16_t xor16_f72_position() {
+  uint16_t saved = __xor16_f72_state;
+  uint16_t pos = __xor16_position(saved, xor16_f72, __xor16_f72_checkpoints, __xor16_f72_order);
+  __xor16_f72_state = saved;
+  return pos;
+}
+
+void xor16_f72_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16_f72, xor16_f72, __xor16_f72_checkpoints);
+}
@@ -0,0 +1,50 @@
+// Jump ahead for xorshift16 generators //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+/* Each step is a 16x16 matrix M over GF(2); table holds M^1, M^2, M^4 ... M^32768, 16 words
+ * each, where word i is what a state with only bit i set becomes. For each set bit k of n we
+ * apply M^(2^k): the new state is the xor of the words for the bits set in the old one. That's
+ * 16 rounds of about 14 clocks per set bit of n, plus 6 clocks per clear one. */
+uint16_t __xor16_jump(uint16_t state, const uint16_t *table, uint16_t n) {
+  if (!n) {
+    return state;
+  }
+  uint16_t bits;
+  uint8_t count;
+  uint8_t hi;
+  __asm__ __volatile__(
+    "1:"                             "\n\t"
+      "lsr    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // next bit of n into carry
+      "brcs   2f"            "\n\t"
+      "adiw   %1, 32"        "\n\t" // clear: skip this matrix
+      "rjmp   4f"            "\n\t"
+    "2:"                             "\n\t"
+      "movw   %A3, %A0"      "\n\t" // set: shift the old state out a bit at a time,
+      "clr    %A0"           "\n\t" // building the new one from the words for the 1's
+      "clr    %B0"           "\n\t"
+      "ldi    %4, 16"        "\n\t"
+    "3:"                             "\n\t"
+      "lpm    r0, Z+"        "\n\t"
+      "lpm    %5, Z+"        "\n\t"
+      "lsr    %B3"           "\n\t"
+      "ror    %A3"           "\n\t"
+      "brcc   5f"            "\n\t"
+      "eor    %A0, r0"       "\n\t"
+      "eor    %B0, %5"       "\n\t"
+    "5:"                             "\n\t"
+      "dec    %4"            "\n\t"
+      "brne   3b"            "\n\t"
+    "4:"                             "\n\t"
+      "mov    r0, %A2"       "\n\t" // stop as soon as there are no more bits in n
+      "or     r0, %B2"       "\n\t"
+      "brne   1b"            "\n\t"
+    :"+r"(state), "+z"(table), "+r"(n), "=&r"(bits), "=&d"(count), "=&r"(hi));
+  return state;
+}
+
+uint16_t xor16_jump(uint16_t n) {
+  __state = __xor16_jump(__state, __xor16_3d9_jump_table, n);
+  return __state;
+}
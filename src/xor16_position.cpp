@@ -0,0 +1,64 @@
+// Position of xorshift16 generators in their cycle //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+/* Positions count steps from a state of 1, so they run from 0 to 65534. The checkpoint table
+ * holds the state at every 256th position and order[] lists the checkpoints sorted by state.
+ * To find the position of a state we step forward until we land on a checkpoint - at most 255
+ * steps - and look each state up with a binary search of the checkpoints. */
+static int16_t __xor16_find_checkpoint(uint16_t s, const uint16_t *checkpoints, const uint8_t *order) {
+  uint16_t lo = 0, hi = 256;
+  while (lo < hi) {
+    uint8_t mid = (lo + hi) >> 1;
+    if (pgm_read_word(&checkpoints[pgm_read_byte(&order[mid])]) < s) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < 256) {
+    uint8_t k = pgm_read_byte(&order[lo]);
+    if (pgm_read_word(&checkpoints[k]) == s) {
+      return k;
+    }
+  }
+  return -1;
+}
+
+/* gen is called up to 255 times; the caller puts its state back afterwards */
+uint16_t __xor16_position(uint16_t state, uint16_t (*gen)(), const uint16_t *checkpoints, const uint8_t *order) {
+  if (!state) {
+    return 0xFFFF;
+  }
+  for (uint16_t ahead = 0; ahead < 256; ahead++) {
+    int16_t k = __xor16_find_checkpoint(state, checkpoints, order);
+    if (k >= 0) {
+      uint16_t cp = (uint16_t) k << 8;
+      return cp >= ahead ? cp - ahead : cp + (65535 - ahead);
+    }
+    state = gen();
+  }
+  return 0xFFFF; // can't happen with a matching table
+}
+
+void __xor16_set_position(uint16_t pos, bool (*seed)(uint16_t), uint16_t (*gen)(), const uint16_t *checkpoints) {
+  if (pos >= 65535) {
+    pos -= 65535;
+  }
+  seed(pgm_read_word(&checkpoints[pos >> 8]));
+  for (uint8_t i = pos & 0xFF; i; i--) {
+    gen();
+  }
+}
+
+/* xor16() is 3d9, so it uses xor16_3d9_position()'s tables */
+uint16_t xor16_position() {
+  uint16_t saved = __state;
+  uint16_t pos = __xor16_position(saved, xor16, __xor16_3d9_checkpoints, __xor16_3d9_order);
+  __state = saved;
+  return pos;
+}
+
+void xor16_set_position(uint16_t pos) {
+  __xor16_set_position(pos, seed_xor16, xor16, __xor16_3d9_checkpoints);
+}
@@ -0,0 +1,25 @@
+// Bitsliced layout for xorshift16 generators //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+/* planes[i] bit j is bit i of states[j]. Only used when setting up or reading back the streams,
+ * so this is plain C: 128 bits, one at a time. */
+void xor16_sliced_load(uint8_t *planes, const uint16_t *states) {
+  for (uint8_t i = 0; i < 16; i++) {
+    uint8_t plane = 0;
+    for (uint8_t j = 8; j--;) {
+      plane = (plane << 1) | ((states[j] >> i) & 1);
+    }
+    planes[i] = plane;
+  }
+}
+
+void xor16_sliced_store(const uint8_t *planes, uint16_t *states) {
+  for (uint8_t j = 0; j < 8; j++) {
+    uint16_t state = 0;
+    for (uint8_t i = 16; i--;) {
+      state = (state << 1) | ((planes[i] >> j) & 1);
+    }
+    states[j] = state;
+  }
+}
@@ -0,0 +1,100 @@
+// Shared shift/xor core for any xorshift16 generator //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+/* One step of the generator with shifts a, b and c, given as 0xabc - the same hex digits as in
+ * the function names. Each of the three shifts is a subroutine: a shift of 8 or more starts with a
+ * byte move, and the rest (0 to 7 bits) is a computed jump into an unrolled ladder of shifts. So
+ * the code is the same size whichever generator it runs, at the cost of about 20 clocks per shift
+ * on top of the ladder. This is what the RNGBETTER_SIZE build uses for every xor16_xxx(). */
+uint16_t xor16_step_abc(uint16_t s, uint16_t abc) {
+  if (__builtin_constant_p(abc)) {
+    if (!rng16::isFullPeriod(abc >> 8, (abc >> 4) & 0x0F, abc & 0x0F)) {
+      badArg("xor16_step_abc: abc must be one of the 60 full period triplets, as 0xabc");
+    }
+  }
+  __asm__ __volatile__(
+      "mov    r20, %B1"      "\n\t" // a
+      "rcall  4f"            "\n\t" // s ^= s << a
+      "mov    r20, %A1"      "\n\t"
+      "swap   r20"           "\n\t"
+      "andi   r20, 0x0F"     "\n\t" // b
+      "rcall  6f"            "\n\t" // s ^= s >> b
+      "mov    r20, %A1"      "\n\t"
+      "andi   r20, 0x0F"     "\n\t" // c
+      "rcall  4f"            "\n\t" // s ^= s << c
+      "rjmp   9f"            "\n\t"
+    "4:"                             "\n\t" // s ^= s << r20
+      "movw   r18, %A0"      "\n\t"
+      "cpi    r20, 8"        "\n\t"
+      "brlo   1f"            "\n\t"
+      "mov    r19, r18"      "\n\t"
+      "clr    r18"           "\n\t"
+      "subi   r20, 8"        "\n\t"
+    "1:"                             "\n\t"
+      "lsl    r20"           "\n\t" // back 2 words per bit
+      "ldi    r30, pm_lo8(5f)" "\n\t"
+      "ldi    r31, pm_hi8(5f)" "\n\t"
+      "sub    r30, r20"      "\n\t"
+      "sbc    r31, __zero_reg__" "\n\t"
+      "ijmp"                 "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+    "5:"                             "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "ret"                  "\n\t"
+    "6:"                             "\n\t" // s ^= s >> r20
+      "movw   r18, %A0"      "\n\t"
+      "cpi    r20, 8"        "\n\t"
+      "brlo   1f"            "\n\t"
+      "mov    r18, r19"      "\n\t"
+      "clr    r19"           "\n\t"
+      "subi   r20, 8"        "\n\t"
+    "1:"                             "\n\t"
+      "lsl    r20"           "\n\t"
+      "ldi    r30, pm_lo8(7f)" "\n\t"
+      "ldi    r31, pm_hi8(7f)" "\n\t"
+      "sub    r30, r20"      "\n\t"
+      "sbc    r31, __zero_reg__" "\n\t"
+      "ijmp"                 "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+      "lsr    r19"           "\n\t"
+      "ror    r18"           "\n\t"
+    "7:"                             "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r19"      "\n\t"
+      "ret"                  "\n\t"
+    "9:"                             "\n\t"
+    :"+r"(s):"r"(abc):"r18","r19","r20","r30","r31");
+  return s;
+}
+
+/* The RNGBETTER_SIZE build's xor16_xxx(): each one is just a call to this with the address of its
+ * state and its shifts, so a generator costs nothing but its state and the call site. */
+uint16_t __xor16_step_at(uint16_t *state, uint16_t abc) {
+  return *state = xor16_step_abc(*state, abc);
+}
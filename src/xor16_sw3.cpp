@@ -0,0 +1,72 @@
+// XOR 16 // full period generator: sw3 - H ^= H >> 1; H ^= L; L ^= H; swap H; L ^= H << 1 //
+// H and L are the high and low bytes of the state. swap exchanges the nybbles of a byte.
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+static uint16_t __xor16_sw3_state;
+
+bool seed_xor16_sw3(uint16_t seed) {
+  if (__builtin_constant_p(seed)) {
+    if(seed == 0) {
+      badArg("rng's must be seeded with a non-zero value, but the argument passed is always zero");
+    }
+  }
+  if(seed) {
+    __xor16_sw3_state = seed;
+    return 1;
+  }
+  return 0;
+}
+
+uint16_t xor16_sw3() {
+    __asm__ __volatile__(
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %B0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "swap   %B0"           "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+    :"+d"((uint16_t)__xor16_sw3_state)::"r18");
+  return __xor16_sw3_state;
+}
+
+void xor16_sw3_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %B0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "swap   %B0"           "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "lsr    r18"           "\n\t"
+      "eor    %B0, r18"      "\n\t"
+      "eor    %B0, %A0"      "\n\t"
+      "eor    %A0, %B0"      "\n\t"
+      "swap   %B0"           "\n\t"
+      "mov    r18, %B0"      "\n\t"
+      "add    r18, r18"      "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+d"((uint16_t)__xor16_sw3_state), "+x"(dst), "+w"(n)::"r18","memory");
+}
@@ -0,0 +1,111 @@
+// XOR 32 // full period generator: 9, 21, 16 //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+static uint32_t __xor32_9_21_16_state;
+
+bool seed_xor32_9_21_16(uint32_t seed) {
+  if (__builtin_constant_p(seed)) {
+    if(seed == 0) {
+      badArg("rng's must be seeded with a non-zero value, but the argument passed is always zero");
+    }
+  }
+  if(seed) {
+    __xor32_9_21_16_state = seed;
+    return 1;
+  }
+  return 0;
+}
+
+uint32_t xor32_9_21_16() {
+    __asm__ __volatile__(
+      "movw   r18, %A0"      "\n\t"
+      "mov    r20, %C0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "rol    r20"           "\n\t"
+      "eor    %B0, r18"      "\n\t"
+      "eor    %C0, r19"      "\n\t"
+      "eor    %D0, r20"      "\n\t"
+      "movw   r20, %C0"      "\n\t"
+      "swap   r20"           "\n\t"
+      "andi   r20, 0x0F"     "\n\t"
+      "swap   r21"           "\n\t"
+      "eor    r20, r21"      "\n\t"
+      "andi   r21, 0x0F"     "\n\t"
+      "eor    r20, r21"      "\n\t"
+      "lsr    r21"           "\n\t"
+      "ror    r20"           "\n\t"
+      "eor    %A0, r20"      "\n\t"
+      "eor    %B0, r21"      "\n\t"
+      "eor    %D0, %B0"      "\n\t"
+      "eor    %C0, %A0"      "\n\t"
+    :"+r"(__xor32_9_21_16_state)::"r18","r19","r20","r21");
+  return __xor32_9_21_16_state;
+}
+
+void xor32_9_21_16_fill(uint32_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  __asm__ __volatile__(
+      "adiw   %2, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B2"           "\n\t"
+      "ror    %A2"           "\n\t" // %2 = number of passes, carry set if n is even
+      "brcc   2f"            "\n\t" // odd n: enter at the second copy
+    "1:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "mov    r20, %C0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "rol    r20"           "\n\t"
+      "eor    %B0, r18"      "\n\t"
+      "eor    %C0, r19"      "\n\t"
+      "eor    %D0, r20"      "\n\t"
+      "movw   r20, %C0"      "\n\t"
+      "swap   r20"           "\n\t"
+      "andi   r20, 0x0F"     "\n\t"
+      "swap   r21"           "\n\t"
+      "eor    r20, r21"      "\n\t"
+      "andi   r21, 0x0F"     "\n\t"
+      "eor    r20, r21"      "\n\t"
+      "lsr    r21"           "\n\t"
+      "ror    r20"           "\n\t"
+      "eor    %A0, r20"      "\n\t"
+      "eor    %B0, r21"      "\n\t"
+      "eor    %D0, %B0"      "\n\t"
+      "eor    %C0, %A0"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "st     X+, %C0"       "\n\t"
+      "st     X+, %D0"       "\n\t"
+    "2:"                             "\n\t"
+      "movw   r18, %A0"      "\n\t"
+      "mov    r20, %C0"      "\n\t"
+      "lsl    r18"           "\n\t"
+      "rol    r19"           "\n\t"
+      "rol    r20"           "\n\t"
+      "eor    %B0, r18"      "\n\t"
+      "eor    %C0, r19"      "\n\t"
+      "eor    %D0, r20"      "\n\t"
+      "movw   r20, %C0"      "\n\t"
+      "swap   r20"           "\n\t"
+      "andi   r20, 0x0F"     "\n\t"
+      "swap   r21"           "\n\t"
+      "eor    r20, r21"      "\n\t"
+      "andi   r21, 0x0F"     "\n\t"
+      "eor    r20, r21"      "\n\t"
+      "lsr    r21"           "\n\t"
+      "ror    r20"           "\n\t"
+      "eor    %A0, r20"      "\n\t"
+      "eor    %B0, r21"      "\n\t"
+      "eor    %D0, %B0"      "\n\t"
+      "eor    %C0, %A0"      "\n\t"
+      "st     X+, %A0"       "\n\t"
+      "st     X+, %B0"       "\n\t"
+      "st     X+, %C0"       "\n\t"
+      "st     X+, %D0"       "\n\t"
+      "sbiw   %2, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+r"(__xor32_9_21_16_state), "+x"(dst), "+w"(n)::"r18","r19","r20","r21","memory");
+}
@@ -0,0 +1,213 @@
+// XOROSHIRO 32++ // 13, 5, 10, 9 - two 16-bit words of state, 16-bit output, period 2^32 - 1 //
+
+#define RNGBETTER_BUILDING_LIBRARY
+#include <rngBetter.h>
+static uint16_t __xoroshiro32pp_s0;
+static uint16_t __xoroshiro32pp_s1;
+
+bool seed_xoroshiro32pp(uint32_t seed) {
+  if (__builtin_constant_p(seed)) {
+    if(seed == 0) {
+      badArg("rng's must be seeded with a non-zero value, but the argument passed is always zero");
+    }
+  }
+  if(seed) {
+    __xoroshiro32pp_s0 = seed;
+    __xoroshiro32pp_s1 = seed >> 16;
+    return 1;
+  }
+  return 0;
+}
+
+/* out = rotl(s0 + s1, 9) + s0; s1 ^= s0; s0 = rotl(s0, 13) ^ s1 ^ (s1 << 5); s1 = rotl(s1, 10)
+ * A rotate by 8 is just a matter of which register is which, so rotl 9 and rotl 10 are one and
+ * two 1-bit rotates, and rotl 13 is a nybble swap and one 1-bit rotate. */
+uint16_t xoroshiro32pp() {
+  uint16_t ret;
+  __asm__ __volatile__(
+      "mov    %B2, %A0"      "\n\t"
+      "add    %B2, %A1"      "\n\t"
+      "mov    %A2, %B0"      "\n\t"
+      "adc    %A2, %B1"      "\n\t" // rotl(s0 + s1, 8)
+      "lsl    %A2"           "\n\t"
+      "rol    %B2"           "\n\t"
+      "adc    %A2, __zero_reg__" "\n\t" // ... 9
+      "add    %A2, %A0"      "\n\t"
+      "adc    %B2, %B0"      "\n\t" // + s0 is the output
+      "eor    %A1, %A0"      "\n\t"
+      "eor    %B1, %B0"      "\n\t" // s1 ^= s0
+      "swap   %A0"           "\n\t"
+      "swap   %B0"           "\n\t"
+      "mov    r18, %A0"      "\n\t"
+      "eor    r18, %B0"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r18"      "\n\t" // s0 = rotl(s0, 12)
+      "lsl    %A0"           "\n\t"
+      "rol    %B0"           "\n\t"
+      "adc    %A0, __zero_reg__" "\n\t" // ... 13
+      "eor    %A0, %A1"      "\n\t"
+      "eor    %B0, %B1"      "\n\t" // ^ s1
+      "movw   r20, %A1"      "\n\t"
+      "swap   r21"           "\n\t"
+      "andi   r21, 0xF0"     "\n\t"
+      "swap   r20"           "\n\t"
+      "eor    r21, r20"      "\n\t"
+      "andi   r20, 0xF0"     "\n\t"
+      "eor    r21, r20"      "\n\t" // s1 << 4
+      "lsl    r20"           "\n\t"
+      "rol    r21"           "\n\t"
+      "eor    %A0, r20"      "\n\t"
+      "eor    %B0, r21"      "\n\t" // ^ (s1 << 5)
+      "lsl    %A1"           "\n\t"
+      "rol    %B1"           "\n\t"
+      "adc    %A1, __zero_reg__" "\n\t"
+      "lsl    %A1"           "\n\t"
+      "rol    %B1"           "\n\t"
+      "adc    %A1, __zero_reg__" "\n\t" // s1 = rotl(s1, 2) ...
+      "movw   r20, %A1"      "\n\t"
+      "mov    %A1, r21"      "\n\t"
+      "mov    %B1, r20"      "\n\t" // ... 10
+    :"+r"(__xoroshiro32pp_s0), "+r"(__xoroshiro32pp_s1), "=&r"(ret)::"r18","r20","r21");
+  return ret;
+}
+
+/* Unrolled twice: the first copy leaves s1 with its bytes swapped, and the second copy works on
+ * it that way, so the rotate by 8 costs nothing. */
+void xoroshiro32pp_fill(uint16_t *dst, uint16_t n) {
+  if (!n) {
+    return;
+  }
+  uint16_t out;
+  __asm__ __volatile__(
+      "adiw   %4, 1"         "\n\t" // n + 1 can carry out of bit 15, so shift that carry back in
+      "ror    %B4"           "\n\t"
+      "ror    %A4"           "\n\t" // %4 = number of passes, carry set if n is even
+      "brcs   1f"            "\n\t"
+      "movw   r20, %A1"      "\n\t" // odd n: the second copy expects s1 with its bytes swapped
+      "mov    %A1, r21"      "\n\t"
+      "mov    %B1, r20"      "\n\t"
+      "rjmp   2f"            "\n\t"
+    "1:"                             "\n\t"
+      "mov    %B2, %A0"      "\n\t"
+      "add    %B2, %A1"      "\n\t"
+      "mov    %A2, %B0"      "\n\t"
+      "adc    %A2, %B1"      "\n\t"
+      "lsl    %A2"           "\n\t"
+      "rol    %B2"           "\n\t"
+      "adc    %A2, __zero_reg__" "\n\t"
+      "add    %A2, %A0"      "\n\t"
+      "adc    %B2, %B0"      "\n\t"
+      "eor    %A1, %A0"      "\n\t"
+      "eor    %B1, %B0"      "\n\t"
+      "swap   %A0"           "\n\t"
+      "swap   %B0"           "\n\t"
+      "mov    r18, %A0"      "\n\t"
+      "eor    r18, %B0"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r18"      "\n\t"
+      "lsl    %A0"           "\n\t"
+      "rol    %B0"           "\n\t"
+      "adc    %A0, __zero_reg__" "\n\t"
+      "eor    %A0, %A1"      "\n\t"
+      "eor    %B0, %B1"      "\n\t"
+      "movw   r20, %A1"      "\n\t"
+      "swap   r21"           "\n\t"
+      "andi   r21, 0xF0"     "\n\t"
+      "swap   r20"           "\n\t"
+      "eor    r21, r20"      "\n\t"
+      "andi   r20, 0xF0"     "\n\t"
+      "eor    r21, r20"      "\n\t"
+      "lsl    r20"           "\n\t"
+      "rol    r21"           "\n\t"
+      "eor    %A0, r20"      "\n\t"
+      "eor    %B0, r21"      "\n\t"
+      "lsl    %A1"           "\n\t"
+      "rol    %B1"           "\n\t"
+      "adc    %A1, __zero_reg__" "\n\t"
+      "lsl    %A1"           "\n\t"
+      "rol    %B1"           "\n\t"
+      "adc    %A1, __zero_reg__" "\n\t"
+      "st     X+, %A2"       "\n\t"
+      "st     X+, %B2"       "\n\t"
+    "2:"                             "\n\t"
+      "mov    %B2, %A0"      "\n\t"
+      "add    %B2, %B1"      "\n\t"
+      "mov    %A2, %B0"      "\n\t"
+      "adc    %A2, %A1"      "\n\t"
+      "lsl    %A2"           "\n\t"
+      "rol    %B2"           "\n\t"
+      "adc    %A2, __zero_reg__" "\n\t"
+      "add    %A2, %A0"      "\n\t"
+      "adc    %B2, %B0"      "\n\t"
+      "eor    %B1, %A0"      "\n\t"
+      "eor    %A1, %B0"      "\n\t"
+      "swap   %A0"           "\n\t"
+      "swap   %B0"           "\n\t"
+      "mov    r18, %A0"      "\n\t"
+      "eor    r18, %B0"      "\n\t"
+      "andi   r18, 0xF0"     "\n\t"
+      "eor    %A0, r18"      "\n\t"
+      "eor    %B0, r18"      "\n\t"
+      "lsl    %A0"           "\n\t"
+      "rol    %B0"           "\n\t"
+      "adc    %A0, __zero_reg__" "\n\t"
+      "eor    %A0, %B1"      "\n\t"
+      "eor    %B0, %A1"      "\n\t"
+      "movw   r20, %A1"      "\n\t"
+      "swap   r20"           "\n\t"
+      "andi   r20, 0xF0"     "\n\t"
+      "swap   r21"           "\n\t"
+      "eor    r20, r21"      "\n\t"
+      "andi   r21, 0xF0"     "\n\t"
+      "eor    r20, r21"      "\n\t"
+      "lsl    r21"           "\n\t"
+      "rol    r20"           "\n\t"
+      "eor    %A0, r21"      "\n\t"
+      "eor    %B0, r20"      "\n\t"
+      "lsl    %B1"           "\n\t"
+      "rol    %A1"           "\n\t"
+      "adc    %B1, __zero_reg__" "\n\t"
+      "lsl    %B1"           "\n\t"
+      "rol    %A1"           "\n\t"
+      "adc    %B1, __zero_reg__" "\n\t"
+      "st     X+, %A2"       "\n\t"
+      "st     X+, %B2"       "\n\t"
+      "sbiw   %4, 1"         "\n\t"
+      "brne   1b"            "\n\t"
+    :"+r"(__xoroshiro32pp_s0), "+r"(__xoroshiro32pp_s1), "=&r"(out), "+x"(dst), "+w"(n)::"r18","r20","r21","memory");
+}
+
+/* Jumps ahead n * 65536 steps, so n = 0 to 65535 give non-overlapping streams of 65536 values.
+ * Each step is a linear map on the 32 state bits, so 2^k steps is the same as some polynomial in
+ * that map: the xor of the states after each of the steps 0 - 31 whose bit is set in the table
+ * entry. The entries are for 2^16 to 2^31 steps, and come from extras/host/rngTables.py xoroshiro.
+ * About 2500 clocks for each 1 bit in n. */
+void xoroshiro32pp_jump(uint16_t n) {
+  static const uint32_t table[16] PROGMEM = {
+    0x700FDAE3, 0x5FC6F895, 0x96A80433, 0x99F9D658,
+    0xC8BD0E1B, 0xBBEB5E4C, 0x609CB5C9, 0xF0C3164E,
+    0xB30C47BB, 0x93F9441E, 0x8341CFD7, 0x0CF4F0AE,
+    0xF77A58FC, 0x1FED63DD, 0x39B094FF, 0xAACCEBF9
+  };
+  const uint32_t *p = table;
+  while (n) {
+    if (n & 1) {
+      uint32_t poly = pgm_read_dword(p);
+      uint16_t s0 = 0, s1 = 0;
+      for (uint8_t i = 0; i < 32; i++) {
+        if (poly & 1) {
+          s0 ^= __xoroshiro32pp_s0;
+          s1 ^= __xoroshiro32pp_s1;
+        }
+        poly >>= 1;
+        xoroshiro32pp();
+      }
+      __xoroshiro32pp_s0 = s0;
+      __xoroshiro32pp_s1 = s1;
+    }
+    n >>= 1;
+    p++;
+  }
+}